@@ -122,9 +122,10 @@ set(DNNL_ENABLE_PRIMITIVE "ALL" CACHE STRING
     - ALL (the default). Includes all primitives to be enabled.
     - <PRIMITIVE_NAME>. Includes only the selected primitive to be enabled.
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
-      DECONVOLUTION, ELTWISE, GROUP_NORMALIZATION, INNER_PRODUCT,
-      LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU, REDUCTION, REORDER,
-      RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM.
+      DECONVOLUTION, ELTWISE, EMBEDDING, GROUP_NORMALIZATION, GROUPED_MATMUL,
+      INNER_PRODUCT, LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU,
+      REDUCTION, REORDER, RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX,
+      SOFTMAX_CROSS_ENTROPY, SUM, TOPK.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
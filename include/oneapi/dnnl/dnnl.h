@@ -233,6 +233,16 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
 dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
         const_dnnl_primitive_t primitive, size_t *size, uint8_t *cache_blob);
 
+/// Retrieves the identifier of a primitive reported in the records of the
+/// execution telemetry. The identifiers are unique within the process.
+///
+/// @param primitive Primitive to query for the identifier.
+/// @param id Output identifier.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_get_telemetry_id(
+        const_dnnl_primitive_t primitive, uint64_t *id);
+
 /// Destroys a primitive.
 ///
 /// @param primitive The primitive to destroy.
@@ -240,6 +250,105 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Creates a bound primitive: a primitive bound to a stream and to a fixed
+/// set of memory arguments that can be executed many times with a minimal
+/// overhead. The arguments are validated and the execution context and the
+/// scratchpad are prepared once at creation instead of at every execution.
+///
+/// @note
+///     The bound memory objects must remain alive as long as the bound
+///     primitive is used. Their data handles can be changed between
+///     executions with dnnl_bound_primitive_set_data_handle() or
+///     dnnl_memory_set_data_handle().
+///
+/// @note
+///     Only CPU engines with non-SYCL runtimes are supported.
+///
+/// @param bound_primitive Output bound primitive.
+/// @param primitive Primitive to bind. The bound primitive keeps a reference
+///     to it.
+/// @param stream Stream to execute the primitive on.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments as for dnnl_primitive_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_bound_primitive_create(
+        dnnl_bound_primitive_t *bound_primitive, dnnl_primitive_t primitive,
+        dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
+
+/// Sets the data handle of a memory argument of a bound primitive.
+///
+/// @param bound_primitive Bound primitive.
+/// @param arg Argument index, one of the `DNNL_ARG_*` values passed at the
+///     creation of the bound primitive.
+/// @param handle New data handle of the bound memory object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_bound_primitive_set_data_handle(
+        const_dnnl_bound_primitive_t bound_primitive, int arg, void *handle);
+
+/// Executes a bound primitive.
+///
+/// @param bound_primitive Bound primitive to execute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_bound_primitive_execute(
+        const_dnnl_bound_primitive_t bound_primitive);
+
+/// Destroys a bound primitive.
+///
+/// @param bound_primitive The bound primitive to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_bound_primitive_destroy(
+        dnnl_bound_primitive_t bound_primitive);
+
+/// Starts recording primitive executions submitted to a stream. Until
+/// dnnl_stream_end_capture() is called, dnnl_primitive_execute() on the
+/// stream validates and records the primitive with its arguments instead of
+/// executing it.
+///
+/// @note
+///     The recorded primitives and memory objects must remain alive as long
+///     as the capture is used. Data handles of the memory objects can be
+///     changed between replays.
+///
+/// @note
+///     Only CPU engines with non-SYCL runtimes are supported.
+///
+/// @param stream Stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Stops recording primitive executions submitted to a stream and returns
+/// the recorded sequence. The primitives in the sequence share a single
+/// scratchpad sized for the largest of them.
+///
+/// @param stream Stream.
+/// @param stream_capture Output stream capture.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(
+        dnnl_stream_t stream, dnnl_stream_capture_t *stream_capture);
+
+/// Executes a recorded sequence of primitives on the stream it was recorded
+/// on, in the order of recording.
+///
+/// @param stream_capture Stream capture.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_capture_replay(
+        const_dnnl_stream_capture_t stream_capture);
+
+/// Destroys a stream capture.
+///
+/// @param stream_capture Stream capture to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_capture_destroy(
+        dnnl_stream_capture_t stream_capture);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -290,6 +399,110 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_dropout(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_dropout(
         dnnl_primitive_attr_t attr, const_dnnl_memory_desc_t dropout_desc);
 
+/// Returns the parameters of the source normalization primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param epsilon Output epsilon.
+/// @param flags Output normalization flags.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise. If the attribute is not set, #dnnl_invalid_arguments is
+///     returned.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_normalization(
+        const_dnnl_primitive_attr_t attr, float *epsilon, unsigned *flags);
+
+/// Sets the source normalization primitive attribute.
+///
+/// Each row of the source tensor along its innermost dimension is normalized
+/// as the layer normalization primitive would do before the primitive
+/// consumes it: src = (src - mean) / sqrt(variance + epsilon) * scale +
+/// shift. The normalized values are rounded to the source data type. It lets
+/// a normalization be fused into the following matmul without writing its
+/// output to memory.
+///
+/// The statistics are passed as #DNNL_ARG_ATTR_SRC_NORM_MEAN and
+/// #DNNL_ARG_ATTR_SRC_NORM_VARIANCE f32 arguments with one value per row when
+/// #dnnl_use_global_stats is set and are computed by the primitive otherwise.
+/// The scale and shift are passed as #DNNL_ARG_ATTR_SRC_NORM_SCALE and
+/// #DNNL_ARG_ATTR_SRC_NORM_SHIFT f32 arguments with one value per element of
+/// the innermost dimension when #dnnl_use_scale and #dnnl_use_shift are set.
+/// With #dnnl_rms_norm the mean is not used.
+///
+/// @note
+///     Only the matmul primitive with floating-point source supports the
+///     attribute.
+///
+/// @param attr Primitive attributes.
+/// @param epsilon Epsilon added to the variance.
+/// @param flags Normalization flags, a combination of #dnnl_use_global_stats,
+///     #dnnl_use_scale, #dnnl_use_shift and #dnnl_rms_norm.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_normalization(
+        dnnl_primitive_attr_t attr, float epsilon, unsigned flags);
+
+/// Returns whether the amax primitive attribute is set for an argument.
+///
+/// @param attr Primitive attributes.
+/// @param arg Argument for which to query the attribute, either
+///     #DNNL_ARG_SRC or #DNNL_ARG_DST.
+/// @param enabled Output value, 1 if the primitive computes the absolute
+///     maximum of the argument and 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_amax(
+        const_dnnl_primitive_attr_t attr, int arg, int *enabled);
+
+/// Sets the amax primitive attribute for an argument.
+///
+/// The primitive computes the absolute maximum of the values of the argument
+/// during its execution and writes it to a single-element f32 memory passed
+/// as #DNNL_ARG_ATTR_SRC_AMAX or #DNNL_ARG_ATTR_DST_AMAX. The absolute
+/// maximum of the source is computed over the source values as stored. The
+/// absolute maximum of the destination is computed over the f32 results
+/// before the destination scales are applied and before the conversion to
+/// the destination data type. It provides the statistics of the fp8 delayed
+/// scaling recipes without an extra pass over the tensors.
+///
+/// @note
+///     The reorder, matmul and eltwise forward propagation primitives
+///     support the attribute.
+///
+/// @param attr Primitive attributes.
+/// @param arg Argument for which to compute the absolute maximum, either
+///     #DNNL_ARG_SRC or #DNNL_ARG_DST.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_amax(
+        dnnl_primitive_attr_t attr, int arg);
+
+/// Returns the streaming primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output streaming attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_streaming(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the streaming primitive attribute value.
+///
+/// A streaming convolution processes a sequence chunk by chunk. It must be a
+/// forward 1D convolution with a unit stride, a left padding equal to
+/// `(KW - 1) * (DW + 1)` and no right padding, i.e. a causal convolution.
+/// Instead of zeros, the left padding takes the last input frames of the
+/// previous chunks from a state memory passed as
+/// #DNNL_ARG_ATTR_STREAMING_STATE, and the primitive updates the state with
+/// the last frames of the current chunk during the same execution. The state
+/// memory descriptor can be queried with #dnnl_query_exec_arg_md. A state
+/// filled with zeros starts a new sequence.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set streaming attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_streaming(
+        dnnl_primitive_attr_t attr, int value);
+
 /// Returns the floating-point math mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -1444,6 +1657,43 @@ dnnl_status_t DNNL_API dnnl_memory_get_data_handle_v2(
 dnnl_status_t DNNL_API dnnl_memory_set_data_handle_v2(
         dnnl_memory_t memory, void *handle, int index);
 
+/// Writes the contents of a memory object to a prepacked file.
+///
+/// The file stores the memory descriptor and the effective CPU ISA next to
+/// the data. The data starts at a page-aligned
+/// offset, so the file can later be mapped by
+/// dnnl_memory_create_from_prepacked_file() without copies. The memory is
+/// expected to be in the layout that consuming primitives query, for example
+/// weights reordered to the format returned by the primitive descriptor.
+///
+/// @param memory Memory object to export. Only CPU memory objects with a
+///     single handle are supported.
+/// @param path Path to the output file.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_export_prepacked(
+        const_dnnl_memory_t memory, const char *path);
+
+/// Creates a memory object over a memory-mapped prepacked file.
+///
+/// The file is mapped privately: pages that are only read are shared with the
+/// page cache and across processes, while writes to the memory object make
+/// private copies of the affected pages and never reach the file. The memory
+/// object owns the mapping.
+///
+/// @note
+///     Files are specific to the effective CPU ISA they were exported with
+///     and to the version of the file format. Other files are rejected with
+///     #dnnl_invalid_arguments and must be exported again.
+///
+/// @param memory Output memory object.
+/// @param engine CPU engine to use.
+/// @param path Path to a file written by dnnl_memory_export_prepacked().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_from_prepacked_file(
+        dnnl_memory_t *memory, dnnl_engine_t engine, const char *path);
+
 /// Destroys a memory object.
 ///
 /// @param memory Memory object to destroy.
@@ -3612,6 +3862,148 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk Top-k
+/// @{
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// @note
+///     Destination and indices memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Top-k algorithm kind. Possible values:
+///     #dnnl_topk_max, #dnnl_topk_sample.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param indices_desc Indices memory descriptor.
+/// @param axis Axis along which the values are selected.
+/// @param k Number of the largest values selected along @p axis.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis, dnnl_dim_t k,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_embedding Embedding
+/// @{
+
+/// Creates a primitive descriptor for an embedding primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @note
+///     Offsets and weights memory descriptors may be NULL or zero memory
+///     descriptors. Offsets are required by the bag algorithms and are not
+///     used by #dnnl_embedding_gather, weights are optional for the bag
+///     algorithms only.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Embedding algorithm kind. Possible values:
+///     #dnnl_embedding_gather, #dnnl_embedding_bag_sum,
+///     #dnnl_embedding_bag_mean.
+/// @param src_desc Table memory descriptor.
+/// @param indices_desc Indices memory descriptor.
+/// @param offsets_desc Bag offsets memory descriptor.
+/// @param weights_desc Per-sample weights memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding
+
+/// @addtogroup dnnl_api_grouped_matmul Grouped Matmul
+/// @{
+
+/// Creates a primitive descriptor for a grouped matrix multiplication
+/// primitive.
+///
+/// @note
+///     Memory descriptors are allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any,
+///     except for the offsets memory descriptor.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor (matrix A), the rows of the
+///     groups being stored one after another.
+/// @param weights_desc Weights memory descriptor (matrices B), one matrix
+///     per group stacked along the first dimension.
+/// @param offsets_desc Group offsets memory descriptor. The offset of a group
+///     is the index of the source row following the last row of the group.
+/// @param bias_desc Bias memory descriptor, a vector per group. Passing NULL,
+///     a zero memory descriptor, or a memory descriptor with format_kind set
+///     to #dnnl_format_kind_undef disables the bias term.
+/// @param dst_desc Destination memory descriptor (matrix C).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_grouped_matmul_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t bias_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_grouped_matmul
+
+/// @addtogroup dnnl_api_softmax_cross_entropy Softmax Cross-Entropy
+/// @{
+
+/// Creates a primitive descriptor for a softmax cross-entropy loss primitive.
+///
+/// @note
+///     Memory descriptors are allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training, which computes the loss and the gradient of
+///     the logits, and #dnnl_forward_inference, which computes the loss only.
+/// @param src_desc Logits memory descriptor, a {N, C} matrix.
+/// @param labels_desc Labels memory descriptor, a {N} vector of s32 class
+///     indices.
+/// @param dst_desc Loss memory descriptor, a {N} vector.
+/// @param diff_src_desc Logits gradient memory descriptor, a {N, C} matrix.
+///     Ignored for #dnnl_forward_inference, can be NULL in this case.
+/// @param label_smoothing The amount of the target probability spread
+///     uniformly over the classes, from 0 to 1.
+/// @param ignore_index The label of the samples which have zero loss and
+///     gradient.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_softmax_cross_entropy_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_prop_kind_t prop_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t labels_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t diff_src_desc, float label_smoothing,
+        dnnl_dim_t ignore_index, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_softmax_cross_entropy
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3642,6 +4034,92 @@ dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_pool
+/// @{
+
+/// Returns the amount of memory in bytes the scratchpad pool may keep for
+/// reuse.
+///
+/// @param capacity Scratchpad pool capacity to query. Concurrently
+/// accessing @p capacity is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_scratchpad_pool_capacity(size_t *capacity);
+
+/// Sets the amount of memory in bytes the scratchpad pool may keep for
+/// reuse. The pool is used by the CPU primitives with the library-managed
+/// scratchpad when the library is built with `ONEDNN_ENABLE_CONCURRENT_EXEC`.
+///
+/// @param capacity Scratchpad pool capacity to set. If a new @p capacity is
+/// less than the amount of memory the pool already keeps then the excess
+/// buffers are freed. Setting the @p capacity to 0 frees all the buffers and
+/// disables the pool. Concurrently modifying @p capacity is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_scratchpad_pool_capacity(size_t capacity);
+
+/// @} dnnl_api_scratchpad_pool
+
+/// @addtogroup dnnl_api_telemetry
+/// @{
+
+/// Returns the number of execution records each thread may keep until they
+/// are drained.
+///
+/// @param capacity Output number of records per thread. The execution
+///     telemetry is disabled when @p capacity is 0.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_get_telemetry_capacity(size_t *capacity);
+
+/// Sets the number of execution records each thread may keep until they are
+/// drained and enables the execution telemetry. Every execution of a
+/// primitive from a thread is then recorded in a ring buffer of the thread.
+/// When the buffer is full, the new records are dropped.
+///
+/// This function overrides the ONEDNN_TELEMETRY_CAPACITY environment
+/// variable.
+///
+/// @param capacity Number of records per thread, rounded up to a power of
+///     two. Setting the @p capacity to 0 disables the execution telemetry.
+///     The records kept with the previous capacity remain available to
+///     dnnl_telemetry_drain().
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is too large, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_telemetry_capacity(size_t capacity);
+
+/// Moves the execution records kept by the threads to a user buffer. The
+/// records of a thread are in the order of the executions. The records of
+/// different threads are not ordered. The function may be called
+/// concurrently with the executions.
+///
+/// @param records Buffer of @p capacity records to fill.
+/// @param capacity Number of records the buffer can hold.
+/// @param count Output number of records written to the buffer.
+/// @param dropped Output number of records dropped since the previous call
+///     because the ring buffer of a thread was full. May be NULL.
+/// @returns #dnnl_success/#dnnl::status::success on success and
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p count is NULL or if @p records is NULL while @p capacity is not 0.
+dnnl_status_t DNNL_API dnnl_telemetry_drain(dnnl_telemetry_record_t *records,
+        size_t capacity, size_t *count, size_t *dropped);
+
+/// Returns the name of the implementation with a given index reported in the
+/// execution records.
+///
+/// @param index Implementation name index.
+/// @param name Output name. The string is owned by the library and remains
+///     valid until the library is unloaded.
+/// @returns #dnnl_success/#dnnl::status::success on success and
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if
+///     @p index is not a valid index.
+dnnl_status_t DNNL_API dnnl_telemetry_get_impl_name(
+        uint32_t index, const char **name);
+
+/// @} dnnl_api_telemetry
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -3790,6 +4268,43 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Sets the huge pages policy for the CPU buffers owned by the library:
+/// scratchpads and constant tensors cached by the graph component. See
+/// #dnnl_cpu_huge_pages_t and #dnnl::cpu_huge_pages for the list of the
+/// values accepted by the C and C++ API functions respectively.
+///
+/// The policy applies to the buffers allocated after the call. When huge
+/// pages cannot be provided, the buffers fall back to regular pages.
+///
+/// This function overrides the ONEDNN_CPU_HUGE_PAGES environment variable.
+/// @sa @ref dev_guide_cpu_huge_pages for more details
+///
+/// @param policy CPU huge pages policy.
+/// @returns #dnnl_success/#dnnl::status::success on success,
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p policy value is invalid and #dnnl_unimplemented/
+///     #dnnl::status::unimplemented if huge pages are not supported on the
+///     target system.
+dnnl_status_t DNNL_API dnnl_set_cpu_huge_pages(dnnl_cpu_huge_pages_t policy);
+
+/// Gets the huge pages policy for the CPU buffers owned by the library.
+///
+/// @returns #dnnl_cpu_huge_pages_t value reflecting the current policy.
+dnnl_cpu_huge_pages_t DNNL_API dnnl_get_cpu_huge_pages(void);
+
+/// Returns the size of the live CPU buffers owned by the library allocated
+/// while a huge pages policy was in effect and how much of them is actually
+/// backed by huge pages.
+///
+/// @param allocated Output size in bytes of the buffers.
+/// @param huge_backed Output size in bytes of the parts of the buffers
+///     backed by huge pages.
+/// @returns #dnnl_success/#dnnl::status::success on success and
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if any of
+///     the output pointers is NULL.
+dnnl_status_t DNNL_API dnnl_get_cpu_huge_pages_usage(
+        size_t *allocated, size_t *huge_backed);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -4014,6 +4529,435 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs matrix-matrix multiply on 16-bit bfloat16 matrices A and B, and
+/// single-precision resulting matrix C.
+///
+/// The operation is defined as for dnnl_sgemm(). The elements of matrices A
+/// and B are passed as the raw bits of the bfloat16 values.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Performs matrix-matrix multiply on 16-bit floating-point matrices A and
+/// B, and single-precision resulting matrix C.
+///
+/// The operation is defined as for dnnl_sgemm(). The elements of matrices A
+/// and B are passed as the raw bits of the float16 values.
+///
+/// @note
+///     On CPU, matrices A and B are converted to single precision before
+///     the multiplication.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Returns the size of the buffer for a single-precision matrix A or B
+/// packed by dnnl_sgemm_pack().
+///
+/// A packed matrix is reused by multiple calls to dnnl_sgemm_compute() with
+/// the same dimensions, transposition flags and leading dimensions, which
+/// saves the copies of the matrix that dnnl_sgemm() makes on every call.
+///
+/// @note
+///     The layout of a packed matrix depends on the number of threads
+///     returned by dnnl_get_max_threads(), which should not change between
+///     packing and computing.
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for matrix A, 'B' or
+///     'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed matrix in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs a single-precision matrix A or B for dnnl_sgemm_compute().
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for matrix A, 'B' or
+///     'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the packed matrix. The size of the buffer is
+///     returned by dnnl_sgemm_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst);
+
+/// Performs single-precision matrix-matrix multiply with matrices A and B,
+/// any of which may be packed by dnnl_sgemm_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// with the notations of dnnl_sgemm().
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A. Ignored if A is
+///     packed.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is
+///     packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const float *A,
+        dnnl_dim_t lda, const float *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Returns the size of the buffer for a bfloat16 matrix A or B packed by
+/// dnnl_gemm_bf16bf16f32_pack().
+///
+/// @sa dnnl_sgemm_pack_get_size()
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for matrix A, 'B' or
+///     'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed matrix in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs a bfloat16 matrix A or B for dnnl_gemm_bf16bf16f32_compute().
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for matrix A, 'B' or
+///     'b' for matrix B.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the packed matrix. The size of the buffer is
+///     returned by dnnl_gemm_bf16bf16f32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst);
+
+/// Performs matrix-matrix multiply on bfloat16 matrices A and B, any of
+/// which may be packed by dnnl_gemm_bf16bf16f32_pack(), and single-precision
+/// resulting matrix C.
+///
+/// @sa dnnl_sgemm_compute()
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A. Ignored if A is
+///     packed.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B. Ignored if B is
+///     packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_compute(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Performs a batch of single-precision matrix-matrix multiplies with the
+/// same dimensions, with the matrices of the batch placed at a constant
+/// distance from each other.
+///
+/// The operation is defined as:
+///
+/// `C_i := alpha * op( A_i ) * op( B_i ) + beta * C_i`
+///
+/// with `X_i = X + i * stride_x` for `0 <= i < batch_size` and the other
+/// notations of dnnl_sgemm(). A stride of 0 shares the matrix between all
+/// the multiplies of the batch.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between two A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between two B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between two C matrices.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a batch of single-precision matrix-matrix multiplies with the
+/// same dimensions, with the matrices of the batch given by arrays of
+/// pointers.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// for `0 <= i < batch_size` with the other notations of dnnl_sgemm().
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const float *const *A, dnnl_dim_t lda, const float *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch_size);
+
+/// Performs a batch of matrix-matrix multiplies on bfloat16 matrices A and
+/// B, and single-precision resulting matrices C, with the matrices of the
+/// batch placed at a constant distance from each other.
+///
+/// @sa dnnl_sgemm_batch_strided()
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between two A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between two B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between two C matrices.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_batch_strided(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const uint16_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a batch of matrix-matrix multiplies on bfloat16 matrices A and
+/// B, and single-precision resulting matrices C, with the matrices of the
+/// batch given by arrays of pointers.
+///
+/// @sa dnnl_sgemm_batch()
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *const *A, dnnl_dim_t lda, const uint16_t *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch_size);
+
+/// Performs a batch of matrix-matrix multiplies on 16-bit floating-point
+/// matrices A and B, and single-precision resulting matrices C, with the
+/// matrices of the batch placed at a constant distance from each other.
+///
+/// @sa dnnl_sgemm_batch_strided(), dnnl_gemm_f16f16f32()
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between two A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between two B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between two C matrices.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32_batch_strided(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const uint16_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a batch of matrix-matrix multiplies on 16-bit floating-point
+/// matrices A and B, and single-precision resulting matrices C, with the
+/// matrices of the batch given by arrays of pointers.
+///
+/// @sa dnnl_sgemm_batch(), dnnl_gemm_f16f16f32()
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch_size The number of multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *const *A, dnnl_dim_t lda, const uint16_t *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch_size);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
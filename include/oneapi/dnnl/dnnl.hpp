@@ -88,6 +88,20 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_bound_primitive_t> {
+    static dnnl_status_t destructor(dnnl_bound_primitive_t p) {
+        return dnnl_bound_primitive_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_stream_capture_t> {
+    static dnnl_status_t destructor(dnnl_stream_capture_t p) {
+        return dnnl_stream_capture_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -151,6 +165,14 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// A top-k primitive.
+        topk = dnnl_topk,
+        /// An embedding primitive.
+        embedding = dnnl_embedding,
+        /// A grouped matmul primitive.
+        grouped_matmul = dnnl_grouped_matmul,
+        /// A softmax cross-entropy loss primitive.
+        softmax_cross_entropy = dnnl_softmax_cross_entropy,
     };
 
     using handle::handle;
@@ -201,6 +223,12 @@ struct primitive : public handle<dnnl_primitive_t> {
     ///     constructor.
     inline std::vector<uint8_t> get_cache_blob() const;
 
+    /// Returns the identifier of the primitive reported in the records of
+    /// the execution telemetry.
+    ///
+    /// @returns Identifier of the primitive.
+    inline uint64_t get_telemetry_id() const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -255,6 +283,13 @@ std::vector<uint8_t> primitive::get_cache_blob() const {
     return cache_blob;
 }
 
+uint64_t primitive::get_telemetry_id() const {
+    uint64_t id;
+    error::wrap_c_api(dnnl_primitive_get_telemetry_id(get(), &id),
+            "could not get a telemetry id from a primitive");
+    return id;
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -501,6 +536,16 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Top-k selection of the largest values
+    topk_max = dnnl_topk_max,
+    /// Random sampling among the top-k largest values
+    topk_sample = dnnl_topk_sample,
+    /// Embedding lookup of a table row per index
+    embedding_gather = dnnl_embedding_gather,
+    /// Embedding bag, sum of the rows of a bag
+    embedding_bag_sum = dnnl_embedding_bag_sum,
+    /// Embedding bag, mean of the rows of a bag
+    embedding_bag_mean = dnnl_embedding_bag_mean,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -3392,6 +3437,36 @@ struct memory : public handle<dnnl_memory_t> {
         reset(result);
     }
 
+    /// Constructs a memory object over a memory-mapped prepacked file.
+    ///
+    /// The memory descriptor is read from the file. Pages that are only read
+    /// are shared with the page cache; writes stay private to the memory
+    /// object.
+    ///
+    /// @sa memory::export_prepacked()
+    ///
+    /// @param aengine CPU engine to use.
+    /// @param path Path to a file written by memory::export_prepacked() with
+    ///     the same effective CPU ISA.
+    /// @returns A memory object owning the mapping of the file.
+    static memory from_prepacked_file(
+            const engine &aengine, const std::string &path) {
+        dnnl_memory_t result;
+        error::wrap_c_api(dnnl_memory_create_from_prepacked_file(
+                                  &result, aengine.get(), path.c_str()),
+                "could not create a memory object from a prepacked file");
+        return memory(result);
+    }
+
+    /// Writes the memory descriptor and the contents of the memory object to
+    /// a prepacked file that can be mapped by memory::from_prepacked_file().
+    ///
+    /// @param path Path to the output file.
+    void export_prepacked(const std::string &path) const {
+        error::wrap_c_api(dnnl_memory_export_prepacked(get(), path.c_str()),
+                "could not export a memory object to a prepacked file");
+    }
+
     /// Returns the associated memory descriptor.
     desc get_desc() const {
         const_dnnl_memory_desc_t cdesc;
@@ -3962,6 +4037,77 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set dropout primitive attribute");
     }
 
+    /// Returns the parameters of a source normalization attribute.
+    ///
+    /// @param epsilon Output epsilon.
+    /// @param flags Output normalization flags.
+    void get_src_normalization(
+            float &epsilon, normalization_flags &flags) const {
+        unsigned c_flags = 0;
+        error::wrap_c_api(dnnl_primitive_attr_get_src_normalization(
+                                  get(), &epsilon, &c_flags),
+                "could not get parameters of a source normalization "
+                "attribute");
+        flags = static_cast<normalization_flags>(c_flags);
+    }
+
+    /// Sets a source normalization attribute. Each row of the source along
+    /// its innermost dimension is normalized as by the layer normalization
+    /// primitive before the primitive consumes it.
+    ///
+    /// @param epsilon Epsilon added to the variance.
+    /// @param flags Normalization flags. Supported flags are
+    ///     #dnnl::normalization_flags::use_global_stats,
+    ///     #dnnl::normalization_flags::use_scale,
+    ///     #dnnl::normalization_flags::use_shift and
+    ///     #dnnl::normalization_flags::rms_norm.
+    void set_src_normalization(float epsilon, normalization_flags flags) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_normalization(get(),
+                                  epsilon, convert_to_c(flags)),
+                "could not set source normalization primitive attribute");
+    }
+
+    /// Returns whether the amax attribute is set for an argument.
+    ///
+    /// @param arg Argument, either #DNNL_ARG_SRC or #DNNL_ARG_DST.
+    /// @returns True if the primitive computes the absolute maximum of the
+    ///     argument.
+    bool get_amax(int arg) const {
+        int enabled = 0;
+        error::wrap_c_api(dnnl_primitive_attr_get_amax(get(), arg, &enabled),
+                "could not get amax primitive attribute");
+        return enabled != 0;
+    }
+
+    /// Sets an amax attribute. The primitive writes the absolute maximum of
+    /// the argument to a single-element f32 memory passed as
+    /// #DNNL_ARG_ATTR_SRC_AMAX or #DNNL_ARG_ATTR_DST_AMAX.
+    ///
+    /// @param arg Argument, either #DNNL_ARG_SRC or #DNNL_ARG_DST.
+    void set_amax(int arg) {
+        error::wrap_c_api(dnnl_primitive_attr_set_amax(get(), arg),
+                "could not set amax primitive attribute");
+    }
+
+    /// Returns the streaming attribute value.
+    bool get_streaming() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_streaming(get(), &result),
+                "could not get streaming primitive attribute");
+        return static_cast<bool>(result);
+    }
+
+    /// Sets the streaming attribute value. A streaming causal 1D convolution
+    /// takes its left context from a state memory passed as
+    /// #DNNL_ARG_ATTR_STREAMING_STATE and updates it during the execution.
+    ///
+    /// @param value Specified streaming mode.
+    void set_streaming(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_streaming(
+                                  get(), static_cast<int>(value)),
+                "could not set streaming primitive attribute");
+    }
+
     /// Returns the fpmath mode
     fpmath_mode get_fpmath_mode() const {
         dnnl_fpmath_mode_t result;
@@ -5395,6 +5541,102 @@ struct primitive_desc : public primitive_desc_base {
     }
 };
 
+/// A primitive bound to a stream and to a fixed set of memory arguments.
+///
+/// The arguments are validated and the execution context and the scratchpad
+/// are prepared once at construction, so that an execution only runs the
+/// primitive implementation. It is intended for small primitives executed
+/// many times where the cost of dnnl::primitive::execute() is comparable to
+/// the computations.
+///
+/// @note
+///     The bound memory objects must remain alive as long as the bound
+///     primitive is used. Only CPU engines with non-SYCL runtimes are
+///     supported.
+struct bound_primitive : public handle<dnnl_bound_primitive_t> {
+    /// Default constructor. Produces an empty object.
+    bound_primitive() = default;
+
+    /// Constructs a bound primitive.
+    ///
+    /// @param aprimitive Primitive to bind.
+    /// @param astream Stream to execute the primitive on.
+    /// @param args Arguments map as for dnnl::primitive::execute().
+    bound_primitive(const primitive &aprimitive, const stream &astream,
+            const std::unordered_map<int, memory> &args) {
+        std::vector<dnnl_exec_arg_t> c_args;
+        c_args.reserve(args.size());
+        for (const auto &a : args)
+            c_args.push_back({a.first, a.second.get(true)});
+
+        dnnl_bound_primitive_t result;
+        error::wrap_c_api(
+                dnnl_bound_primitive_create(&result, aprimitive.get(),
+                        astream.get(), (int)c_args.size(), c_args.data()),
+                "could not create a bound primitive");
+        reset(result);
+    }
+
+    /// Sets the data handle of a bound memory argument.
+    ///
+    /// @param arg Argument index as passed at construction.
+    /// @param handle New data handle.
+    void set_data_handle(int arg, void *handle) const {
+        error::wrap_c_api(
+                dnnl_bound_primitive_set_data_handle(get(), arg, handle),
+                "could not set a data handle of a bound primitive argument");
+    }
+
+    /// Executes the bound primitive.
+    void execute() const {
+        error::wrap_c_api(dnnl_bound_primitive_execute(get()),
+                "could not execute a bound primitive");
+    }
+};
+
+/// A sequence of primitive executions recorded on a stream.
+///
+/// Between begin() and end(), dnnl::primitive::execute() on the stream
+/// records the primitive with its arguments instead of executing it. A
+/// replay executes the recorded primitives in order with the per-execution
+/// argument processing done once at recording.
+///
+/// @note
+///     The recorded primitives and memory objects must remain alive as long
+///     as the capture is used. Only CPU engines with non-SYCL runtimes are
+///     supported.
+struct stream_capture : public handle<dnnl_stream_capture_t> {
+    /// Default constructor. Produces an empty object.
+    stream_capture() = default;
+
+    /// Starts recording primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream.
+    static void begin(const stream &astream) {
+        error::wrap_c_api(dnnl_stream_begin_capture(astream.get()),
+                "could not begin a stream capture");
+    }
+
+    /// Stops recording primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream.
+    /// @returns The recorded sequence.
+    static stream_capture end(const stream &astream) {
+        dnnl_stream_capture_t c_capture;
+        error::wrap_c_api(dnnl_stream_end_capture(astream.get(), &c_capture),
+                "could not end a stream capture");
+        stream_capture result;
+        result.reset(c_capture);
+        return result;
+    }
+
+    /// Executes the recorded sequence.
+    void replay() const {
+        error::wrap_c_api(dnnl_stream_capture_replay(get()),
+                "could not replay a stream capture");
+    }
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_convolution Convolution
@@ -13712,6 +13954,547 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk Top-k
+///
+/// A primitive to select the k largest values of a data tensor along an axis
+/// with their indices, or to randomly sample one of them.
+///
+/// @sa @ref dev_guide_topk in developer guide
+///
+/// @{
+
+/// Top-k.
+struct topk : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a top-k primitive.
+        ///
+        /// @note
+        ///     Destination and indices memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Top-k algorithm kind. Possible values:
+        ///     #dnnl_topk_max, #dnnl_topk_sample.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param axis Axis along which the values are selected.
+        /// @param k Number of the largest values selected along @p axis.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &indices_desc, int axis, memory::dim k,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    dst_desc.get(), indices_desc.get(), axis, k, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the top-k primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a top-k primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a top-k primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::topk) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     an indices parameter.
+        memory::desc indices_desc() const { return base::dst_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    topk(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a top-k primitive from a cache blob.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    /// @param cache_blob Cache blob.
+    topk(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_embedding Embedding
+///
+/// A primitive to look up the rows of an embedding table, optionally reducing
+/// them over bags of indices.
+///
+/// @sa @ref dev_guide_embedding in developer guide
+///
+/// @{
+
+/// Embedding.
+struct embedding : public primitive {
+    /// Primitive descriptor for an embedding primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding gather
+        /// primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &indices_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, algorithm::embedding_gather, src_desc,
+                    indices_desc, nullptr, nullptr, dst_desc, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Embedding algorithm kind. Possible values:
+        ///     #dnnl_embedding_bag_sum, #dnnl_embedding_bag_mean.
+        /// @param src_desc Table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Bag offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    &offsets_desc, nullptr, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        /// with per-sample weights.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Embedding algorithm kind. Possible values:
+        ///     #dnnl_embedding_bag_sum, #dnnl_embedding_bag_mean.
+        /// @param src_desc Table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Bag offsets memory descriptor.
+        /// @param weights_desc Per-sample weights memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &weights_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    &offsets_desc, &weights_desc, dst_desc, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding primitive from
+        /// a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns a bag offsets memory descriptor.
+        /// @returns Bag offsets memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     an offsets parameter.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc *offsets_desc,
+                const memory::desc *weights_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    indices_desc.get(), optional_arg(offsets_desc),
+                    optional_arg(weights_desc), dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the embedding primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding() = default;
+
+    /// Constructs an embedding primitive.
+    /// @param pd Primitive descriptor for an embedding primitive.
+    embedding(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding primitive from a cache blob.
+    /// @param pd Primitive descriptor for an embedding primitive.
+    /// @param cache_blob Cache blob.
+    embedding(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding
+
+/// @addtogroup dnnl_api_grouped_matmul Grouped Matmul
+///
+/// A primitive to perform a matrix multiplication per group of source rows,
+/// each group being multiplied by its own weights matrix. The sizes of the
+/// groups are given at execution time.
+///
+/// @sa @ref dev_guide_grouped_matmul in developer guide
+///
+/// @{
+
+/// Grouped matrix multiplication (grouped matmul) primitive.
+struct grouped_matmul : public primitive {
+    /// Primitive descriptor for a grouped matmul primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        /// without bias.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source (matrix A).
+        /// @param weights_desc Memory descriptor for weights (matrices B).
+        /// @param offsets_desc Memory descriptor for the group offsets.
+        /// @param dst_desc Memory descriptor for destination (matrix C).
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, src_desc, weights_desc, offsets_desc,
+                    nullptr, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        /// with bias.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source (matrix A).
+        /// @param weights_desc Memory descriptor for weights (matrices B).
+        /// @param offsets_desc Memory descriptor for the group offsets.
+        /// @param bias_desc Memory descriptor for bias.
+        /// @param dst_desc Memory descriptor for destination (matrix C).
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &offsets_desc, const memory::desc &bias_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, src_desc, weights_desc, offsets_desc,
+                    &bias_desc, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a grouped matmul
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::grouped_matmul) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a group offsets memory descriptor.
+        /// @returns Group offsets memory descriptor.
+        memory::desc offsets_desc() const { return base::src_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::convolution_forward::primitive_desc::bias_desc()const
+        memory::desc bias_desc() const { return base::weights_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+    private:
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &offsets_desc, const memory::desc *bias_desc,
+                const memory::desc &dst_desc, const primitive_attr &attr,
+                bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_grouped_matmul_primitive_desc_create(
+                    &pd, aengine.get(), src_desc.get(), weights_desc.get(),
+                    offsets_desc.get(), optional_arg(bias_desc),
+                    dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the grouped matmul primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    grouped_matmul() = default;
+
+    /// Constructs a grouped matmul primitive.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    grouped_matmul(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a grouped matmul primitive from a cache blob.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    /// @param cache_blob Cache blob.
+    grouped_matmul(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_grouped_matmul
+
+/// @addtogroup dnnl_api_softmax_cross_entropy Softmax Cross-Entropy
+///
+/// A primitive to compute the cross-entropy loss of the softmax of logits
+/// against class labels, fused with the gradient of the logits for training.
+///
+/// @sa @ref dev_guide_softmax_cross_entropy in developer guide
+///
+/// @{
+
+/// Softmax cross-entropy loss primitive.
+struct softmax_cross_entropy : public primitive {
+    /// Primitive descriptor for a softmax cross-entropy loss primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a softmax cross-entropy loss
+        /// primitive computing the loss and the gradient of the logits.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Logits memory descriptor.
+        /// @param labels_desc Labels memory descriptor.
+        /// @param dst_desc Loss memory descriptor.
+        /// @param diff_src_desc Logits gradient memory descriptor.
+        /// @param label_smoothing The amount of the target probability
+        ///     spread uniformly over the classes.
+        /// @param ignore_index The label of the samples which have zero loss
+        ///     and gradient.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                const memory::desc &src_desc, const memory::desc &labels_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &diff_src_desc,
+                float label_smoothing = 0.f, memory::dim ignore_index = -1,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aprop_kind, src_desc, labels_desc,
+                    dst_desc, &diff_src_desc, label_smoothing, ignore_index,
+                    attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a softmax cross-entropy loss
+        /// primitive computing the loss only.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. The only possible value is
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Logits memory descriptor.
+        /// @param labels_desc Labels memory descriptor.
+        /// @param dst_desc Loss memory descriptor.
+        /// @param label_smoothing The amount of the target probability
+        ///     spread uniformly over the classes.
+        /// @param ignore_index The label of the samples which have zero loss.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                const memory::desc &src_desc, const memory::desc &labels_desc,
+                const memory::desc &dst_desc, float label_smoothing = 0.f,
+                memory::dim ignore_index = -1,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aprop_kind, src_desc, labels_desc,
+                    dst_desc, nullptr, label_smoothing, ignore_index, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for a softmax cross-entropy loss
+        /// primitive from a C API primitive descriptor that must have a
+        /// matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a softmax cross-entropy
+        ///     loss primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::softmax_cross_entropy,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a labels memory descriptor.
+        /// @returns Labels memory descriptor.
+        memory::desc labels_desc() const { return base::src_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_prop_kind()const
+        dnnl::prop_kind get_prop_kind() const { return base::get_prop_kind(); }
+
+    private:
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                const memory::desc &src_desc, const memory::desc &labels_desc,
+                const memory::desc &dst_desc,
+                const memory::desc *diff_src_desc, float label_smoothing,
+                memory::dim ignore_index, const primitive_attr &attr,
+                bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status
+                    = dnnl_softmax_cross_entropy_primitive_desc_create(&pd,
+                            aengine.get(), dnnl::convert_to_c(aprop_kind),
+                            src_desc.get(), labels_desc.get(), dst_desc.get(),
+                            optional_arg(diff_src_desc), label_smoothing,
+                            ignore_index, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the softmax cross-entropy primitive. Run workload "
+                        "with environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    softmax_cross_entropy() = default;
+
+    /// Constructs a softmax cross-entropy loss primitive.
+    /// @param pd Primitive descriptor for a softmax cross-entropy loss
+    ///     primitive.
+    softmax_cross_entropy(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a softmax cross-entropy loss primitive from a cache blob.
+    /// @param pd Primitive descriptor for a softmax cross-entropy loss
+    ///     primitive.
+    /// @param cache_blob Cache blob.
+    softmax_cross_entropy(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_softmax_cross_entropy
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13851,6 +14634,35 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_cpu_huge_pages_t
+enum class cpu_huge_pages {
+    /// @copydoc dnnl_cpu_huge_pages_none
+    none = dnnl_cpu_huge_pages_none,
+    /// @copydoc dnnl_cpu_huge_pages_transparent
+    transparent = dnnl_cpu_huge_pages_transparent,
+    /// @copydoc dnnl_cpu_huge_pages_explicit_2m
+    explicit_2m = dnnl_cpu_huge_pages_explicit_2m,
+    /// @copydoc dnnl_cpu_huge_pages_explicit_1g
+    explicit_1g = dnnl_cpu_huge_pages_explicit_1g,
+};
+
+/// @copydoc dnnl_set_cpu_huge_pages()
+inline status set_cpu_huge_pages(cpu_huge_pages policy) {
+    return static_cast<status>(dnnl_set_cpu_huge_pages(
+            static_cast<dnnl_cpu_huge_pages_t>(policy)));
+}
+
+/// @copydoc dnnl_get_cpu_huge_pages()
+inline cpu_huge_pages get_cpu_huge_pages() {
+    return static_cast<cpu_huge_pages>(dnnl_get_cpu_huge_pages());
+}
+
+/// @copydoc dnnl_get_cpu_huge_pages_usage()
+inline void get_cpu_huge_pages_usage(size_t &allocated, size_t &huge_backed) {
+    error::wrap_c_api(dnnl_get_cpu_huge_pages_usage(&allocated, &huge_backed),
+            "could not get huge pages usage");
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -13934,6 +14746,82 @@ inline void set_primitive_cache_capacity(int capacity) {
 
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_pool Scratchpad pool
+///
+/// A pool of scratchpad buffers reused across executions of the CPU
+/// primitives, see @ref dev_guide_attributes_scratchpad.
+///
+/// @{
+
+/// @copydoc dnnl_get_scratchpad_pool_capacity(size_t *capacity)
+inline size_t get_scratchpad_pool_capacity() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_scratchpad_pool_capacity(&result),
+            "could not get scratchpad pool capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_scratchpad_pool_capacity(size_t capacity)
+inline void set_scratchpad_pool_capacity(size_t capacity) {
+    error::wrap_c_api(dnnl_set_scratchpad_pool_capacity(capacity),
+            "could not set scratchpad pool capacity");
+}
+
+/// @} dnnl_api_scratchpad_pool
+
+/// @addtogroup dnnl_api_telemetry Execution telemetry
+///
+/// Low-overhead records of the primitive executions kept in a ring buffer
+/// per thread.
+///
+/// @{
+
+/// @copydoc dnnl_telemetry_record_t
+using telemetry_record = dnnl_telemetry_record_t;
+
+/// @copydoc dnnl_get_telemetry_capacity(size_t *capacity)
+inline size_t get_telemetry_capacity() {
+    size_t result;
+    error::wrap_c_api(dnnl_get_telemetry_capacity(&result),
+            "could not get telemetry capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_telemetry_capacity(size_t capacity)
+inline void set_telemetry_capacity(size_t capacity) {
+    error::wrap_c_api(dnnl_set_telemetry_capacity(capacity),
+            "could not set telemetry capacity");
+}
+
+/// Moves at most @p max_count execution records kept by the threads to a
+/// vector. The records of a thread are in the order of the executions. The
+/// records of different threads are not ordered.
+///
+/// @param max_count Maximal number of records to return.
+/// @param dropped Output number of records dropped since the previous call
+///     because the ring buffer of a thread was full. May be nullptr.
+/// @returns Vector of the execution records.
+inline std::vector<telemetry_record> drain_telemetry(
+        size_t max_count, size_t *dropped = nullptr) {
+    std::vector<telemetry_record> records(max_count);
+    size_t count = 0;
+    error::wrap_c_api(dnnl_telemetry_drain(records.data(), max_count, &count,
+                              dropped),
+            "could not drain telemetry");
+    records.resize(count);
+    return records;
+}
+
+/// @copydoc dnnl_telemetry_get_impl_name(uint32_t index, const char **name)
+inline const char *get_telemetry_impl_name(uint32_t index) {
+    const char *name;
+    error::wrap_c_api(dnnl_telemetry_get_impl_name(index, &name),
+            "could not get telemetry implementation name");
+    return name;
+}
+
+/// @} dnnl_api_telemetry
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -13967,6 +14855,133 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_gemm_bf16bf16f32()
+inline status gemm_bf16bf16f32(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *A,
+        dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb, float beta,
+        float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32()
+inline status gemm_f16f16f32(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *A,
+        dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb, float beta,
+        float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_f16f16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const float *A, dnnl_dim_t lda,
+        const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack_get_size()
+inline status gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack()
+inline status gemm_bf16bf16f32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_compute()
+inline status gemm_bf16bf16f32_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const uint16_t *A, dnnl_dim_t lda,
+        const uint16_t *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch_size));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        dnnl_dim_t lda, const float *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, batch_size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_batch_strided()
+inline status gemm_bf16bf16f32_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const uint16_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_batch_strided(transa,
+            transb, M, N, K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C,
+            ldc, stride_c, batch_size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_batch()
+inline status gemm_bf16bf16f32_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *const *A,
+        dnnl_dim_t lda, const uint16_t *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_batch(transa, transb, M,
+            N, K, alpha, A, lda, B, ldb, beta, C, ldc, batch_size));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32_batch_strided()
+inline status gemm_f16f16f32_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const uint16_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_f16f16f32_batch_strided(transa,
+            transb, M, N, K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C,
+            ldc, stride_c, batch_size));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32_batch()
+inline status gemm_f16f16f32_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *const *A,
+        dnnl_dim_t lda, const uint16_t *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_f16f16f32_batch(transa, transb, M, N,
+            K, alpha, A, lda, B, ldb, beta, C, ldc, batch_size));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -556,6 +556,85 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
 
 /// @} dnnl_graph_api_compiled_partition
 
+/// @addtogroup dnnl_graph_api_memory_plan
+/// @{
+
+/// Creates a memory plan for a sequence of compiled partitions executed in
+/// the given order. The plan assigns every intermediate tensor, i.e. an output
+/// of a partition consumed by a later partition in the sequence, and the
+/// internal temporary buffers of every partition an offset in a single arena
+/// such that buffers with overlapping lifetimes never alias. Outputs which
+/// are not consumed inside the sequence or listed in @p output_ids are left
+/// to the user. The compiled partitions must outlive the plan.
+///
+/// @param memory_plan The handle of output memory plan.
+/// @param num_partitions The number of compiled partitions.
+/// @param partitions A list of compiled partitions in execution order. All
+///     of them must be compiled for the same engine.
+/// @param num_output_ids The number of tensor IDs in @p output_ids.
+/// @param output_ids A list of tensor IDs which must not be placed in the
+///     arena even if they are consumed inside the sequence.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_create(
+        dnnl_graph_memory_plan_t *memory_plan, size_t num_partitions,
+        const_dnnl_graph_compiled_partition_t *partitions,
+        size_t num_output_ids, const size_t *output_ids);
+
+/// Destroys a memory plan.
+///
+/// @param memory_plan The memory plan to be destroyed.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_destroy(
+        dnnl_graph_memory_plan_t memory_plan);
+
+/// Returns the size of the arena required by a memory plan.
+///
+/// @param memory_plan The handle of target memory plan.
+/// @param size The output size of the arena in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_get_size(
+        const_dnnl_graph_memory_plan_t memory_plan, size_t *size);
+
+/// Returns the offset of an intermediate tensor in the arena. If the tensor
+/// ID is not placed in the arena, an error status #dnnl_invalid_arguments
+/// will be returned by the API.
+///
+/// @param memory_plan The handle of target memory plan.
+/// @param tid The unique id of required tensor.
+/// @param offset The output offset of the tensor in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_get_offset(
+        const_dnnl_graph_memory_plan_t memory_plan, size_t tid,
+        size_t *offset);
+
+/// Executes a compiled partition of a memory plan. Input and output tensors
+/// without a data handle which are placed in the arena are bound to their
+/// offsets, and the internal temporary buffers of the partition are taken
+/// from the arena instead of the allocator. Only CPU engines are supported.
+///
+/// @param memory_plan The handle of target memory plan.
+/// @param index The index of the compiled partition in the plan.
+/// @param stream The stream used for execution.
+/// @param arena The arena buffer. It must be at least the size returned by
+///     #dnnl_graph_memory_plan_get_size and aligned to 64 bytes.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors.
+/// @param num_outputs The number of output tensors.
+/// @param outputs A non-empty list of output tensors.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_memory_plan_execute(
+        const_dnnl_graph_memory_plan_t memory_plan, size_t index,
+        dnnl_stream_t stream, void *arena, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
+        const_dnnl_graph_tensor_t *outputs);
+
+/// @} dnnl_graph_api_memory_plan
+
 /// @addtogroup dnnl_graph_api_graph
 /// @{
 
@@ -96,6 +96,13 @@ struct graph_handle_traits<dnnl_graph_compiled_partition_t> {
     }
 };
 
+template <>
+struct graph_handle_traits<dnnl_graph_memory_plan_t> {
+    static dnnl_status_t destructor(dnnl_graph_memory_plan_t p) {
+        return dnnl_graph_memory_plan_destroy(p);
+    }
+};
+
 template <>
 struct graph_handle_traits<dnnl_graph_allocator_t> {
     static dnnl_status_t destructor(dnnl_graph_allocator_t p) {
@@ -113,6 +120,7 @@ DNNL_GRAPH_HANDLE_ALIAS(op);
 DNNL_GRAPH_HANDLE_ALIAS(tensor);
 DNNL_GRAPH_HANDLE_ALIAS(compiled_partition);
 DNNL_GRAPH_HANDLE_ALIAS(partition);
+DNNL_GRAPH_HANDLE_ALIAS(memory_plan);
 
 #undef DNNL_GRAPH_HANDLE_ALIAS
 
@@ -740,6 +748,98 @@ public:
 
 /// @} dnnl_graph_api_compiled_partition
 
+/// @addtogroup dnnl_graph_api_memory_plan Memory Plan
+///
+/// A memory plan places the intermediate tensors and the internal temporary
+/// buffers of a sequence of compiled partitions in a single user-provided
+/// arena, reusing memory between buffers whose lifetimes do not overlap.
+///
+/// @{
+
+/// A memory plan object.
+class memory_plan : public memory_plan_handle {
+public:
+    /// Default constructor. Constructs an empty object.
+    memory_plan() = default;
+
+    /// Constructs a memory plan for compiled partitions executed in the given
+    /// order. The compiled partitions must outlive the plan.
+    ///
+    /// @param partitions A list of compiled partitions in execution order.
+    /// @param output_ids A list of tensor IDs which must not be placed in the
+    ///     arena even if they are consumed inside the sequence.
+    memory_plan(const std::vector<compiled_partition> &partitions,
+            const std::vector<size_t> &output_ids = {}) {
+        std::vector<const_dnnl_graph_compiled_partition_t> c_partitions;
+        c_partitions.reserve(partitions.size());
+        for (const auto &cp : partitions)
+            c_partitions.push_back(cp.get());
+
+        dnnl_graph_memory_plan_t p = nullptr;
+        error::wrap_c_api(
+                dnnl_graph_memory_plan_create(&p, c_partitions.size(),
+                        c_partitions.data(), output_ids.size(),
+                        output_ids.data()),
+                "could not create a memory plan");
+        reset(p);
+    }
+
+    /// Returns the size of the arena in bytes.
+    ///
+    /// @returns The size of the arena.
+    size_t get_size() const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_graph_memory_plan_get_size(get(), &size),
+                "could not get the arena size from a memory plan");
+        return size;
+    }
+
+    /// Returns the offset of an intermediate tensor in the arena. If the
+    /// tensor is not placed in the arena, an exception will be raised.
+    ///
+    /// @param tid The unique id of required tensor.
+    /// @returns The offset of the tensor in bytes.
+    size_t get_offset(size_t tid) const {
+        size_t offset = 0;
+        error::wrap_c_api(
+                dnnl_graph_memory_plan_get_offset(get(), tid, &offset),
+                "could not get the tensor offset from a memory plan");
+        return offset;
+    }
+
+    /// Executes a compiled partition of the plan. Tensors created without a
+    /// data handle are bound to the arena.
+    ///
+    /// @param index The index of the compiled partition in the plan.
+    /// @param astream Stream object to run over.
+    /// @param arena The arena buffer of at least get_size() bytes aligned to
+    ///     64 bytes.
+    /// @param inputs A list of input tensors.
+    /// @param outputs A list of output tensors.
+    void execute(size_t index, stream &astream, void *arena,
+            const std::vector<tensor> &inputs,
+            const std::vector<tensor> &outputs) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+        std::vector<const_dnnl_graph_tensor_t> c_outputs;
+        c_outputs.reserve(outputs.size());
+        for (auto &out : outputs) {
+            c_outputs.push_back(out.get());
+        }
+
+        error::wrap_c_api(
+                dnnl_graph_memory_plan_execute(get(), index, astream.get(),
+                        arena, c_inputs.size(), c_inputs.data(),
+                        c_outputs.size(), c_outputs.data()),
+                "could not execute the memory plan");
+    }
+};
+
+/// @} dnnl_graph_api_memory_plan
+
 /// @addtogroup dnnl_graph_api_op Op
 ///
 /// OP is an abstraction of computation logic for deep neural network
@@ -1246,6 +1346,11 @@ public:
     /// optimal layout will be represented as an opaque layout ID saved in the
     /// output logical tensor.
     ///
+    /// The input logical tensors can also contain unknown dimensions. In this
+    /// case, the dimensions are resolved from the tensors given on execution
+    /// and the partition is specialized for every new set of input shapes.
+    /// The specializations are cached inside the compiled partition.
+    ///
     /// @param inputs A list of input logical tensors.
     /// @param outputs A list of output logical tensors.
     /// @param e The engine used to compile the partition.
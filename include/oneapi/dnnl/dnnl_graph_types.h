@@ -455,6 +455,20 @@ typedef const struct dnnl_graph_compiled_partition
 
 /// @} dnnl_graph_api_compiled_partition
 
+/// @addtogroup dnnl_graph_api_memory_plan
+/// @{
+
+/// An opaque structure to describe a memory plan.
+struct dnnl_graph_memory_plan;
+
+/// A memory plan handle.
+typedef struct dnnl_graph_memory_plan *dnnl_graph_memory_plan_t;
+
+/// A constant memory plan handle.
+typedef const struct dnnl_graph_memory_plan *const_dnnl_graph_memory_plan_t;
+
+/// @} dnnl_graph_api_memory_plan
+
 /// @addtogroup dnnl_graph_api_tensor
 /// @{
 
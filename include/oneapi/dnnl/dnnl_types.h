@@ -2048,6 +2048,14 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// A top-k primitive.
+    dnnl_topk,
+    /// An embedding primitive.
+    dnnl_embedding,
+    /// A grouped matmul primitive.
+    dnnl_grouped_matmul,
+    /// A softmax cross-entropy loss primitive.
+    dnnl_softmax_cross_entropy,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2206,6 +2214,16 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Top-k selection of the largest values
+    dnnl_topk_max = 0x40000,
+    /// Random sampling among the top-k largest values
+    dnnl_topk_sample,
+    /// Embedding lookup of a table row per index
+    dnnl_embedding_gather = 0x50000,
+    /// Embedding bag, sum of the rows of a bag
+    dnnl_embedding_bag_sum,
+    /// Embedding bag, mean of the rows of a bag
+    dnnl_embedding_bag_mean,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2473,6 +2491,24 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_bound_primitive
+/// An opaque structure to describe a primitive bound to a stream and to
+/// memory arguments.
+struct dnnl_bound_primitive;
+/// A bound primitive handle.
+typedef struct dnnl_bound_primitive *dnnl_bound_primitive_t;
+/// A constant bound primitive handle.
+typedef const struct dnnl_bound_primitive *const_dnnl_bound_primitive_t;
+
+/// @struct dnnl_stream_capture
+/// An opaque structure to describe a sequence of primitive executions
+/// recorded on a stream.
+struct dnnl_stream_capture;
+/// A stream capture handle.
+typedef struct dnnl_stream_capture *dnnl_stream_capture_t;
+/// A constant stream capture handle.
+typedef const struct dnnl_stream_capture *const_dnnl_stream_capture_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -2680,6 +2716,27 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Deprecated value.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Mean of the source rows for the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_MEAN 514
+
+/// Variance of the source rows for the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_VARIANCE 515
+
+/// Scale for the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_SCALE 516
+
+/// Shift for the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_SHIFT 517
+
+/// Absolute maximum of the source for the amax attribute.
+#define DNNL_ARG_ATTR_SRC_AMAX 518
+
+/// Absolute maximum of the destination for the amax attribute.
+#define DNNL_ARG_ATTR_DST_AMAX 519
+
+/// Input frames carried between the calls of a streaming convolution.
+#define DNNL_ARG_ATTR_STREAMING_STATE 520
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
@@ -2944,8 +3001,48 @@ typedef enum {
     dnnl_cpu_isa_prefer_ymm = 0x1,
 } dnnl_cpu_isa_hints_t;
 
+/// CPU huge pages policy for the buffers owned by the library
+typedef enum {
+    /// Regular pages
+    dnnl_cpu_huge_pages_none = 0x0,
+
+    /// Transparent huge pages requested with madvise()
+    dnnl_cpu_huge_pages_transparent = 0x1,
+
+    /// Explicit 2 MB huge pages from the hugetlbfs pool
+    dnnl_cpu_huge_pages_explicit_2m = 0x2,
+
+    /// Explicit 1 GB huge pages from the hugetlbfs pool
+    dnnl_cpu_huge_pages_explicit_1g = 0x3,
+} dnnl_cpu_huge_pages_t;
+
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_telemetry
+/// @{
+
+/// A record of a primitive execution captured by the execution telemetry.
+typedef struct {
+    /// Identifier of the executed primitive, see
+    /// dnnl_primitive_get_telemetry_id().
+    uint64_t primitive_id;
+    /// Kind of the executed primitive.
+    dnnl_primitive_kind_t primitive_kind;
+    /// Index of the implementation name, see
+    /// dnnl_telemetry_get_impl_name().
+    uint32_t impl_name_index;
+    /// Number of threads available to the execution, 0 for non-CPU engines.
+    int nthr;
+    /// Start of the execution in nanoseconds of a monotonic clock.
+    uint64_t start_ns;
+    /// End of the execution in nanoseconds of a monotonic clock.
+    uint64_t end_ns;
+    /// Total size in bytes of the memory arguments of the execution.
+    uint64_t bytes;
+} dnnl_telemetry_record_t;
+
+/// @} dnnl_api_telemetry
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
@@ -327,6 +327,182 @@ dnnl_status_t DNNL_API dnnl_transform_destroy(dnnl_transform_t transform);
 
 /// @} dnnl_api_ukernel_brgemm
 
+/// @addtogroup dnnl_api_ukernel_eltwise
+/// @{
+
+/// Creates an eltwise ukernel object. The ukernel applies an elementwise
+/// operation to an `M x N` block of `f32` values, such as a BRGeMM
+/// accumulation buffer, and converts the result to the destination data type.
+///
+/// @param eltwise Output eltwise ukernel object.
+/// @param M Number of rows.
+/// @param N Number of columns.
+/// @param ld_src Leading dimension of the source.
+/// @param ld_dst Leading dimension of the destination.
+/// @param dst_dt Destination data type.
+/// @param alg_kind Elementwise algorithm kind, as for the eltwise primitive.
+/// @param alpha The alpha parameter for the elementwise operation. Specific
+///     meaning depends on the algorithm.
+/// @param beta The beta parameter for the elementwise operation. Specific
+///     meaning depends on the algorithm.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_eltwise_create(
+        dnnl_ukernel_eltwise_t *eltwise, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t ld_src, dnnl_dim_t ld_dst, dnnl_data_type_t dst_dt,
+        dnnl_alg_kind_t alg_kind, float alpha, float beta);
+
+/// Generates an executable part of eltwise ukernel object.
+/// @param eltwise Eltwise ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_eltwise_generate(
+        dnnl_ukernel_eltwise_t eltwise);
+
+/// Executes an eltwise ukernel object. The source and the destination may
+/// point to the same buffer when the destination data type is `f32` and the
+/// leading dimensions are equal.
+///
+/// @param eltwise Eltwise ukernel object.
+/// @param src_ptr Pointer to an `f32` source buffer.
+/// @param dst_ptr Pointer to a destination buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_eltwise_execute(
+        const_dnnl_ukernel_eltwise_t eltwise, const void *src_ptr,
+        void *dst_ptr);
+
+/// Destroys an eltwise ukernel object.
+///
+/// @param eltwise Eltwise ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_eltwise_destroy(
+        dnnl_ukernel_eltwise_t eltwise);
+
+/// @} dnnl_api_ukernel_eltwise
+
+/// @addtogroup dnnl_api_ukernel_reduction
+/// @{
+
+/// Creates a reduction ukernel object. The ukernel reduces every row of an
+/// `M x N` block of `f32` values to a single `f32` value.
+///
+/// @param reduction Output reduction ukernel object.
+/// @param M Number of rows.
+/// @param N Number of columns.
+/// @param ld_src Leading dimension of the source.
+/// @param alg_kind Reduction algorithm kind. Must be one of
+///     #dnnl_reduction_max or #dnnl_reduction_sum.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_reduction_create(
+        dnnl_ukernel_reduction_t *reduction, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t ld_src, dnnl_alg_kind_t alg_kind);
+
+/// Generates an executable part of reduction ukernel object.
+/// @param reduction Reduction ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_reduction_generate(
+        dnnl_ukernel_reduction_t reduction);
+
+/// Executes a reduction ukernel object.
+///
+/// @param reduction Reduction ukernel object.
+/// @param src_ptr Pointer to an `f32` source buffer.
+/// @param dst_ptr Pointer to a buffer of `M` values the results of the
+///     rows are written to.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_reduction_execute(
+        const_dnnl_ukernel_reduction_t reduction, const void *src_ptr,
+        float *dst_ptr);
+
+/// Destroys a reduction ukernel object.
+///
+/// @param reduction Reduction ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_reduction_destroy(
+        dnnl_ukernel_reduction_t reduction);
+
+/// @} dnnl_api_ukernel_reduction
+
+/// @addtogroup dnnl_api_ukernel_softmax
+/// @{
+
+/// Creates an online softmax ukernel object. The ukernel processes an
+/// `M x N` block of `f32` scores `S`, the columns of the block being a part
+/// of the rows softmax is computed over, and updates the running statistics
+/// of the rows and the output `O` accumulated with the previous blocks.
+///
+/// @param softmax Output online softmax ukernel object.
+/// @param M Number of rows.
+/// @param N Number of columns of the scores block.
+/// @param ld_s Leading dimension of the scores.
+/// @param ld_p Leading dimension of the probabilities.
+/// @param p_dt Probabilities data type.
+/// @param N_o Number of columns of the output. May be zero when the output
+///     is not used.
+/// @param ld_o Leading dimension of the output.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_create(
+        dnnl_ukernel_softmax_t *softmax, dnnl_dim_t M, dnnl_dim_t N,
+        dnnl_dim_t ld_s, dnnl_dim_t ld_p, dnnl_data_type_t p_dt,
+        dnnl_dim_t N_o, dnnl_dim_t ld_o);
+
+/// Generates an executable part of online softmax ukernel object.
+/// @param softmax Online softmax ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_generate(
+        dnnl_ukernel_softmax_t softmax);
+
+/// Executes an online softmax ukernel object. For every row `m`, computes
+/// `max_new = max(max[m], max_n S(m, n))`, `P(m, n) = exp(S(m, n) - max_new)`
+/// and rescales the previous sum and output by `exp(max[m] - max_new)`,
+/// then updates `max[m]` and adds the sum of the row of `P` to `sum[m]`.
+///
+/// The maximums must be initialized with `-inf` before the first block, the
+/// sums and the output are initialized by the first block.
+///
+/// @param softmax Online softmax ukernel object.
+/// @param S_ptr Pointer to an `f32` scores buffer.
+/// @param P_ptr Pointer to a probabilities buffer.
+/// @param max_ptr Pointer to a buffer of `M` running maximums.
+/// @param sum_ptr Pointer to a buffer of `M` running sums.
+/// @param O_ptr Pointer to an `f32` output buffer. May be NULL when `N_o` is
+///     zero.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_execute(
+        const_dnnl_ukernel_softmax_t softmax, const void *S_ptr, void *P_ptr,
+        float *max_ptr, float *sum_ptr, float *O_ptr);
+
+/// Divides the rows of the output by the running sums once all the blocks
+/// are processed.
+///
+/// @param softmax Online softmax ukernel object.
+/// @param sum_ptr Pointer to a buffer of `M` running sums.
+/// @param O_ptr Pointer to an `f32` output buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_finalize(
+        const_dnnl_ukernel_softmax_t softmax, const float *sum_ptr,
+        float *O_ptr);
+
+/// Destroys an online softmax ukernel object.
+///
+/// @param softmax Online softmax ukernel object.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_ukernel_softmax_destroy(
+        dnnl_ukernel_softmax_t softmax);
+
+/// @} dnnl_api_ukernel_softmax
+
 #endif
 
 /// @} dnnl_api_ukernel
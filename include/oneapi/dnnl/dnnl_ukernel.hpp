@@ -51,6 +51,27 @@ struct handle_traits<dnnl_transform_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_ukernel_eltwise_t> {
+    static dnnl_status_t destructor(dnnl_ukernel_eltwise_t p) {
+        return dnnl_ukernel_eltwise_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_ukernel_reduction_t> {
+    static dnnl_status_t destructor(dnnl_ukernel_reduction_t p) {
+        return dnnl_ukernel_reduction_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_ukernel_softmax_t> {
+    static dnnl_status_t destructor(dnnl_ukernel_softmax_t p) {
+        return dnnl_ukernel_softmax_destroy(p);
+    }
+};
+
 template <>
 struct handle_traits<dnnl_ukernel_attr_params_t> {
     static dnnl_status_t destructor(dnnl_ukernel_attr_params_t p) {
@@ -458,6 +479,220 @@ struct transform : public handle<dnnl_transform_t> {
 
 /// @} dnnl_api_ukernel_transform
 
+/// @addtogroup dnnl_api_ukernel_eltwise Eltwise ukernel
+/// Elementwise routines
+/// @{
+
+/// Eltwise ukernel
+struct eltwise : public handle<dnnl_ukernel_eltwise_t> {
+    /// Default constructor. Produces an empty object.
+    eltwise() = default;
+
+    /// Constructs an eltwise ukernel object. The ukernel applies an
+    /// elementwise operation to an `M x N` block of `f32` values, such as a
+    /// BRGeMM accumulation buffer, and converts the result to the
+    /// destination data type.
+    ///
+    /// @param M Number of rows.
+    /// @param N Number of columns.
+    /// @param ld_src Leading dimension of the source.
+    /// @param ld_dst Leading dimension of the destination.
+    /// @param dst_dt Destination data type.
+    /// @param aalgorithm Elementwise algorithm kind, as for the eltwise
+    ///     primitive.
+    /// @param alpha The alpha parameter for the elementwise operation.
+    ///     Specific meaning depends on the algorithm.
+    /// @param beta The beta parameter for the elementwise operation.
+    ///     Specific meaning depends on the algorithm.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    eltwise(memory::dim M, memory::dim N, memory::dim ld_src,
+            memory::dim ld_dst, memory::data_type dst_dt, algorithm aalgorithm,
+            float alpha = 0.f, float beta = 0.f, bool allow_empty = false) {
+
+        dnnl_ukernel_eltwise_t eltwise = nullptr;
+        dnnl_status_t status = dnnl_ukernel_eltwise_create(&eltwise, M, N,
+                ld_src, ld_dst, memory::convert_to_c(dst_dt),
+                dnnl::convert_to_c(aalgorithm), alpha, beta);
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create an eltwise ukernel object");
+        reset(eltwise);
+    }
+
+    /// Generates an executable part of eltwise ukernel object.
+    void generate() {
+        dnnl_status_t status = dnnl_ukernel_eltwise_generate(get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not generate an eltwise ukernel object");
+    }
+
+    /// Executes an eltwise ukernel object. The source and the destination
+    /// may point to the same buffer when the destination data type is `f32`
+    /// and the leading dimensions are equal.
+    ///
+    /// @param src Pointer to an `f32` source buffer.
+    /// @param dst Pointer to a destination buffer.
+    void execute(const void *src, void *dst) const {
+        dnnl_status_t status = dnnl_ukernel_eltwise_execute(get(), src, dst);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute an eltwise ukernel object");
+    }
+};
+
+/// @} dnnl_api_ukernel_eltwise
+
+/// @addtogroup dnnl_api_ukernel_reduction Reduction ukernel
+/// Row-wise reduction routines
+/// @{
+
+/// Reduction ukernel
+struct reduction : public handle<dnnl_ukernel_reduction_t> {
+    /// Default constructor. Produces an empty object.
+    reduction() = default;
+
+    /// Constructs a reduction ukernel object. The ukernel reduces every row
+    /// of an `M x N` block of `f32` values to a single `f32` value.
+    ///
+    /// @param M Number of rows.
+    /// @param N Number of columns.
+    /// @param ld_src Leading dimension of the source.
+    /// @param aalgorithm Reduction algorithm kind. Must be one of
+    ///     #dnnl::algorithm::reduction_max or #dnnl::algorithm::reduction_sum.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    reduction(memory::dim M, memory::dim N, memory::dim ld_src,
+            algorithm aalgorithm, bool allow_empty = false) {
+
+        dnnl_ukernel_reduction_t reduction = nullptr;
+        dnnl_status_t status = dnnl_ukernel_reduction_create(
+                &reduction, M, N, ld_src, dnnl::convert_to_c(aalgorithm));
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create a reduction ukernel object");
+        reset(reduction);
+    }
+
+    /// Generates an executable part of reduction ukernel object.
+    void generate() {
+        dnnl_status_t status = dnnl_ukernel_reduction_generate(get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not generate a reduction ukernel object");
+    }
+
+    /// Executes a reduction ukernel object.
+    ///
+    /// @param src Pointer to an `f32` source buffer.
+    /// @param dst Pointer to a buffer of `M` values the results of the rows
+    ///     are written to.
+    void execute(const void *src, float *dst) const {
+        dnnl_status_t status
+                = dnnl_ukernel_reduction_execute(get(), src, dst);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a reduction ukernel object");
+    }
+};
+
+/// @} dnnl_api_ukernel_reduction
+
+/// @addtogroup dnnl_api_ukernel_softmax Online softmax ukernel
+/// Online softmax routines
+/// @{
+
+/// Online softmax ukernel
+struct softmax : public handle<dnnl_ukernel_softmax_t> {
+    /// Default constructor. Produces an empty object.
+    softmax() = default;
+
+    /// Constructs an online softmax ukernel object. The ukernel processes an
+    /// `M x N` block of `f32` scores, the columns of the block being a part
+    /// of the rows softmax is computed over, and updates the running
+    /// statistics of the rows and the output accumulated with the previous
+    /// blocks.
+    ///
+    /// @param M Number of rows.
+    /// @param N Number of columns of the scores block.
+    /// @param ld_s Leading dimension of the scores.
+    /// @param ld_p Leading dimension of the probabilities.
+    /// @param p_dt Probabilities data type.
+    /// @param N_o Number of columns of the output. May be zero when the
+    ///     output is not used.
+    /// @param ld_o Leading dimension of the output.
+    /// @param allow_empty A flag signifying whether construction is
+    ///     allowed to fail without throwing an exception. In this case an
+    ///     empty object will be produced. This flag is optional and
+    ///     defaults to false.
+    softmax(memory::dim M, memory::dim N, memory::dim ld_s, memory::dim ld_p,
+            memory::data_type p_dt, memory::dim N_o, memory::dim ld_o,
+            bool allow_empty = false) {
+
+        dnnl_ukernel_softmax_t softmax = nullptr;
+        dnnl_status_t status = dnnl_ukernel_softmax_create(&softmax, M, N,
+                ld_s, ld_p, memory::convert_to_c(p_dt), N_o, ld_o);
+
+        if (!allow_empty)
+            error::wrap_c_api(status,
+                    "could not create an online softmax ukernel object");
+        reset(softmax);
+    }
+
+    /// Generates an executable part of online softmax ukernel object.
+    void generate() {
+        dnnl_status_t status = dnnl_ukernel_softmax_generate(get());
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not generate an online softmax ukernel object");
+    }
+
+    /// Executes an online softmax ukernel object. For every row `m`,
+    /// computes `max_new = max(max[m], max_n S(m, n))`,
+    /// `P(m, n) = exp(S(m, n) - max_new)` and rescales the previous sum and
+    /// output by `exp(max[m] - max_new)`, then updates `max[m]` and adds the
+    /// sum of the row of `P` to `sum[m]`.
+    ///
+    /// The maximums must be initialized with `-inf` before the first block,
+    /// the sums and the output are initialized by the first block.
+    ///
+    /// @param S Pointer to an `f32` scores buffer.
+    /// @param P Pointer to a probabilities buffer.
+    /// @param max Pointer to a buffer of `M` running maximums.
+    /// @param sum Pointer to a buffer of `M` running sums.
+    /// @param O Pointer to an `f32` output buffer. May be nullptr when `N_o`
+    ///     is zero.
+    void execute(const void *S, void *P, float *max, float *sum,
+            float *O = nullptr) const {
+        dnnl_status_t status
+                = dnnl_ukernel_softmax_execute(get(), S, P, max, sum, O);
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not execute an online softmax ukernel object");
+    }
+
+    /// Divides the rows of the output by the running sums once all the
+    /// blocks are processed.
+    ///
+    /// @param sum Pointer to a buffer of `M` running sums.
+    /// @param O Pointer to an `f32` output buffer.
+    void finalize(const float *sum, float *O) const {
+        dnnl_status_t status = dnnl_ukernel_softmax_finalize(get(), sum, O);
+        if (status != dnnl_success)
+            error::wrap_c_api(status,
+                    "could not finalize an online softmax ukernel object");
+    }
+};
+
+/// @} dnnl_api_ukernel_softmax
+
 #endif
 
 } // namespace ukernel
@@ -80,6 +80,51 @@ typedef struct dnnl_transform *dnnl_transform_t;
 typedef const struct dnnl_transform *const_dnnl_transform_t;
 
 /// @} dnnl_api_ukernel_brgemm
+
+/// @addtogroup dnnl_api_ukernel_eltwise
+/// @{
+
+/// @struct dnnl_ukernel_eltwise
+/// An opaque structure to describe an eltwise ukernel.
+struct dnnl_ukernel_eltwise;
+
+/// An eltwise ukernel handle.
+typedef struct dnnl_ukernel_eltwise *dnnl_ukernel_eltwise_t;
+
+/// A constant eltwise ukernel handle.
+typedef const struct dnnl_ukernel_eltwise *const_dnnl_ukernel_eltwise_t;
+
+/// @} dnnl_api_ukernel_eltwise
+
+/// @addtogroup dnnl_api_ukernel_reduction
+/// @{
+
+/// @struct dnnl_ukernel_reduction
+/// An opaque structure to describe a reduction ukernel.
+struct dnnl_ukernel_reduction;
+
+/// A reduction ukernel handle.
+typedef struct dnnl_ukernel_reduction *dnnl_ukernel_reduction_t;
+
+/// A constant reduction ukernel handle.
+typedef const struct dnnl_ukernel_reduction *const_dnnl_ukernel_reduction_t;
+
+/// @} dnnl_api_ukernel_reduction
+
+/// @addtogroup dnnl_api_ukernel_softmax
+/// @{
+
+/// @struct dnnl_ukernel_softmax
+/// An opaque structure to describe an online softmax ukernel.
+struct dnnl_ukernel_softmax;
+
+/// An online softmax ukernel handle.
+typedef struct dnnl_ukernel_softmax *dnnl_ukernel_softmax_t;
+
+/// A constant online softmax ukernel handle.
+typedef const struct dnnl_ukernel_softmax *const_dnnl_ukernel_softmax_t;
+
+/// @} dnnl_api_ukernel_softmax
 #endif
 
 /// @} dnnl_api_ukernel
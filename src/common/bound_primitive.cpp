@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "bound_primitive.hpp"
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "memory.hpp"
+#include "primitive.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_iface.hpp"
+#include "stream.hpp"
+#include "telemetry.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+#if defined(DNNL_ENABLE_ITT_TASKS)
+#include "ittnotify.hpp"
+#endif
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+dnnl_bound_primitive::dnnl_bound_primitive(
+        primitive_iface_t *primitive_iface, stream_t *stream)
+    : primitive_iface_(primitive_iface), stream_(stream) {
+    primitive_iface_->retain();
+}
+
+dnnl_bound_primitive::~dnnl_bound_primitive() {
+    // The grantor refers to the context and to the scratchpad.
+    grantor_.reset();
+    primitive_iface_->release();
+}
+
+status_t dnnl_bound_primitive::init(
+        int nargs, const dnnl_exec_arg_t *c_args, bool defer_scratchpad) {
+    const auto *pd = primitive_iface_->pd()->impl().get();
+
+    exec_args_t args;
+    CHECK(cvt_primitive_args(pd, nargs, c_args, args));
+    args_.reserve(args.size());
+    for (const auto &a : args)
+        args_.emplace_back(a.first, a.second.mem);
+
+    ctx_ = utils::make_unique<exec_ctx_t>(stream_, std::move(args));
+    if (!ctx_) return out_of_memory;
+    ctx_->set_resource_mapper(primitive_iface_->resource_mapper());
+
+    if (pd->attr()->scratchpad_mode_ == scratchpad_mode::user) {
+        memory_t *scratchpad_memory = ctx_->output(DNNL_ARG_SCRATCHPAD);
+        return set_scratchpad(scratchpad_memory
+                        ? scratchpad_memory->memory_storage()
+                        : nullptr);
+    }
+    // A global scratchpad may be reallocated by other primitives between
+    // executions, hence a bound primitive owns its scratchpad.
+    const size_t scratchpad_size = library_scratchpad_size();
+    if (scratchpad_size && defer_scratchpad) return success;
+    if (scratchpad_size) {
+        scratchpad_.reset(
+                create_scratchpad(stream_->engine(), scratchpad_size, false));
+        if (!scratchpad_ || !scratchpad_->get_memory_storage())
+            return out_of_memory;
+    }
+    return set_scratchpad(
+            scratchpad_ ? scratchpad_->get_memory_storage() : nullptr);
+}
+
+size_t dnnl_bound_primitive::library_scratchpad_size() const {
+    const auto *pd = primitive_iface_->pd()->impl().get();
+    if (pd->attr()->scratchpad_mode_ == scratchpad_mode::user) return 0;
+    return pd->scratchpad_size(scratchpad_mode::library);
+}
+
+status_t dnnl_bound_primitive::set_scratchpad(
+        const memory_storage_t *mem_storage) {
+    const auto *pd = primitive_iface_->pd()->impl().get();
+    grantor_ = utils::make_unique<memory_tracking::grantor_t>(
+            pd->scratchpad_registry().grantor(mem_storage, *ctx_));
+    if (!grantor_) return out_of_memory;
+    ctx_->set_scratchpad_grantor(grantor_.get());
+    return success;
+}
+
+status_t dnnl_bound_primitive::set_data_handle(int arg, void *handle) const {
+    for (const auto &a : args_) {
+        if (a.first == arg) return a.second->set_data_handle(handle);
+    }
+    return invalid_arguments;
+}
+
+status_t dnnl_bound_primitive::execute(bool call_stream_hooks) const {
+    if (!grantor_) return invalid_arguments;
+
+    const auto kind = primitive_iface_->pd()->impl()->kind();
+    bool use_regular_path
+            = get_verbose(verbose_t::exec_profile, prim_kind2_comp_kind(kind))
+            || telemetry::is_enabled();
+#if defined(DNNL_ENABLE_ITT_TASKS)
+    use_regular_path = use_regular_path
+            || itt::get_itt(itt::__itt_task_level_low);
+#endif
+
+    if (call_stream_hooks) stream_->before_exec_hook();
+    status_t status = success;
+    if (use_regular_path) {
+        // Profiling and telemetry are done by the regular execution path,
+        // it resets the scratchpad grantor of the context on exit.
+        status = primitive_execute(primitive_iface_, *ctx_);
+        ctx_->set_scratchpad_grantor(grantor_.get());
+    } else {
+        status = primitive_iface_->execute_prepared(*ctx_);
+    }
+    if (call_stream_hooks) stream_->after_exec_hook();
+
+    return status;
+}
+
+// API
+status_t dnnl_bound_primitive_create(bound_primitive_t **bound_primitive,
+        primitive_iface_t *primitive_iface, stream_t *stream, int nargs,
+        const dnnl_exec_arg_t *c_args) {
+    bool ok = !utils::any_null(bound_primitive, primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine()
+            && IMPLICATION(nargs > 0, c_args != nullptr);
+    if (!ok) return invalid_arguments;
+
+    // Device streams order executions with events the bound primitive would
+    // have to manage as well.
+    if (stream->engine()->kind() != engine_kind::cpu
+            || stream->engine()->runtime_kind() == runtime_kind::sycl)
+        return unimplemented;
+
+    auto bp = utils::make_unique<bound_primitive_t>(primitive_iface, stream);
+    if (!bp) return out_of_memory;
+    CHECK(bp->init(nargs, c_args));
+    *bound_primitive = bp.release();
+    return success;
+}
+
+status_t dnnl_bound_primitive_set_data_handle(
+        const bound_primitive_t *bound_primitive, int arg, void *handle) {
+    if (bound_primitive == nullptr) return invalid_arguments;
+    return bound_primitive->set_data_handle(arg, handle);
+}
+
+status_t dnnl_bound_primitive_execute(
+        const bound_primitive_t *bound_primitive) {
+    if (bound_primitive == nullptr) return invalid_arguments;
+    return bound_primitive->execute();
+}
+
+status_t dnnl_bound_primitive_destroy(bound_primitive_t *bound_primitive) {
+    delete bound_primitive;
+    return success;
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_BOUND_PRIMITIVE_HPP
+#define COMMON_BOUND_PRIMITIVE_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "primitive_exec_types.hpp"
+#include "scratchpad.hpp"
+#include "utils.hpp"
+
+// dnnl_bound_primitive is a primitive bound to a stream and to a fixed set of
+// memory arguments. Everything `dnnl_primitive_execute()` does on every call
+// is done once at creation: the arguments are validated and converted, the
+// execution context is built and a scratchpad that belongs to the bound
+// primitive is allocated and granted. An execution then only runs the
+// primitive implementation.
+struct dnnl_bound_primitive : public dnnl::impl::c_compatible {
+    dnnl_bound_primitive(primitive_iface_t *primitive_iface,
+            dnnl::impl::stream_t *stream);
+    ~dnnl_bound_primitive();
+
+    // With `defer_scratchpad` the library scratchpad is not allocated and,
+    // if the primitive needs one, the bound primitive cannot be executed
+    // until set_scratchpad() is called. It lets several bound primitives
+    // executed one after another share a single scratchpad.
+    dnnl::impl::status_t init(int nargs, const dnnl_exec_arg_t *c_args,
+            bool defer_scratchpad = false);
+
+    // Size of the scratchpad to pass to set_scratchpad().
+    size_t library_scratchpad_size() const;
+    dnnl::impl::status_t set_scratchpad(
+            const dnnl::impl::memory_storage_t *mem_storage);
+
+    dnnl::impl::status_t set_data_handle(int arg, void *handle) const;
+
+    dnnl::impl::status_t execute(bool call_stream_hooks = true) const;
+
+private:
+    primitive_iface_t *primitive_iface_;
+    dnnl::impl::stream_t *stream_;
+
+    // Bound memory arguments, the memory objects are owned by the user.
+    std::vector<std::pair<int, dnnl::impl::memory_t *>> args_;
+    std::unique_ptr<dnnl::impl::exec_ctx_t> ctx_;
+    std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    std::unique_ptr<dnnl::impl::memory_tracking::grantor_t> grantor_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_bound_primitive);
+};
+
+#endif
@@ -144,6 +144,11 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t topk_max = dnnl_topk_max;
+const alg_kind_t topk_sample = dnnl_topk_sample;
+const alg_kind_t embedding_gather = dnnl_embedding_gather;
+const alg_kind_t embedding_bag_sum = dnnl_embedding_bag_sum;
+const alg_kind_t embedding_bag_mean = dnnl_embedding_bag_mean;
 // Internal only alg kinds.
 const alg_kind_t internal_only_start = (alg_kind_t)(1 << 12);
 // GPU only via jit_eltwise injector.
@@ -1980,6 +1985,10 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t topk = dnnl_topk;
+const primitive_kind_t embedding = dnnl_embedding;
+const primitive_kind_t grouped_matmul = dnnl_grouped_matmul;
+const primitive_kind_t softmax_cross_entropy = dnnl_softmax_cross_entropy;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -2093,6 +2102,8 @@ const stream_flags_t profiling = static_cast<stream_flags_t>(1 << 2);
 #endif
 } // namespace stream_flags
 using stream_t = dnnl_stream;
+using bound_primitive_t = dnnl_bound_primitive;
+using stream_capture_t = dnnl_stream_capture;
 
 struct memory_storage_t;
 
@@ -2113,10 +2124,12 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
 struct group_normalization_pd_t;
+struct grouped_matmul_pd_t;
 struct inner_product_bwd_data_pd_t;
 struct inner_product_bwd_weights_pd_t;
 struct inner_product_fwd_pd_t;
@@ -2140,9 +2153,11 @@ struct rnn_fwd_pd_t;
 struct rnn_pd_t;
 struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
+struct softmax_cross_entropy_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
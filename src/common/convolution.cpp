@@ -172,7 +172,8 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
         auto fwd_attr_mask = smask_t::post_ops | smask_t::sum_dt
-                | smask_t::fpmath_mode | smask_t::rounding_mode;
+                | smask_t::fpmath_mode | smask_t::rounding_mode
+                | smask_t::streaming;
         const bool is_gpu = engine->kind() == engine_kind::gpu;
 
         const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
@@ -244,6 +245,24 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
             // Note: verbose support is inside the call.
             CHECK(po.validate_binary(engine->kind(), &desc.dst_desc));
         }
+
+        // Check streaming: only a causal 1D convolution can carry its left
+        // context between the calls.
+        if (!attr->streaming_.has_default_values()) {
+            const int ndims = desc.src_desc.ndims;
+            VCHECK_CONV_UNIMPL(ndims == 3, VERBOSE_BAD_NDIMS, "src", ndims);
+            const bool with_groups = desc.weights_desc.ndims == ndims + 1;
+            const dim_t kw = desc.weights_desc.dims[with_groups + ndims - 1];
+            const dim_t context = (kw - 1) * (desc.dilates[0] + 1);
+            VCHECK_CONV_UNIMPL(desc.strides[0] == 1, VERBOSE_BAD_PARAM,
+                    "strides");
+            VCHECK_CONV_UNIMPL(desc.padding[0][0] == context
+                            && desc.padding[1][0] == 0,
+                    VERBOSE_BAD_PARAM, "padding");
+            VCHECK_CONV_UNIMPL(attr->post_ops_.find(primitive_kind::convolution)
+                            == -1,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+        }
     } else {
         auto bwd_attr_mask = smask_t::fpmath_mode | smask_t::accumulation_mode;
         VCHECK_CONV_UNIMPL(attr->has_default_values(bwd_attr_mask),
@@ -334,6 +334,12 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        // The state is read and updated in place.
+        if (arg == DNNL_ARG_ATTR_STREAMING_STATE)
+            return attr()->streaming_.has_default_values()
+                    ? arg_usage_t::unused
+                    : arg_usage_t::output;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -344,6 +350,7 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
             case DNNL_ARG_WEIGHTS: return weights_md(0);
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_ATTR_STREAMING_STATE: return &streaming_state_md_;
             default: return convolution_pd_t::arg_md(arg);
         }
     }
@@ -378,6 +385,8 @@ protected:
     memory_desc_t weights_md_;
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
+    // Defined by the implementations supporting the streaming attribute.
+    memory_desc_t streaming_state_md_;
 
     convolution_fwd_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const convolution_fwd_pd_t *hint_fwd_pd)
@@ -385,7 +394,8 @@ protected:
         , src_md_(desc_.src_desc)
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
-        , dst_md_(desc_.dst_desc) {}
+        , dst_md_(desc_.dst_desc)
+        , streaming_state_md_(glob_zero_md) {}
 
     bool set_default_formats_common(
             format_tag_t src_tag, format_tag_t wei_tag, format_tag_t dst_tag) {
@@ -1784,6 +1784,10 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_topk) return "topk";
+    if (v == dnnl_embedding) return "embedding";
+    if (v == dnnl_grouped_matmul) return "grouped_matmul";
+    if (v == dnnl_softmax_cross_entropy) return "softmax_cross_entropy";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
     assert(!"unknown prim_kind");
@@ -1862,6 +1866,11 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_topk_max) return "topk_max";
+    if (v == dnnl_topk_sample) return "topk_sample";
+    if (v == dnnl_embedding_gather) return "embedding_gather";
+    if (v == dnnl_embedding_bag_sum) return "embedding_bag_sum";
+    if (v == dnnl_embedding_bag_mean) return "embedding_bag_mean";
     if (v == dnnl::impl::alg_kind::softmax_accurate_inf_as_zero) return "softmax_accurate_inf_as_zero";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
@@ -0,0 +1,207 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "embedding_pd.hpp"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_EMBEDDING(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_EMBEDDING_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+namespace {
+bool is_present(const memory_desc_t *md) {
+    return md != nullptr && !types::is_zero_md(md);
+}
+
+// The index-like tensors are plain vectors without runtime dimensions.
+bool is_plain_vector(const memory_desc_t *md) {
+    return md->ndims == 1 && md->format_kind == format_kind::blocked
+            && md->extra.flags == 0
+            && !memory_desc_wrapper(md).has_runtime_dims_or_strides();
+}
+} // namespace
+
+status_t embedding_desc_init(embedding_desc_t *embedding_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *weights_desc, const memory_desc_t *dst_desc) {
+
+    VCHECK_EMBEDDING(
+            !any_null(src_desc, indices_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_EMBEDDING(one_of(alg_kind, embedding_gather, embedding_bag_sum,
+                             embedding_bag_mean),
+            VERBOSE_BAD_ALGORITHM);
+
+    const bool is_bag = alg_kind != embedding_gather;
+    const bool with_offsets = is_present(offsets_desc);
+    const bool with_weights = is_present(weights_desc);
+    VCHECK_EMBEDDING(is_bag == with_offsets, VERBOSE_NULL_ARG);
+    VCHECK_EMBEDDING(IMPLICATION(with_weights, is_bag),
+            VERBOSE_BAD_PARAM, "weights");
+
+    VCHECK_EMBEDDING(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_EMBEDDING(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_EMBEDDING(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "src");
+    VCHECK_EMBEDDING(one_of(src_desc->data_type, data_type::f32,
+                             data_type::bf16, data_type::f16, data_type::s8,
+                             data_type::u8, data_type::s4, data_type::u4),
+            VERBOSE_INVALID_DATATYPE, "src");
+    VCHECK_EMBEDDING(
+            !memory_desc_wrapper(src_desc).has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    VCHECK_EMBEDDING(is_plain_vector(indices_desc), VERBOSE_BAD_PARAM,
+            "indices");
+    VCHECK_EMBEDDING(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+    const dim_t nindices = indices_desc->dims[0];
+
+    if (with_offsets) {
+        VCHECK_EMBEDDING(is_plain_vector(offsets_desc), VERBOSE_BAD_PARAM,
+                "offsets");
+        VCHECK_EMBEDDING(offsets_desc->data_type == data_type::s32,
+                VERBOSE_INVALID_DATATYPE, "offsets");
+    }
+
+    if (with_weights) {
+        VCHECK_EMBEDDING(is_plain_vector(weights_desc), VERBOSE_BAD_PARAM,
+                "weights");
+        VCHECK_EMBEDDING(one_of(weights_desc->data_type, data_type::f32,
+                                 data_type::bf16, data_type::f16),
+                VERBOSE_INVALID_DATATYPE, "weights");
+        VCHECK_EMBEDDING(weights_desc->dims[0] == nindices,
+                VERBOSE_INCONSISTENT_DIM, "indices", 0, "weights", 0);
+    }
+
+    // A destination row per index for the gather, per bag otherwise.
+    const dim_t nrows = is_bag ? offsets_desc->dims[0] : nindices;
+    VCHECK_EMBEDDING(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_EMBEDDING(dst_desc->dims[0] == nrows, VERBOSE_INCONSISTENT_DIM,
+            is_bag ? "offsets" : "indices", 0, "dst", 0);
+    VCHECK_EMBEDDING(dst_desc->dims[1] == src_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "dst", 1);
+    VCHECK_EMBEDDING(one_of(dst_desc->data_type, data_type::f32,
+                             data_type::bf16, data_type::f16),
+            VERBOSE_INVALID_DATATYPE, "dst");
+    VCHECK_EMBEDDING(one_of(dst_desc->format_kind, format_kind::blocked,
+                             format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_EMBEDDING(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                             dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    auto ed = embedding_desc_t();
+    ed.primitive_kind = primitive_kind::embedding;
+    ed.alg_kind = alg_kind;
+
+    ed.src_desc = *src_desc;
+    ed.indices_desc = *indices_desc;
+    ed.offsets_desc = with_offsets ? *offsets_desc : types::zero_md();
+    ed.weights_desc = with_weights ? *weights_desc : types::zero_md();
+    ed.dst_desc = *dst_desc;
+
+    (*embedding_desc) = ed;
+    return success;
+}
+
+status_t embedding_attr_check(
+        const embedding_desc_t &desc, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Quantized tables are dequantized with a common or a per-row scale and
+    // zero-point of the source.
+    VCHECK_EMBEDDING_UNIMPL(attr->has_default_values(smask_t::scales
+                                    | smask_t::zero_points),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const int per_row_mask = 1 << 0;
+    static const std::vector<int> supported_args {DNNL_ARG_SRC};
+
+    const auto &sc = attr->scales_;
+    VCHECK_EMBEDDING_UNIMPL(sc.has_default_values(supported_args),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    if (!sc.has_default_values(DNNL_ARG_SRC)) {
+        VCHECK_EMBEDDING_UNIMPL(
+                one_of(sc.get_mask(DNNL_ARG_SRC), 0, per_row_mask),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_EMBEDDING_UNIMPL(sc.get(DNNL_ARG_SRC).has_default_groups(),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_EMBEDDING_UNIMPL(one_of(sc.get_data_type(DNNL_ARG_SRC),
+                                        data_type::f32, data_type::bf16,
+                                        data_type::f16),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    const auto &zp = attr->zero_points_;
+    VCHECK_EMBEDDING_UNIMPL(zp.has_default_values(supported_args),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    if (!zp.has_default_values(DNNL_ARG_SRC)) {
+        VCHECK_EMBEDDING_UNIMPL(types::is_integral_dt(desc.src_desc.data_type),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_EMBEDDING_UNIMPL(
+                one_of(zp.get_mask(DNNL_ARG_SRC), 0, per_row_mask),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_EMBEDDING_UNIMPL(zp.get(DNNL_ARG_SRC).has_default_groups(),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_EMBEDDING_UNIMPL(one_of(zp.get_data_type(DNNL_ARG_SRC),
+                                        data_type::s32, data_type::s8,
+                                        data_type::u8),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_embedding_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *weights_desc, const memory_desc_t *dst_desc,
+        const primitive_attr_t *attr) {
+
+    auto embedding_desc = embedding_desc_t();
+    CHECK(embedding_desc_init(&embedding_desc, alg_kind, src_desc,
+            indices_desc, offsets_desc, weights_desc, dst_desc));
+    CHECK(embedding_attr_check(embedding_desc, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&embedding_desc, nullptr, attr);
+}
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_PD_HPP
+#define COMMON_EMBEDDING_PD_HPP
+
+#include "c_types_map.hpp"
+#include "memory_desc.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_EMBEDDING(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, embedding, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_EMBEDDING_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, embedding, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t embedding_desc_init(embedding_desc_t *embedding_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *weights_desc, const memory_desc_t *dst_desc);
+
+// NOLINTBEGIN(google-default-arguments)
+struct embedding_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding;
+
+    using hint_class = embedding_pd_t;
+
+    const embedding_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_SRC_1: return arg_usage_t::input;
+            case DNNL_ARG_SRC_2:
+                return is_bag() ? arg_usage_t::input : arg_usage_t::unused;
+            case DNNL_ARG_WEIGHTS:
+                return with_weights() ? arg_usage_t::input
+                                      : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_SRC_2: return src_md(2);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // The first source is the table, the second and the third ones are the
+    // indices and the bag offsets. The weights are the per-sample weights.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc()->src_desc;
+            case 1: return &desc()->indices_desc;
+            case 2: return &desc()->offsets_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc()->weights_desc : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2 + is_bag() + with_weights(); }
+    int n_outputs() const override { return 1; }
+
+    bool is_bag() const {
+        return desc()->alg_kind != alg_kind::embedding_gather;
+    }
+    bool is_mean() const {
+        return desc()->alg_kind == alg_kind::embedding_bag_mean;
+    }
+    bool with_weights() const {
+        return !types::is_zero_md(&desc()->weights_desc);
+    }
+
+    dim_t table_rows() const { return desc()->src_desc.dims[0]; }
+    dim_t embedding_dim() const { return desc()->src_desc.dims[1]; }
+    dim_t nindices() const { return desc()->indices_desc.dims[0]; }
+    // The number of destination rows: one per bag, one per index otherwise.
+    dim_t nbags() const { return dst_md_.dims[0]; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md()).has_zero_dim();
+    }
+
+protected:
+    embedding_desc_t desc_;
+
+    memory_desc_t dst_md_;
+
+    embedding_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<embedding_desc_t>(adesc))
+        , dst_md_(desc_.dst_desc) {}
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_tag(dst_md_, format_tag::ab);
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2024 Intel Corporation
+* Copyright 2021-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <sstream>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -25,11 +27,13 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/profiler.hpp"
 #include "common/stack_checker.hpp"
 #include "common/verbose.hpp"
@@ -57,6 +61,79 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     return s_;
 }
 
+char c2f_identifier(char identifier) {
+    if (identifier == 'A' || identifier == 'a') return 'B';
+    if (identifier == 'B' || identifier == 'b') return 'A';
+    return identifier;
+}
+
+const bfloat16_t *to_bf16(const uint16_t *ptr) {
+    return reinterpret_cast<const bfloat16_t *>(ptr);
+}
+
+const float16_t *to_f16(const uint16_t *ptr) {
+    return reinterpret_cast<const float16_t *>(ptr);
+}
+
+// Converts the row-major matrix `op(src)` of size `rows x cols` to a dense
+// f32 matrix that keeps the transposition of the source.
+status_t cvt_f16_to_f32(std::vector<float> &dst, dim_t &ld_dst, char trans,
+        dim_t rows, dim_t cols, const float16_t *src, dim_t ld) {
+    const bool is_trans = utils::one_of(trans, 'T', 't');
+    if (!is_trans && !utils::one_of(trans, 'N', 'n'))
+        return status::invalid_arguments;
+
+    const dim_t nrows = is_trans ? cols : rows;
+    const dim_t ncols = is_trans ? rows : cols;
+    if (nrows < 0 || ncols < 0 || ld < nstl::max(dim_t(1), ncols))
+        return status::invalid_arguments;
+    if (nrows * ncols > 0 && src == nullptr) return status::invalid_arguments;
+
+    ld_dst = nstl::max(dim_t(1), ncols);
+    dst.resize(nstl::max(dim_t(1), nrows * ld_dst));
+    parallel_nd(nrows, [&](dim_t r) {
+        cvt_float16_to_float(&dst[r * ld_dst], src + r * ld, ncols);
+    });
+    return status::success;
+}
+
+// There is no f16 GEMM on CPU, the matrices A and B are converted to f32.
+status_t gemm_f16f16f32(char transa, char transb, dim_t M, dim_t N, dim_t K,
+        float alpha, const float16_t *A, dim_t lda, const float16_t *B,
+        dim_t ldb, float beta, float *C, dim_t ldc) {
+    std::vector<float> a_f32, b_f32;
+    dim_t lda_f32 = 0, ldb_f32 = 0;
+    CHECK(cvt_f16_to_f32(a_f32, lda_f32, transa, M, K, A, lda));
+    CHECK(cvt_f16_to_f32(b_f32, ldb_f32, transb, K, N, B, ldb));
+    return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+            b_f32.data(), &ldb_f32, a_f32.data(), &lda_f32, &beta, C, &ldc,
+            nullptr, false);
+}
+
+// Runs the multiplies of a batch. When the batch has enough multiplies to
+// keep all the threads busy, the multiplies are distributed between the
+// threads and each one runs on a single thread, which avoids the
+// synchronization of a multithreaded GEMM on small matrices. Otherwise, the
+// multiplies run one after another on all the threads.
+template <typename gemm_t>
+status_t gemm_batch(dim_t batch_size, const gemm_t &gemm) {
+    if (batch_size < 0) return status::invalid_arguments;
+
+    const int nthr = dnnl_get_current_num_threads();
+    if (nthr == 1 || batch_size < nthr) {
+        for (dim_t i = 0; i < batch_size; i++)
+            CHECK(gemm(i));
+        return status::success;
+    }
+
+    std::atomic<status_t> status(status::success);
+    parallel_nd(batch_size, [&](dim_t i) {
+        const status_t st = gemm(i);
+        if (st != status::success) status = st;
+    });
+    return status;
+}
+
 } // namespace
 #endif
 
@@ -141,16 +218,226 @@ dnnl_status_t dnnl_gemm_s8s8s32(char transa, char transb, char offsetc, dim_t M,
 #endif
 }
 
-extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
-        char transb, dim_t M, dim_t N, dim_t K, float alpha,
-        const bfloat16_t *A, dim_t lda, const bfloat16_t *B, dim_t ldb,
-        float beta, float *C, dim_t ldc) {
+dnnl_status_t dnnl_gemm_bf16bf16f32(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const uint16_t *A, dim_t lda,
+        const uint16_t *B, dim_t ldb, float beta, float *C, dim_t ldc) {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
     status_t status = dnnl_success;
     MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
             MAYBE_RUN_STACK_CHECKER(dnnl_gemm_bf16bf16f32,
                     cpu::gemm_bf16bf16f32, &transb, &transa, &N, &M, &K, &alpha,
-                    B, &ldb, A, &lda, &beta, C, &ldc));
+                    to_bf16(B), &ldb, to_bf16(A), &lda, &beta, C, &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const uint16_t *A, dim_t lda, const uint16_t *B,
+        dim_t ldb, float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f16", "f16", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_f16f16f32, gemm_f16f16f32,
+                    transa, transb, M, N, K, alpha, to_f16(A), lda, to_f16(B),
+                    ldb, beta, C, ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl::impl::status::invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::sgemm_pack_get_size(&f_identifier, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        float *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::sgemm_pack(&f_identifier, &transb, &transa, &N, &M, &K, &ldb,
+            &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const float *A, dim_t lda, const float *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    const float alpha = 1.f;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_compute, cpu::sgemm_compute,
+                    &transb, &transa, &N, &M, &K, B, &ldb, A, &lda, &beta, C,
+                    &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dim_t M, dim_t N, dim_t K, dim_t lda,
+        dim_t ldb, size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl::impl::status::invalid_arguments;
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_bf16bf16f32_pack_get_size(&f_identifier, &transb,
+            &transa, &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const uint16_t *src, uint16_t *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char f_identifier = c2f_identifier(identifier);
+    return cpu::gemm_bf16bf16f32_pack(&f_identifier, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, to_bf16(src), reinterpret_cast<bfloat16_t *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_compute(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, const uint16_t *A, dim_t lda, const uint16_t *B,
+        dim_t ldb, float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    const float alpha = 1.f;
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_bf16bf16f32_compute,
+                    cpu::gemm_bf16bf16f32_compute, &transb, &transa, &N, &M, &K,
+                    to_bf16(B), &ldb, to_bf16(A), &lda, &beta, C, &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            gemm_batch(batch_size, [&](dim_t i) {
+                return cpu::extended_sgemm(&transb, &transa, &N, &M, &K,
+                        &alpha, B + i * stride_b, &ldb, A + i * stride_a, &lda,
+                        &beta, C + i * stride_c, &ldc, nullptr, false);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, dim_t lda,
+        const float *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size > 0 && utils::any_null(A, B, C))
+        return dnnl::impl::status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            gemm_batch(batch_size, [&](dim_t i) {
+                return cpu::extended_sgemm(&transb, &transa, &N, &M, &K,
+                        &alpha, B[i], &ldb, A[i], &lda, &beta, C[i], &ldc,
+                        nullptr, false);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_batch_strided(char transa, char transb,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint16_t *A, dim_t lda,
+        dim_t stride_a, const uint16_t *B, dim_t ldb, dim_t stride_b,
+        float beta, float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            gemm_batch(batch_size, [&](dim_t i) {
+                return cpu::gemm_bf16bf16f32(&transb, &transa, &N, &M, &K,
+                        &alpha, to_bf16(B + i * stride_b), &ldb,
+                        to_bf16(A + i * stride_a), &lda, &beta,
+                        C + i * stride_c, &ldc);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_batch(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const uint16_t *const *A, dim_t lda,
+        const uint16_t *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size > 0 && utils::any_null(A, B, C))
+        return dnnl::impl::status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            gemm_batch(batch_size, [&](dim_t i) {
+                return cpu::gemm_bf16bf16f32(&transb, &transa, &N, &M, &K,
+                        &alpha, to_bf16(B[i]), &ldb, to_bf16(A[i]), &lda, &beta,
+                        C[i], &ldc);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32_batch_strided(char transa, char transb,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint16_t *A, dim_t lda,
+        dim_t stride_a, const uint16_t *B, dim_t ldb, dim_t stride_b,
+        float beta, float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f16", "f16", "f32",
+            gemm_batch(batch_size, [&](dim_t i) {
+                return gemm_f16f16f32(transa, transb, M, N, K, alpha,
+                        to_f16(A + i * stride_a), lda, to_f16(B + i * stride_b),
+                        ldb, beta, C + i * stride_c, ldc);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32_batch(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const uint16_t *const *A, dim_t lda,
+        const uint16_t *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size > 0 && utils::any_null(A, B, C))
+        return dnnl::impl::status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f16", "f16", "f32",
+            gemm_batch(batch_size, [&](dim_t i) {
+                return gemm_f16f16f32(transa, transb, M, N, K, alpha,
+                        to_f16(A[i]), lda, to_f16(B[i]), ldb, beta, C[i], ldc);
+            }));
     return status;
 #else
     return dnnl::impl::status::unimplemented;
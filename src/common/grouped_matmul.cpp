@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "grouped_matmul_pd.hpp"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_GROUPED_MATMUL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, grouped_matmul, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_GROUPED_MATMUL_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, grouped_matmul, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+namespace {
+bool is_present(const memory_desc_t *md) {
+    return md != nullptr && !types::is_zero_md(md);
+}
+
+bool is_blocked_or_any(const memory_desc_t *md) {
+    return one_of(md->format_kind, format_kind::blocked, format_kind::any)
+            && IMPLICATION(md->format_kind == format_kind::blocked,
+                    md->extra.flags == 0);
+}
+
+bool is_fp_dt(data_type_t dt) {
+    return one_of(dt, data_type::f32, data_type::bf16, data_type::f16);
+}
+
+// Checks the quantization parameters of the weights. The mask may select
+// the group, the K and the N dimensions and the groups may only split K.
+bool weights_qparams_ok(const quant_entry_t &e, dim_t K) {
+    const int full_mask = (1 << 3) - 1;
+    const int k_mask = 1 << 1;
+    const int mask = e.get_mask();
+    if ((mask & ~full_mask) != 0) return false;
+    if (e.has_default_groups()) return true;
+    const dim_t group_k = e.get_group(0);
+    const dim_t group_n = e.get_group(1);
+    return (mask & k_mask) && group_k > 0 && K % group_k == 0 && group_n == 1;
+}
+} // namespace
+
+status_t grouped_matmul_desc_init(grouped_matmul_desc_t *grouped_matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *bias_desc,
+        const memory_desc_t *dst_desc) {
+
+    VCHECK_GROUPED_MATMUL(
+            !any_null(src_desc, weights_desc, offsets_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+
+    const bool with_bias = is_present(bias_desc);
+
+    VCHECK_GROUPED_MATMUL(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_GROUPED_MATMUL(weights_desc->ndims == 3, VERBOSE_BAD_NDIMS,
+            "weights", weights_desc->ndims);
+    VCHECK_GROUPED_MATMUL(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_GROUPED_MATMUL(IMPLICATION(with_bias, bias_desc->ndims == 2),
+            VERBOSE_BAD_NDIMS, "bias", with_bias ? bias_desc->ndims : 0);
+
+    for (const auto *md : {src_desc, weights_desc, dst_desc}) {
+        VCHECK_GROUPED_MATMUL(
+                !memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_GROUPED_MATMUL(is_blocked_or_any(md), VERBOSE_UNSUPPORTED_TAG);
+    }
+    if (with_bias) {
+        VCHECK_GROUPED_MATMUL(
+                !memory_desc_wrapper(bias_desc).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_GROUPED_MATMUL(
+                is_blocked_or_any(bias_desc), VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    const dim_t ngroups = weights_desc->dims[0];
+    const dim_t M = src_desc->dims[0];
+    const dim_t K = src_desc->dims[1];
+    const dim_t N = weights_desc->dims[2];
+
+    VCHECK_GROUPED_MATMUL(weights_desc->dims[1] == K, VERBOSE_INCONSISTENT_DIM,
+            "src", 1, "weights", 1);
+    VCHECK_GROUPED_MATMUL(dst_desc->dims[0] == M, VERBOSE_INCONSISTENT_DIM,
+            "src", 0, "dst", 0);
+    VCHECK_GROUPED_MATMUL(dst_desc->dims[1] == N, VERBOSE_INCONSISTENT_DIM,
+            "weights", 2, "dst", 1);
+    VCHECK_GROUPED_MATMUL(IMPLICATION(with_bias, bias_desc->dims[0] == ngroups),
+            VERBOSE_INCONSISTENT_DIM, "bias", 0, "weights", 0);
+    VCHECK_GROUPED_MATMUL(IMPLICATION(with_bias, bias_desc->dims[1] == N),
+            VERBOSE_INCONSISTENT_DIM, "bias", 1, "weights", 2);
+
+    // The offsets are read at execution time, their layout has to be known.
+    VCHECK_GROUPED_MATMUL(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "offsets", offsets_desc->ndims);
+    VCHECK_GROUPED_MATMUL(offsets_desc->format_kind == format_kind::blocked
+                    && offsets_desc->extra.flags == 0
+                    && !memory_desc_wrapper(offsets_desc)
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_UNSUPPORTED_TAG_S, "offsets");
+    VCHECK_GROUPED_MATMUL(offsets_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "offsets");
+    VCHECK_GROUPED_MATMUL(offsets_desc->dims[0] == ngroups,
+            VERBOSE_INCONSISTENT_DIM, "offsets", 0, "weights", 0);
+
+    // Integer weights are decompressed to the floating-point data type of
+    // the source.
+    VCHECK_GROUPED_MATMUL(is_fp_dt(src_desc->data_type),
+            VERBOSE_INVALID_DATATYPE, "src");
+    VCHECK_GROUPED_MATMUL(is_fp_dt(weights_desc->data_type)
+                    || one_of(weights_desc->data_type, data_type::s8,
+                            data_type::u8, data_type::s4, data_type::u4),
+            VERBOSE_INVALID_DATATYPE, "weights");
+    VCHECK_GROUPED_MATMUL(
+            IMPLICATION(with_bias, is_fp_dt(bias_desc->data_type)),
+            VERBOSE_INVALID_DATATYPE, "bias");
+    VCHECK_GROUPED_MATMUL(is_fp_dt(dst_desc->data_type),
+            VERBOSE_INVALID_DATATYPE, "dst");
+
+    auto gd = grouped_matmul_desc_t();
+    gd.primitive_kind = primitive_kind::grouped_matmul;
+
+    gd.src_desc = *src_desc;
+    gd.weights_desc = *weights_desc;
+    gd.offsets_desc = *offsets_desc;
+    gd.bias_desc = with_bias ? *bias_desc : types::zero_md();
+    gd.dst_desc = *dst_desc;
+    gd.accum_data_type = data_type::f32;
+
+    (*grouped_matmul_desc) = gd;
+    return success;
+}
+
+status_t grouped_matmul_attr_check(
+        const grouped_matmul_desc_t &desc, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    VCHECK_GROUPED_MATMUL_UNIMPL(
+            attr->has_default_values(smask_t::scales_groups
+                    | smask_t::scales_data_type | smask_t::zero_points_groups
+                    | smask_t::zero_points_data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const dim_t K = desc.src_desc.dims[1];
+
+    // The source and the destination are scaled by a common factor, the
+    // weights scales are applied when the weights are decompressed.
+    const auto &sc = attr->scales_;
+    VCHECK_GROUPED_MATMUL_UNIMPL(
+            sc.has_default_values(
+                    {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+        if (sc.has_default_values(arg)) continue;
+        VCHECK_GROUPED_MATMUL_UNIMPL(
+                sc.get_mask(arg) == 0 && sc.get(arg).has_default_groups(),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_GROUPED_MATMUL_UNIMPL(is_fp_dt(sc.get_data_type(arg)),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+    if (!sc.has_default_values(DNNL_ARG_WEIGHTS)) {
+        VCHECK_GROUPED_MATMUL_UNIMPL(
+                weights_qparams_ok(sc.get(DNNL_ARG_WEIGHTS), K),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_GROUPED_MATMUL_UNIMPL(
+                is_fp_dt(sc.get_data_type(DNNL_ARG_WEIGHTS)),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    const auto &zp = attr->zero_points_;
+    static const std::vector<int> zp_supported_args {DNNL_ARG_WEIGHTS};
+    VCHECK_GROUPED_MATMUL_UNIMPL(zp.has_default_values(zp_supported_args),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    if (!zp.has_default_values(DNNL_ARG_WEIGHTS)) {
+        VCHECK_GROUPED_MATMUL_UNIMPL(
+                types::is_integral_dt(desc.weights_desc.data_type),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_GROUPED_MATMUL_UNIMPL(
+                weights_qparams_ok(zp.get(DNNL_ARG_WEIGHTS), K),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_GROUPED_MATMUL_UNIMPL(
+                one_of(zp.get_data_type(DNNL_ARG_WEIGHTS), data_type::s32,
+                        data_type::s8, data_type::u8, data_type::s4,
+                        data_type::u4),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_grouped_matmul_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *bias_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+
+    auto grouped_matmul_desc = grouped_matmul_desc_t();
+    CHECK(grouped_matmul_desc_init(&grouped_matmul_desc, src_desc,
+            weights_desc, offsets_desc, bias_desc, dst_desc));
+    CHECK(grouped_matmul_attr_check(grouped_matmul_desc, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&grouped_matmul_desc, nullptr, attr);
+}
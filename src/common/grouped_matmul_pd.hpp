@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GROUPED_MATMUL_PD_HPP
+#define COMMON_GROUPED_MATMUL_PD_HPP
+
+#include "c_types_map.hpp"
+#include "memory_desc.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_GROUPED_MATMUL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, grouped_matmul, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_GROUPED_MATMUL_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, grouped_matmul, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t grouped_matmul_desc_init(grouped_matmul_desc_t *grouped_matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *bias_desc,
+        const memory_desc_t *dst_desc);
+
+// NOLINTBEGIN(google-default-arguments)
+struct grouped_matmul_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::grouped_matmul;
+
+    using hint_class = grouped_matmul_pd_t;
+
+    const grouped_matmul_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_SRC_1:
+            case DNNL_ARG_WEIGHTS: return arg_usage_t::input;
+            case DNNL_ARG_BIAS:
+                return with_bias() ? arg_usage_t::input : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_SRC_1: return src_md(1, user_input);
+            case DNNL_ARG_WEIGHTS: return weights_md(0, user_input);
+            case DNNL_ARG_BIAS: return weights_md(1, user_input);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // The second source is the vector of the group offsets.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return user_input ? &desc()->src_desc : &src_md_;
+            case 1: return &desc()->offsets_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return user_input ? &desc()->weights_desc : &weights_md_;
+            case 1: return user_input ? &desc()->bias_desc : &bias_md_;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3 + with_bias(); }
+    int n_outputs() const override { return 1; }
+
+    bool with_bias() const { return !types::is_zero_md(&desc()->bias_desc); }
+
+    dim_t M() const { return desc()->src_desc.dims[0]; }
+    dim_t K() const { return desc()->src_desc.dims[1]; }
+    dim_t N() const { return desc()->weights_desc.dims[2]; }
+    dim_t ngroups() const { return desc()->weights_desc.dims[0]; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md()).has_zero_dim();
+    }
+
+protected:
+    grouped_matmul_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t weights_md_;
+    memory_desc_t bias_md_;
+    memory_desc_t dst_md_;
+
+    grouped_matmul_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<grouped_matmul_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , weights_md_(desc_.weights_desc)
+        , bias_md_(desc_.bias_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // The matrices default to the plain row-major layouts.
+    status_t set_default_params() {
+        using namespace format_tag;
+        if (src_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(src_md_, ab));
+        if (weights_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(weights_md_, abc));
+        if (with_bias() && bias_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(bias_md_, ab));
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(dst_md_, ab));
+        return status::success;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,317 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "huge_pages.hpp"
+#include "memory_debug.hpp"
+#include "utils.hpp"
+
+#if defined(__linux__) && !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace huge_pages {
+
+namespace {
+
+constexpr size_t size_2m = size_t(1) << 21;
+constexpr size_t size_1g = size_t(1) << 30;
+
+bool is_supported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+enum class backing_t { regular, transparent, explicit_huge };
+
+struct allocation_t {
+    size_t size;
+    backing_t backing;
+};
+
+// Keeps track of the buffers allocated under a policy other than `none`, so
+// that they are released the way they were allocated and the usage can be
+// reported.
+struct registry_t {
+    std::mutex mutex;
+    std::unordered_map<void *, allocation_t> allocations;
+    // The number of the allocations, read without the lock.
+    std::atomic<size_t> size {0};
+};
+
+registry_t &registry() {
+    // Never destroyed: cached buffers may be released after the static
+    // objects of the library.
+    static registry_t *r = new registry_t();
+    return *r;
+}
+
+dnnl_cpu_huge_pages_t init_policy() {
+    if (!is_supported()) return dnnl_cpu_huge_pages_none;
+
+    const std::string val = getenv_string_user("CPU_HUGE_PAGES");
+    if (val == "transparent") return dnnl_cpu_huge_pages_transparent;
+    if (val == "explicit_2m") return dnnl_cpu_huge_pages_explicit_2m;
+    if (val == "explicit_1g") return dnnl_cpu_huge_pages_explicit_1g;
+    return dnnl_cpu_huge_pages_none;
+}
+
+std::atomic<int> &policy() {
+    static std::atomic<int> p(init_policy());
+    return p;
+}
+
+#ifdef __linux__
+void *map_explicit(size_t size, size_t page_size) {
+    const int page_size_log2 = page_size == size_1g ? 30 : 21;
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+                    | (page_size_log2 << MAP_HUGE_SHIFT),
+            -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+// Maps a region aligned to the huge page size, so that the kernel may back
+// all of it with transparent huge pages.
+void *map_transparent(size_t size) {
+    const size_t mapped_size = size + size_2m;
+    void *ptr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) return nullptr;
+
+    char *base = static_cast<char *>(ptr);
+    const size_t addr = reinterpret_cast<size_t>(ptr);
+    const size_t head = utils::rnd_up(addr, size_2m) - addr;
+    const size_t tail = mapped_size - head - size;
+    if (head > 0) munmap(base, head);
+    if (tail > 0) munmap(base + head + size, tail);
+
+#ifdef MADV_HUGEPAGE
+    // The advice fails when transparent huge pages are disabled, the region
+    // is then backed by regular pages.
+    madvise(base + head, size, MADV_HUGEPAGE);
+#endif
+    return base + head;
+}
+
+// Returns how many bytes of the ranges are backed by transparent huge pages.
+// The kernel reports the usage per mapping and the mappings of neighbouring
+// buffers may be merged, so the usage of a mapping is accounted up to the size
+// of the ranges it overlaps.
+size_t get_transparent_usage(
+        const std::vector<std::pair<size_t, size_t>> &ranges) {
+    std::ifstream smaps("/proc/self/smaps");
+    if (!smaps.is_open()) return 0;
+
+    size_t usage = 0;
+    size_t map_begin = 0, map_end = 0;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        size_t begin = 0, end = 0, kb = 0;
+        if (sscanf(line.c_str(), "%zx-%zx ", &begin, &end) == 2) {
+            map_begin = begin;
+            map_end = end;
+            continue;
+        }
+        if (sscanf(line.c_str(), "AnonHugePages: %zu kB", &kb) != 1 || kb == 0)
+            continue;
+
+        size_t overlap = 0;
+        for (const auto &r : ranges) {
+            const size_t b = std::max(r.first, map_begin);
+            const size_t e = std::min(r.second, map_end);
+            if (b < e) overlap += e - b;
+        }
+        usage += std::min(overlap, kb * 1024);
+    }
+    return usage;
+}
+#endif
+
+// Tries to map a buffer backed by huge pages, returns nullptr if the buffer
+// is too small for huge pages or if they are not available.
+void *map(size_t size, dnnl_cpu_huge_pages_t p, allocation_t &allocation) {
+#ifdef __linux__
+    void *ptr = nullptr;
+    if (p == dnnl_cpu_huge_pages_transparent) {
+        if (size < size_2m) return nullptr;
+        allocation = {utils::rnd_up(size, size_2m), backing_t::transparent};
+        return map_transparent(allocation.size);
+    }
+
+    // Buffers smaller than a page use smaller pages to keep the waste below
+    // a half of the buffer.
+    if (p == dnnl_cpu_huge_pages_explicit_1g && size >= size_1g) {
+        allocation = {utils::rnd_up(size, size_1g), backing_t::explicit_huge};
+        ptr = map_explicit(allocation.size, size_1g);
+    }
+    if (ptr == nullptr && size >= size_2m) {
+        allocation = {utils::rnd_up(size, size_2m), backing_t::explicit_huge};
+        ptr = map_explicit(allocation.size, size_2m);
+    }
+    return ptr;
+#else
+    UNUSED(size);
+    UNUSED(p);
+    UNUSED(allocation);
+    return nullptr;
+#endif
+}
+
+} // namespace
+
+void *malloc(size_t size, int alignment, bool &is_tracked) {
+    is_tracked = false;
+    const auto p = get_policy();
+    if (p == dnnl_cpu_huge_pages_none || memory_debug::is_mem_debug()
+            || size == 0)
+        return impl::malloc(size, alignment);
+
+    // Mapped regions are aligned to at least a regular page.
+    assert(alignment <= 4096);
+    allocation_t allocation {size, backing_t::regular};
+    void *ptr = map(size, p, allocation);
+    if (ptr == nullptr) {
+        allocation = {size, backing_t::regular};
+        ptr = impl::malloc(size, alignment);
+        if (ptr == nullptr) return nullptr;
+    }
+
+    auto &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    r.allocations.emplace(ptr, allocation);
+    r.size = r.allocations.size();
+    is_tracked = true;
+    return ptr;
+}
+
+void free(void *p) {
+    if (p == nullptr) return;
+
+    // A tracked buffer keeps the registry non-empty until it is released.
+    auto &r = registry();
+    if (r.size == 0) {
+        impl::free(p);
+        return;
+    }
+
+    allocation_t allocation {0, backing_t::regular};
+    {
+        std::lock_guard<std::mutex> guard(r.mutex);
+        auto it = r.allocations.find(p);
+        if (it != r.allocations.end()) {
+            allocation = it->second;
+            r.allocations.erase(it);
+            r.size = r.allocations.size();
+        }
+    }
+
+#ifdef __linux__
+    if (allocation.backing != backing_t::regular) {
+        munmap(p, allocation.size);
+        return;
+    }
+#endif
+    impl::free(p);
+}
+
+dnnl_cpu_huge_pages_t get_policy() {
+    return static_cast<dnnl_cpu_huge_pages_t>(policy().load());
+}
+
+status_t set_policy(dnnl_cpu_huge_pages_t p) {
+    if (!utils::one_of(p, dnnl_cpu_huge_pages_none,
+                dnnl_cpu_huge_pages_transparent,
+                dnnl_cpu_huge_pages_explicit_2m,
+                dnnl_cpu_huge_pages_explicit_1g))
+        return status::invalid_arguments;
+    if (p != dnnl_cpu_huge_pages_none && !is_supported())
+        return status::unimplemented;
+
+    policy().store(p);
+    return status::success;
+}
+
+status_t get_usage(size_t *allocated, size_t *huge_backed) {
+    if (utils::any_null(allocated, huge_backed))
+        return status::invalid_arguments;
+
+    *allocated = 0;
+    *huge_backed = 0;
+    std::vector<std::pair<size_t, size_t>> transparent_ranges;
+    {
+        auto &r = registry();
+        std::lock_guard<std::mutex> guard(r.mutex);
+        for (const auto &a : r.allocations) {
+            const size_t size = a.second.size;
+            *allocated += size;
+            if (a.second.backing == backing_t::explicit_huge)
+                *huge_backed += size;
+            else if (a.second.backing == backing_t::transparent) {
+                const size_t addr = reinterpret_cast<size_t>(a.first);
+                transparent_ranges.emplace_back(addr, addr + size);
+            }
+        }
+    }
+
+#ifdef __linux__
+    if (!transparent_ranges.empty())
+        *huge_backed += get_transparent_usage(transparent_ranges);
+#endif
+    return status::success;
+}
+
+} // namespace huge_pages
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_cpu_huge_pages(dnnl_cpu_huge_pages_t policy) {
+    return dnnl::impl::huge_pages::set_policy(policy);
+}
+
+dnnl_cpu_huge_pages_t dnnl_get_cpu_huge_pages() {
+    return dnnl::impl::huge_pages::get_policy();
+}
+
+dnnl_status_t dnnl_get_cpu_huge_pages_usage(
+        size_t *allocated, size_t *huge_backed) {
+    return dnnl::impl::huge_pages::get_usage(allocated, huge_backed);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_HUGE_PAGES_HPP
+#define COMMON_HUGE_PAGES_HPP
+
+#include <stddef.h>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace huge_pages {
+
+// Allocates a buffer owned by the library, such as a scratchpad or a cached
+// constant tensor, following the huge pages policy. Falls back to regular
+// pages when huge pages cannot be provided. Sets `is_tracked` if the buffer is
+// registered for the usage report, which is the case for the buffers allocated
+// under a policy other than `none`. A tracked buffer must be released with
+// `huge_pages::free()`, an untracked one may be released with `impl::free()`.
+void *malloc(size_t size, int alignment, bool &is_tracked);
+
+// Releases a buffer allocated with `huge_pages::malloc()`. The registry is
+// looked up only while tracked buffers are alive.
+void free(void *p);
+
+dnnl_cpu_huge_pages_t get_policy();
+status_t set_policy(dnnl_cpu_huge_pages_t policy);
+
+// Returns the size of the live buffers allocated with `huge_pages::malloc()`
+// while a policy other than `none` was in effect and how many bytes of them
+// are backed by huge pages.
+status_t get_usage(size_t *allocated, size_t *huge_backed);
+
+} // namespace huge_pages
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -201,6 +201,34 @@
     { nullptr }
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_EMBEDDING
+#define REG_EMBEDDING_P(...) __VA_ARGS__
+#else
+#define REG_EMBEDDING_P(...) \
+    { nullptr }
+#endif
+
+#if BUILD_PRIMITIVE_ALL || BUILD_GROUPED_MATMUL
+#define REG_GROUPED_MATMUL_P(...) __VA_ARGS__
+#else
+#define REG_GROUPED_MATMUL_P(...) \
+    { nullptr }
+#endif
+
+#if BUILD_PRIMITIVE_ALL || BUILD_SOFTMAX_CROSS_ENTROPY
+#define REG_SOFTMAX_CROSS_ENTROPY_P(...) __VA_ARGS__
+#else
+#define REG_SOFTMAX_CROSS_ENTROPY_P(...) \
+    { nullptr }
+#endif
+
+#if BUILD_PRIMITIVE_ALL || BUILD_TOPK
+#define REG_TOPK_P(...) __VA_ARGS__
+#else
+#define REG_TOPK_P(...) \
+    { nullptr }
+#endif
+
 // Primitive CPU ISA section is in src/cpu/platform.hpp
 
 #if BUILD_PRIMITIVE_GPU_ISA_ALL || BUILD_XELP
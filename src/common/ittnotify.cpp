@@ -79,6 +79,10 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(topk),
+            CASE(embedding),
+            CASE(grouped_matmul),
+            CASE(softmax_cross_entropy),
             CASE(sdpa),
     };
 #undef CASE
@@ -50,7 +50,7 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     auto attr_mask = smask_t::post_ops | smask_t::sum_dt | smask_t::dropout
-            | smask_t::rounding_mode;
+            | smask_t::rounding_mode | smask_t::src_norm | smask_t::amax;
     // Matmul supports scales for floating point data types
     attr_mask |= smask_t::scales_data_type;
 
@@ -78,6 +78,12 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
 
+    // Source normalization is defined for floating-point sources only.
+    VCHECK_MATMUL_UNIMPL(IMPLICATION(!attr->src_norm_.has_default_values(),
+                                 utils::one_of(src_dt, data_type::f32,
+                                         data_type::bf16, data_type::f16)),
+            VERBOSE_UNSUPPORTED_ATTR);
+
     const int ndims_src = desc.src_desc.ndims;
     const int ndims_wei = desc.weights_desc.ndims;
     const int m_idx = ndims_src - 2;
@@ -36,7 +36,10 @@ struct exec_ctx_t;
 enum memory_flags_t {
     alloc = 0x1,
     use_runtime_ptr = 0x2,
-    prefer_device_usm = 0x4
+    prefer_device_usm = 0x4,
+    // The buffer is owned by the library, e.g. a scratchpad, and follows the
+    // CPU huge pages policy.
+    prefer_huge_pages = 0x8
 };
 } // namespace impl
 } // namespace dnnl
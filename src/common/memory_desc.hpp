@@ -38,7 +38,9 @@ enum class wino_memory_format_t {
     // Tensor of weights for 4x3 convolution.
     //
     // Internal weights format for 4x3 Winograd.
-    wino_wei_OBaaIBOIio
+    wino_wei_OBaaIBOIio,
+    // Internal weights format for 4x3 brgemm-based Winograd.
+    wino_wei_aaOio_brgemm
 };
 
 enum class rnn_packed_memory_format_t { undef, ldigo_p, ldgoi_p, ldio_p };
@@ -0,0 +1,244 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if defined __unix__ || defined __APPLE__ || defined __FreeBSD__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define DNNL_PREPACKED_MMAP 1
+#endif
+
+#include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl_version.h"
+
+#include "common/c_types_map.hpp"
+#include "common/engine.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_serialization.hpp"
+#include "common/serialization.hpp"
+#include "common/utils.hpp"
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/cpu_memory_storage.hpp"
+#endif
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// On-disk layout of a prepacked file:
+//   prepacked_header_t | serialized memory_desc_t | zero padding | data
+// The data starts at a page-aligned offset so that a mapping of the file can
+// be handed to primitives as is.
+//
+// The memory descriptor is stored with the same serialization as in the
+// primitive cache keys, so files don't depend on the layout of
+// `memory_desc_t`. The format version changes with any change of the header
+// or of that serialization.
+constexpr char prepacked_magic[8] = {'D', 'N', 'N', 'L', 'P', 'A', 'C', 'K'};
+constexpr uint32_t prepacked_format_version = 2;
+constexpr uint64_t prepacked_data_alignment = 4096;
+
+struct prepacked_header_t {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t header_size;
+    // The library version that wrote the file, for diagnostics only.
+    uint32_t version_major;
+    uint32_t version_minor;
+    uint32_t version_patch;
+    // Effective ISA at export time. Blocked weights layouts are chosen per
+    // ISA, so weights packed for another ISA would be reordered again by
+    // primitives and defeat the purpose of the file.
+    uint32_t isa;
+    uint64_t md_size;
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+prepacked_header_t make_header(size_t md_size, size_t data_size) {
+    prepacked_header_t h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, prepacked_magic, sizeof(h.magic));
+    h.format_version = prepacked_format_version;
+    h.header_size = sizeof(prepacked_header_t);
+    h.version_major = DNNL_VERSION_MAJOR;
+    h.version_minor = DNNL_VERSION_MINOR;
+    h.version_patch = DNNL_VERSION_PATCH;
+    h.isa = static_cast<uint32_t>(dnnl_get_effective_cpu_isa());
+    h.md_size = md_size;
+    h.data_offset = utils::rnd_up(
+            sizeof(prepacked_header_t) + md_size, prepacked_data_alignment);
+    h.data_size = data_size;
+    return h;
+}
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE && defined(DNNL_PREPACKED_MMAP)
+// A CPU memory storage over a private mapping of a prepacked file. Pages that
+// are only read stay shared with the page cache; a write makes a private copy
+// of the page and never reaches the file.
+class cpu_mapped_memory_storage_t : public cpu::cpu_memory_storage_t {
+public:
+    cpu_mapped_memory_storage_t(engine_t *engine, void *base, size_t size)
+        : cpu::cpu_memory_storage_t(engine), base_(base), size_(size) {}
+
+    ~cpu_mapped_memory_storage_t() override { munmap(base_, size_); }
+
+private:
+    void *base_;
+    size_t size_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_mapped_memory_storage_t);
+};
+#endif
+
+} // namespace
+
+status_t dnnl_memory_export_prepacked(
+        const memory_t *memory, const char *path) {
+    VCHECK_MEMORY(!any_null(memory, path), invalid_arguments, VERBOSE_NULL_ARG);
+    VCHECK_MEMORY(memory->engine()->kind() == engine_kind::cpu,
+            invalid_arguments, VERBOSE_BAD_ENGINE_KIND);
+    VCHECK_MEMORY(memory->get_num_handles() == 1, unimplemented,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const memory_desc_wrapper mdw(memory->md());
+    VCHECK_MEMORY(!mdw.has_runtime_dims_or_strides(), invalid_arguments,
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_MEMORY(one_of(mdw.format_kind(), format_kind::blocked,
+                          format_kind::wino, format_kind::rnn_packed,
+                          format_kind::cublaslt_blocked),
+            invalid_arguments, VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    void *handle = nullptr;
+    CHECK(memory->get_data_handle(&handle));
+    const size_t size = mdw.size();
+    VCHECK_MEMORY(handle != nullptr || size == 0, invalid_arguments,
+            VERBOSE_NULL_ARG);
+
+    serialization_stream_t md_stream;
+    serialize(md_stream, *memory->md());
+    const auto &md_data = md_stream.get_data();
+
+    const prepacked_header_t h = make_header(md_data.size(), size);
+    const std::vector<char> padding(
+            h.data_offset - sizeof(h) - md_data.size(), 0);
+
+    FILE *f = dnnl::impl::fopen(path, "wb");
+    VCHECK_MEMORY(f != nullptr, invalid_arguments, VERBOSE_BAD_PREPACKED_FILE,
+            "could not open file for writing");
+    bool ok = fwrite(&h, sizeof(h), 1, f) == 1
+            && fwrite(md_data.data(), 1, md_data.size(), f) == md_data.size()
+            && fwrite(padding.data(), 1, padding.size(), f) == padding.size()
+            && (size == 0 || fwrite(handle, size, 1, f) == 1);
+    ok = (fclose(f) == 0) && ok;
+    VCHECK_MEMORY(ok, runtime_error, VERBOSE_BAD_PREPACKED_FILE,
+            "could not write file");
+
+    return success;
+}
+
+status_t dnnl_memory_create_from_prepacked_file(
+        memory_t **memory, engine_t *engine, const char *path) {
+    VCHECK_MEMORY(!any_null(memory, engine, path), invalid_arguments,
+            VERBOSE_NULL_ARG);
+    VCHECK_MEMORY(engine->kind() == engine_kind::cpu, invalid_arguments,
+            VERBOSE_BAD_ENGINE_KIND);
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE && defined(DNNL_PREPACKED_MMAP)
+    const int fd = open(path, O_RDONLY);
+    VCHECK_MEMORY(fd >= 0, invalid_arguments, VERBOSE_BAD_PREPACKED_FILE,
+            "could not open file for reading");
+
+    struct stat st;
+    const bool stat_ok = fstat(fd, &st) == 0;
+    const size_t file_size = stat_ok ? static_cast<size_t>(st.st_size) : 0;
+    void *base = nullptr;
+    if (file_size >= sizeof(prepacked_header_t)) {
+        base = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                fd, 0);
+        if (base == MAP_FAILED) base = nullptr;
+    }
+    // The mapping keeps its own reference to the file.
+    close(fd);
+    VCHECK_MEMORY(base != nullptr, invalid_arguments,
+            VERBOSE_BAD_PREPACKED_FILE, "could not map file");
+
+    // Unmaps the file on every early exit until the storage takes ownership.
+    std::unique_ptr<void, std::function<void(void *)>> mapping(
+            base, [&](void *p) { munmap(p, file_size); });
+
+    prepacked_header_t h;
+    std::memcpy(&h, base, sizeof(h));
+    const prepacked_header_t ref = make_header(0, 0);
+    VCHECK_MEMORY(std::memcmp(h.magic, ref.magic, sizeof(h.magic)) == 0,
+            invalid_arguments, VERBOSE_BAD_PREPACKED_FILE,
+            "not a prepacked file");
+    VCHECK_MEMORY(h.format_version == ref.format_version
+                    && h.header_size == ref.header_size,
+            invalid_arguments, VERBOSE_BAD_PREPACKED_FILE,
+            "unsupported format version");
+    VCHECK_MEMORY(h.isa == ref.isa, invalid_arguments,
+            VERBOSE_BAD_PREPACKED_FILE, "isa mismatch");
+    VCHECK_MEMORY(h.md_size <= file_size - sizeof(h)
+                    && h.data_offset
+                            == utils::rnd_up(sizeof(h) + h.md_size,
+                                    prepacked_data_alignment)
+                    && h.data_offset <= file_size
+                    && h.data_size <= file_size - h.data_offset,
+            invalid_arguments, VERBOSE_BAD_PREPACKED_FILE, "truncated file");
+
+    const auto *md_ptr = static_cast<const uint8_t *>(base) + sizeof(h);
+    const auto md_stream = serialization_stream_t::from_data(
+            std::vector<uint8_t>(md_ptr, md_ptr + h.md_size));
+    deserializer_t d(md_stream);
+    memory_desc_t md;
+    VCHECK_MEMORY(deserialize(d, md) == success, invalid_arguments,
+            VERBOSE_BAD_PREPACKED_FILE, "bad memory descriptor");
+    const memory_desc_wrapper mdw(&md);
+    VCHECK_MEMORY(!mdw.format_any() && !mdw.has_runtime_dims_or_strides()
+                    && mdw.size() == h.data_size,
+            invalid_arguments, VERBOSE_BAD_PREPACKED_FILE,
+            "inconsistent memory descriptor");
+
+    auto storage = utils::make_unique<cpu_mapped_memory_storage_t>(
+            engine, base, file_size);
+    if (!storage) return out_of_memory;
+    mapping.release();
+    void *data = static_cast<char *>(base) + h.data_offset;
+    CHECK(storage->init(memory_flags_t::use_runtime_ptr, h.data_size, data));
+
+    auto _memory = new memory_t(engine, &md, std::move(storage));
+    if (_memory == nullptr) return out_of_memory;
+    *memory = _memory;
+    return success;
+#else
+    VERROR(common, memory, VERBOSE_BAD_PREPACKED_FILE,
+            "file mapping is not supported on this platform");
+    return unimplemented;
+#endif
+}
@@ -213,6 +213,7 @@ enum {
     key_conv_permuted_weights,
     key_conv_rtus_space,
     key_conv_store_wsp,
+    key_conv_streaming_src,
     key_conv_tails,
     key_conv_tr_diff_dst,
     key_conv_tr_diff_dst_bctx,
@@ -231,6 +232,7 @@ enum {
     key_deconv_zp,
     key_eltwise_diff_dst,
     key_eltwise_src,
+    key_embedding_acc,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
     key_gemm_asm_tmp_buffer,
@@ -252,6 +254,8 @@ enum {
     key_gnorm_reduction,
     key_gnorm_tmp_mean,
     key_gnorm_tmp_var,
+    key_grouped_matmul_tiles,
+    key_grouped_matmul_wsp,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -272,6 +276,8 @@ enum {
     key_matmul_dst_trans,
     key_matmul_dst_cast_acc,
     key_matmul_sparse_tmp_ptr,
+    key_matmul_src_norm_stats,
+    key_matmul_dst_amax,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -321,6 +327,8 @@ enum {
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_indices,
+    key_topk_values,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -501,6 +501,77 @@ struct reduction_desc_t : public op_desc_t {
     float eps {};
 };
 
+// A descriptor of top-k operation.
+struct topk_desc_t : public op_desc_t {
+    topk_desc_t() : op_desc_t(primitive_kind::topk) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(topk_desc_t);
+
+    // The kind of top-k algorithm. Possible values: #dnnl_topk_max and
+    // #dnnl_topk_sample.
+    alg_kind_t alg_kind {};
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // The axis along which the values are selected.
+    int axis {};
+    // The number of the largest values selected along the axis.
+    dim_t k {};
+};
+
+// A descriptor of an embedding operation.
+struct embedding_desc_t : public op_desc_t {
+    embedding_desc_t() : op_desc_t(primitive_kind::embedding) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(embedding_desc_t);
+
+    // The kind of embedding algorithm. Possible values:
+    // #dnnl_embedding_gather, #dnnl_embedding_bag_sum and
+    // #dnnl_embedding_bag_mean.
+    alg_kind_t alg_kind {};
+    // Table memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Bag offsets memory descriptor, a zero memory descriptor for
+    // #dnnl_embedding_gather.
+    memory_desc_t offsets_desc;
+    // Per-sample weights memory descriptor, a zero memory descriptor when
+    // the rows are not weighted.
+    memory_desc_t weights_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a grouped matrix multiplication operation.
+//
+// The source rows of a group are contiguous, the groups are delimited at
+// execution time by the offsets, and each group is multiplied by its own
+// matrix of the weights:
+//   dst[m, :] = src[m, :] * weights[g, :, :] (+ bias[g, :]),
+//   offsets[g - 1] <= m < offsets[g].
+struct grouped_matmul_desc_t : public op_desc_t {
+    grouped_matmul_desc_t() : op_desc_t(primitive_kind::grouped_matmul) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(grouped_matmul_desc_t);
+
+    // Source memory descriptor, a {M, K} matrix.
+    memory_desc_t src_desc;
+    // Weights memory descriptor, a {G, K, N} stack of matrices.
+    memory_desc_t weights_desc;
+    // Group offsets memory descriptor, a {G} vector.
+    memory_desc_t offsets_desc;
+    // Bias memory descriptor, a {G, N} matrix or a zero memory descriptor.
+    memory_desc_t bias_desc;
+    // Destination memory descriptor, a {M, N} matrix.
+    memory_desc_t dst_desc;
+    // The accumulator data type.
+    data_type_t accum_data_type {};
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t : public op_desc_t {
     softmax_desc_t() : op_desc_t(primitive_kind::softmax) {}
@@ -525,6 +596,38 @@ struct softmax_desc_t : public op_desc_t {
     memory_desc_t diff_dst_desc;
 };
 
+// A descriptor of a softmax cross-entropy loss operation.
+//
+// For every sample `n` of the {N, C} logits with the label `l`:
+//   p[n, c] = softmax(src[n, :])[c],
+//   t[n, c] = (1 - label_smoothing) * (c == l) + label_smoothing / C,
+//   dst[n] = -sum_c t[n, c] * log(p[n, c]),
+//   diff_src[n, c] = p[n, c] - t[n, c] (forward training only).
+// The samples labeled with the ignore index have zero loss and gradient.
+struct softmax_cross_entropy_desc_t : public op_desc_t {
+    softmax_cross_entropy_desc_t()
+        : op_desc_t(primitive_kind::softmax_cross_entropy) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(softmax_cross_entropy_desc_t);
+
+    // The kind of propagation. Possible values: #dnnl_forward_training and
+    // #dnnl_forward_inference.
+    prop_kind_t prop_kind {};
+    // Logits memory descriptor, a {N, C} matrix.
+    memory_desc_t src_desc;
+    // Labels memory descriptor, a {N} vector.
+    memory_desc_t labels_desc;
+    // Loss memory descriptor, a {N} vector.
+    memory_desc_t dst_desc;
+    // Logits gradient memory descriptor, a {N, C} matrix for the forward
+    // training or a zero memory descriptor.
+    memory_desc_t diff_src_desc;
+    // The amount of the target probability spread over all the classes.
+    float label_smoothing {};
+    // The label of the samples excluded from the loss.
+    dim_t ignore_index {};
+};
+
 // A descriptor of a binary operation.
 struct binary_desc_t : public op_desc_t {
     binary_desc_t() : op_desc_t(primitive_kind::binary) {}
@@ -122,6 +122,9 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & smask_t::dropout), dropout_.has_default_values()));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::rounding_mode),
             rounding_mode_.has_default_values()));
+    CHECK_MASK(smask_t::src_norm, src_norm_);
+    CHECK_MASK(smask_t::amax, amax_);
+    CHECK_MASK(smask_t::streaming, streaming_);
     CHECK_ARG(this->defined(smask_t::none));
     bool fpmath_mode_ok = IMPLICATION(
             (bool)(~mask & smask_t::fpmath_mode) && fpmath_.apply_to_int_,
@@ -410,6 +413,28 @@ status_t primitive_attr_t::set_dropout(const memory_desc_t *user_dropout_desc) {
     return success;
 }
 
+status_t primitive_attr_t::set_src_norm(float epsilon, unsigned flags) {
+    using namespace normalization_flags;
+    const unsigned supported
+            = use_global_stats | use_scale | use_shift | rms_norm;
+    VCONDCHECK(primitive, create, check, attr, (flags & ~supported) == 0,
+            invalid_arguments, VERBOSE_BAD_FLAGS);
+    VCONDCHECK(primitive, create, check, attr, epsilon >= 0.f,
+            invalid_arguments, VERBOSE_BAD_PARAM, "epsilon");
+    src_norm_.enabled_ = true;
+    src_norm_.flags_ = flags;
+    src_norm_.epsilon_ = epsilon;
+    return success;
+}
+
+status_t primitive_attr_t::set_amax(int arg) {
+    VCHECK_ATTR(utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_DST),
+            VERBOSE_BAD_PARAM, "arg");
+    if (arg == DNNL_ARG_SRC) amax_.src_ = true;
+    if (arg == DNNL_ARG_DST) amax_.dst_ = true;
+    return success;
+}
+
 status_t primitive_attr_t::set_fpmath_mode(
         fpmath_mode_t fpmath_mode, bool apply_to_int) {
     auto st = check_fpmath_mode(fpmath_mode);
@@ -496,6 +521,46 @@ status_t dnnl_primitive_attr_set_dropout(
     return attr->set_dropout(user_dropout_desc);
 }
 
+status_t dnnl_primitive_attr_get_src_normalization(
+        const primitive_attr_t *attr, float *epsilon, unsigned *flags) {
+    if (any_null(attr)) return invalid_arguments;
+    if (attr->src_norm_.has_default_values()) return invalid_arguments;
+    if (epsilon) *epsilon = attr->src_norm_.epsilon_;
+    if (flags) *flags = attr->src_norm_.flags_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_normalization(
+        primitive_attr_t *attr, float epsilon, unsigned flags) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_src_norm(epsilon, flags);
+}
+
+status_t dnnl_primitive_attr_get_amax(
+        const primitive_attr_t *attr, int arg, int *enabled) {
+    if (any_null(attr, enabled)) return invalid_arguments;
+    *enabled = attr->amax_.has(arg);
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_amax(primitive_attr_t *attr, int arg) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_amax(arg);
+}
+
+status_t dnnl_primitive_attr_get_streaming(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+    *value = attr->streaming_.enabled_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_streaming(primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->streaming_.enabled_ = value;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_fpmath_mode(
         const primitive_attr_t *attr, fpmath_mode_t *mode) {
     if (any_null(attr, mode)) return invalid_arguments;
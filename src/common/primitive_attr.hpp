@@ -198,6 +198,65 @@ struct dropout_t : public c_compatible {
     dnnl::impl::memory_desc_t user_dropout_desc_;
 };
 
+// Normalization of the source rows applied before the primitive consumes
+// them: src = (src - mean) / sqrt(variance + epsilon) * scale + shift, where
+// the statistics are computed over the innermost dimension. Flags follow the
+// semantics of the layer normalization primitive.
+struct src_norm_t : public c_compatible {
+    src_norm_t() = default;
+
+    bool has_default_values() const { return !enabled_; }
+    bool operator==(const src_norm_t &rhs) const {
+        return enabled_ == rhs.enabled_ && flags_ == rhs.flags_
+                && epsilon_ == rhs.epsilon_;
+    }
+
+    bool use_global_stats() const {
+        return flags_ & normalization_flags::use_global_stats;
+    }
+    bool use_scale() const { return flags_ & normalization_flags::use_scale; }
+    bool use_shift() const { return flags_ & normalization_flags::use_shift; }
+    bool rms_norm() const { return flags_ & normalization_flags::rms_norm; }
+
+    bool enabled_ = false;
+    unsigned flags_ = 0;
+    float epsilon_ = 0.f;
+};
+
+// Absolute maximum of the source or of the destination of the primitive,
+// written to a single f32 value during the execution. The destination values
+// are taken before the destination scales and the conversion to the
+// destination data type.
+struct amax_t : public c_compatible {
+    amax_t() = default;
+
+    bool has_default_values() const { return !src_ && !dst_; }
+    bool has(int arg) const {
+        if (arg == DNNL_ARG_SRC) return src_;
+        if (arg == DNNL_ARG_DST) return dst_;
+        return false;
+    }
+    bool operator==(const amax_t &rhs) const {
+        return src_ == rhs.src_ && dst_ == rhs.dst_;
+    }
+
+    bool src_ = false;
+    bool dst_ = false;
+};
+
+// Streaming mode of a causal convolution: the left padding is taken from a
+// state holding the last input frames of the previous calls.
+struct streaming_t : public c_compatible {
+    streaming_t() = default;
+
+    bool has_default_values() const { return !enabled_; }
+    bool operator==(const streaming_t &rhs) const {
+        return enabled_ == rhs.enabled_;
+    }
+
+    bool enabled_ = false;
+};
+
 struct rnd_mode_t : public c_compatible {
     rnd_mode_t() = default;
 
@@ -567,6 +626,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         CHECK(rnn_tparams_.copy_from(other.rnn_tparams_));
         if (other.gpu_attr_) gpu_attr_ = other.gpu_attr_->clone();
         dropout_ = other.dropout_;
+        src_norm_ = other.src_norm_;
+        amax_ = other.amax_;
+        streaming_ = other.streaming_;
 
         return status::success;
     }
@@ -592,6 +654,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_mode = 1u << 15,
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
+        src_norm = 1u << 18,
+        amax = 1u << 19,
+        streaming = 1u << 20,
     };
 
     /** Returns true if the attributes have default values.
@@ -618,7 +683,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                             && gpu_attr_->is_equal(*rhs.gpu_attr_))
                         || (!gpu_attr_ && !rhs.gpu_attr_))
                 && dropout_ == rhs.dropout_
-                && rounding_mode_ == rhs.rounding_mode_;
+                && rounding_mode_ == rhs.rounding_mode_
+                && src_norm_ == rhs.src_norm_ && amax_ == rhs.amax_
+                && streaming_ == rhs.streaming_;
         return ret;
     }
 
@@ -628,6 +695,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             dnnl::impl::accumulation_mode_t am);
     dnnl::impl::status_t set_dropout(
             const dnnl::impl::memory_desc_t *dropout_desc);
+    dnnl::impl::status_t set_src_norm(float epsilon, unsigned flags);
+    dnnl::impl::status_t set_amax(int arg);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
@@ -694,6 +763,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::rnn_tparams_t rnn_tparams_;
     dnnl::impl::dropout_t dropout_;
     dnnl::impl::rnd_mode_t rounding_mode_;
+    dnnl::impl::src_norm_t src_norm_;
+    dnnl::impl::amax_t amax_;
+    dnnl::impl::streaming_t streaming_;
 
     std::unique_ptr<dnnl::impl::primitive_attr_item_t> gpu_attr_;
 
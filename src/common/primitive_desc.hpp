@@ -184,6 +184,28 @@ struct primitive_desc_t : public c_compatible {
             return !attr()->rounding_mode_.has_default_values()
                     ? arg_usage_t::input
                     : arg_usage_t::unused;
+        if (utils::one_of(arg, DNNL_ARG_ATTR_SRC_NORM_MEAN,
+                    DNNL_ARG_ATTR_SRC_NORM_VARIANCE,
+                    DNNL_ARG_ATTR_SRC_NORM_SCALE,
+                    DNNL_ARG_ATTR_SRC_NORM_SHIFT)) {
+            const auto &sn = attr()->src_norm_;
+            bool used = !sn.has_default_values();
+            if (arg == DNNL_ARG_ATTR_SRC_NORM_MEAN)
+                used = used && sn.use_global_stats() && !sn.rms_norm();
+            if (arg == DNNL_ARG_ATTR_SRC_NORM_VARIANCE)
+                used = used && sn.use_global_stats();
+            if (arg == DNNL_ARG_ATTR_SRC_NORM_SCALE)
+                used = used && sn.use_scale();
+            if (arg == DNNL_ARG_ATTR_SRC_NORM_SHIFT)
+                used = used && sn.use_shift();
+            return used ? arg_usage_t::input : arg_usage_t::unused;
+        }
+        if (arg == DNNL_ARG_ATTR_SRC_AMAX)
+            return attr()->amax_.has(DNNL_ARG_SRC) ? arg_usage_t::output
+                                                   : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_DST_AMAX)
+            return attr()->amax_.has(DNNL_ARG_DST) ? arg_usage_t::output
+                                                   : arg_usage_t::unused;
 
         for (int idx = 0; idx < attr()->post_ops_.len(); ++idx) {
             using namespace primitive_kind;
@@ -232,10 +254,27 @@ struct primitive_desc_t : public c_compatible {
             case DNNL_ARG_SCRATCHPAD: return scratchpad_md(0);
             case DNNL_ARG_ATTR_DROPOUT_MASK:
                 return &attr()->dropout_.dropout_desc_;
+            case DNNL_ARG_ATTR_SRC_AMAX:
+                return attr()->amax_.has(DNNL_ARG_SRC) ? &amax_md()
+                                                       : &glob_zero_md;
+            case DNNL_ARG_ATTR_DST_AMAX:
+                return attr()->amax_.has(DNNL_ARG_DST) ? &amax_md()
+                                                       : &glob_zero_md;
             default: return &glob_zero_md;
         }
     }
 
+    // The single f32 value an amax attribute writes.
+    static const memory_desc_t &amax_md() {
+        static const memory_desc_t md = []() {
+            memory_desc_t md {};
+            const dims_t dims = {1};
+            memory_desc_init_by_tag(md, 1, dims, data_type::f32, format_tag::a);
+            return md;
+        }();
+        return md;
+    }
+
     virtual const memory_desc_t *invariant_src_md(
             int index = 0, bool user_input = false) const {
         return get_prop_kind() == prop_kind::backward_data ? diff_src_md(index)
@@ -64,13 +64,20 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                                         | DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
                         || (arg == DNNL_ARG_ATTR_DROPOUT_PROBABILITY)
                         || (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
-                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED);
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
+                        || utils::one_of(arg, DNNL_ARG_ATTR_SRC_NORM_MEAN,
+                                DNNL_ARG_ATTR_SRC_NORM_VARIANCE,
+                                DNNL_ARG_ATTR_SRC_NORM_SCALE,
+                                DNNL_ARG_ATTR_SRC_NORM_SHIFT);
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
                 n_outputs++;
                 extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
-                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK);
+                        || (arg == DNNL_ARG_ATTR_DROPOUT_MASK)
+                        || utils::one_of(arg, DNNL_ARG_ATTR_SRC_AMAX,
+                                DNNL_ARG_ATTR_DST_AMAX,
+                                DNNL_ARG_ATTR_STREAMING_STATE);
                 break;
             case primitive_desc_t::arg_usage_t::unused:
                 VINFO(primitive, exec, check, primitive,
@@ -83,8 +83,10 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding)
             CASE(gemm)
             CASE(group_normalization)
+            CASE(grouped_matmul)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -98,7 +100,9 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
+            CASE(softmax_cross_entropy)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -307,6 +311,15 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = hash_combine(
                 seed, get_md_hash(attr.dropout_.user_dropout_desc_));
     }
+    if (!attr.src_norm_.has_default_values()) {
+        seed = hash_combine(seed, attr.src_norm_.flags_);
+        seed = hash_combine(seed, float2int(attr.src_norm_.epsilon_));
+    }
+    if (!attr.amax_.has_default_values()) {
+        seed = hash_combine(seed, attr.amax_.src_);
+        seed = hash_combine(seed, attr.amax_.dst_);
+    }
+    seed = hash_combine(seed, attr.streaming_.enabled_);
     // Combined hash for attributes
     return seed;
 }
@@ -423,6 +436,21 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -462,6 +490,22 @@ size_t get_desc_hash(const group_normalization_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const grouped_matmul_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.bias_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Accumulator type
+    seed = hash_combine(seed, static_cast<size_t>(desc.accum_data_type));
+    // Combined hash for grouped_matmul desc
+    return seed;
+}
+
 size_t get_desc_hash(const inner_product_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -703,6 +747,23 @@ size_t get_desc_hash(const softmax_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const softmax_cross_entropy_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.labels_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_src_desc));
+    // Loss parameters
+    seed = hash_combine(seed, desc.label_smoothing);
+    seed = hash_combine(seed, desc.ignore_index);
+    // Combined hash for softmax_cross_entropy desc
+    return seed;
+}
+
 size_t get_desc_hash(const sum_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -719,6 +780,22 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis, k
+    seed = hash_combine(seed, desc.axis);
+    seed = hash_combine(seed, desc.k);
+    // Combined hash for topk desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
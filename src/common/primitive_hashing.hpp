@@ -73,8 +73,10 @@ size_t get_desc_hash(const batch_normalization_desc_t &desc);
 size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
+size_t get_desc_hash(const embedding_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
 size_t get_desc_hash(const group_normalization_desc_t &desc);
+size_t get_desc_hash(const grouped_matmul_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
 size_t get_desc_hash(const layer_normalization_desc_t &desc);
 size_t get_desc_hash(const lrn_desc_t &desc);
@@ -88,7 +90,9 @@ size_t get_desc_hash(const rnn_desc_t &desc);
 size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
+size_t get_desc_hash(const softmax_cross_entropy_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const topk_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
 template <typename T>
@@ -170,8 +174,10 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding)
             CASE(gemm)
             CASE(group_normalization)
+            CASE(grouped_matmul)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -185,7 +191,9 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
+            CASE(softmax_cross_entropy)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive_kind");
         }
@@ -24,6 +24,8 @@
 #endif
 
 #include "cache_hit_types.hpp"
+#include "dnnl_thread.hpp"
+#include "memory.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
@@ -33,6 +35,8 @@
 #include "scratchpad_debug.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
+#include "stream_capture.hpp"
+#include "telemetry.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -54,6 +58,24 @@ void unpoison_outputs(const exec_args_t &args) {
         msan_unpoison(p, s);
     }
 }
+
+void record_telemetry(const primitive_iface_t *primitive_iface,
+        const exec_ctx_t &ctx, uint64_t start_ns) {
+    dnnl_telemetry_record_t r;
+    r.end_ns = telemetry::get_nsec();
+    r.start_ns = start_ns;
+    r.primitive_id = primitive_iface->telemetry_id();
+    r.primitive_kind = primitive_iface->pd()->impl()->kind();
+    r.impl_name_index = primitive_iface->impl_name_index();
+    r.nthr = primitive_iface->engine()->kind() == engine_kind::cpu
+            ? dnnl_get_current_num_threads()
+            : 0;
+    r.bytes = 0;
+    for (const auto &arg : ctx.args())
+        if (arg.second.mem)
+            r.bytes += memory_desc_wrapper(arg.second.mem->md()).size();
+    telemetry::record(r);
+}
 } // namespace
 
 namespace dnnl {
@@ -127,6 +149,12 @@ status_t primitive_execute(
             VPROF(start_ms, primitive, exec, VERBOSE_profile,
                     primitive_iface->pd()->info(), duration_ms);
         }
+    } else if (telemetry::is_enabled()) {
+        // The execution is not waited for, the record of an asynchronous
+        // stream covers the submission only.
+        const uint64_t start_ns = telemetry::get_nsec();
+        status = stream->enqueue_primitive(primitive_iface, ctx);
+        record_telemetry(primitive_iface, ctx, start_ns);
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
@@ -191,6 +219,11 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             && IMPLICATION(nargs > 0, c_args != nullptr);
     if (!ok) return invalid_arguments;
 
+    if (stream->capture())
+        return stream->capture()->record(
+                const_cast<primitive_iface_t *>(primitive_iface), nargs,
+                c_args);
+
     exec_args_t args;
     status_t status = cvt_primitive_args(
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
@@ -224,6 +257,13 @@ status_t dnnl_primitive_get_primitive_desc(
     return safe_ptr_assign(*primitive_desc_iface, primitive_iface->pd());
 }
 
+status_t dnnl_primitive_get_telemetry_id(
+        const primitive_iface_t *primitive_iface, uint64_t *id) {
+    if (utils::any_null(primitive_iface, id)) return invalid_arguments;
+    *id = primitive_iface->telemetry_id();
+    return success;
+}
+
 status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
         size_t *size, uint8_t *cache_blob) {
     if (utils::any_null(primitive_iface, size)) {
@@ -260,7 +300,10 @@ dnnl_primitive::dnnl_primitive(
     : counter_(1)
     , primitive_(primitive)
     , pd_(utils::make_unique<primitive_desc_iface_t>(
-              primitive_->pd(), engine)) {}
+              primitive_->pd(), engine))
+    , telemetry_id_(telemetry::get_primitive_id())
+    , impl_name_index_(
+              telemetry::get_impl_name_index(primitive_->pd()->name())) {}
 
 // reorder specialization
 dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_t> &primitive,
@@ -268,7 +311,10 @@ dnnl_primitive::dnnl_primitive(const std::shared_ptr<primitive_t> &primitive,
     : counter_(1)
     , primitive_(primitive)
     , pd_(utils::make_unique<reorder_primitive_desc_iface_t>(
-              primitive_->pd(), engine, src_engine, dst_engine)) {}
+              primitive_->pd(), engine, src_engine, dst_engine))
+    , telemetry_id_(telemetry::get_primitive_id())
+    , impl_name_index_(
+              telemetry::get_impl_name_index(primitive_->pd()->name())) {}
 
 dnnl_primitive::~dnnl_primitive() {
     if (scratchpad_debug::is_protect_scratchpad() && scratchpad_ != nullptr
@@ -284,7 +330,8 @@ status_t dnnl_primitive::init() {
     const size_t scratchpad_size
             = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
 
-    if (scratchpad_size) {
+    // A pooled scratchpad is taken for every execution.
+    if (scratchpad_size && !use_scratchpad_pool(pd_->engine())) {
         const memory_tracking::registry_t &registry
                 = primitive_->pd()->scratchpad_registry();
         bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
@@ -318,12 +365,24 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     const memory_storage_t *mem_storage = nullptr;
+    std::unique_ptr<scratchpad_t> pooled_scratchpad;
     if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
     } else if (scratchpad_) {
         mem_storage = scratchpad_->get_memory_storage();
+    } else {
+        const size_t scratchpad_size
+                = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
+        if (scratchpad_size) {
+            pooled_scratchpad.reset(
+                    create_pooled_scratchpad(engine(), scratchpad_size));
+            if (!pooled_scratchpad
+                    || !pooled_scratchpad->get_memory_storage())
+                return out_of_memory;
+            mem_storage = pooled_scratchpad->get_memory_storage();
+        }
     }
 
     auto scratchpad_grantor
@@ -336,6 +395,13 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     return status;
 }
 
+status_t dnnl_primitive::execute_prepared(const exec_ctx_t &ctx) const {
+    assert(ctx.grantor_handle() && ctx.get_resource_mapper());
+    const status_t status = primitive_->execute(ctx);
+    if (msan_enabled) unpoison_outputs(ctx.args());
+    return status;
+}
+
 status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
     return primitive_->get_cache_blob_size(engine(), size);
 }
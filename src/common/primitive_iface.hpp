@@ -65,6 +65,15 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Executes the primitive with a context that already has a scratchpad
+    // grantor and a resource mapper set, see dnnl_bound_primitive.
+    dnnl::impl::status_t execute_prepared(
+            const dnnl::impl::exec_ctx_t &ctx) const;
+    const dnnl::impl::resource_mapper_t *resource_mapper() const {
+        return &resource_mapper_;
+    }
+    uint64_t telemetry_id() const { return telemetry_id_; }
+    uint32_t impl_name_index() const { return impl_name_index_; }
 
     void retain() { counter_++; }
 
@@ -81,6 +90,8 @@ private:
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    const uint64_t telemetry_id_;
+    const uint32_t impl_name_index_;
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
@@ -35,8 +35,10 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding)
         CASE(gemm)
         CASE(group_normalization)
+        CASE(grouped_matmul)
         CASE(inner_product)
         CASE(layer_normalization)
         CASE(lrn)
@@ -50,7 +52,9 @@ status_t serialize_desc(
         CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
+        CASE(softmax_cross_entropy)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -141,6 +145,114 @@ void serialize(serialization_stream_t &sstream, const memory_desc_t &md) {
     }
 }
 
+namespace {
+
+// Pops an array written by `append_array()` with `size` elements.
+template <typename T>
+bool pop_array(deserializer_t &d, size_t size, T *ptr) {
+    size_t stored_size = 0;
+    d.pop(stored_size);
+    if (stored_size != size) return false;
+    for (size_t i = 0; i < size; i++)
+        d.pop(ptr[i]);
+    return true;
+}
+
+} // namespace
+
+status_t deserialize(deserializer_t &d, memory_desc_t &md) {
+    md = memory_desc_t();
+    d.pop(md.ndims);
+    if (md.ndims < 0 || md.ndims > DNNL_MAX_NDIMS)
+        return status::invalid_arguments;
+    const size_t ndims = md.ndims;
+
+    bool ok = pop_array(d, ndims, md.dims);
+    d.pop(md.data_type);
+    ok = ok && pop_array(d, ndims, md.padded_dims)
+            && pop_array(d, ndims, md.padded_offsets);
+    if (!ok) return status::invalid_arguments;
+    d.pop(md.offset0);
+    d.pop(md.format_kind);
+    // format desc
+    switch ((int)md.format_kind) {
+        case format_kind::blocked: {
+            auto &blk = md.format_desc.blocking;
+            if (!pop_array(d, ndims, blk.strides))
+                return status::invalid_arguments;
+            d.pop(blk.inner_nblks);
+            if (blk.inner_nblks < 0 || blk.inner_nblks > DNNL_MAX_NDIMS)
+                return status::invalid_arguments;
+            ok = pop_array(d, blk.inner_nblks, blk.inner_blks)
+                    && pop_array(d, blk.inner_nblks, blk.inner_idxs);
+            if (!ok) return status::invalid_arguments;
+            break;
+        }
+        case format_kind::wino:
+            d.pop(md.format_desc.wino_desc.wino_format);
+            d.pop(md.format_desc.wino_desc.r);
+            d.pop(md.format_desc.wino_desc.alpha);
+            d.pop(md.format_desc.wino_desc.ic);
+            d.pop(md.format_desc.wino_desc.oc);
+            d.pop(md.format_desc.wino_desc.ic_block);
+            d.pop(md.format_desc.wino_desc.oc_block);
+            d.pop(md.format_desc.wino_desc.ic2_block);
+            d.pop(md.format_desc.wino_desc.oc2_block);
+            d.pop(md.format_desc.wino_desc.adj_scale);
+            d.pop(md.format_desc.wino_desc.size);
+            break;
+        case format_kind::cublaslt_blocked:
+            d.pop(md.format_desc.cublaslt_blocked_desc.cublaslt_format);
+            d.pop(md.format_desc.cublaslt_blocked_desc.size);
+            break;
+        case format_kind::rnn_packed: {
+            auto &rnn = md.format_desc.rnn_packed_desc;
+            d.pop(rnn.format);
+            d.pop(rnn.n_parts);
+            d.pop(rnn.n);
+            d.pop(rnn.ldb);
+            if (rnn.n_parts < 0 || rnn.n_parts > rnn_packed_desc_t::max_n_parts)
+                return status::invalid_arguments;
+            const size_t n_parts = rnn.n_parts;
+            ok = pop_array(d, n_parts, rnn.parts)
+                    && pop_array(d, n_parts, rnn.part_pack_size)
+                    && pop_array(d, n_parts, rnn.pack_part);
+            if (!ok) return status::invalid_arguments;
+            d.pop(rnn.offset_compensation);
+            d.pop(rnn.size);
+            break;
+        }
+        // The sparse descriptors aren't serialized.
+        default: return status::invalid_arguments;
+    }
+
+    if (d.empty()) return status::success;
+
+    d.pop(md.extra.flags);
+    if (md.extra.flags
+            & (dnnl_memory_extra_flag_compensation_conv_s8s8
+                    | dnnl_memory_extra_flag_rnn_u8s8_compensation)) {
+        d.pop(md.extra.compensation_mask);
+    }
+    if (md.extra.flags & dnnl_memory_extra_flag_scale_adjust) {
+        d.pop(md.extra.scale_adjust);
+    }
+    if (md.extra.flags
+            & dnnl_memory_extra_flag_compensation_conv_asymmetric_src) {
+        d.pop(md.extra.asymm_compensation_mask);
+    }
+    if (md.extra.flags
+            & dnnl_memory_extra_flag_compensation_gpu_conv_asymmetric_src) {
+        ok = pop_array(d, 3, md.extra.idhw) && pop_array(d, 3, md.extra.odhw)
+                && pop_array(d, 3, md.extra.pdhw)
+                && pop_array(d, 3, md.extra.ddhw);
+        if (!ok) return status::invalid_arguments;
+        d.pop(md.extra.dst_size);
+    }
+
+    return d.empty() ? status::success : status::invalid_arguments;
+}
+
 void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops) {
     // post_ops: entry[:]
     for (int i = 0; i < post_ops.len(); i++) {
@@ -210,6 +322,21 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
         serialize(sstream, attr.dropout_.user_dropout_desc_);
     }
 
+    if (!attr.src_norm_.has_default_values()) {
+        sstream.append('n');
+        sstream.append(attr.src_norm_.flags_);
+        sstream.append(attr.src_norm_.epsilon_);
+    }
+
+    if (!attr.amax_.has_default_values()) {
+        sstream.append('a');
+        sstream.append(attr.amax_.src_);
+        sstream.append(attr.amax_.dst_);
+    }
+
+    // streaming
+    sstream.append(attr.streaming_.enabled_);
+
     serialize(sstream, attr.post_ops_);
 
     // rnn_data_qparams: scale, shift
@@ -319,6 +446,18 @@ void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc) {
     sstream.append(desc.beta);
 }
 
+void serialize(serialization_stream_t &sstream, const embedding_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -353,6 +492,20 @@ void serialize(serialization_stream_t &sstream,
     sstream.append(desc.flags);
 }
 
+void serialize(
+        serialization_stream_t &sstream, const grouped_matmul_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.bias_desc);
+    serialize(sstream, desc.dst_desc);
+    // Accumulator type
+    sstream.append(desc.accum_data_type);
+}
+
 void serialize(
         serialization_stream_t &sstream, const inner_product_desc_t &desc) {
     // Kinds
@@ -557,6 +710,21 @@ void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc) {
     sstream.append(desc.softmax_axis);
 }
 
+void serialize(serialization_stream_t &sstream,
+        const softmax_cross_entropy_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.prop_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.labels_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.diff_src_desc);
+    // Loss parameters
+    sstream.append(desc.label_smoothing);
+    sstream.append(desc.ignore_index);
+}
+
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
     // Kinds
     sstream.append(desc.primitive_kind);
@@ -571,6 +739,19 @@ void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.indices_desc);
+    // Axis, k
+    sstream.append(desc.axis);
+    sstream.append(desc.k);
+}
+
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -34,9 +34,12 @@ void serialize(serialization_stream_t &sstream,
 void serialize(serialization_stream_t &sstream, const binary_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const convolution_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const embedding_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc);
 void serialize(serialization_stream_t &sstream,
         const group_normalization_desc_t &desc);
+void serialize(
+        serialization_stream_t &sstream, const grouped_matmul_desc_t &desc);
 void serialize(
         serialization_stream_t &sstream, const inner_product_desc_t &desc);
 void serialize(serialization_stream_t &sstream,
@@ -52,11 +55,20 @@ void serialize(serialization_stream_t &sstream, const rnn_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc);
+void serialize(serialization_stream_t &sstream,
+        const softmax_cross_entropy_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sum_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc);
 
 status_t serialize_desc(
         serialization_stream_t &sstream, const op_desc_t *op_desc);
 
+// Restores a memory descriptor written by `serialize()`. The extra info is
+// optional in the stream, so the descriptor must be the last object of it.
+// Returns `invalid_arguments` for streams that don't describe a valid
+// descriptor.
+status_t deserialize(deserializer_t &d, memory_desc_t &md);
+
 } // namespace impl
 } // namespace dnnl
 
@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <memory>
 
 #include "engine.hpp"
+#include "math_utils.hpp"
+#include "scratchpad_debug.hpp"
 #include "utils.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -53,7 +56,9 @@ memory_storage_t *create_scratchpad_memory_storage(
 #endif
 
     memory_storage_t *mem_storage = nullptr;
-    auto status = mem_engine->create_memory_storage(&mem_storage, size);
+    auto status = mem_engine->create_memory_storage(&mem_storage,
+            memory_flags_t::alloc | memory_flags_t::prefer_huge_pages, size,
+            nullptr);
     MAYBE_UNUSED(status);
     return mem_storage;
 }
@@ -138,6 +143,203 @@ thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+namespace {
+
+/*
+  A pool of scratchpad memory storages shared by the primitives executed on
+  native CPU engines. The storages are grouped by size classes, a class keeps
+  up to `slots_per_class` storages in slots which are handed off with atomic
+  exchanges, so acquiring and releasing a storage never blocks. The amount of
+  memory kept by the pool is bounded by its capacity, the storages released
+  above the capacity are freed.
+*/
+struct scratchpad_pool_t {
+    scratchpad_pool_t(engine_t *engine, size_t capacity)
+        : engine_(engine), capacity_(capacity), retained_(0) {
+        for (auto &class_slots : slots_)
+            for (auto &slot : class_slots)
+                slot.store(nullptr);
+    }
+
+    ~scratchpad_pool_t() { evict(0); }
+
+    // Returns a storage of at least `size` bytes and the index of its size
+    // class, or `n_classes` for the sizes that are not pooled.
+    memory_storage_t *acquire(size_t size, int &size_class) {
+        size_class = get_size_class(size);
+        if (size_class == n_classes)
+            return create_memory_storage(size);
+
+        for (auto &slot : slots_[size_class]) {
+            if (slot.load(std::memory_order_relaxed) == nullptr) continue;
+            auto *mem_storage
+                    = slot.exchange(nullptr, std::memory_order_acquire);
+            if (mem_storage) {
+                retained_ -= get_class_size(size_class);
+                return mem_storage;
+            }
+        }
+        return create_memory_storage(get_class_size(size_class));
+    }
+
+    void release(memory_storage_t *mem_storage, int size_class) {
+        if (mem_storage == nullptr) return;
+        if (size_class < n_classes && reserve(get_class_size(size_class))) {
+            for (auto &slot : slots_[size_class]) {
+                memory_storage_t *expected = nullptr;
+                if (slot.compare_exchange_strong(expected, mem_storage,
+                            std::memory_order_release,
+                            std::memory_order_relaxed))
+                    return;
+            }
+            retained_ -= get_class_size(size_class);
+        }
+        delete mem_storage;
+    }
+
+    size_t get_capacity() const { return capacity_; }
+
+    void set_capacity(size_t capacity) {
+        capacity_ = capacity;
+        evict(capacity);
+    }
+
+    static size_t get_class_size(int size_class) {
+        if (size_class == 0) return min_size;
+        const int p = min_size_log2 + (size_class - 1) / 4;
+        const size_t j = (size_class - 1) % 4 + 1;
+        return (size_t(1) << p) + j * (size_t(1) << (p - 2));
+    }
+
+private:
+    // The smallest class is a page, then each power of two is split into
+    // four classes so rounding a size up to its class wastes at most 25% of
+    // the memory. The sizes above 2^max_size_log2 bytes are not pooled.
+    static constexpr int min_size_log2 = 12;
+    static constexpr size_t min_size = size_t(1) << min_size_log2;
+    static constexpr int max_size_log2 = 40;
+    static constexpr int n_classes = (max_size_log2 - min_size_log2) * 4 + 1;
+    static constexpr int slots_per_class = 16;
+
+    static int get_size_class(size_t size) {
+        if (size <= min_size) return 0;
+        const int p = math::ilog2q(size - 1);
+        if (p >= max_size_log2) return n_classes;
+        const size_t base = size_t(1) << p;
+        const size_t j = utils::div_up(size - base, base / 4);
+        return (p - min_size_log2) * 4 + static_cast<int>(j);
+    }
+
+    memory_storage_t *create_memory_storage(size_t size) const {
+        memory_storage_t *mem_storage = nullptr;
+        auto status = engine_->create_memory_storage(&mem_storage,
+                memory_flags_t::alloc | memory_flags_t::prefer_huge_pages,
+                size, nullptr);
+        MAYBE_UNUSED(status);
+        return mem_storage;
+    }
+
+    // Accounts `size` bytes as retained by the pool if it fits the capacity.
+    bool reserve(size_t size) {
+        size_t retained = retained_.load();
+        do {
+            if (retained + size > capacity_) return false;
+        } while (!retained_.compare_exchange_weak(retained, retained + size));
+        return true;
+    }
+
+    // Frees the storages, the largest ones first, until the pool keeps no
+    // more than `capacity` bytes.
+    void evict(size_t capacity) {
+        for (int c = n_classes - 1; c >= 0; c--) {
+            for (auto &slot : slots_[c]) {
+                if (retained_ <= capacity) return;
+                auto *mem_storage = slot.exchange(nullptr);
+                if (mem_storage == nullptr) continue;
+                retained_ -= get_class_size(c);
+                delete mem_storage;
+            }
+        }
+    }
+
+    engine_t *engine_;
+    std::atomic<size_t> capacity_;
+    std::atomic<size_t> retained_;
+    std::atomic<memory_storage_t *> slots_[n_classes][slots_per_class];
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
+
+scratchpad_pool_t &scratchpad_pool() {
+    // The storages are created by the service engine, which has to outlive
+    // the pool. It doesn't depend on the engines of the primitives either.
+    static engine_t *engine = cpu::get_service_engine();
+    // The default capacity is set in megabytes.
+    static const int capacity_mb
+            = getenv_int_user("SCRATCHPAD_POOL_CAPACITY", 512);
+    static scratchpad_pool_t pool(
+            engine, size_t(nstl::max(capacity_mb, 0)) << 20);
+    return pool;
+}
+
+} // namespace
+
+/*
+  Implementation of the scratchpad_t interface that takes a memory storage
+  from the scratchpad pool for the lifetime of the object
+*/
+struct pooled_scratchpad_t : public scratchpad_t {
+    pooled_scratchpad_t(size_t size) {
+        mem_storage_ = scratchpad_pool().acquire(size, size_class_);
+        size_ = mem_storage_ == nullptr ? 0 : size;
+    }
+
+    ~pooled_scratchpad_t() override {
+        scratchpad_pool().release(mem_storage_, size_class_);
+    }
+
+    const memory_storage_t *get_memory_storage() const override {
+        return mem_storage_;
+    }
+
+    size_t size() const override { return size_; }
+
+private:
+    memory_storage_t *mem_storage_;
+    int size_class_;
+    size_t size_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(pooled_scratchpad_t);
+};
+#endif
+
+bool use_scratchpad_pool(engine_t *engine) {
+    // The storage is returned to the pool once `execute()` returns, which
+    // requires a synchronous execution. A protected scratchpad has to keep its
+    // guard pages set up once for the primitive.
+#if defined(DNNL_ENABLE_CONCURRENT_EXEC) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    return engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind())
+            && scratchpad_pool().get_capacity() > 0
+            && !scratchpad_debug::is_protect_scratchpad();
+#else
+    UNUSED(engine);
+    return false;
+#endif
+}
+
+scratchpad_t *create_pooled_scratchpad(engine_t *engine, size_t size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (use_scratchpad_pool(engine)) return new pooled_scratchpad_t(size);
+#endif
+    // The pool may be disabled after the primitive was created, the memory
+    // is then allocated for the execution only.
+    return new concurrent_scratchpad_t(engine, size);
+}
+
 /*
    Scratchpad creation routine
 */
@@ -161,3 +363,21 @@ scratchpad_t *create_scratchpad(
 
 } // namespace impl
 } // namespace dnnl
+
+dnnl::impl::status_t dnnl_get_scratchpad_pool_capacity(size_t *capacity) {
+    if (capacity == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity = 0;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    *capacity = dnnl::impl::scratchpad_pool().get_capacity();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_scratchpad_pool_capacity(size_t capacity) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    dnnl::impl::scratchpad_pool().set_capacity(capacity);
+#else
+    UNUSED(capacity);
+#endif
+    return dnnl::impl::status::success;
+}
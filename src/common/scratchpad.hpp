@@ -33,6 +33,16 @@ struct scratchpad_t {
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Returns whether the primitives executed on the engine take their scratchpad
+// from the scratchpad pool for the duration of every execution instead of
+// owning it for their lifetime.
+bool use_scratchpad_pool(engine_t *engine);
+
+// Creates a scratchpad whose memory is returned to the scratchpad pool when
+// the scratchpad is destroyed. If the pool is no longer used, the scratchpad
+// owns its memory.
+scratchpad_t *create_pooled_scratchpad(engine_t *engine, size_t size);
+
 } // namespace impl
 } // namespace dnnl
 #endif
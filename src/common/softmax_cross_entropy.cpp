@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+#include "softmax_cross_entropy_pd.hpp"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_SOFTMAX_CROSS_ENTROPY(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, softmax_cross_entropy, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_SOFTMAX_CROSS_ENTROPY_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, softmax_cross_entropy, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+namespace {
+bool is_present(const memory_desc_t *md) {
+    return md != nullptr && !types::is_zero_md(md);
+}
+
+bool is_blocked_or_any(const memory_desc_t *md) {
+    return one_of(md->format_kind, format_kind::blocked, format_kind::any)
+            && IMPLICATION(md->format_kind == format_kind::blocked,
+                    md->extra.flags == 0);
+}
+
+bool is_fp_dt(data_type_t dt) {
+    return one_of(dt, data_type::f32, data_type::bf16, data_type::f16);
+}
+} // namespace
+
+status_t softmax_cross_entropy_desc_init(
+        softmax_cross_entropy_desc_t *softmax_cross_entropy_desc,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *labels_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *diff_src_desc, float label_smoothing,
+        dim_t ignore_index) {
+
+    VCHECK_SOFTMAX_CROSS_ENTROPY(
+            one_of(prop_kind, prop_kind::forward_training,
+                    prop_kind::forward_inference),
+            VERBOSE_BAD_PROPKIND);
+    VCHECK_SOFTMAX_CROSS_ENTROPY(
+            !any_null(src_desc, labels_desc, dst_desc), VERBOSE_NULL_ARG);
+
+    const bool is_training = prop_kind == prop_kind::forward_training;
+    VCHECK_SOFTMAX_CROSS_ENTROPY(
+            IMPLICATION(is_training, is_present(diff_src_desc)),
+            VERBOSE_NULL_ARG);
+
+    VCHECK_SOFTMAX_CROSS_ENTROPY(src_desc->ndims == 2, VERBOSE_BAD_NDIMS,
+            "src", src_desc->ndims);
+    VCHECK_SOFTMAX_CROSS_ENTROPY(labels_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "labels", labels_desc->ndims);
+    VCHECK_SOFTMAX_CROSS_ENTROPY(dst_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "dst", dst_desc->ndims);
+    VCHECK_SOFTMAX_CROSS_ENTROPY(
+            IMPLICATION(is_training, diff_src_desc->ndims == 2),
+            VERBOSE_BAD_NDIMS, "diff_src",
+            is_training ? diff_src_desc->ndims : 0);
+
+    for (const auto *md : {src_desc, labels_desc, dst_desc}) {
+        VCHECK_SOFTMAX_CROSS_ENTROPY(
+                !memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_SOFTMAX_CROSS_ENTROPY(
+                is_blocked_or_any(md), VERBOSE_UNSUPPORTED_TAG);
+    }
+    if (is_training) {
+        VCHECK_SOFTMAX_CROSS_ENTROPY(
+                !memory_desc_wrapper(diff_src_desc)
+                                .has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_SOFTMAX_CROSS_ENTROPY(
+                is_blocked_or_any(diff_src_desc), VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    const dim_t N = src_desc->dims[0];
+    VCHECK_SOFTMAX_CROSS_ENTROPY(labels_desc->dims[0] == N,
+            VERBOSE_INCONSISTENT_DIM, "src", 0, "labels", 0);
+    VCHECK_SOFTMAX_CROSS_ENTROPY(dst_desc->dims[0] == N,
+            VERBOSE_INCONSISTENT_DIM, "src", 0, "dst", 0);
+    if (is_training) {
+        for (int d = 0; d < 2; d++)
+            VCHECK_SOFTMAX_CROSS_ENTROPY(
+                    diff_src_desc->dims[d] == src_desc->dims[d],
+                    VERBOSE_INCONSISTENT_DIM, "src", d, "diff_src", d);
+    }
+
+    VCHECK_SOFTMAX_CROSS_ENTROPY(is_fp_dt(src_desc->data_type),
+            VERBOSE_INVALID_DATATYPE, "src");
+    VCHECK_SOFTMAX_CROSS_ENTROPY(labels_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "labels");
+    VCHECK_SOFTMAX_CROSS_ENTROPY(is_fp_dt(dst_desc->data_type),
+            VERBOSE_INVALID_DATATYPE, "dst");
+    VCHECK_SOFTMAX_CROSS_ENTROPY(
+            IMPLICATION(is_training, is_fp_dt(diff_src_desc->data_type)),
+            VERBOSE_INVALID_DATATYPE, "diff_src");
+
+    VCHECK_SOFTMAX_CROSS_ENTROPY(
+            label_smoothing >= 0.f && label_smoothing <= 1.f,
+            VERBOSE_BAD_PARAM, "label_smoothing");
+
+    auto sd = softmax_cross_entropy_desc_t();
+    sd.primitive_kind = primitive_kind::softmax_cross_entropy;
+    sd.prop_kind = prop_kind;
+
+    sd.src_desc = *src_desc;
+    sd.labels_desc = *labels_desc;
+    sd.dst_desc = *dst_desc;
+    sd.diff_src_desc = is_training ? *diff_src_desc : types::zero_md();
+    sd.label_smoothing = label_smoothing;
+    sd.ignore_index = ignore_index;
+
+    (*softmax_cross_entropy_desc) = sd;
+    return success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_softmax_cross_entropy_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *labels_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *diff_src_desc, float label_smoothing,
+        dim_t ignore_index, const primitive_attr_t *attr) {
+
+    auto softmax_cross_entropy_desc = softmax_cross_entropy_desc_t();
+    CHECK(softmax_cross_entropy_desc_init(&softmax_cross_entropy_desc,
+            prop_kind, src_desc, labels_desc, dst_desc, diff_src_desc,
+            label_smoothing, ignore_index));
+    VCHECK_SOFTMAX_CROSS_ENTROPY_UNIMPL(
+            attr == nullptr || attr->has_default_values(),
+            VERBOSE_UNSUPPORTED_ATTR);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&softmax_cross_entropy_desc, nullptr, attr);
+}
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_SOFTMAX_CROSS_ENTROPY_PD_HPP
+#define COMMON_SOFTMAX_CROSS_ENTROPY_PD_HPP
+
+#include "c_types_map.hpp"
+#include "memory_desc.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_SOFTMAX_CROSS_ENTROPY(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, softmax_cross_entropy, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_SOFTMAX_CROSS_ENTROPY_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, softmax_cross_entropy, (f), \
+            "%s," msg, this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t softmax_cross_entropy_desc_init(
+        softmax_cross_entropy_desc_t *softmax_cross_entropy_desc,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *labels_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *diff_src_desc, float label_smoothing,
+        dim_t ignore_index);
+
+// NOLINTBEGIN(google-default-arguments)
+struct softmax_cross_entropy_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::softmax_cross_entropy;
+
+    using hint_class = softmax_cross_entropy_pd_t;
+
+    const softmax_cross_entropy_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::prop_kind:
+                *(prop_kind_t *)result = desc()->prop_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_SRC_1: return arg_usage_t::input;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            case DNNL_ARG_DIFF_SRC:
+                return is_training() ? arg_usage_t::output
+                                     : arg_usage_t::unused;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_SRC_1: return src_md(1, user_input);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DIFF_SRC: return diff_src_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // The second source is the vector of the labels. The gradient of the
+    // logits is an output computed along with the loss.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return user_input ? &desc()->src_desc : &src_md_;
+            case 1: return user_input ? &desc()->labels_desc : &labels_md_;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *diff_src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0 && is_training())
+            return user_input ? &desc()->diff_src_desc : &diff_src_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2; }
+    int n_outputs() const override { return 1 + is_training(); }
+
+    bool is_training() const {
+        return desc()->prop_kind == prop_kind::forward_training;
+    }
+    dim_t N() const { return desc()->src_desc.dims[0]; }
+    dim_t C() const { return desc()->src_desc.dims[1]; }
+    float label_smoothing() const { return desc()->label_smoothing; }
+    dim_t ignore_index() const { return desc()->ignore_index; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md()).has_zero_dim();
+    }
+
+protected:
+    softmax_cross_entropy_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t labels_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t diff_src_md_;
+
+    softmax_cross_entropy_pd_t(const op_desc_t *adesc,
+            const primitive_attr_t *attr, const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<softmax_cross_entropy_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , labels_md_(desc_.labels_desc)
+        , dst_md_(desc_.dst_desc)
+        , diff_src_md_(desc_.diff_src_desc) {}
+
+    // The logits and their gradient default to the row-major layout, the
+    // gradient takes the layout of the logits if they are defined.
+    status_t set_default_params() {
+        using namespace format_tag;
+        if (src_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(src_md_, ab));
+        if (labels_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(labels_md_, a));
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(dst_md_, a));
+        if (is_training() && diff_src_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    diff_src_md_, src_md_.format_desc.blocking));
+        return status::success;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
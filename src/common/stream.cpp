@@ -24,6 +24,7 @@
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
 #include "stream.hpp"
+#include "stream_capture.hpp"
 #include "utils.hpp"
 
 #include "common/stream_impl.hpp"
@@ -32,6 +33,10 @@ using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::utils;
 
+stream_t::~dnnl_stream() {
+    delete capture_;
+}
+
 status_t stream_t::enqueue_primitive(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     return primitive_iface->execute(ctx);
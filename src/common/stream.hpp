@@ -29,7 +29,7 @@
 struct dnnl_stream : public dnnl::impl::c_compatible {
     dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl)
         : engine_(engine), impl_(impl) {}
-    virtual ~dnnl_stream() = default;
+    virtual ~dnnl_stream();
 
     /** returns stream's engine */
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -78,6 +78,13 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 
     dnnl::impl::stream_impl_t *impl() { return impl_.get(); }
 
+    /** returns the capture being recorded, if any (see
+     * dnnl_stream_begin_capture()) */
+    dnnl::impl::stream_capture_t *capture() const { return capture_; }
+    void set_capture(dnnl::impl::stream_capture_t *capture) {
+        capture_ = capture;
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::impl::status_t get_threadpool(
             dnnl::threadpool_interop::threadpool_iface **threadpool) const {
@@ -91,6 +98,8 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     std::unique_ptr<dnnl::impl::stream_impl_t> impl_;
+    // Owned by the stream until the capture ends.
+    dnnl::impl::stream_capture_t *capture_ = nullptr;
 };
 
 #endif
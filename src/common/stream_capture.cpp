@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "primitive_iface.hpp"
+#include "stream.hpp"
+#include "stream_capture.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+status_t dnnl_stream_capture::record(primitive_iface_t *primitive_iface,
+        int nargs, const dnnl_exec_arg_t *c_args) {
+    auto bp = utils::make_unique<bound_primitive_t>(primitive_iface, stream_);
+    if (!bp) return out_of_memory;
+    CHECK(bp->init(nargs, c_args, /* defer_scratchpad = */ true));
+    entries_.push_back(std::move(bp));
+    return success;
+}
+
+status_t dnnl_stream_capture::finalize() {
+    size_t scratchpad_size = 0;
+    for (const auto &e : entries_)
+        scratchpad_size
+                = std::max(scratchpad_size, e->library_scratchpad_size());
+
+    if (scratchpad_size) {
+        scratchpad_.reset(
+                create_scratchpad(stream_->engine(), scratchpad_size, false));
+        if (!scratchpad_ || !scratchpad_->get_memory_storage())
+            return out_of_memory;
+    }
+
+    for (const auto &e : entries_) {
+        if (e->library_scratchpad_size() == 0) continue;
+        CHECK(e->set_scratchpad(scratchpad_->get_memory_storage()));
+    }
+    return success;
+}
+
+status_t dnnl_stream_capture::replay() const {
+    stream_->before_exec_hook();
+    status_t status = success;
+    for (const auto &e : entries_) {
+        status = e->execute(/* call_stream_hooks = */ false);
+        if (status != success) break;
+    }
+    stream_->after_exec_hook();
+    return status;
+}
+
+// API
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (stream == nullptr || stream->capture() != nullptr)
+        return invalid_arguments;
+    if (stream->engine()->kind() != engine_kind::cpu
+            || stream->engine()->runtime_kind() == runtime_kind::sycl)
+        return unimplemented;
+
+    auto capture = utils::make_unique<stream_capture_t>(stream);
+    if (!capture) return out_of_memory;
+    stream->set_capture(capture.release());
+    return success;
+}
+
+status_t dnnl_stream_end_capture(
+        stream_t *stream, stream_capture_t **stream_capture) {
+    if (utils::any_null(stream, stream_capture) || stream->capture() == nullptr)
+        return invalid_arguments;
+
+    std::unique_ptr<stream_capture_t> capture(stream->capture());
+    stream->set_capture(nullptr);
+    CHECK(capture->finalize());
+    *stream_capture = capture.release();
+    return success;
+}
+
+status_t dnnl_stream_capture_replay(const stream_capture_t *stream_capture) {
+    if (stream_capture == nullptr) return invalid_arguments;
+    return stream_capture->replay();
+}
+
+status_t dnnl_stream_capture_destroy(stream_capture_t *stream_capture) {
+    delete stream_capture;
+    return success;
+}
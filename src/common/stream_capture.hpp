@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_CAPTURE_HPP
+#define COMMON_STREAM_CAPTURE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "bound_primitive.hpp"
+#include "c_types_map.hpp"
+#include "scratchpad.hpp"
+#include "utils.hpp"
+
+// A sequence of primitive executions recorded on a stream. While a stream
+// captures, dnnl_primitive_execute() records the primitive and its arguments
+// instead of executing it. Each recorded execution is turned into a bound
+// primitive, so a replay runs implementations back to back without argument
+// resolution and with the stream hooks called once for the whole sequence.
+// Recorded primitives run one after another, hence they share a single
+// scratchpad sized for the largest of them.
+struct dnnl_stream_capture : public dnnl::impl::c_compatible {
+    dnnl_stream_capture(dnnl::impl::stream_t *stream) : stream_(stream) {}
+
+    dnnl::impl::status_t record(primitive_iface_t *primitive_iface,
+            int nargs, const dnnl_exec_arg_t *c_args);
+
+    // Allocates the shared scratchpad, must be called once after the last
+    // record.
+    dnnl::impl::status_t finalize();
+
+    dnnl::impl::status_t replay() const;
+
+    dnnl::impl::stream_t *stream() const { return stream_; }
+    size_t size() const { return entries_.size(); }
+
+private:
+    dnnl::impl::stream_t *stream_;
+    std::vector<std::unique_ptr<dnnl::impl::bound_primitive_t>> entries_;
+    std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_stream_capture);
+};
+
+#endif
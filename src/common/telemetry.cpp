@@ -0,0 +1,211 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "telemetry.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace telemetry {
+
+namespace {
+
+constexpr size_t max_capacity = size_t(1) << 24;
+
+// A single-producer single-consumer ring buffer of records. The owner thread
+// pushes the records without locks, the records are drained under the lock
+// of the registry.
+struct ring_t {
+    ring_t(size_t capacity) : records_(capacity), mask_(capacity - 1) {}
+
+    size_t capacity() const { return records_.size(); }
+
+    void push(const dnnl_telemetry_record_t &r) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == capacity()) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        records_[head & mask_] = r;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    size_t drain(dnnl_telemetry_record_t *records, size_t n) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_acquire);
+        n = std::min(n, head - tail);
+        for (size_t i = 0; i < n; i++)
+            records[i] = records_[(tail + i) & mask_];
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire)
+                == tail_.load(std::memory_order_relaxed);
+    }
+
+    size_t take_dropped() {
+        return dropped_.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<dnnl_telemetry_record_t> records_;
+    const size_t mask_;
+    std::atomic<size_t> head_ {0};
+    std::atomic<size_t> tail_ {0};
+    std::atomic<size_t> dropped_ {0};
+};
+
+struct registry_t {
+    std::mutex mutex;
+    // The rings of the threads. A ring no longer referenced by its thread,
+    // because the thread exited or the capacity changed, is removed once it
+    // is drained.
+    std::vector<std::shared_ptr<ring_t>> rings;
+    // A deque keeps the names in place when new ones are added.
+    std::deque<std::string> impl_names;
+    std::unordered_map<std::string, uint32_t> impl_name_indices;
+};
+
+registry_t &registry() {
+    // Never destroyed: threads may record executions after the static
+    // objects of the library are destroyed.
+    static registry_t *r = new registry_t();
+    return *r;
+}
+
+// The capacity of the rings is a power of two to wrap the indices with a
+// mask.
+size_t round_capacity(size_t c) {
+    return c == 0 ? 0 : utils::rnd_up_pow2(std::min(c, max_capacity));
+}
+
+std::atomic<size_t> &capacity() {
+    static std::atomic<size_t> c(round_capacity(static_cast<size_t>(
+            std::max(0, getenv_int_user("TELEMETRY_CAPACITY", 0)))));
+    return c;
+}
+
+} // namespace
+
+bool is_enabled() {
+    return capacity().load(std::memory_order_relaxed) != 0;
+}
+
+uint64_t get_nsec() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+uint64_t get_primitive_id() {
+    static std::atomic<uint64_t> id(0);
+    return id.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t get_impl_name_index(const char *name) {
+    auto &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    const auto it = r.impl_name_indices.find(name);
+    if (it != r.impl_name_indices.end()) return it->second;
+
+    const auto index = static_cast<uint32_t>(r.impl_names.size());
+    r.impl_names.emplace_back(name);
+    r.impl_name_indices.emplace(r.impl_names.back(), index);
+    return index;
+}
+
+void record(const dnnl_telemetry_record_t &rec) {
+    static thread_local std::shared_ptr<ring_t> ring;
+
+    const size_t c = capacity().load(std::memory_order_relaxed);
+    if (c == 0) return;
+    if (!ring || ring->capacity() != c) {
+        ring = std::make_shared<ring_t>(c);
+        auto &r = registry();
+        std::lock_guard<std::mutex> guard(r.mutex);
+        r.rings.push_back(ring);
+    }
+    ring->push(rec);
+}
+
+} // namespace telemetry
+} // namespace impl
+} // namespace dnnl
+
+using namespace dnnl::impl;
+
+status_t dnnl_get_telemetry_capacity(size_t *capacity) {
+    if (capacity == nullptr) return status::invalid_arguments;
+    *capacity = telemetry::capacity().load();
+    return status::success;
+}
+
+status_t dnnl_set_telemetry_capacity(size_t capacity) {
+    if (capacity > telemetry::max_capacity) return status::invalid_arguments;
+    telemetry::capacity().store(telemetry::round_capacity(capacity));
+    return status::success;
+}
+
+status_t dnnl_telemetry_drain(dnnl_telemetry_record_t *records,
+        size_t capacity, size_t *count, size_t *dropped) {
+    if (count == nullptr || (records == nullptr && capacity > 0))
+        return status::invalid_arguments;
+
+    auto &r = telemetry::registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    size_t n = 0, n_dropped = 0;
+    for (const auto &ring : r.rings) {
+        n += ring->drain(records + n, capacity - n);
+        n_dropped += ring->take_dropped();
+    }
+    r.rings.erase(std::remove_if(r.rings.begin(), r.rings.end(),
+                          [](const std::shared_ptr<telemetry::ring_t> &ring) {
+                              return ring.use_count() == 1 && ring->empty();
+                          }),
+            r.rings.end());
+
+    *count = n;
+    if (dropped) *dropped = n_dropped;
+    return status::success;
+}
+
+status_t dnnl_telemetry_get_impl_name(uint32_t index, const char **name) {
+    if (name == nullptr) return status::invalid_arguments;
+
+    auto &r = telemetry::registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    if (index >= r.impl_names.size()) return status::invalid_arguments;
+    *name = r.impl_names[index].c_str();
+    return status::success;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
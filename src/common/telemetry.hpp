@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_TELEMETRY_HPP
+#define COMMON_TELEMETRY_HPP
+
+#include <stdint.h>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+namespace dnnl {
+namespace impl {
+namespace telemetry {
+
+// Returns whether the primitive executions are recorded.
+bool is_enabled();
+
+// Returns the time in nanoseconds of the clock of the records.
+uint64_t get_nsec();
+
+// Returns a new primitive identifier.
+uint64_t get_primitive_id();
+
+// Returns the index of an implementation name, registering the name on the
+// first call.
+uint32_t get_impl_name_index(const char *name);
+
+// Appends a record to the ring buffer of the calling thread.
+void record(const dnnl_telemetry_record_t &r);
+
+} // namespace telemetry
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+#include "topk_pd.hpp"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_TOPK_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+namespace dnnl {
+namespace impl {
+
+status_t topk_desc_init(topk_desc_t *topk_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int axis, dim_t k) {
+
+    VCHECK_TOPK(!any_null(src_desc, dst_desc, indices_desc), VERBOSE_NULL_ARG);
+    VCHECK_TOPK(one_of(alg_kind, topk_max, topk_sample), VERBOSE_BAD_ALGORITHM);
+    VCHECK_TOPK(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_TOPK(one_of(src_desc->data_type, data_type::f32, data_type::bf16,
+                        data_type::f16),
+            VERBOSE_INVALID_DATATYPE, "src");
+    VCHECK_TOPK(one_of(dst_desc->data_type, data_type::f32, data_type::bf16,
+                        data_type::f16),
+            VERBOSE_INVALID_DATATYPE, "dst");
+    VCHECK_TOPK(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+
+    const int ndims = src_desc->ndims;
+    VCHECK_TOPK(0 <= axis && axis < ndims, VERBOSE_BAD_AXIS);
+    VCHECK_TOPK(0 < k && k <= src_desc->dims[axis], VERBOSE_BAD_PARAM, "k");
+
+    VCHECK_TOPK(ndims == dst_desc->ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+            "dst");
+    VCHECK_TOPK(ndims == indices_desc->ndims, VERBOSE_INCONSISTENT_NDIMS,
+            "src", "indices");
+    VCHECK_TOPK(!memory_desc_wrapper(src_desc).has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // The selected values are kept along the axis for #dnnl_topk_max, a
+    // single sampled value is returned for #dnnl_topk_sample.
+    const dim_t dst_axis_dim = alg_kind == topk_max ? k : 1;
+    for (int d = 0; d < ndims; ++d) {
+        const dim_t dim = d == axis ? dst_axis_dim : src_desc->dims[d];
+        VCHECK_TOPK(dst_desc->dims[d] == dim, VERBOSE_INCONSISTENT_DIM, "src",
+                d, "dst", d);
+        VCHECK_TOPK(indices_desc->dims[d] == dim, VERBOSE_INCONSISTENT_DIM,
+                "src", d, "indices", d);
+    }
+
+    VCHECK_TOPK(one_of(dst_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_TOPK(one_of(indices_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+
+    VCHECK_TOPK(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_TOPK(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                        dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+    VCHECK_TOPK(IMPLICATION(indices_desc->format_kind == format_kind::blocked,
+                        indices_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "indices");
+
+    auto td = topk_desc_t();
+    td.primitive_kind = primitive_kind::topk;
+    td.alg_kind = alg_kind;
+
+    td.src_desc = *src_desc;
+    td.dst_desc = *dst_desc;
+    td.indices_desc = *indices_desc;
+    td.axis = axis;
+    td.k = k;
+
+    (*topk_desc) = td;
+    return success;
+}
+
+status_t topk_attr_check(
+        const topk_desc_t &desc, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // The source scale divides the logits by the sampling temperature.
+    VCHECK_TOPK_UNIMPL(desc.alg_kind == topk_sample, VERBOSE_UNSUPPORTED_ATTR);
+    VCHECK_TOPK_UNIMPL(attr->has_default_values(smask_t::scales),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const auto &sc = attr->scales_;
+    static const std::vector<int> supported_args {DNNL_ARG_SRC};
+    VCHECK_TOPK_UNIMPL(sc.has_default_values(supported_args),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VCHECK_TOPK_UNIMPL(IMPLICATION(!sc.has_default_values(DNNL_ARG_SRC),
+                               sc.get_mask(DNNL_ARG_SRC) == 0
+                                       && sc.get_data_type(DNNL_ARG_SRC)
+                                               == data_type::f32),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_topk_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *indices_desc,
+        int axis, dim_t k, const primitive_attr_t *attr) {
+
+    auto topk_desc = topk_desc_t();
+    CHECK(topk_desc_init(
+            &topk_desc, alg_kind, src_desc, dst_desc, indices_desc, axis, k));
+    CHECK(topk_attr_check(topk_desc, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&topk_desc, nullptr, attr);
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "c_types_map.hpp"
+#include "memory_desc.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_TOPK_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, topk, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t topk_desc_init(topk_desc_t *topk_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int axis, dim_t k);
+
+// NOLINTBEGIN(google-default-arguments)
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+
+    using hint_class = topk_pd_t;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            case query::axis_s32: *(int *)result = desc()->axis; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return arg_usage_t::input;
+            case DNNL_ARG_SRC_1:
+                return is_sample() ? arg_usage_t::input : arg_usage_t::unused;
+            case DNNL_ARG_DST:
+            case DNNL_ARG_DST_1: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_1: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // The second source is the seed of the random sampling, the second
+    // destination holds the indices of the selected values.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        if (index == 1 && is_sample()) return &seed_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        if (index == 1)
+            return user_input ? &desc()->indices_desc : &indices_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 1 + is_sample(); }
+    int n_outputs() const override { return 2; }
+
+    bool is_sample() const {
+        return desc()->alg_kind == alg_kind::topk_sample;
+    }
+    int axis() const { return desc()->axis; }
+    dim_t k() const { return desc()->k; }
+    dim_t axis_size() const { return src_md_.dims[axis()]; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md()).has_zero_dim();
+    }
+
+protected:
+    topk_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t indices_md_;
+    memory_desc_t seed_md_;
+
+    topk_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<topk_desc_t>(adesc))
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc)
+        , indices_md_(desc_.indices_desc)
+        , seed_md_(types::zero_md()) {
+        const dims_t seed_dims = {1};
+        memory_desc_init_by_tag(
+                seed_md_, 1, seed_dims, data_type::s32, format_tag::x);
+    }
+
+    // Outputs with `any` format take the layout of the source.
+    status_t set_default_params() {
+        CHECK(set_default_format(dst_md_));
+        return set_default_format(indices_md_);
+    }
+
+private:
+    status_t set_default_format(memory_desc_t &md) const {
+        if (md.format_kind != format_kind::any) return status::success;
+
+        memory_desc_t new_md = src_md_;
+        new_md.data_type = md.data_type;
+        new_md.dims[axis()] = md.dims[axis()];
+        utils::array_copy(new_md.padded_dims, new_md.dims, md.ndims);
+        utils::array_set(new_md.padded_offsets, 0, md.ndims);
+        new_md.format_desc.blocking.inner_nblks = 0;
+        new_md.extra = memory_extra_desc_t();
+
+        // Keep the order of the source dimensions with dense strides.
+        dims_t perm, strides;
+        for (int d = 0; d < md.ndims; ++d) {
+            perm[d] = d;
+            strides[d] = src_md_.format_desc.blocking.strides[d];
+        }
+        dims_t ou_dims;
+        utils::array_copy(ou_dims, new_md.dims, md.ndims);
+        utils::simultaneous_sort(strides, ou_dims, perm, md.ndims,
+                [](stride_t a, stride_t b) { return a - b; });
+
+        dim_t stride = 1;
+        for (int _d = 0; _d < md.ndims; ++_d) {
+            const auto d = perm[_d];
+            new_md.format_desc.blocking.strides[d] = stride;
+            stride *= new_md.dims[d];
+        }
+        md = new_md;
+        return status::success;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -41,8 +41,10 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
+#include "grouped_matmul_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -55,8 +57,10 @@
 #include "rnn_pd.hpp"
 #include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
+#include "softmax_cross_entropy_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -234,6 +238,10 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 REGEX_SEARCH(k, graph, regexp);
                 REGEX_SEARCH(k, gemm_api, regexp);
                 REGEX_SEARCH(k, ukernel, regexp);
+                REGEX_SEARCH(k, topk, regexp);
+                REGEX_SEARCH(k, embedding, regexp);
+                REGEX_SEARCH(k, grouped_matmul, regexp);
+                REGEX_SEARCH(k, softmax_cross_entropy, regexp);
 #undef REGEX_SEARCH
             } catch (const std::exception &e) {
                 filter_status().status = filter_status_t::flags::invalid;
@@ -819,6 +827,21 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             default: assert(!"unsupported format_kind");
         }
     }
+
+    const src_norm_t &sn = attr->src_norm_;
+    if (!sn.has_default_values()) {
+        ss << field_delim() << "attr-src-norm:"
+           << normalization_flags2str(sn.flags_) << ":" << sn.epsilon_;
+    }
+
+    const amax_t &amax = attr->amax_;
+    if (!amax.has_default_values()) {
+        ss << field_delim() << "attr-amax:";
+        if (amax.src_) ss << "src" << (amax.dst_ ? "+" : "");
+        if (amax.dst_) ss << "dst";
+    }
+
+    if (attr->streaming_.enabled_) ss << field_delim() << "attr-streaming:1";
     return ss;
 }
 
@@ -1330,6 +1353,93 @@ std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    auto ind_md = pd->dst_md(1);
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind())
+       << " ";
+    ss << md2fmt_str("indices", ind_md,
+            pd->invariant_dst_user_format_kind(DNNL_ARG_DST_1));
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << " axis:" << pd->desc()->axis
+       << " k:" << pd->desc()->k << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_embedding(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto ind_md = pd->src_md(1);
+    auto off_md = pd->src_md(2);
+    auto wei_md = pd->invariant_wei_md();
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("indices", ind_md, pd->invariant_src_user_format_kind(1))
+       << " ";
+    if (pd->is_bag())
+        ss << md2fmt_str("offsets", off_md,
+                pd->invariant_src_user_format_kind(2))
+           << " ";
+    if (pd->with_weights())
+        ss << md2fmt_str("wei", wei_md, pd->invariant_wei_user_format_kind())
+           << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(ind_md) << ":"
+       << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_grouped_matmul(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto off_md = pd->src_md(1);
+    auto wei_md = pd->invariant_wei_md();
+    auto bia_md = pd->invariant_bia_md();
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str("offsets", off_md, pd->invariant_src_user_format_kind(1))
+       << " ";
+    ss << md2fmt_str("wei", wei_md, pd->invariant_wei_user_format_kind())
+       << " ";
+    if (pd->with_bias())
+        ss << md2fmt_str("bia", bia_md, pd->invariant_bia_user_format_kind())
+           << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(wei_md);
+
+    return ss.str();
+}
+
 std::string mds2str_reorder(const memory_desc_t *src_md,
         format_kind_t src_user_format_kind, const memory_desc_t *dst_md,
         format_kind_t dst_user_format_kind) {
@@ -1538,6 +1648,37 @@ std::string init_info_softmax(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_softmax_cross_entropy(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto labels_md = pd->src_md(1);
+    auto dst_md = pd->dst_md();
+    auto diff_src_md = pd->diff_src_md();
+
+    ss << md2fmt_str("src", src_md, pd->invariant_src_user_format_kind())
+       << " ";
+    ss << md2fmt_str(
+            "labels", labels_md, pd->invariant_src_user_format_kind(1))
+       << " ";
+    ss << md2fmt_str("dst", dst_md, pd->dst_md(0, true)->format_kind);
+    if (!types::is_zero_md(diff_src_md)) {
+        ss << " "
+           << md2fmt_str("diff_src", diff_src_md,
+                      pd->diff_src_md(0, true)->format_kind);
+    }
+
+    ss << "," << pd->attr() << ",";
+    ss << "ls:" << pd->label_smoothing() << " ignore:" << pd->ignore_index()
+       << ",";
+    ss << md2dim_str(src_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_sum(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1661,7 +1802,13 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::embedding:
+        case primitive_kind::grouped_matmul:
+        case primitive_kind::softmax_cross_entropy:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1730,7 +1877,13 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::embedding:
+        case primitive_kind::grouped_matmul:
+        case primitive_kind::softmax_cross_entropy:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1770,6 +1923,10 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(softmax);
             CASE(sum);
             CASE(sdpa);
+            CASE(topk);
+            CASE(embedding);
+            CASE(grouped_matmul);
+            CASE(softmax_cross_entropy);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
@@ -234,6 +234,10 @@ struct component_t {
         graph = 1 << 22,
         gemm_api = 1 << 23,
         ukernel = 1 << 24,
+        topk = 1 << 25,
+        embedding = 1 << 26,
+        grouped_matmul = 1 << 27,
+        softmax_cross_entropy = 1 << 28,
         all = (uint32_t)-1,
     };
 };
@@ -119,6 +119,7 @@
 #define VERBOSE_SMALL_SHAPES "small shapes fall back"
 #define VERBOSE_NONTRIVIAL_STRIDE "only trivial strides are supported"
 #define VERBOSE_UNSUPPORTED_MEM_STRIDE "unsupported memory stride"
+#define VERBOSE_BAD_PREPACKED_FILE "bad prepacked file: %s"
 
 #define VERBOSE_IMPL_HEURISTIC_FAIL "heuristic fail: %s"
 #define VERBOSE_1x1CONV_HEURISTIC_FAIL "heuristic fail for 1x1 convolution: %s"
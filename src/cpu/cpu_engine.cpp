@@ -33,7 +33,8 @@ status_t cpu_engine_t::create_memory_storage(
     assert(runtime_kind() != runtime_kind::sycl);
     if (runtime_kind() == runtime_kind::sycl) return status::runtime_error;
 
-    auto _storage = new cpu_memory_storage_t(this);
+    auto _storage = new cpu_memory_storage_t(
+            this, flags & memory_flags_t::prefer_huge_pages);
     if (_storage == nullptr) return status::out_of_memory;
     status_t status = _storage->init(flags, size, handle);
     if (status != status::success) {
@@ -59,7 +59,9 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding);
 DECLARE_IMPL_LIST(group_normalization);
+DECLARE_IMPL_LIST(grouped_matmul);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
@@ -71,6 +73,8 @@ DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(softmax_cross_entropy);
+DECLARE_IMPL_LIST(topk);
 
 #undef DECLARE_IMPL_LIST
 
@@ -95,7 +99,9 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding);
             CASE(group_normalization);
+            CASE(grouped_matmul);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
@@ -107,6 +113,8 @@ public:
             CASE(rnn);
             CASE(shuffle);
             CASE(softmax);
+            CASE(softmax_cross_entropy);
+            CASE(topk);
             case primitive_kind::sdpa: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
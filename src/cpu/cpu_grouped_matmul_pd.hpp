@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_GROUPED_MATMUL_PD_HPP
+#define CPU_CPU_GROUPED_MATMUL_PD_HPP
+
+#include "common/grouped_matmul_pd.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/grouped_matmul_utils.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_grouped_matmul_pd_t : public grouped_matmul_pd_t {
+    using grouped_matmul_pd_t::grouped_matmul_pd_t;
+
+protected:
+    // Checks the configurations supported by the implementations over plain
+    // matrices, which share the driver in `grouped_matmul_utils`.
+    status_t init_plain(engine_t *engine) {
+        using namespace data_type;
+        using sm = primitive_attr_t::skip_mask_t;
+
+        const auto wei_dt = weights_md()->data_type;
+        VDISPATCH_GROUPED_MATMUL(
+                platform::has_data_type_support(src_md()->data_type),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_GROUPED_MATMUL(platform::has_data_type_support(wei_dt),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_GROUPED_MATMUL(
+                platform::has_data_type_support(dst_md()->data_type),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_GROUPED_MATMUL(IMPLICATION(with_bias(),
+                                         platform::has_data_type_support(
+                                                 weights_md(1)->data_type)),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_GROUPED_MATMUL(
+                attr()->has_default_values(sm::scales_groups
+                        | sm::scales_data_type | sm::zero_points_groups
+                        | sm::zero_points_data_type),
+                VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_GROUPED_MATMUL(set_default_params() == status::success,
+                VERBOSE_UNSUPPORTED_TAG);
+
+        const memory_desc_wrapper wei_d(weights_md());
+        VDISPATCH_GROUPED_MATMUL(
+                memory_desc_wrapper(src_md()).matches_tag(format_tag::ab),
+                VERBOSE_UNSUPPORTED_TAG_S, "src");
+        VDISPATCH_GROUPED_MATMUL(wei_d.matches_tag(format_tag::abc),
+                VERBOSE_UNSUPPORTED_TAG_S, "weights");
+        VDISPATCH_GROUPED_MATMUL(
+                memory_desc_wrapper(dst_md()).matches_tag(format_tag::ab),
+                VERBOSE_UNSUPPORTED_TAG_S, "dst");
+        VDISPATCH_GROUPED_MATMUL(
+                IMPLICATION(with_bias(),
+                        memory_desc_wrapper(weights_md(1))
+                                .matches_tag(format_tag::ab)),
+                VERBOSE_UNSUPPORTED_TAG_S, "bias");
+        // Rows of 4-bit weights have to start on a byte boundary.
+        VDISPATCH_GROUPED_MATMUL(
+                IMPLICATION(utils::one_of(wei_dt, s4, u4),
+                        N() % 2 == 0 && wei_d.offset0() % 2 == 0),
+                VERBOSE_BAD_DIM, "weights", 2);
+        VDISPATCH_GROUPED_MATMUL(memory_desc_wrapper(src_md(1)).is_dense(),
+                VERBOSE_UNSUPPORTED_TAG_S, "offsets");
+
+        auto scratchpad = scratchpad_registry().registrar();
+        grouped_matmul_utils::init_scratchpad(scratchpad, ngroups());
+
+        return status::success;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "common/c_types_map.hpp"
+#include "common/huge_pages.hpp"
 #include "common/memory.hpp"
 #include "common/memory_storage.hpp"
 #include "common/stream.hpp"
@@ -33,8 +34,10 @@ namespace cpu {
 
 class cpu_memory_storage_t : public memory_storage_t {
 public:
-    cpu_memory_storage_t(engine_t *engine)
-        : memory_storage_t(engine), data_(nullptr, release) {}
+    cpu_memory_storage_t(engine_t *engine, bool prefer_huge_pages = false)
+        : memory_storage_t(engine)
+        , data_(nullptr, release)
+        , prefer_huge_pages_(prefer_huge_pages) {}
     ~cpu_memory_storage_t() override = default;
 
     status_t get_data_handle(void **handle) const override {
@@ -87,19 +90,27 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        const int alignment = platform::get_cache_line_size();
+        // Only the buffers tracked under a huge pages policy go back through
+        // the registry of the huge pages.
+        bool is_tracked = false;
+        void *ptr = prefer_huge_pages_
+                ? huge_pages::malloc(size, alignment, is_tracked)
+                : malloc(size, alignment);
         if (!ptr) return status::out_of_memory;
-        data_ = decltype(data_)(ptr, destroy);
+        data_ = decltype(data_)(ptr, is_tracked ? destroy_huge_pages : destroy);
         return status::success;
     }
 
 private:
     std::unique_ptr<void, void (*)(void *)> data_;
+    bool prefer_huge_pages_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
     static void release(void *ptr) {}
     static void destroy(void *ptr) { free(ptr); }
+    static void destroy_huge_pages(void *ptr) { huge_pages::free(ptr); }
 };
 
 } // namespace cpu
@@ -18,10 +18,14 @@
 #define CPU_CPU_PRIMITIVE_HPP
 
 #include <assert.h>
+#include <atomic>
+#include <cmath>
 
 #include "oneapi/dnnl/dnnl_types.h"
 
+#include "common/bit_cast.hpp"
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/primitive_attr.hpp"
 #include "common/primitive_exec_types.hpp"
 #include "common/utils.hpp"
@@ -138,4 +142,89 @@
 
 //NOLINTEND(bugprone-macro-parentheses)
 
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Absolute maximum of a source or a destination requested by the amax
+// attribute. Threads reduce their share of the values locally and merge the
+// result with `update()`, `store()` writes the maximum once all the threads
+// are done.
+struct amax_accumulator_t {
+    amax_accumulator_t(
+            const exec_ctx_t &ctx, const primitive_attr_t *attr, int arg)
+        : amax_(attr->amax_.has(arg)
+                          ? static_cast<float *>(ctx.host_ptr(
+                                  arg == DNNL_ARG_SRC ? DNNL_ARG_ATTR_SRC_AMAX
+                                                      : DNNL_ARG_ATTR_DST_AMAX))
+                          : nullptr) {}
+
+    bool enabled() const { return amax_ != nullptr; }
+
+    // Non-negative floats are ordered as their bit patterns, which lets a
+    // NaN win over any number.
+    void update(float value) {
+        const uint32_t bits = utils::bit_cast<uint32_t>(std::fabs(value));
+        uint32_t cur = bits_.load(std::memory_order_relaxed);
+        while (bits > cur
+                && !bits_.compare_exchange_weak(
+                        cur, bits, std::memory_order_relaxed)) {}
+    }
+
+    // Merges the absolute maximum of `nelems` contiguous values of type `dt`.
+    // Floating-point values are reduced as their bit patterns with the sign
+    // cleared, which keeps the loop an integer max the compiler vectorizes.
+    void update(const void *ptr, data_type_t dt, dim_t nelems) {
+        using namespace data_type;
+        switch (dt) {
+            case f32: update_abs_bits<uint32_t>(ptr, dt, nelems); break;
+            case bf16:
+            case f16: update_abs_bits<uint16_t>(ptr, dt, nelems); break;
+            case f8_e5m2:
+            case f8_e4m3: update_abs_bits<uint8_t>(ptr, dt, nelems); break;
+            case s32: update_int<int32_t>(ptr, nelems); break;
+            case s8: update_int<int8_t>(ptr, nelems); break;
+            case u8: update_int<uint8_t>(ptr, nelems); break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    float value() const { return utils::bit_cast<float>(bits_.load()); }
+
+    void store() const {
+        if (amax_) *amax_ = value();
+    }
+
+private:
+    float *amax_;
+    std::atomic<uint32_t> bits_ {0};
+
+    template <typename bits_t>
+    void update_abs_bits(const void *ptr, data_type_t dt, dim_t nelems) {
+        const bits_t abs_mask = static_cast<bits_t>(~bits_t(0) >> 1);
+        const auto *p = static_cast<const bits_t *>(ptr);
+        bits_t m = 0;
+        PRAGMA_OMP_SIMD(reduction(max : m))
+        for (dim_t i = 0; i < nelems; i++)
+            m = nstl::max(m, static_cast<bits_t>(p[i] & abs_mask));
+        update(io::load_float_value(dt, &m, 0));
+    }
+
+    template <typename int_t>
+    void update_int(const void *ptr, dim_t nelems) {
+        const auto *p = static_cast<const int_t *>(ptr);
+        int_t lo = 0, hi = 0;
+        PRAGMA_OMP_SIMD(reduction(min : lo) reduction(max : hi))
+        for (dim_t i = 0; i < nelems; i++) {
+            lo = nstl::min(lo, p[i]);
+            hi = nstl::max(hi, p[i]);
+        }
+        update(nstl::max(-static_cast<float>(lo), static_cast<float>(hi)));
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
 #endif // CPU_CPU_PRIMITIVE_HPP
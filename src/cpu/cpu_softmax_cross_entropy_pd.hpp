@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_CPU_SOFTMAX_CROSS_ENTROPY_PD_HPP
+#define CPU_CPU_SOFTMAX_CROSS_ENTROPY_PD_HPP
+
+#include "common/softmax_cross_entropy_pd.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_softmax_cross_entropy_pd_t : public softmax_cross_entropy_pd_t {
+    using softmax_cross_entropy_pd_t::softmax_cross_entropy_pd_t;
+
+protected:
+    // Checks the configurations supported by the implementations over plain
+    // matrices of logits.
+    status_t init_plain(engine_t *engine) {
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                platform::has_data_type_support(src_md()->data_type),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                platform::has_data_type_support(dst_md()->data_type),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                IMPLICATION(is_training(),
+                        platform::has_data_type_support(
+                                diff_src_md()->data_type)),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                set_default_params() == status::success,
+                VERBOSE_UNSUPPORTED_TAG);
+
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                memory_desc_wrapper(src_md()).matches_tag(format_tag::ab),
+                VERBOSE_UNSUPPORTED_TAG_S, "src");
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                memory_desc_wrapper(src_md(1)).is_dense(),
+                VERBOSE_UNSUPPORTED_TAG_S, "labels");
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                memory_desc_wrapper(dst_md()).is_dense(),
+                VERBOSE_UNSUPPORTED_TAG_S, "dst");
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                IMPLICATION(is_training(),
+                        memory_desc_wrapper(diff_src_md())
+                                .matches_tag(format_tag::ab)),
+                VERBOSE_UNSUPPORTED_TAG_S, "diff_src");
+
+        return status::success;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
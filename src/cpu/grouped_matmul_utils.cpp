@@ -0,0 +1,327 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_grouped_matmul_pd.hpp"
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/grouped_matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace grouped_matmul_utils {
+
+namespace {
+
+// Converts `n` consecutive values to f32.
+using load_row_t = void (*)(const void *row, float *out, dim_t n);
+
+template <data_type_t dt>
+void load_row(const void *row, float *out, dim_t n) {
+    using data_t = typename prec_traits_t<dt>::type;
+    const data_t *r = static_cast<const data_t *>(row);
+    PRAGMA_OMP_SIMD()
+    for (dim_t j = 0; j < n; ++j)
+        out[j] = static_cast<float>(r[j]);
+}
+
+// Two 4-bit values per byte, the first one in the low half.
+template <bool is_signed>
+void load_int4_row(const void *row, float *out, dim_t n) {
+    const uint8_t *r = static_cast<const uint8_t *>(row);
+    PRAGMA_OMP_SIMD()
+    for (dim_t j = 0; j < n / 2; ++j) {
+        int lo = r[j] & 0xf;
+        int hi = r[j] >> 4;
+        if (is_signed) {
+            lo = (lo ^ 0x8) - 0x8;
+            hi = (hi ^ 0x8) - 0x8;
+        }
+        out[2 * j] = static_cast<float>(lo);
+        out[2 * j + 1] = static_cast<float>(hi);
+    }
+}
+
+load_row_t get_load_row(data_type_t dt) {
+    using namespace data_type;
+    switch (dt) {
+        case f32: return load_row<f32>;
+        case bf16: return load_row<bf16>;
+        case f16: return load_row<f16>;
+        case s8: return load_row<s8>;
+        case u8: return load_row<u8>;
+        case s4: return load_int4_row<true>;
+        case u4: return load_int4_row<false>;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+// Quantization parameters of the weights, the mask selects the group, the K
+// and the N dimensions.
+struct wei_qparams_t {
+    wei_qparams_t(const quant_entries_t &entries, dim_t K, dim_t N)
+        : enabled(!entries.has_default_values(DNNL_ARG_WEIGHTS))
+        , dt(entries.get_data_type(DNNL_ARG_WEIGHTS)) {
+        const int mask = entries.get_mask(DNNL_ARG_WEIGHTS);
+        per_group = mask & (1 << 0);
+        per_k = mask & (1 << 1);
+        per_n = mask & (1 << 2);
+        group_k = per_k ? entries.get_group(DNNL_ARG_WEIGHTS, 0) : K;
+        k_stride = per_n ? N : 1;
+        g_stride = per_k ? (K / group_k) * k_stride : k_stride;
+    }
+
+    // Whether the parameters change at the row `k` of the weights.
+    bool changes_at(dim_t k) const { return k % group_k == 0; }
+
+    // The offset of the parameters of the row `k` of the group `g`.
+    dim_t row_off(dim_t g, dim_t k) const {
+        return (per_group ? g * g_stride : 0)
+                + (per_k ? (k / group_k) * k_stride : 0);
+    }
+
+    bool enabled;
+    data_type_t dt;
+    bool per_group = false, per_k = false, per_n = false;
+    dim_t group_k = 1, k_stride = 1, g_stride = 1;
+};
+
+} // namespace
+
+void init_scratchpad(
+        memory_tracking::registrar_t &scratchpad, dim_t ngroups) {
+    using namespace memory_tracking::names;
+    // The first rows and the first tiles of the groups.
+    scratchpad.book<dim_t>(key_grouped_matmul_tiles, 2 * (ngroups + 1));
+    scratchpad.book<float>(
+            key_grouped_matmul_wsp, dnnl_get_max_threads() * wsp_per_thr);
+}
+
+status_t execute(const exec_ctx_t &ctx, const cpu_grouped_matmul_pd_t *pd,
+        const tile_gemm_t &gemm) {
+    using namespace memory_tracking::names;
+
+    const dim_t M = pd->M();
+    const dim_t K = pd->K();
+    const dim_t N = pd->N();
+    const dim_t ngroups = pd->ngroups();
+    if (M == 0 || N == 0 || ngroups == 0) return status::success;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd->src_md(0));
+    const memory_desc_wrapper off_d(pd->src_md(1));
+    const memory_desc_wrapper wei_d(pd->weights_md(0));
+    const memory_desc_wrapper bia_d(pd->weights_md(1));
+    const memory_desc_wrapper dst_d(pd->dst_md());
+
+    const auto src_dt = src_d.data_type();
+    const auto wei_dt = wei_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const bool wei_is_int4
+            = utils::one_of(wei_dt, data_type::s4, data_type::u4);
+    const size_t src_dt_size = types::data_type_size(src_dt);
+    const size_t wei_dt_size = types::data_type_size(wei_dt);
+    const size_t dst_dt_size = types::data_type_size(dst_dt);
+    const load_row_t load_src_row = get_load_row(src_dt);
+    const load_row_t load_wei_row = get_load_row(wei_dt);
+    const bool with_bias = pd->with_bias();
+
+    offsets += off_d.offset0();
+
+    const auto &scales = pd->attr()->scales_;
+    const wei_qparams_t wei_sc(scales, K, N);
+    const void *wei_scales = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    VCHECK_ATTR(IMPLICATION(wei_sc.enabled, wei_scales != nullptr),
+            "Scales buffer for arg %d is missing", DNNL_ARG_WEIGHTS);
+    const wei_qparams_t wei_zp(pd->attr()->zero_points_, K, N);
+    const void *wei_zero_points = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+    VCHECK_ATTR(IMPLICATION(wei_zp.enabled, wei_zero_points != nullptr),
+            "Zero points buffer for arg %d is missing", DNNL_ARG_WEIGHTS);
+
+    // The common source and destination scales, as for matmul the result is
+    // `(src_scale * acc + bias) / dst_scale`.
+    float common_scales[2] = {1.f, 1.f};
+    for (int i : {0, 1}) {
+        const int arg = i == 0 ? DNNL_ARG_SRC : DNNL_ARG_DST;
+        if (scales.has_default_values(arg)) continue;
+        const void *arg_scales
+                = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | arg);
+        VCHECK_ATTR(arg_scales != nullptr,
+                "Scales buffer for arg %d is missing", arg);
+        common_scales[i] = io::load_float_value(
+                scales.get_data_type(arg), arg_scales, 0);
+    }
+    const float inv_dst_scale = 1.f / common_scales[1];
+    const float acc_scale = common_scales[0] * inv_dst_scale;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto wsp = scratchpad.template get<float>(key_grouped_matmul_wsp);
+    auto group_rows = scratchpad.template get<dim_t>(key_grouped_matmul_tiles);
+    auto group_tiles = group_rows + ngroups + 1;
+
+    // The offsets are not trusted to be sorted, a group past the end of the
+    // previous one or of the source is empty.
+    const dim_t nb_n = utils::div_up(N, n_blk);
+    group_rows[0] = 0;
+    group_tiles[0] = 0;
+    for (dim_t g = 0; g < ngroups; ++g) {
+        const dim_t beg = group_rows[g];
+        const dim_t end = nstl::max(beg, nstl::min<dim_t>(offsets[g], M));
+        group_rows[g + 1] = end;
+        group_tiles[g + 1]
+                = group_tiles[g] + utils::div_up(end - beg, m_blk) * nb_n;
+    }
+    const dim_t ntiles = group_tiles[ngroups];
+    if (ntiles == 0) return status::success;
+
+    auto wei_row = [&](dim_t g, dim_t k, dim_t n) {
+        const dim_t off = wei_d.blk_off(g, k, n);
+        return weights + (wei_is_int4 ? off / 2 : off * wei_dt_size);
+    };
+
+    // Loads the quantization parameters of the row `k` of the N block.
+    auto load_qparams = [&](const wei_qparams_t &qp, const void *buf,
+                                dim_t g, dim_t k, dim_t n0, dim_t nb,
+                                float *out) {
+        const dim_t off = qp.row_off(g, k);
+        for (dim_t n = 0; n < nb; ++n)
+            out[n] = io::load_float_value(
+                    qp.dt, buf, off + (qp.per_n ? n0 + n : 0));
+    };
+
+    const int nthr = static_cast<int>(
+            nstl::min<dim_t>(dnnl_get_max_threads(), ntiles));
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(ntiles, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *src_buf = wsp + ithr * wsp_per_thr;
+        float *wei_buf = src_buf + m_blk * k_blk;
+        float *acc = wei_buf + k_blk * n_blk;
+        float *sc_buf = acc + m_blk * n_blk;
+        float *zp_buf = sc_buf + n_blk;
+        float *bia_buf = zp_buf + n_blk;
+
+        dim_t g = std::upper_bound(group_tiles, group_tiles + ngroups + 1,
+                          start)
+                - group_tiles - 1;
+        for (dim_t t = start; t < end; ++t) {
+            while (group_tiles[g + 1] <= t)
+                ++g;
+
+            const dim_t nb_m = utils::div_up(
+                    group_rows[g + 1] - group_rows[g], m_blk);
+            const dim_t tile = t - group_tiles[g];
+            const dim_t m0 = group_rows[g] + (tile % nb_m) * m_blk;
+            const dim_t n0 = (tile / nb_m) * n_blk;
+            const dim_t mb = nstl::min(m_blk, group_rows[g + 1] - m0);
+            const dim_t nb = nstl::min(n_blk, N - n0);
+
+            for (dim_t i = 0; i < m_blk * n_blk; ++i)
+                acc[i] = 0.f;
+
+            for (dim_t k0 = 0; k0 < K; k0 += k_blk) {
+                const dim_t kb = nstl::min(k_blk, K - k0);
+
+                for (dim_t m = 0; m < mb; ++m)
+                    load_src_row(src
+                                    + src_d.blk_off(m0 + m, k0) * src_dt_size,
+                            src_buf + m * k_blk, kb);
+                for (dim_t m = mb; m < m_blk; ++m)
+                    utils::array_set(src_buf + m * k_blk, 0.f, kb);
+
+                for (dim_t k = 0; k < kb; ++k) {
+                    float *w = wei_buf + k * n_blk;
+                    load_wei_row(wei_row(g, k0 + k, n0), w, nb);
+                    if (!wei_sc.enabled && !wei_zp.enabled) continue;
+
+                    if (wei_sc.enabled && (k == 0 || wei_sc.changes_at(k0 + k)))
+                        load_qparams(wei_sc, wei_scales, g, k0 + k, n0, nb,
+                                sc_buf);
+                    if (wei_zp.enabled && (k == 0 || wei_zp.changes_at(k0 + k)))
+                        load_qparams(wei_zp, wei_zero_points, g, k0 + k, n0,
+                                nb, zp_buf);
+                    if (wei_zp.enabled) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t n = 0; n < nb; ++n)
+                            w[n] -= zp_buf[n];
+                    }
+                    if (wei_sc.enabled) {
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t n = 0; n < nb; ++n)
+                            w[n] *= sc_buf[n];
+                    }
+                }
+
+                gemm(src_buf, wei_buf, acc, mb, kb, nb);
+            }
+
+            if (with_bias) {
+                for (dim_t n = 0; n < nb; ++n)
+                    bia_buf[n] = inv_dst_scale
+                            * io::load_float_value(bia_d.data_type(), bias,
+                                    bia_d.off(g, n0 + n));
+            }
+
+            for (dim_t m = 0; m < mb; ++m) {
+                float *c = acc + m * n_blk;
+                PRAGMA_OMP_SIMD()
+                for (dim_t n = 0; n < nb; ++n)
+                    c[n] = c[n] * acc_scale + (with_bias ? bia_buf[n] : 0.f);
+
+                char *d = dst + dst_d.blk_off(m0 + m, n0) * dst_dt_size;
+                switch (dst_dt) {
+                    case data_type::f32:
+                        utils::array_copy(reinterpret_cast<float *>(d), c, nb);
+                        break;
+                    case data_type::bf16:
+                        cvt_float_to_bfloat16(
+                                reinterpret_cast<bfloat16_t *>(d), c, nb);
+                        break;
+                    case data_type::f16:
+                        cvt_float_to_float16(
+                                reinterpret_cast<float16_t *>(d), c, nb);
+                        break;
+                    default: assert(!"unsupported data type");
+                }
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace grouped_matmul_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GROUPED_MATMUL_UTILS_HPP
+#define CPU_GROUPED_MATMUL_UTILS_HPP
+
+#include <functional>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_grouped_matmul_pd_t;
+
+namespace grouped_matmul_utils {
+
+// The tile sizes. The N block is even to keep the 4-bit weights byte aligned.
+constexpr dim_t m_blk = 32;
+constexpr dim_t n_blk = 64;
+constexpr dim_t k_blk = 256;
+
+// A thread converts a block of the source and decompresses a block of the
+// weights to f32, accumulates a tile, and keeps the quantization parameters
+// and the bias of the N block.
+constexpr dim_t wsp_per_thr
+        = m_blk * k_blk + k_blk * n_blk + m_blk * n_blk + 3 * n_blk;
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad, dim_t ngroups);
+
+// Accumulates the product of an `m_blk x kb` block of the source and a
+// `kb x nb` block of the weights, both f32 with the leading dimensions
+// `k_blk` and `n_blk`, into the `m_blk x n_blk` tile `c`. Only the first `mb`
+// rows of the tile are stored, the rows of the source past them are zero.
+using tile_gemm_t = std::function<void(const float *a, const float *b,
+        float *c, dim_t mb, dim_t kb, dim_t nb)>;
+
+// Splits the destination of every group in tiles, distributes the tiles
+// between the threads, prepares the f32 blocks of the operands for `gemm` and
+// applies the scales and the bias to the accumulated tiles.
+status_t execute(const exec_ctx_t &ctx, const cpu_grouped_matmul_pd_t *pd,
+        const tile_gemm_t &gemm);
+
+} // namespace grouped_matmul_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
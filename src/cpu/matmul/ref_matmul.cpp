@@ -45,6 +45,13 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto seed = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
     const auto rnd_seed
             = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_ROUNDING_SEED);
+    const auto sn_mean = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_MEAN);
+    const auto sn_var
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_VARIANCE);
+    const auto sn_scale
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_SCALE);
+    const auto sn_shift
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_SHIFT);
     auto dropout_mask = CTX_OUT_CLEAN_MEM(
             unsigned char *, DNNL_ARG_ATTR_DROPOUT_MASK, status);
     CHECK(status);
@@ -66,9 +73,23 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const memory_desc_wrapper dropout_mask_d(
             pd()->attr()->dropout_.dropout_desc_);
 
+    amax_accumulator_t src_amax(ctx, pd()->attr(), DNNL_ARG_SRC);
+    amax_accumulator_t dst_amax(ctx, pd()->attr(), DNNL_ARG_DST);
+
     if (src_d.has_zero_dim() || weights_d.has_zero_dim()
-            || dst_d.has_zero_dim())
+            || dst_d.has_zero_dim()) {
+        // The outputs are empty but the maxima are still expected: zero for
+        // an empty tensor, and a source with a non-empty shape is accounted
+        // in full.
+        if (src_amax.enabled() && !src_d.has_zero_dim()) {
+            for (dim_t i = 0; i < src_d.nelems(); i++)
+                src_amax.update(io::load_float_value(
+                        src_d.data_type(), src, src_d.off_l(i)));
+        }
+        src_amax.store();
+        dst_amax.store();
         return status::success;
+    }
 
     const bool non_default_attrs = !pd()->attr()->has_default_values();
 
@@ -80,6 +101,45 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const dim_t K = helper.K();
     const dim_t batch = helper.batch();
 
+    // Source normalization: mean and inverse standard deviation of every
+    // source row are stored one after another in the scratchpad.
+    const auto &src_norm = pd()->attr()->src_norm_;
+    const bool with_src_norm = !src_norm.has_default_values();
+    float *sn_stats = with_src_norm
+            ? ctx.get_scratchpad_grantor().template get<float>(
+                    memory_tracking::names::key_matmul_src_norm_stats)
+            : nullptr;
+    if (with_src_norm) {
+        const dim_t rows = src_d.nelems() / K;
+        parallel_nd(rows, [&](dim_t r) {
+            float mean = 0.f, var = 0.f;
+            if (src_norm.use_global_stats()) {
+                mean = src_norm.rms_norm() ? 0.f : sn_mean[r];
+                var = sn_var[r];
+            } else {
+                dims_t idx;
+                utils::l_dims_by_l_offset(idx, r * K, src_d.dims(), ndims);
+                auto load = [&](dim_t k) {
+                    idx[ndims - 1] = k;
+                    return io::load_float_value(
+                            src_d.data_type(), src, src_d.off_v(idx));
+                };
+                if (!src_norm.rms_norm()) {
+                    for (dim_t k = 0; k < K; ++k)
+                        mean += load(k);
+                    mean /= K;
+                }
+                for (dim_t k = 0; k < K; ++k) {
+                    const float d = load(k) - mean;
+                    var += d * d;
+                }
+                var /= K;
+            }
+            sn_stats[2 * r] = mean;
+            sn_stats[2 * r + 1] = 1.f / sqrtf(var + src_norm.epsilon_);
+        });
+    }
+
     // Weights decompression
     const bool with_wei_decompression
             = utils::one_of(weights_d.data_type(), data_type::s8, data_type::u8,
@@ -126,8 +186,9 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto dst_rnd_mode = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST);
 
-    // mm kernel
-    auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
+    // mm kernel, the source values are accounted in `src_max` once per row
+    auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n,
+                       float &src_max) {
         float acc = 0;
         dims_t src_dims_idx, weights_dims_idx;
         utils::copy_dims_with_mask(src_dims_idx, dst_dims_idx, ndims, src_mask);
@@ -137,13 +198,25 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         weights_dims_idx[ndims - 1] = n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
+        dim_t src_row = 0;
+        for (int d = 0; d < ndims - 1; ++d)
+            src_row = src_row * src_d.dims()[d] + src_dims_idx[d];
         for (dim_t k = 0; k < K; ++k) {
             src_k_dim = k;
             wei_k_dim = k;
             const auto src_off = src_d.off_v(src_dims_idx);
             const auto weights_off = weights_d.off_v(weights_dims_idx);
-            const float s
-                    = io::load_float_value(src_d.data_type(), src, src_off);
+            float s = io::load_float_value(src_d.data_type(), src, src_off);
+            if (n == 0) src_max = nstl::max(src_max, ::fabsf(s));
+            if (with_src_norm) {
+                s = (s - sn_stats[2 * src_row]) * sn_stats[2 * src_row + 1];
+                if (src_norm.use_scale()) s *= sn_scale[k];
+                if (src_norm.use_shift()) s += sn_shift[k];
+                // The normalized source is consumed in the source data type.
+                float s_rounded = 0.f;
+                io::store_float_value(src_d.data_type(), s, &s_rounded, 0);
+                s = io::load_float_value(src_d.data_type(), &s_rounded, 0);
+            }
             float w = io::load_float_value(
                     weights_d.data_type(), weights, weights_off);
             // weights decompression should happen before the operation
@@ -190,6 +263,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     // logic, we limit parallelization on M and N by a factor of 2.
     parallel_nd(batch, utils::div_up(M, 2), utils::div_up(N, 2),
             [&](dim_t mb, dim_t m_, dim_t n_) {
+                float src_max = 0.f, dst_max = 0.f;
                 for_(int m = 2 * m_; m < std::min<int>(2 * (m_ + 1), M); m++)
                 for (int n = 2 * n_; n < std::min<int>(2 * (n_ + 1), N); n++) {
                     dims_t dst_dims_idx;
@@ -197,7 +271,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                     const size_t l_offset = mb * M * N + m * N + n;
                     utils::l_dims_by_l_offset(
                             dst_dims_idx, l_offset, dst_d.dims(), ndims);
-                    float d = ker(dst_dims_idx, m, n);
+                    float d = ker(dst_dims_idx, m, n, src_max);
                     if (with_src_scales) d *= src_scales[0];
                     if (with_wei_scales && !with_wei_decompression) {
                         // Single scale value was already converted into f32.
@@ -222,6 +296,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                         args.dst_md = pd()->dst_md();
                         ref_post_ops->execute(d, args);
                     }
+                    dst_max = nstl::max(dst_max, ::fabsf(d));
                     if (with_dst_scales) d *= dst_scales[0];
                     if (dst_rnd_mode == rounding_mode::stochastic)
                         d = math::stochastic_round_fwd(
@@ -230,7 +305,11 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                     utils::dim_iterator(
                             dst_d.dims(), dst_dims_idx, batch_ndims);
                 }
+                if (src_amax.enabled()) src_amax.update(src_max);
+                if (dst_amax.enabled()) dst_amax.update(dst_max);
             });
+    src_amax.store();
+    dst_amax.store();
 
     return status::success;
 }
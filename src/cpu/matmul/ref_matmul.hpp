@@ -100,7 +100,8 @@ struct ref_matmul_t : public primitive_t {
                                     | smask_t::zero_points_groups
                                     | smask_t::post_ops | smask_t::sum_dt
                                     | smask_t::fpmath_mode | smask_t::dropout
-                                    | smask_t::rounding_mode,
+                                    | smask_t::rounding_mode
+                                    | smask_t::src_norm | smask_t::amax,
                             dst_type),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type,
@@ -126,11 +127,27 @@ struct ref_matmul_t : public primitive_t {
                             memory_desc_wrapper(dst_md(0)).similar_to(
                                     attr_.dropout_.dropout_desc_, true, false)),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(IMPLICATION(!attr_.src_norm_.has_default_values(),
+                                     !has_runtime_dims_or_strides()),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
+            init_scratchpad();
             return status::success;
         }
 
     private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            if (attr()->src_norm_.has_default_values()) return;
+
+            // Mean and inverse standard deviation of every source row.
+            const memory_desc_wrapper src_d(src_md());
+            const dim_t rows = src_d.nelems() / K();
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    key_matmul_src_norm_stats, 2 * rows);
+        }
+
         bool zero_points_ok() const {
             const auto &zp = attr()->zero_points_;
             if (!zp.has_default_values(DNNL_ARG_SRC)) { return false; }
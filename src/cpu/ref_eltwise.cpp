@@ -15,12 +15,14 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <cmath>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_eltwise.hpp"
 #include "cpu/simple_q10n.hpp"
 
@@ -101,21 +103,35 @@ status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
     const float beta = pd()->desc()->beta;
     const int ndims = pd()->ndims();
 
-    parallel_nd(
-            MB, C, D, H, W, [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
-                auto data_p_off = DATA_OFF(src_d, n, c, d, h, w);
-                float res = compute_eltwise_scalar_fwd(
-                        alg_kind, src[data_p_off], alpha, beta);
-                dim_t data_l_off = (((n * C + c) * D + d) * H + h) * W + w;
-
-                ref_post_ops_t::args_t args;
-                args.ctx = &ctx;
-                args.l_offset = data_l_off;
-                args.dst_md = pd()->dst_md();
-                ref_post_ops->execute(res, args);
-
-                dst[data_p_off] = cpu::q10n::saturate_and_round<data_t>(res);
-            });
+    amax_accumulator_t src_amax(ctx, pd()->attr(), DNNL_ARG_SRC);
+    amax_accumulator_t dst_amax(ctx, pd()->attr(), DNNL_ARG_DST);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        float src_max = 0.f, dst_max = 0.f;
+        for_nd(ithr, nthr, MB, C, D, H, W,
+                [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
+                    auto data_p_off = DATA_OFF(src_d, n, c, d, h, w);
+                    const float s = src[data_p_off];
+                    float res = compute_eltwise_scalar_fwd(
+                            alg_kind, s, alpha, beta);
+                    dim_t data_l_off = (((n * C + c) * D + d) * H + h) * W + w;
+
+                    ref_post_ops_t::args_t args;
+                    args.ctx = &ctx;
+                    args.l_offset = data_l_off;
+                    args.dst_md = pd()->dst_md();
+                    ref_post_ops->execute(res, args);
+
+                    src_max = nstl::max(src_max, std::fabs(s));
+                    dst_max = nstl::max(dst_max, std::fabs(res));
+                    dst[data_p_off]
+                            = cpu::q10n::saturate_and_round<data_t>(res);
+                });
+        if (src_amax.enabled()) src_amax.update(src_max);
+        if (dst_amax.enabled()) dst_amax.update(dst_max);
+    });
+    src_amax.store();
+    dst_amax.store();
     return status::success;
 }
 
@@ -53,7 +53,8 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_ELTWISE(platform::has_data_type_support(data_type),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_ELTWISE(attr()->has_default_values(sm::post_ops),
+            VDISPATCH_ELTWISE(
+                    attr()->has_default_values(sm::post_ops | sm::amax),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_ELTWISE(
                     ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
@@ -76,8 +77,10 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     && src_d.blocking_desc().inner_idxs[0] == 1
                     && src_d.only_padded_dim(1) && src_d.is_dense(true);
 
+            // Only the generic path computes the absolute maximum.
             const auto &po = attr()->post_ops_;
-            if (has_zero_dim_memory() || !po.has_default_values())
+            if (has_zero_dim_memory() || !po.has_default_values()
+                    || !attr()->amax_.has_default_values())
                 use_dense_ = use_nCspBc_padded_ = false;
 
             return status::success;
@@ -32,6 +32,7 @@
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/brgemm_wino_reorders.hpp"
 #include "cpu/x64/jit_uni_reorder.hpp"
 #include "cpu/x64/jit_uni_reorder_direct_copy.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_reorders.hpp"
@@ -2557,7 +2557,7 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
         using smask_t = primitive_attr_t::skip_mask_t;
         smask_t skip_mask = smask_t::scales_data_type | smask_t::scales_groups
                 | smask_t::zero_points_data_type | smask_t::zero_points_groups
-                | smask_t::post_ops;
+                | smask_t::post_ops | smask_t::amax;
         VDISPATCH_REORDER_IC(
                 attr->has_default_values(skip_mask), VERBOSE_UNSUPPORTED_ATTR);
         VDISPATCH_REORDER_IC(simple_po_check(attr), VERBOSE_UNSUPPORTED_POSTOP);
@@ -2622,7 +2622,7 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
                     src_zps_group0, src_zps_group1, src_zps_d.data_type());
         }
 
-        parallel_nd(input_d.nelems(), [&](dim_t idx) {
+        const auto ker = [&](dim_t idx, float &src_max, float &dst_max) {
             // Must be per thread; when shared, race condition happens.
             dims_t input_idx {};
             float src_scale = 1.f;
@@ -2660,11 +2660,29 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
 
             const auto i_off = input_d.off_l(idx);
             const auto o_off = output_d.off_l(idx);
-            float d = src_scale * (input[i_off] - src_zp_val);
+            const float s = input[i_off];
+            float d = src_scale * (s - src_zp_val);
             if (beta) d += beta * output[o_off];
+            src_max = nstl::max(src_max, std::fabs(s));
+            dst_max = nstl::max(dst_max, std::fabs(d));
             d = d * dst_scale + dst_zp;
             output[o_off] = _qz_a1b0<data_type::f32, type_o>()(d);
+        };
+
+        amax_accumulator_t src_amax(ctx, pd->attr(), DNNL_ARG_SRC);
+        amax_accumulator_t dst_amax(ctx, pd->attr(), DNNL_ARG_DST);
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(input_d.nelems(), nthr, ithr, start, end);
+            float src_max = 0.f, dst_max = 0.f;
+            for (dim_t idx = start; idx < end; idx++)
+                ker(idx, src_max, dst_max);
+            if (src_amax.enabled()) src_amax.update(src_max);
+            if (dst_amax.enabled()) dst_amax.update(dst_max);
         });
+        src_amax.store();
+        dst_amax.store();
         return status::success;
     }
 };
@@ -2693,12 +2711,21 @@ struct simple_reorder_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             using skip_mask_t = primitive_attr_t::skip_mask_t;
-            VDISPATCH_REORDER_IC(
-                    attr->has_default_values(skip_mask_t::scales_data_type
-                            | skip_mask_t::scales_groups
-                            | skip_mask_t::zero_points_data_type
-                            | skip_mask_t::zero_points_groups
-                            | skip_mask_t::post_ops),
+            auto skip_mask = skip_mask_t::scales_data_type
+                    | skip_mask_t::scales_groups
+                    | skip_mask_t::zero_points_data_type
+                    | skip_mask_t::zero_points_groups | skip_mask_t::post_ops;
+            // Only the generic reference implementation computes the absolute
+            // maxima requested with the amax attribute.
+            constexpr bool is_generic_reference
+                    = std::is_same<spec, cpu::spec::reference>::value
+                    && tag_i == format_tag::any && tag_o == format_tag::any
+                    && !utils::one_of(type_i, data_type::s4, data_type::u4,
+                            data_type::f4_e2m1, data_type::f4_e3m0)
+                    && !utils::one_of(type_o, data_type::s4, data_type::u4,
+                            data_type::f4_e2m1, data_type::f4_e3m0);
+            if (is_generic_reference) skip_mask = skip_mask | skip_mask_t::amax;
+            VDISPATCH_REORDER_IC(attr->has_default_values(skip_mask),
                     VERBOSE_UNSUPPORTED_ATTR);
 
             auto status = simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
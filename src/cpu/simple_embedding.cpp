@@ -0,0 +1,249 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_embedding.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// How many indices ahead the table rows are prefetched.
+constexpr dim_t prefetch_distance = 16;
+
+void prefetch_row(const char *row, size_t size) {
+#if defined(__GNUC__) || defined(__clang__)
+    for (size_t off = 0; off < size; off += platform::get_cache_line_size())
+        __builtin_prefetch(row + off, /* rw = */ 0, /* locality = */ 3);
+#else
+    MAYBE_UNUSED(row);
+    MAYBE_UNUSED(size);
+#endif
+}
+
+// Accumulates `alpha * (row - zero_point)` into the f32 buffer, `beta` being
+// `alpha * zero_point`.
+using accumulate_row_t = void (*)(
+        const void *row, float alpha, float beta, float *acc, dim_t n);
+
+template <data_type_t src_type>
+void accumulate_row(
+        const void *row, float alpha, float beta, float *acc, dim_t n) {
+    using src_t = typename prec_traits_t<src_type>::type;
+    const src_t *r = static_cast<const src_t *>(row);
+    PRAGMA_OMP_SIMD()
+    for (dim_t j = 0; j < n; ++j)
+        acc[j] += alpha * static_cast<float>(r[j]) - beta;
+}
+
+// Two 4-bit values per byte, the first one in the low half.
+template <bool is_signed>
+void accumulate_int4_row(
+        const void *row, float alpha, float beta, float *acc, dim_t n) {
+    const uint8_t *r = static_cast<const uint8_t *>(row);
+    PRAGMA_OMP_SIMD()
+    for (dim_t j = 0; j < n / 2; ++j) {
+        int lo = r[j] & 0xf;
+        int hi = r[j] >> 4;
+        if (is_signed) {
+            lo = (lo ^ 0x8) - 0x8;
+            hi = (hi ^ 0x8) - 0x8;
+        }
+        acc[2 * j] += alpha * static_cast<float>(lo) - beta;
+        acc[2 * j + 1] += alpha * static_cast<float>(hi) - beta;
+    }
+}
+
+accumulate_row_t get_accumulate_row(data_type_t src_dt) {
+    using namespace data_type;
+    switch (src_dt) {
+        case f32: return accumulate_row<f32>;
+        case bf16: return accumulate_row<bf16>;
+        case f16: return accumulate_row<f16>;
+        case s8: return accumulate_row<s8>;
+        case u8: return accumulate_row<u8>;
+        case s4: return accumulate_int4_row<true>;
+        case u4: return accumulate_int4_row<false>;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+} // namespace
+
+status_t simple_embedding_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const dim_t nbags = pd()->nbags();
+    const dim_t emb_dim = pd()->embedding_dim();
+    if (nbags == 0 || emb_dim == 0) return status::success;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper ind_d(pd()->src_md(1));
+    const memory_desc_wrapper off_d(pd()->src_md(2));
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t table_rows = pd()->table_rows();
+    const dim_t nindices = pd()->nindices();
+    const bool is_bag = pd()->is_bag();
+    const bool is_mean = pd()->is_mean();
+    const bool with_weights = pd()->with_weights();
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const bool is_int4 = utils::one_of(src_dt, data_type::s4, data_type::u4);
+    const size_t src_dt_size = types::data_type_size(src_dt);
+    const size_t dst_dt_size = types::data_type_size(dst_dt);
+    const size_t row_size = is_int4 ? emb_dim / 2 : emb_dim * src_dt_size;
+    const accumulate_row_t accumulate = get_accumulate_row(src_dt);
+
+    if (nindices > 0) indices += ind_d.offset0();
+    if (is_bag) offsets += off_d.offset0();
+
+    const auto &scales = pd()->attr()->scales_;
+    const bool with_scales = !scales.has_default_values(DNNL_ARG_SRC);
+    const bool per_row_scales = with_scales && scales.get_mask(DNNL_ARG_SRC);
+    const auto scales_dt = scales.get_data_type(DNNL_ARG_SRC);
+    const void *src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    VCHECK_ATTR(IMPLICATION(with_scales, src_scales != nullptr),
+            "Scales buffer for arg %d is missing", DNNL_ARG_SRC);
+
+    const auto &zero_points = pd()->attr()->zero_points_;
+    const bool with_zp = !zero_points.has_default_values(DNNL_ARG_SRC);
+    const bool per_row_zp = with_zp && zero_points.get_mask(DNNL_ARG_SRC);
+    const auto zp_dt = zero_points.get_data_type(DNNL_ARG_SRC);
+    const void *src_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC);
+    VCHECK_ATTR(IMPLICATION(with_zp, src_zp != nullptr),
+            "Zero points buffer for arg %d is missing", DNNL_ARG_SRC);
+
+    auto acc_buf = ctx.get_scratchpad_grantor().template get<float>(
+            key_embedding_acc);
+
+    auto table_row = [&](dim_t row) {
+        const dim_t off = src_d.blk_off(row);
+        return src + (is_int4 ? off / 2 : off * src_dt_size);
+    };
+
+    // The range of indices of a bag. The offsets are not trusted to be
+    // sorted, a bag out of the indices range is empty.
+    auto bag_range = [&](dim_t bag, dim_t &beg, dim_t &end) {
+        if (!is_bag) {
+            beg = bag;
+            end = bag + 1;
+            return;
+        }
+        beg = nstl::min<dim_t>(nstl::max<dim_t>(offsets[bag], 0), nindices);
+        end = bag + 1 < nbags ? offsets[bag + 1] : nindices;
+        end = nstl::max(beg, nstl::min(end, nindices));
+    };
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t bag_start = 0, bag_end = 0;
+        balance211(nbags, nthr, ithr, bag_start, bag_end);
+        if (bag_start == bag_end) return;
+
+        // The rows are prefetched up to the last index of the thread.
+        dim_t last_beg = 0, last_end = 0;
+        bag_range(bag_end - 1, last_beg, last_end);
+        const dim_t ind_end = last_end;
+
+        for (dim_t bag = bag_start; bag < bag_end; ++bag) {
+            dim_t beg = 0, end = 0;
+            bag_range(bag, beg, end);
+
+            char *dst_row = dst + dst_d.blk_off(bag) * dst_dt_size;
+            float *acc = dst_dt == data_type::f32
+                    ? reinterpret_cast<float *>(dst_row)
+                    : acc_buf + ithr * emb_dim;
+            PRAGMA_OMP_SIMD()
+            for (dim_t j = 0; j < emb_dim; ++j)
+                acc[j] = 0.f;
+
+            dim_t nrows = 0;
+            for (dim_t i = beg; i < end; ++i) {
+                if (i + prefetch_distance < ind_end) {
+                    const dim_t next = indices[i + prefetch_distance];
+                    if (0 <= next && next < table_rows)
+                        prefetch_row(table_row(next), row_size);
+                }
+
+                // Out of range indices don't contribute to the bag.
+                const dim_t row = indices[i];
+                if (row < 0 || row >= table_rows) continue;
+
+                float alpha = with_weights
+                        ? io::load_float_value(wei_d.data_type(), weights,
+                                wei_d.off_l(i))
+                        : 1.f;
+                if (with_scales)
+                    alpha *= io::load_float_value(
+                            scales_dt, src_scales, per_row_scales ? row : 0);
+                const float zp = with_zp
+                        ? static_cast<float>(io::load_int_value(
+                                zp_dt, src_zp, per_row_zp ? row : 0))
+                        : 0.f;
+                accumulate(table_row(row), alpha, alpha * zp, acc, emb_dim);
+                ++nrows;
+            }
+
+            if (is_mean && nrows > 0) {
+                const float inv_size = 1.f / static_cast<float>(nrows);
+                PRAGMA_OMP_SIMD()
+                for (dim_t j = 0; j < emb_dim; ++j)
+                    acc[j] *= inv_size;
+            }
+
+            switch (dst_dt) {
+                case data_type::f32: break;
+                case data_type::bf16:
+                    cvt_float_to_bfloat16(
+                            reinterpret_cast<bfloat16_t *>(dst_row), acc,
+                            emb_dim);
+                    break;
+                case data_type::f16:
+                    cvt_float_to_float16(
+                            reinterpret_cast<float16_t *>(dst_row), acc,
+                            emb_dim);
+                    break;
+                default: assert(!"unsupported data type");
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
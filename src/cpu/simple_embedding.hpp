@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_EMBEDDING_HPP
+#define CPU_SIMPLE_EMBEDDING_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_embedding_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Embedding lookup and bag reduction over plain tables.
+//
+// The bags are distributed between the threads and the rows of a bag are
+// dequantized and accumulated in f32. The rows are random accesses into
+// tables usually much larger than the caches which the hardware prefetchers
+// can't anticipate, so the rows of the next indices are prefetched in
+// software while the current one is accumulated.
+struct simple_embedding_t : public primitive_t {
+    struct pd_t : public cpu_embedding_pd_t {
+        using cpu_embedding_pd_t::cpu_embedding_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_embedding_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using sm = primitive_attr_t::skip_mask_t;
+
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            VDISPATCH_EMBEDDING(platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING(platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING(IMPLICATION(with_weights(),
+                                        platform::has_data_type_support(
+                                                weights_md()->data_type)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING(
+                    attr()->has_default_values(sm::scales | sm::zero_points),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_EMBEDDING(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper dst_d(dst_md());
+            VDISPATCH_EMBEDDING(src_d.matches_tag(format_tag::ab),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_EMBEDDING(dst_d.matches_tag(format_tag::ab),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+            // Rows of 4-bit tables have to start on a byte boundary.
+            VDISPATCH_EMBEDDING(IMPLICATION(utils::one_of(src_dt, s4, u4),
+                                        embedding_dim() % 2 == 0
+                                                && src_d.offset0() % 2 == 0),
+                    VERBOSE_BAD_DIM, "src", 1);
+            VDISPATCH_EMBEDDING(memory_desc_wrapper(src_md(1)).is_dense(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "indices");
+            VDISPATCH_EMBEDDING(IMPLICATION(is_bag(),
+                                        memory_desc_wrapper(src_md(2))
+                                                .is_dense()),
+                    VERBOSE_UNSUPPORTED_TAG_S, "offsets");
+            VDISPATCH_EMBEDDING(IMPLICATION(with_weights(),
+                                        memory_desc_wrapper(weights_md())
+                                                .is_dense()),
+                    VERBOSE_UNSUPPORTED_TAG_S, "weights");
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+    private:
+        // The rows are accumulated in f32 directly in an f32 destination
+        // and in a per-thread buffer otherwise.
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            if (dst_md()->data_type == data_type::f32) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(key_embedding_acc,
+                    dnnl_get_max_threads() * embedding_dim());
+        }
+    };
+
+    simple_embedding_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
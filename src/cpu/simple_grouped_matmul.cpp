@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/grouped_matmul_utils.hpp"
+#include "cpu/simple_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t simple_grouped_matmul_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using namespace grouped_matmul_utils;
+
+    auto gemm = [](const float *a, const float *b, float *c, dim_t mb,
+                        dim_t kb, dim_t nb) {
+        for (dim_t m = 0; m < mb; ++m) {
+            float *c_row = c + m * n_blk;
+            const float *a_row = a + m * k_blk;
+            for (dim_t k = 0; k < kb; ++k) {
+                const float *b_row = b + k * n_blk;
+                PRAGMA_OMP_SIMD()
+                for (dim_t n = 0; n < nb; ++n)
+                    c_row[n] += a_row[k] * b_row[n];
+            }
+        }
+    };
+
+    return grouped_matmul_utils::execute(ctx, pd(), gemm);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_GROUPED_MATMUL_HPP
+#define CPU_SIMPLE_GROUPED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_grouped_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Grouped matrix multiplication over plain matrices.
+//
+// The destination of every group is split in M x N tiles and the tiles of
+// all the groups are distributed between the threads at once, so that the
+// groups with a few rows don't leave the cores idle as separate matmuls
+// would. The tiles of a thread go over the M blocks first, which keeps the
+// block of the weights, decompressed to f32 once per K block, in cache. The
+// tiles are accumulated with a plain loop, see `grouped_matmul_utils`.
+struct simple_grouped_matmul_t : public primitive_t {
+    struct pd_t : public cpu_grouped_matmul_pd_t {
+        using cpu_grouped_matmul_pd_t::cpu_grouped_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_grouped_matmul_t);
+
+        status_t init(engine_t *engine) { return init_plain(engine); }
+    };
+
+    simple_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
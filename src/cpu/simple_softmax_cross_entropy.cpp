@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cmath>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_softmax_cross_entropy.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// The number of logits converted to f32 at once. A block stays in registers
+// or L1 and the exponents of a block are computed in a single loop.
+constexpr dim_t block_size = 64;
+
+void load_block(data_type_t dt, const void *row, dim_t c, dim_t len,
+        float *block) {
+    if (dt == data_type::f32) {
+        const float *src = static_cast<const float *>(row) + c;
+        for (dim_t i = 0; i < len; ++i)
+            block[i] = src[i];
+        return;
+    }
+    for (dim_t i = 0; i < len; ++i)
+        block[i] = io::load_float_value(dt, row, c + i);
+}
+
+} // namespace
+
+status_t simple_softmax_cross_entropy_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto labels = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto diff_src = pd()->is_training()
+            ? CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC)
+            : nullptr;
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper labels_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+
+    const dim_t N = pd()->N();
+    const dim_t C = pd()->C();
+    const float eps = pd()->label_smoothing();
+    const float eps_c = eps / C;
+    const dim_t ignore_index = pd()->ignore_index();
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const auto diff_src_dt = diff_src_d.data_type();
+    const size_t src_dt_size = types::data_type_size(src_dt);
+    const size_t diff_src_dt_size = types::data_type_size(diff_src_dt);
+
+    parallel_nd(N, [&](dim_t n) {
+        const void *x = src + src_d.off(n, 0) * src_dt_size;
+        void *dx = diff_src
+                ? diff_src + diff_src_d.off(n, 0) * diff_src_dt_size
+                : nullptr;
+        const dim_t label = labels[labels_d.off(n)];
+        const dim_t dst_off = dst_d.off(n);
+
+        if (label == ignore_index) {
+            io::store_float_value(dst_dt, 0.f, dst, dst_off);
+            if (dx) {
+                for (dim_t c = 0; c < C; ++c)
+                    io::store_float_value(diff_src_dt, 0.f, dx, c);
+            }
+            return;
+        }
+        // The loss of a label outside of the classes is undefined.
+        if (label < 0 || label >= C) {
+            const float nan = std::numeric_limits<float>::quiet_NaN();
+            io::store_float_value(dst_dt, nan, dst, dst_off);
+            if (dx) {
+                for (dim_t c = 0; c < C; ++c)
+                    io::store_float_value(diff_src_dt, nan, dx, c);
+            }
+            return;
+        }
+
+        float block[block_size];
+
+        // Pass 1: the running maximum `m` and the sum `s` of exp(x - m),
+        // rescaled whenever the maximum grows.
+        float m = -std::numeric_limits<float>::infinity();
+        float s = 0.f;
+        float sum_x = 0.f;
+        for (dim_t c = 0; c < C; c += block_size) {
+            const dim_t len = nstl::min(block_size, C - c);
+            load_block(src_dt, x, c, len, block);
+
+            float block_max = block[0];
+            for (dim_t i = 1; i < len; ++i)
+                block_max = nstl::max(block_max, block[i]);
+            if (block_max > m) {
+                s *= ::expf(m - block_max);
+                m = block_max;
+            }
+
+            float block_s = 0.f;
+            float block_x = 0.f;
+            for (dim_t i = 0; i < len; ++i) {
+                block_s += ::expf(block[i] - m);
+                block_x += block[i];
+            }
+            s += block_s;
+            sum_x += block_x;
+        }
+
+        // With t = (1 - eps) * onehot(label) + eps / C and
+        // log(p_c) = x_c - m - log(s):
+        // loss = -sum(t_c * log(p_c))
+        //      = m + log(s) - (1 - eps) * x_label - eps / C * sum(x_c).
+        const float x_label = io::load_float_value(src_dt, x, label);
+        const float log_s = m + ::logf(s);
+        const float loss = log_s - (1.f - eps) * x_label - eps_c * sum_x;
+        io::store_float_value(dst_dt, loss, dst, dst_off);
+
+        if (!dx) return;
+
+        // Pass 2: the gradient p - t.
+        const float inv_s = 1.f / s;
+        for (dim_t c = 0; c < C; c += block_size) {
+            const dim_t len = nstl::min(block_size, C - c);
+            load_block(src_dt, x, c, len, block);
+            for (dim_t i = 0; i < len; ++i)
+                block[i] = ::expf(block[i] - m) * inv_s - eps_c;
+            if (label >= c && label < c + len) block[label - c] -= 1.f - eps;
+            for (dim_t i = 0; i < len; ++i)
+                io::store_float_value(diff_src_dt, block[i], dx, c + i);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_SIMPLE_SOFTMAX_CROSS_ENTROPY_HPP
+#define CPU_SIMPLE_SOFTMAX_CROSS_ENTROPY_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_softmax_cross_entropy_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Softmax cross-entropy loss over the rows of a matrix of logits.
+//
+// The probabilities are never written to memory. A first pass over a row
+// computes its maximum and the sum of the exponents online, block by block,
+// along with the sum of the logits the label smoothing needs. The loss
+// follows from these three values and the logit of the label. For training,
+// a second pass recomputes the probabilities and writes the gradient while
+// the row is still in cache.
+struct simple_softmax_cross_entropy_t : public primitive_t {
+    struct pd_t : public cpu_softmax_cross_entropy_pd_t {
+        using cpu_softmax_cross_entropy_pd_t::cpu_softmax_cross_entropy_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_softmax_cross_entropy_t);
+
+        status_t init(engine_t *engine) { return init_plain(engine); }
+    };
+
+    simple_softmax_cross_entropy_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
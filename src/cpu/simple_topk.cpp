@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Candidates are ordered by decreasing value, then by increasing index.
+inline bool is_better(float a, dim_t ia, float b, dim_t ib) {
+    return a > b || (a == b && ia < ib);
+}
+
+// A heap of k candidates with the worst one on top.
+struct topk_heap_t {
+    topk_heap_t(float *vals, dim_t *idxs, dim_t k)
+        : vals_(vals), idxs_(idxs), k_(k) {}
+
+    float top() const { return vals_[0]; }
+
+    void replace_top(float v, dim_t i) {
+        vals_[0] = v;
+        idxs_[0] = i;
+        sift_down(0, k_);
+    }
+
+    void replace_top_if_better(float v, dim_t i) {
+        if (is_better(v, i, vals_[0], idxs_[0])) replace_top(v, i);
+    }
+
+    // Sorts the candidates from the best to the worst one.
+    void sort() {
+        for (dim_t n = k_ - 1; n > 0; --n) {
+            nstl::swap(vals_[0], vals_[n]);
+            nstl::swap(idxs_[0], idxs_[n]);
+            sift_down(0, n);
+        }
+    }
+
+private:
+    void sift_down(dim_t pos, dim_t size) {
+        const float v = vals_[pos];
+        const dim_t i = idxs_[pos];
+        for (;;) {
+            dim_t child = 2 * pos + 1;
+            if (child >= size) break;
+            if (child + 1 < size
+                    && is_better(vals_[child], idxs_[child], vals_[child + 1],
+                            idxs_[child + 1]))
+                child++;
+            if (!is_better(v, i, vals_[child], idxs_[child])) break;
+            vals_[pos] = vals_[child];
+            idxs_[pos] = idxs_[child];
+            pos = child;
+        }
+        vals_[pos] = v;
+        idxs_[pos] = i;
+    }
+
+    float *vals_;
+    dim_t *idxs_;
+    dim_t k_;
+};
+
+// Pushes the values [beg, end) of a row into the heap. The values are scanned
+// by blocks and a block is only inspected element by element when its
+// maximum can enter the heap, the block maximum is a vectorized reduction.
+template <data_type_t src_type>
+void select_chunk(const void *src, dim_t stride, dim_t beg, dim_t end,
+        topk_heap_t &heap) {
+    using src_t = typename prec_traits_t<src_type>::type;
+    const src_t *s = static_cast<const src_t *>(src);
+
+    constexpr dim_t block = 16;
+    float buf[block];
+
+    dim_t i = beg;
+    for (; i + block <= end; i += block) {
+        float bmax = -std::numeric_limits<float>::infinity();
+        PRAGMA_OMP_SIMD(reduction(max : bmax))
+        for (dim_t j = 0; j < block; ++j) {
+            buf[j] = static_cast<float>(s[(i + j) * stride]);
+            bmax = nstl::max(bmax, buf[j]);
+        }
+        if (bmax < heap.top()) continue;
+        for (dim_t j = 0; j < block; ++j)
+            heap.replace_top_if_better(buf[j], i + j);
+    }
+    for (; i < end; ++i)
+        heap.replace_top_if_better(static_cast<float>(s[i * stride]), i);
+}
+
+} // namespace
+
+status_t simple_topk_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_1);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper ind_d(pd()->dst_md(1));
+
+    const dim_t nrows = pd()->nrows();
+    if (nrows == 0) return status::success;
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t chunk_size = pd()->chunk_size_;
+    const bool is_sample = pd()->is_sample();
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const size_t src_dt_size = types::data_type_size(src_dt);
+    const dim_t src_axis_stride = src_d.blocking_desc().strides[axis];
+    const dim_t dst_axis_stride = dst_d.blocking_desc().strides[axis];
+    const dim_t ind_axis_stride = ind_d.blocking_desc().strides[axis];
+
+    auto cand_vals = ctx.get_scratchpad_grantor().template get<float>(
+            key_topk_values);
+    auto cand_idxs = ctx.get_scratchpad_grantor().template get<dim_t>(
+            key_topk_indices);
+
+    // Offset of the first element of a row, the rows enumerate all the
+    // positions of the dimensions other than the axis.
+    auto row_offset = [&](const memory_desc_wrapper &md, dim_t row) {
+        dim_t off = md.offset0();
+        for (int d = ndims - 1; d >= 0; --d) {
+            if (d == axis) continue;
+            const dim_t dim = src_d.dims()[d];
+            off += (row % dim) * md.blocking_desc().strides[d];
+            row /= dim;
+        }
+        return off;
+    };
+
+    // Pass 1: the k best candidates of every chunk of every row. The heap is
+    // initialized with sentinels which lose against any value of the row.
+    parallel_nd(nrows, nchunks, [&](dim_t row, dim_t chunk) {
+        float *vals = cand_vals + (row * nchunks + chunk) * k;
+        dim_t *idxs = cand_idxs + (row * nchunks + chunk) * k;
+        for (dim_t j = 0; j < k; ++j) {
+            vals[j] = -std::numeric_limits<float>::infinity();
+            idxs[j] = axis_size;
+        }
+        topk_heap_t heap(vals, idxs, k);
+
+        const dim_t beg = chunk * chunk_size;
+        const dim_t end = nstl::min(beg + chunk_size, axis_size);
+        const char *row_src = src + src_dt_size * row_offset(src_d, row);
+        switch (src_dt) {
+            case data_type::f32:
+                select_chunk<data_type::f32>(
+                        row_src, src_axis_stride, beg, end, heap);
+                break;
+            case data_type::bf16:
+                select_chunk<data_type::bf16>(
+                        row_src, src_axis_stride, beg, end, heap);
+                break;
+            case data_type::f16:
+                select_chunk<data_type::f16>(
+                        row_src, src_axis_stride, beg, end, heap);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    });
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    auto seed_ptr = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    const uint32_t seed = is_sample ? static_cast<uint32_t>(seed_ptr[0]) : 0;
+
+    // Pass 2: merge the candidates of the chunks of a row into the heap of
+    // the first chunk, sort it and write the outputs.
+    parallel_nd(nrows, [&](dim_t row) {
+        float *vals = cand_vals + row * nchunks * k;
+        dim_t *idxs = cand_idxs + row * nchunks * k;
+        topk_heap_t heap(vals, idxs, k);
+        for (dim_t j = k; j < nchunks * k; ++j)
+            heap.replace_top_if_better(vals[j], idxs[j]);
+        heap.sort();
+
+        const dim_t dst_off = row_offset(dst_d, row);
+        const dim_t ind_off = row_offset(ind_d, row);
+
+        if (!is_sample) {
+            for (dim_t j = 0; j < k; ++j) {
+                io::store_float_value(
+                        dst_dt, vals[j], dst, dst_off + j * dst_axis_stride);
+                indices[ind_off + j * ind_axis_stride]
+                        = static_cast<int32_t>(idxs[j]);
+            }
+            return;
+        }
+
+        // Softmax over the candidates of the logits divided by the
+        // temperature, which is passed as the inverse source scale.
+        const float scale = src_scales[0];
+        float sum = 0.f;
+        for (dim_t j = 0; j < k; ++j) {
+            vals[j] = ::expf(scale * (vals[j] - vals[0]));
+            sum += vals[j];
+        }
+
+        const uint32_t r = math::philox4x32(static_cast<uint32_t>(row), seed);
+        const float u = static_cast<float>(r >> 8) * (1.f / (1 << 24));
+        const float target = u * sum;
+        dim_t pick = k - 1;
+        float acc = 0.f;
+        for (dim_t j = 0; j < k; ++j) {
+            acc += vals[j];
+            if (target < acc) {
+                pick = j;
+                break;
+            }
+        }
+
+        io::store_float_value(dst_dt, vals[pick] / sum, dst, dst_off);
+        indices[ind_off] = static_cast<int32_t>(idxs[pick]);
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
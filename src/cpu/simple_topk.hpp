@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOPK_HPP
+#define CPU_SIMPLE_TOPK_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Top-k selection along an axis.
+//
+// Every row of the source is split in chunks so that short batches of very
+// long rows (e.g. vocabulary logits of a few decoded tokens) still use all the
+// threads. Each chunk keeps the k largest values seen so far in a min-heap and
+// skips whole blocks of values which are not larger than the heap top, which
+// is the common case once the heap is warm. The candidates of the chunks are
+// then merged per row.
+struct simple_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_topk_t);
+
+        status_t init(engine_t *engine) {
+            using sm = primitive_attr_t::skip_mask_t;
+
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            VDISPATCH_TOPK(platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(attr()->has_default_values(sm::scales),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOPK(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_TOPK(memory_desc_wrapper(src_md()).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "src");
+            VDISPATCH_TOPK(memory_desc_wrapper(dst_md()).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "dst");
+            VDISPATCH_TOPK(memory_desc_wrapper(dst_md(1)).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG_S, "indices");
+
+            init_chunks();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        dim_t nrows() const {
+            return utils::array_product(src_md()->dims, src_md()->ndims)
+                    / axis_size();
+        }
+
+        // Number of chunks each row is split in and their length.
+        dim_t nchunks_ = 1;
+        dim_t chunk_size_ = 0;
+
+    private:
+        void init_chunks() {
+            // A chunk keeps up to k candidates for the merge, don't split the
+            // rows in chunks much shorter than that.
+            const dim_t min_chunk_size = nstl::max<dim_t>(4 * k(), 4096);
+            const dim_t nthr = dnnl_get_max_threads();
+            const dim_t rows = nstl::max<dim_t>(nrows(), 1);
+            nchunks_ = nstl::max<dim_t>(1,
+                    nstl::min(utils::div_up(nthr, rows),
+                            axis_size() / min_chunk_size));
+            chunk_size_ = utils::div_up(axis_size(), nchunks_);
+        }
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            const dim_t ncands = nrows() * nchunks_ * k();
+            scratchpad.template book<float>(key_topk_values, ncands);
+            scratchpad.template book<dim_t>(key_topk_indices, ncands);
+        }
+    };
+
+    simple_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/stream.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/streaming_convolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t streaming_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+
+    VDISPATCH_CONV(!attr()->streaming_.has_default_values(),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(ndims() == 3, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(
+            impl::is_dense_format_kind({src_md(), weights_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    // Channels last is what the brgemm-based implementations prefer.
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, nwc));
+    is_nwc_ = memory_desc_matches_tag(src_md_, nwc);
+    VDISPATCH_CONV(is_nwc_ || memory_desc_matches_tag(src_md_, ncw),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+
+    // The left padding of a causal convolution is its context.
+    const format_tag_t tag = is_nwc_ ? nwc : ncw;
+    const data_type_t src_dt = src_md_.data_type;
+    const dims_t state_dims = {MB(), IC(), padL()};
+    CHECK(memory_desc_init_by_tag(
+            streaming_state_md_, ndims(), state_dims, src_dt, tag));
+    const dims_t ext_src_dims = {MB(), IC(), padL() + IW()};
+    CHECK(memory_desc_init_by_tag(
+            ext_src_md_, ndims(), ext_src_dims, src_dt, tag));
+
+    const convolution_desc_t *cd = desc();
+    const dims_t padding_l = {0};
+    convolution_desc_t conv_d = convolution_desc_t();
+    CHECK(conv_desc_init(&conv_d, cd->prop_kind, cd->alg_kind, &ext_src_md_,
+            &weights_md_, &bias_md_, &dst_md_, cd->strides, cd->dilates,
+            padding_l, cd->padding[1]));
+
+    primitive_attr_t conv_attr(*attr());
+    if (!conv_attr.is_initialized()) return status::out_of_memory;
+    conv_attr.streaming_ = streaming_t();
+    primitive_desc_iterator_t it(engine,
+            reinterpret_cast<const op_desc_t *>(&conv_d), &conv_attr, nullptr);
+    if (!it.is_initialized()) return status::out_of_memory;
+    VDISPATCH_CONV(
+            ++it != it.end(), VERBOSE_PRIMITIVE_CREATION_FAIL, "convolution");
+    conv_pd_ = *it;
+
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = *conv_pd_->weights_md(0);
+    if (bias_md_.format_kind == format_kind::any)
+        bias_md_ = *conv_pd_->weights_md(1);
+    if (dst_md_.format_kind == format_kind::any)
+        dst_md_ = *conv_pd_->dst_md();
+
+    init_name();
+    init_scratchpad();
+    return status::success;
+}
+
+void streaming_convolution_fwd_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    const memory_desc_wrapper ext_src_d(ext_src_md_);
+    scratchpad.book(key_conv_streaming_src, ext_src_d.size(), 1);
+    scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+}
+
+status_t streaming_convolution_fwd_t::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+status_t streaming_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto state = CTX_OUT_MEM(char *, DNNL_ARG_ATTR_STREAMING_STATE);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto ext_src = scratchpad.get<char>(key_conv_streaming_src);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper state_d(
+            pd()->arg_md(DNNL_ARG_ATTR_STREAMING_STATE));
+    const memory_desc_wrapper ext_src_d(pd()->ext_src_md_);
+    const size_t dt_size = src_d.data_type_size();
+    const bool is_nwc = pd()->is_nwc_;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->IC();
+    const dim_t IW = pd()->IW();
+    const dim_t context = pd()->padL();
+    if (state == nullptr && context > 0) return status::invalid_arguments;
+
+    // Copies `nw` frames of the channels [c, c + nc), contiguously along the
+    // channels for nwc and along the sequence for ncw.
+    auto copy_frames = [&](char *to, const memory_desc_wrapper &to_d,
+                               dim_t to_w, const char *from,
+                               const memory_desc_wrapper &from_d,
+                               dim_t from_w, dim_t nw, dim_t mb, dim_t c,
+                               dim_t nc) {
+        if (is_nwc) {
+            for (dim_t w = 0; w < nw; w++)
+                std::memcpy(to + to_d.blk_off(mb, c, to_w + w) * dt_size,
+                        from + from_d.blk_off(mb, c, from_w + w) * dt_size,
+                        nc * dt_size);
+        } else {
+            for (dim_t ic = c; ic < c + nc; ic++)
+                std::memcpy(to + to_d.blk_off(mb, ic, to_w) * dt_size,
+                        from + from_d.blk_off(mb, ic, from_w) * dt_size,
+                        nw * dt_size);
+        }
+    };
+
+    // A work item owns its channels over the whole sequence, so the state
+    // can be overwritten once gathered.
+    const dim_t c_blk = 64;
+    parallel_nd(MB, utils::div_up(C, c_blk), [&](dim_t mb, dim_t cb) {
+        const dim_t c = cb * c_blk;
+        const dim_t nc = nstl::min(c_blk, C - c);
+        copy_frames(ext_src, ext_src_d, 0, state, state_d, 0, context, mb, c,
+                nc);
+        copy_frames(ext_src, ext_src_d, context, src, src_d, 0, IW, mb, c, nc);
+        copy_frames(state, state_d, 0, ext_src, ext_src_d, IW, context, mb, c,
+                nc);
+    });
+
+    engine_t *engine = ctx.stream()->engine();
+    std::unique_ptr<memory_t, memory_deleter_t> ext_src_mem;
+    CHECK(safe_ptr_assign(ext_src_mem,
+            new memory_t(engine, &pd()->ext_src_md_,
+                    scratchpad.get_memory_storage(key_conv_streaming_src))));
+
+    exec_args_t conv_args = ctx.args();
+    conv_args[DNNL_ARG_SRC] = {ext_src_mem.get(), true};
+    conv_args.erase(DNNL_ARG_ATTR_STREAMING_STATE);
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
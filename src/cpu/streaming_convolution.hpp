@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_STREAMING_CONVOLUTION_HPP
+#define CPU_STREAMING_CONVOLUTION_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Causal 1D convolution with the streaming attribute.
+//
+// The left context of a chunk comes from the state instead of the zero
+// padding. The state and the chunk are gathered into a single sequence in the
+// scratchpad, which then goes through the best convolution implementation
+// without padding, so only the outputs of the new frames are computed. The
+// state is updated from the gathered sequence in the same pass, while the
+// frames are still in cache.
+struct streaming_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(name_.c_str(), streaming_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+        // The state followed by the chunk.
+        memory_desc_t ext_src_md_;
+        bool is_nwc_ = false;
+
+    private:
+        std::string name_ = "streaming:";
+
+        void init_name() { name_.append(conv_pd_->name()); }
+        void init_scratchpad();
+    };
+
+    streaming_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -40,6 +40,9 @@ const pack_type_t pack32 = dnnl_pack_type_pack32;
 using attr_params_t = dnnl_ukernel_attr_params;
 using brgemm_t = dnnl_brgemm;
 using transform_t = dnnl_transform;
+using eltwise_t = dnnl_ukernel_eltwise;
+using reduction_t = dnnl_ukernel_reduction;
+using softmax_t = dnnl_ukernel_softmax;
 
 } // namespace ukernel
 } // namespace cpu
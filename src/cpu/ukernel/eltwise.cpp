@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/ukernel/eltwise.hpp"
+#endif
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::ukernel;
+
+status_t dnnl_ukernel_eltwise_create(eltwise_t **eltwise, dim_t M, dim_t N,
+        dim_t ld_src, dim_t ld_dst, data_type_t dst_dt, alg_kind_t alg_kind,
+        float alpha, float beta) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_eltwise_create(eltwise, M, N, ld_src,
+            ld_dst, dst_dt, alg_kind, alpha, beta);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_eltwise_generate(eltwise_t *eltwise) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_eltwise_generate(eltwise);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_eltwise_execute(
+        const eltwise_t *eltwise, const void *src_ptr, void *dst_ptr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_eltwise_execute(
+            eltwise, src_ptr, dst_ptr);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_eltwise_destroy(eltwise_t *eltwise) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_eltwise_destroy(eltwise);
+#endif
+    return status::unimplemented;
+}
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/ukernel/softmax.hpp"
+#endif
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::ukernel;
+
+status_t dnnl_ukernel_softmax_create(softmax_t **softmax, dim_t M, dim_t N,
+        dim_t ld_s, dim_t ld_p, data_type_t p_dt, dim_t N_o, dim_t ld_o) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_create(
+            softmax, M, N, ld_s, ld_p, p_dt, N_o, ld_o);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_generate(softmax_t *softmax) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_generate(softmax);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_execute(const softmax_t *softmax,
+        const void *S_ptr, void *P_ptr, float *max_ptr, float *sum_ptr,
+        float *O_ptr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_execute(
+            softmax, S_ptr, P_ptr, max_ptr, sum_ptr, O_ptr);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_finalize(
+        const softmax_t *softmax, const float *sum_ptr, float *O_ptr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_finalize(
+            softmax, sum_ptr, O_ptr);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_ukernel_softmax_destroy(softmax_t *softmax) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_ukernel_softmax_destroy(softmax);
+#endif
+    return status::unimplemented;
+}
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
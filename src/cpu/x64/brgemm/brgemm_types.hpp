@@ -294,6 +294,8 @@ struct brgemm_desc_t {
 
     int is_oc_scale = 0;
     bool with_dst_scales = false;
+    // Accumulate the absolute maximum of D values before destination scales.
+    bool with_dst_amax = false;
     // Grouping in batch used by brdgmm kernel
     int bs_group {0};
 
@@ -496,7 +498,7 @@ struct brgemm_desc_t {
                 brgemm_broadcast_t::none, zp_type_a, zp_type_b, zp_type_c);
         return dt_c != dt_d || with_eltwise || with_binary || with_scales
                 || with_bias || with_sum || req_s8s8_compensation
-                || has_zero_points || with_dst_scales;
+                || has_zero_points || with_dst_scales || with_dst_amax;
     }
 
     bool is_xf16() const noexcept { return is_bf16 || is_f16; }
@@ -602,6 +604,7 @@ struct brgemm_kernel_params_t {
     size_t skip_accm = 0;
     int32_t zp_a_val = 1;
     const void *ptr_dst_scales = nullptr;
+    void *ptr_dst_amax = nullptr;
     dim_t dynamic_LDA = 0;
     dim_t dynamic_LDB = 0;
     dim_t dynamic_LDC = 0;
@@ -712,6 +715,9 @@ private:
 /// @param dst_scales - Vector of inverted scale factor values for matix C,
 ///     common scale vector type only is supported, it must be broadcasted to
 ///     vector of simd width length.
+/// @param dst_amax - Vector of simd width length the kernel merges the
+///     absolute maxima of D values before destination scales into, lane-wise.
+///     The values are kept as f32 bit patterns with the sign bit cleared.
 ///
 struct brgemm_post_ops_data_t {
     brgemm_post_ops_data_t() = default;
@@ -725,7 +731,7 @@ struct brgemm_post_ops_data_t {
             const void *c_zp_values = nullptr, bool skip_accumulation = false,
             int32_t zp_a_val = 1, bool do_only_comp = false,
             bool do_only_zp_a_val = false, const float *dst_scales = nullptr,
-            const void *a_zp_values = nullptr)
+            const void *a_zp_values = nullptr, float *dst_amax = nullptr)
         : bias(bias)
         , scales(scales)
         , binary_post_ops_rhs(binary_post_ops_rhs)
@@ -741,7 +747,8 @@ struct brgemm_post_ops_data_t {
         , do_only_comp {do_only_comp}
         , do_only_zp_a_val {do_only_zp_a_val}
         , dst_scales(dst_scales)
-        , a_zp_values(a_zp_values) {}
+        , a_zp_values(a_zp_values)
+        , dst_amax(dst_amax) {}
 
     const void *bias = nullptr;
     const float *scales = nullptr;
@@ -759,6 +766,7 @@ struct brgemm_post_ops_data_t {
     const bool do_only_zp_a_val = false;
     const float *dst_scales = nullptr;
     const void *a_zp_values = nullptr;
+    float *dst_amax = nullptr;
 };
 
 } // namespace x64
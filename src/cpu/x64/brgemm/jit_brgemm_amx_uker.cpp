@@ -1383,6 +1383,26 @@ void jit_brgemm_amx_uker_base_t::process_output_range(
         apply_post_ops_to_range(bi, bd_start, bd_finish, bdb, ldb);
     }
 
+    if (brg.with_dst_amax) {
+        // Non-negative f32 values are ordered as their bit patterns, the
+        // lanes are merged with an unsigned integer max.
+        mov(reg_dst_scales, ptr[param1 + GET_OFF(ptr_dst_amax)]);
+        const auto zmm_amax = zmm_tmp_1();
+        const auto zmm_abs = zmm_tmp_2();
+        const Xbyak::Zmm zmm_amax_masked
+                = bi.ldi->is_tail(ldb) ? zmm_amax | ld_tail_mask : zmm_amax;
+        vmovups(zmm_amax, ptr[reg_dst_scales]);
+        for (auto bd = bd_start; bd < bd_finish; bd++) {
+            if (!is_out_bd(bi.bdi, bdb, bd)) continue;
+
+            auto zmm = accm(bd);
+            vpslld(zmm_abs, zmm, 1);
+            vpsrld(zmm_abs, zmm_abs, 1);
+            vpmaxud(zmm_amax_masked, zmm_amax, zmm_abs);
+        }
+        vmovups(ptr[reg_dst_scales], zmm_amax);
+    }
+
     if (brg.with_dst_scales) {
         mov(reg_dst_scales, ptr[param1 + GET_OFF(ptr_dst_scales)]);
         auto zmm_dst_scales = zmm_tmp_1();
@@ -273,7 +273,8 @@ private:
     // these are used for FP8 as temporary push/pop spaces
     constexpr static int reg_val_tmp_1_ = 256;
     constexpr static int reg_val_tmp_2_ = 264;
-    constexpr static int stack_space_needed_ = 272;
+    constexpr static int reg_dst_amax_offs_ = 272;
+    constexpr static int stack_space_needed_ = 280;
 
     bool is_ldb_loop_ = false;
     bool with_binary_non_scalar_bcast_ = false;
@@ -965,6 +966,11 @@ void jit_brgemm_kernel_t<Wmm>::read_params() {
         mov(ptr[rsp + reg_dst_scales_offs_], reg_dst_scales);
     }
 
+    if (brg.with_dst_amax) {
+        mov(reg_dst_scales, ptr[param1 + GET_OFF(ptr_dst_amax)]);
+        mov(ptr[rsp + reg_dst_amax_offs_], reg_dst_scales);
+    }
+
     if (brg.is_runtime_ldc) {
         mov(reg_tmp_read_values, ptr[param1 + GET_OFF(dynamic_LDC)]);
         if (brg.typesize_C > 1) shl(reg_tmp_read_values, (brg.typesize_C >> 1));
@@ -1346,6 +1352,27 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
     if (postops_injector_)
         apply_post_ops(bd_block, ld_block2, ldb_and_bdb_offset, is_ld_tail);
 
+    if (brg.with_dst_amax) {
+        // Non-negative f32 values are ordered as their bit patterns, the
+        // lanes are merged with an unsigned integer max.
+        mov(reg_aux_dst_scales, ptr[rsp + reg_dst_amax_offs_]);
+        auto vmm_amax = vmm_tmp(0);
+        auto vmm_abs = vmm_tmp(1);
+        uni_vmovups(vmm_amax, ptr[reg_aux_dst_scales]);
+        for (dim_t ld = 0; ld < ld_block2; ld++) {
+            const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
+            const Vmm vmm_amax_masked
+                    = is_tail ? vmm_amax | ld_tail_mask : vmm_amax;
+            for (dim_t bd = 0; bd < bd_block; bd++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                vpslld(vmm_abs, vmm, 1);
+                vpsrld(vmm_abs, vmm_abs, 1);
+                vpmaxud(vmm_amax_masked, vmm_amax, vmm_abs);
+            }
+        }
+        uni_vmovups(ptr[reg_aux_dst_scales], vmm_amax);
+    }
+
     if (brg.with_dst_scales) {
         mov(reg_aux_dst_scales, ptr[rsp + reg_dst_scales_offs_]);
         auto vmm_dst_scales = vmm_tmp(0);
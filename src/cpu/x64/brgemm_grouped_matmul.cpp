@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/grouped_matmul_utils.hpp"
+
+#include "cpu/x64/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace grouped_matmul_utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    VDISPATCH_GROUPED_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    CHECK(init_plain(engine));
+    VDISPATCH_GROUPED_MATMUL_SC(init_brgemm_desc(), "brgemm init failed");
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_brgemm_desc() {
+    for_(int is_n_tail = 0; is_n_tail < 2; is_n_tail++)
+    for (int is_k_tail = 0; is_k_tail < 2; is_k_tail++) {
+        const dim_t N_blk = is_n_tail ? N() % n_blk : N() < n_blk ? 0 : n_blk;
+        const dim_t K_blk = is_k_tail ? K() % k_blk : K() < k_blk ? 0 : k_blk;
+        if (N_blk == 0 || K_blk == 0) continue;
+
+        // The tiles of a group are accumulated over the K blocks.
+        auto &brg = brgs_[is_n_tail][is_k_tail];
+        const brgemm_strides_t strides {0, 0};
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_strd, data_type::f32,
+                data_type::f32, false, false, brgemm_row_major, 1.f, 1.f,
+                k_blk, n_blk, n_blk, m_blk, N_blk, K_blk, &strides));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::init(engine_t *engine) {
+    for_(int is_n_tail = 0; is_n_tail < 2; is_n_tail++)
+    for (int is_k_tail = 0; is_k_tail < 2; is_k_tail++) {
+        const auto &brg = pd()->brgs_[is_n_tail][is_k_tail];
+        if (brg.bcast_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[is_n_tail][is_k_tail], ker));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    // All the tiles but the last ones of a group along N and K have the full
+    // blocks.
+    auto gemm = [&](const float *a, const float *b, float *c, dim_t mb,
+                        dim_t kb, dim_t nb) {
+        MAYBE_UNUSED(mb);
+        const auto *ker = brg_kernels_[nb != n_blk][kb != k_blk].get();
+        assert(ker != nullptr);
+        brgemm_kernel_execute(ker, 1, a, b, nullptr, c);
+    };
+
+    return grouped_matmul_utils::execute(ctx, pd(), gemm);
+}
+
+template struct brgemm_grouped_matmul_t<avx512_core>;
+template struct brgemm_grouped_matmul_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
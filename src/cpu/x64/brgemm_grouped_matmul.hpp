@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_grouped_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Grouped matrix multiplication over plain matrices with the tiles of the
+// groups accumulated by brgemm kernels. The tiling, the conversion of the
+// source and the decompression of the weights to f32 are shared with the
+// simple implementation, the kernels take the f32 blocks as is. The M block
+// of the kernels is fixed, the rows past the end of a group are zero.
+template <cpu_isa_t isa>
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public cpu_grouped_matmul_pd_t {
+        using cpu_grouped_matmul_pd_t::cpu_grouped_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Indexed by `is_n_tail` and `is_k_tail`.
+        brgemm_desc_t brgs_[2][2];
+
+    private:
+        status_t init_brgemm_desc();
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[2][2];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/brgemm_wino_reorders.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino {
+
+status_t init_weights_md(
+        memory_desc_t &md, dim_t oc, dim_t ic, data_type_t dt, int oc_block) {
+    const int vnni = vnni_granularity(dt);
+    const dim_t ic_pad = utils::rnd_up(ic, vnni);
+    const dim_t nb_oc = utils::div_up(oc, oc_block);
+
+    for (int d = 0; d < md.ndims; d++) {
+        md.padded_dims[d] = md.dims[d];
+        md.padded_offsets[d] = 0;
+    }
+    md.offset0 = 0;
+    md.data_type = dt;
+    md.format_kind = format_kind::wino;
+
+    auto &wd = md.format_desc.wino_desc;
+    wd.wino_format = wino_memory_format_t::wino_wei_aaOio_brgemm;
+    wd.r = r;
+    wd.alpha = alpha;
+    wd.ic = static_cast<int>(ic);
+    wd.oc = static_cast<int>(oc);
+    wd.ic_block = static_cast<int>(ic_pad);
+    wd.oc_block = oc_block;
+    wd.ic2_block = 1;
+    wd.oc2_block = static_cast<int>(nb_oc);
+    wd.adj_scale = 1.f;
+    wd.size = static_cast<size_t>(n_points) * nb_oc * oc_block * ic_pad
+            * types::data_type_size(dt);
+
+    return status::success;
+}
+
+} // namespace brgemm_wino
+
+status_t brgemm_wino_weights_reorder_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+
+    const memory_desc_wrapper id(src_md_), od(dst_md_);
+
+    VDISPATCH_REORDER(brgemm_wino::is_weights_md(od),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+    VDISPATCH_REORDER(id.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER(utils::one_of(id.data_type(), f32, bf16)
+                    && utils::one_of(od.data_type(), f32, bf16),
+            VERBOSE_UNSUPPORTED_DT);
+
+    const auto &wd = od.wino_desc();
+    VDISPATCH_REORDER(id.ndims() == 4 && od.ndims() == 4,
+            VERBOSE_BAD_NDIMS, "src", id.ndims());
+    VDISPATCH_REORDER(id.dims()[0] == wd.oc && id.dims()[1] == wd.ic
+                    && id.dims()[2] == wd.r && id.dims()[3] == wd.r,
+            VERBOSE_INCONSISTENT_DIM, "src", 0, "dst", 0);
+
+    return status::success;
+}
+
+status_t brgemm_wino_weights_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    using namespace status;
+
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return out_of_memory;
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+    return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd.release());
+}
+
+status_t brgemm_wino_weights_reorder_t::execute(const exec_ctx_t &ctx) const {
+    using namespace brgemm_wino;
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_TO);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &wd = dst_d.wino_desc();
+    const auto sdt = src_d.data_type();
+    const auto ddt = dst_d.data_type();
+    const int vnni = vnni_granularity(ddt);
+
+    // Padded input and output channels must contribute zeros to the brgemm.
+    if (wd.ic_block != wd.ic || wd.oc2_block * wd.oc_block != wd.oc)
+        std::memset(dst, 0, wd.size);
+
+    // G = [[ 1/4,     0,    0],
+    //      [-1/6,  -1/6, -1/6],
+    //      [-1/6,   1/6, -1/6],
+    //      [1/24,  1/12,  1/6],
+    //      [1/24, -1/12,  1/6],
+    //      [   0,     0,    1]]
+    const auto transform = [](const float *g, float *u, int stride) {
+        const float g0 = g[0], g1 = g[stride], g2 = g[2 * stride];
+        u[0] = g0 / 4.f;
+        u[stride] = -(g0 + g1 + g2) / 6.f;
+        u[2 * stride] = -(g0 - g1 + g2) / 6.f;
+        u[3 * stride] = g0 / 24.f + g1 / 12.f + g2 / 6.f;
+        u[4 * stride] = g0 / 24.f - g1 / 12.f + g2 / 6.f;
+        u[5 * stride] = g2;
+    };
+
+    parallel_nd(wd.oc, wd.ic, [&](dim_t oc, dim_t ic) {
+        float g[r * r];
+        for_(int kh = 0; kh < r; kh++)
+        for (int kw = 0; kw < r; kw++)
+            g[kh * r + kw] = io::load_float_value(
+                    sdt, src, src_d.off(oc, ic, kh, kw));
+
+        // tmp = G * g, stored as [alpha][r].
+        float tmp[alpha * r];
+        for (int kw = 0; kw < r; kw++)
+            transform(g + kw, tmp + kw, r);
+
+        // u = tmp * G^T, stored as [alpha][alpha].
+        float u[n_points];
+        for (int i = 0; i < alpha; i++)
+            transform(tmp + i * r, u + i * alpha, 1);
+
+        for (int p = 0; p < n_points; p++)
+            io::store_float_value(
+                    ddt, u[p], dst, weights_off(wd, vnni, p, oc, ic));
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_BRGEMM_WINO_REORDERS_HPP
+#define CPU_X64_BRGEMM_WINO_REORDERS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino {
+
+// Winograd F(4x4, 3x3): every 4x4 output tile is computed from a 6x6 input
+// tile, so the transformed domain has alpha * alpha = 36 points.
+constexpr int r = 3;
+constexpr int m = 4;
+constexpr int alpha = m + r - 1;
+constexpr int n_points = alpha * alpha;
+
+// Weights in `wino_wei_aaOio_brgemm` format are laid out as
+// [alpha * alpha][nb_oc][ic_pad][oc_block] so that every transformed point
+// is a ready-to-use brgemm B matrix. For bf16 pairs of input channels are
+// interleaved (VNNI), i.e. [ic_pad / 2][oc_block][2]. The descriptor keeps
+// ic_pad in `ic_block` and nb_oc in `oc2_block`.
+inline int vnni_granularity(data_type_t dt) {
+    return dt == data_type::bf16 ? 2 : 1;
+}
+
+status_t init_weights_md(
+        memory_desc_t &md, dim_t oc, dim_t ic, data_type_t dt, int oc_block);
+
+inline bool is_weights_md(const memory_desc_wrapper &mdw) {
+    return mdw.is_wino_desc()
+            && mdw.wino_desc().wino_format
+            == wino_memory_format_t::wino_wei_aaOio_brgemm;
+}
+
+inline dim_t weights_off(
+        const wino_desc_t &wd, int vnni, int point, dim_t oc, dim_t ic) {
+    const dim_t ocb = oc / wd.oc_block;
+    const dim_t ocv = oc % wd.oc_block;
+    return ((point * wd.oc2_block + ocb) * wd.ic_block + (ic / vnni) * vnni)
+            * wd.oc_block
+            + ocv * vnni + ic % vnni;
+}
+
+} // namespace brgemm_wino
+
+// Transforms plain 3x3 convolution weights `g` into the Winograd domain
+// `U = G * g * G^T` in the layout expected by brgemm-based Winograd
+// convolution.
+struct brgemm_wino_weights_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                "brgemm_wino_weights_reorder_t", brgemm_wino_weights_reorder_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    brgemm_wino_weights_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -575,11 +575,6 @@ status_t brdgmm_dw_convolution_fwd_t::init(engine_t *engine) {
 
 status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
 
-    const char *const __restrict src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
-    const char *const __restrict weights
-            = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
-    const char *const __restrict bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
-    char *const __restrict dst = CTX_OUT_MEM(const char *, DNNL_ARG_DST);
     const std::vector<const void *> post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(
                     pd()->attr()->post_ops_, ctx);
@@ -594,10 +589,44 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     DEFINE_ZERO_POINTS_BUFFER(dst_zero_point, DNNL_ARG_DST);
 
     const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
-    const float *oscales = scale_utils::precompute_scales(
-            ctx.get_scratchpad_grantor(), src_scales, wei_scales, pd()->IC(),
-            pd()->OC(), false, wei_scale_mask > 0, pd()->attr(),
-            jit_scale_precompute_.get());
+
+    call_args_t args;
+    args.src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    args.weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    args.bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    args.dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    args.post_ops_binary_rhs = post_ops_binary_rhs_arg_vec.data();
+    args.oscales = scale_utils::precompute_scales(ctx.get_scratchpad_grantor(),
+            src_scales, wei_scales, pd()->IC(), pd()->OC(), false,
+            wei_scale_mask > 0, pd()->attr(), jit_scale_precompute_.get());
+    args.dst_scales = dst_scales;
+    args.src_zero_point = src_zero_point;
+    args.dst_zero_point = dst_zero_point;
+
+    const int chb_work = div_up(jcp.ngroups, jcp.nb_ch_blocking);
+    const int work_amount = jcp.mb * jcp.od * jcp.oh * jcp.nb_ow * chb_work;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        execute_range(args, start, end);
+    });
+    return status::success;
+}
+
+void brdgmm_dw_convolution_fwd_t::execute_range(
+        const call_args_t &args, int start, int end) const {
+
+    const char *const __restrict src = args.src;
+    const char *const __restrict weights = args.weights;
+    const char *const __restrict bias = args.bias;
+    char *const __restrict dst = args.dst;
+    const float *oscales = args.oscales;
+    const float *dst_scales = args.dst_scales;
+    const int32_t *src_zero_point = args.src_zero_point;
+    const int32_t *dst_zero_point = args.dst_zero_point;
+
+    const auto &jcp = pd()->jcp_;
 
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
     const size_t wei_size = weights_d.size();
@@ -618,7 +647,6 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     const int chb_step = jcp.nb_ch_blocking;
     const int chb_work = div_up(jcp.ngroups, chb_step);
     const int ow_step = jcp.ow_block;
-    const int work_amount = jcp.mb * jcp.od * jcp.oh * jcp.nb_ow * chb_work;
 
     const int max_bs = jcp.kd * jcp.kh * jcp.kw;
 
@@ -655,138 +683,128 @@ status_t brdgmm_dw_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     const int n_rpad_blks
             = 1 + nstl::max(0, div_up(jcp.r_pad - (rpad_1 - w_shift), w_shift));
 
-    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
-        int start {0}, end {0};
-        balance211(work_amount, nthr, ithr, start, end);
-        int n {0}, chb {0}, od {0}, oh {0}, owb {0};
-
-        auto iwork = start;
-        const brgemm_kernel_t *kernel = nullptr;
-        const brgemm_kernel_t *kernel_chb_tail
-                = brdgmm_kernels_[jcp.chb_tail_idx].get();
-        brgemm_post_ops_data_t post_ops_data;
-        post_ops_data.binary_post_ops_rhs = post_ops_binary_rhs_arg_vec.data();
-        post_ops_data.data_C_ptr_ = dst;
-
-        while (iwork < end) {
-            nd_iterator_init(iwork, n, jcp.mb, od, jcp.od, oh, jcp.oh, owb,
-                    jcp.nb_ow, chb, chb_work);
-            const bool is_m_tail = jcp.ow_tail != 0 && (owb + 1 == jcp.nb_ow);
-            const bool is_n_tail = jcp.chb_tail != 0 && (chb + 1 == chb_work);
-            if (is_m_tail && chb != 0) {
-                // the tail ow_block is not split btw threads to reduce the
-                // number of kernels.
-                utils::nd_iterator_jump(iwork, end, n, jcp.mb, od, jcp.od, oh,
-                        jcp.oh, owb, jcp.nb_ow, chb, chb_work);
-                continue;
-            }
+    int n {0}, chb {0}, od {0}, oh {0}, owb {0};
+
+    auto iwork = start;
+    const brgemm_kernel_t *kernel = nullptr;
+    const brgemm_kernel_t *kernel_chb_tail
+            = brdgmm_kernels_[jcp.chb_tail_idx].get();
+    brgemm_post_ops_data_t post_ops_data;
+    post_ops_data.binary_post_ops_rhs = args.post_ops_binary_rhs;
+    post_ops_data.data_C_ptr_ = dst;
+
+    while (iwork < end) {
+        nd_iterator_init(iwork, n, jcp.mb, od, jcp.od, oh, jcp.oh, owb,
+                jcp.nb_ow, chb, chb_work);
+        const bool is_m_tail = jcp.ow_tail != 0 && (owb + 1 == jcp.nb_ow);
+        const bool is_n_tail = jcp.chb_tail != 0 && (chb + 1 == chb_work);
+        if (is_m_tail && chb != 0) {
+            // the tail ow_block is not split btw threads to reduce the
+            // number of kernels.
+            utils::nd_iterator_jump(iwork, end, n, jcp.mb, od, jcp.od, oh,
+                    jcp.oh, owb, jcp.nb_ow, chb, chb_work);
+            continue;
+        }
 
-            // Begin: get number of owb to process and its corresponding ker_idx
-            const auto rem_work = end - iwork;
-            const int rem_row_owb
-                    = saturate(1, jcp.nb_ow - owb, rem_work / chb_work);
-            int cur_n_owb = 1;
-            int ker_idx = 0;
-            if (is_n_tail) {
-                ker_idx = jcp.chb_tail_idx;
-            } else if (is_m_tail) {
-                ker_idx = jcp.ow_tail_idx;
-            } else if (chb != 0 || rem_work < chb_work) {
-                ker_idx = jcp.nb_ch_blocking_idx;
-            } else if (rem_row_owb == jcp.nb_ow) {
-                ker_idx = 0;
-                cur_n_owb = jcp.nb_ow;
-            } else {
-                // The ow_tail kernel is processed alone, subtract if it exists.
-                const int log_rem_owb = log2(rem_row_owb
-                        - (owb + rem_row_owb >= jcp.nb_ow)
-                                * (jcp.ow_tail != 0));
-                cur_n_owb = (1 << log_rem_owb);
-                ker_idx = log_rem_owb + 1; // add 1 as 0th is full row.
-            }
+        // Begin: get number of owb to process and its corresponding ker_idx
+        const auto rem_work = end - iwork;
+        const int rem_row_owb
+                = saturate(1, jcp.nb_ow - owb, rem_work / chb_work);
+        int cur_n_owb = 1;
+        int ker_idx = 0;
+        if (is_n_tail) {
+            ker_idx = jcp.chb_tail_idx;
+        } else if (is_m_tail) {
+            ker_idx = jcp.ow_tail_idx;
+        } else if (chb != 0 || rem_work < chb_work) {
+            ker_idx = jcp.nb_ch_blocking_idx;
+        } else if (rem_row_owb == jcp.nb_ow) {
+            ker_idx = 0;
+            cur_n_owb = jcp.nb_ow;
+        } else {
+            // The ow_tail kernel is processed alone, subtract if it exists.
+            const int log_rem_owb = log2(rem_row_owb
+                    - (owb + rem_row_owb >= jcp.nb_ow) * (jcp.ow_tail != 0));
+            cur_n_owb = (1 << log_rem_owb);
+            ker_idx = log_rem_owb + 1; // add 1 as 0th is full row.
+        }
 
-            kernel = brdgmm_kernels_[ker_idx].get();
-            // end ker_idx
-
-            // Begin: get batch_element idx
-            const int ow = owb * ow_step;
-
-            const int id_s = od * jcp.stride_d - jcp.f_pad;
-            const int ih_s = oh * jcp.stride_h - jcp.t_pad;
-            const int iw_s = ow * jcp.stride_w - jcp.l_pad;
-
-            const int d_bi = nstl::min(od, d_blk_info.n_lpad_blks - 1)
-                    + nstl::max(0, od - d_blk_info.rpad_blk_start_idx + 1);
-            const int h_bi = nstl::min(oh, h_blk_info.n_lpad_blks - 1)
-                    + nstl::max(0, oh - h_blk_info.rpad_blk_start_idx + 1);
-            const int w_bi = nstl::min(owb, w_blk_info.n_lpad_blks - 1);
-
-            const int ow_e
-                    = nstl::min(ow + cur_n_owb * jcp.ow_block, jcp.ow) - 1;
-            const int rpad = ow_e * jcp.stride_w - jcp.l_pad + jcp.kw - jcp.iw;
-            const int rpad_i = rpad <= rpad_1 - w_shift
-                    ? 0
-                    : 1 + div_up(rpad - rpad_1, w_shift);
-
-            const int bi //[d_bi][h_bi][w_bi][rpad_i] _
-                    = ((d_bi * n_h_blks + h_bi) * n_w_blks + w_bi) * n_rpad_blks
-                    + rpad_i;
-            assert(static_cast<int>(pd()->batches_.size())
-                    >= (bi + 1) * max_bs);
-            const brgemm_batch_element_t *brg_batch
-                    = &(pd()->batches_[bi * max_bs]);
-            const int bs = pd()->bs_[bi];
-            // end: get batch_element idx
-
-            int ch = chb * chb_step;
-
-            auto *ptr_A = src
-                    + static_cast<ptrdiff_t>(n * src_mb_stride
-                            + id_s * src_d_stride + ih_s * src_h_stride
-                            + iw_s * src_w_stride + ch * src_ch_stride);
-            auto *ptr_B = weights + ch * wei_ch_stride;
-            auto *ptr_C = dst + n * dst_mb_stride + od * dst_d_stride
-                    + oh * dst_h_stride + ow * dst_w_stride
-                    + ch * dst_ch_stride;
-            const int rem_chb_work = chb_work - chb;
-            int chb_loop_work = is_m_tail || (chb == 0 && rem_work >= chb_work)
-                    ? 1 // Compute entire chb_work in single jit call
-                    : nstl::min(rem_work, rem_chb_work);
-            iwork += cur_n_owb * nstl::min(rem_work, rem_chb_work);
-
-            while (chb_loop_work) {
-                post_ops_data.bias = bias + ch * jcp.bia_dsz;
-                post_ops_data.scales = &oscales[jcp.is_oc_scale * ch];
-                post_ops_data.oc_logical_off = ch;
-                post_ops_data.dst_scales = dst_scales;
-                const bool is_bcast_zp
-                        = pd()->attr()->zero_points_.get_mask(DNNL_ARG_SRC)
-                        == 0;
-                post_ops_data.a_zp_values = jcp.src_zero_point
-                        ? src_zero_point + ch * !is_bcast_zp
-                        : nullptr;
-                post_ops_data.c_zp_values
-                        = jcp.dst_zero_point ? dst_zero_point : nullptr;
-                post_ops_data.a_zp_compensations
-                        = jcp.src_zero_point ? zp_compensation + ch : nullptr;
-
-                void *scratch = jcp.s8s8_compensation_required
-                        ? static_cast<void *>(s8s8_comp_ptr + ch)
-                        : nullptr;
-                brgemm_kernel_execute_postops(kernel, bs, ptr_A, ptr_B,
-                        brg_batch, ptr_C, ptr_C, post_ops_data, scratch);
-                ++chb;
-                if (jcp.chb_tail != 0 && chb + 1 == chb_work)
-                    kernel = kernel_chb_tail;
-                ch += chb_step;
-                ptr_A += chb_step * src_ch_stride;
-                ptr_B += chb_step * wei_ch_stride;
-                ptr_C += chb_step * dst_ch_stride;
-                --chb_loop_work;
-            }
+        kernel = brdgmm_kernels_[ker_idx].get();
+        // end ker_idx
+
+        // Begin: get batch_element idx
+        const int ow = owb * ow_step;
+
+        const int id_s = od * jcp.stride_d - jcp.f_pad;
+        const int ih_s = oh * jcp.stride_h - jcp.t_pad;
+        const int iw_s = ow * jcp.stride_w - jcp.l_pad;
+
+        const int d_bi = nstl::min(od, d_blk_info.n_lpad_blks - 1)
+                + nstl::max(0, od - d_blk_info.rpad_blk_start_idx + 1);
+        const int h_bi = nstl::min(oh, h_blk_info.n_lpad_blks - 1)
+                + nstl::max(0, oh - h_blk_info.rpad_blk_start_idx + 1);
+        const int w_bi = nstl::min(owb, w_blk_info.n_lpad_blks - 1);
+
+        const int ow_e = nstl::min(ow + cur_n_owb * jcp.ow_block, jcp.ow) - 1;
+        const int rpad = ow_e * jcp.stride_w - jcp.l_pad + jcp.kw - jcp.iw;
+        const int rpad_i = rpad <= rpad_1 - w_shift
+                ? 0
+                : 1 + div_up(rpad - rpad_1, w_shift);
+
+        const int bi //[d_bi][h_bi][w_bi][rpad_i] _
+                = ((d_bi * n_h_blks + h_bi) * n_w_blks + w_bi) * n_rpad_blks
+                + rpad_i;
+        assert(static_cast<int>(pd()->batches_.size()) >= (bi + 1) * max_bs);
+        const brgemm_batch_element_t *brg_batch
+                = &(pd()->batches_[bi * max_bs]);
+        const int bs = pd()->bs_[bi];
+        // end: get batch_element idx
+
+        int ch = chb * chb_step;
+
+        auto *ptr_A = src
+                + static_cast<ptrdiff_t>(n * src_mb_stride + id_s * src_d_stride
+                        + ih_s * src_h_stride + iw_s * src_w_stride
+                        + ch * src_ch_stride);
+        auto *ptr_B = weights + ch * wei_ch_stride;
+        auto *ptr_C = dst + n * dst_mb_stride + od * dst_d_stride
+                + oh * dst_h_stride + ow * dst_w_stride + ch * dst_ch_stride;
+        const int rem_chb_work = chb_work - chb;
+        int chb_loop_work = is_m_tail || (chb == 0 && rem_work >= chb_work)
+                ? 1 // Compute entire chb_work in single jit call
+                : nstl::min(rem_work, rem_chb_work);
+        iwork += cur_n_owb * nstl::min(rem_work, rem_chb_work);
+
+        while (chb_loop_work) {
+            post_ops_data.bias = bias + ch * jcp.bia_dsz;
+            post_ops_data.scales = &oscales[jcp.is_oc_scale * ch];
+            post_ops_data.oc_logical_off = ch;
+            post_ops_data.dst_scales = dst_scales;
+            const bool is_bcast_zp
+                    = pd()->attr()->zero_points_.get_mask(DNNL_ARG_SRC) == 0;
+            post_ops_data.a_zp_values
+                    = jcp.src_zero_point ? src_zero_point + ch * !is_bcast_zp
+                                         : nullptr;
+            post_ops_data.c_zp_values
+                    = jcp.dst_zero_point ? dst_zero_point : nullptr;
+            post_ops_data.a_zp_compensations
+                    = jcp.src_zero_point ? zp_compensation + ch : nullptr;
+
+            void *scratch = jcp.s8s8_compensation_required
+                    ? static_cast<void *>(s8s8_comp_ptr + ch)
+                    : nullptr;
+            brgemm_kernel_execute_postops(kernel, bs, ptr_A, ptr_B,
+                    brg_batch, ptr_C, ptr_C, post_ops_data, scratch);
+            ++chb;
+            if (jcp.chb_tail != 0 && chb + 1 == chb_work)
+                kernel = kernel_chb_tail;
+            ch += chb_step;
+            ptr_A += chb_step * src_ch_stride;
+            ptr_B += chb_step * wei_ch_stride;
+            ptr_C += chb_step * dst_ch_stride;
+            --chb_loop_work;
         }
-    });
-    return status::success;
+    }
 }
 } // namespace x64
 } // namespace cpu
@@ -33,7 +33,11 @@ namespace x64 {
 
 struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     struct pd_t : public cpu_convolution_fwd_pd_t {
-        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+        // Note: check `USING_INHERITED_IS_IMPOSSIBLE` comment in other files
+        // for details why this ctor can't be removed.
+        pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brdgmm_dw:", jcp_.isa, ""),
                 brdgmm_dw_convolution_fwd_t);
@@ -54,6 +58,25 @@ struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override;
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    // Arguments shared by all the work items of a single execution.
+    struct call_args_t {
+        const char *src;
+        const char *weights;
+        const char *bias;
+        char *dst;
+        const void *const *post_ops_binary_rhs;
+        const float *oscales;
+        const float *dst_scales;
+        const int32_t *src_zero_point;
+        const int32_t *dst_zero_point;
+    };
+
+    // Computes work items [start, end) of the (mb, od, oh, nb_ow, chb_work)
+    // space. A row of the output is a contiguous range of `nb_ow * chb_work`
+    // items, which lets a fusing primitive drive the convolution row by row
+    // with `src` pointing to its own buffer.
+    void execute_range(const call_args_t &args, int start, int end) const;
+
 private:
     std::vector<std::unique_ptr<brgemm_kernel_t>> brdgmm_kernels_;
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
@@ -21,6 +21,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/dw_convolution_utils.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -79,13 +80,37 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
     VDISPATCH_CONV(attr()->has_default_values(skip_mask, dst_type),
             VERBOSE_UNSUPPORTED_ATTR);
-    VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_type, is_int8),
+
+    // A depthwise convolution post-op splits the attributes: the 1x1 part
+    // keeps the post-ops preceding it, the rest goes to the fused depthwise.
+    const int dw_po_index
+            = attr()->post_ops_.find(primitive_kind::convolution);
+    const bool with_dw_conv = dw_po_index != -1;
+    if (with_dw_conv) {
+        CHECK(attr_1x1_.copy_from(*attr()));
+        attr_1x1_.post_ops_.entry_.resize(dw_po_index);
+        for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
+            CHECK(attr_1x1_.scales_.set(
+                    DNNL_ARG_ATTR_POST_OP_DW | arg, default_quant_entry()));
+    }
+    auto &attr_1x1_ref = with_dw_conv ? attr_1x1_ : attr_;
+
+    VDISPATCH_CONV(
+            attr_1x1_ref.post_ops_.check_sum_consistency(dst_type, is_int8),
             VERBOSE_UNSUPPORTED_POSTOP);
-    CHECK(attr_scales_ok());
+    if (with_dw_conv) {
+        CHECK(attr_scales_ok({{DNNL_ARG_SRC, {0}}, {DNNL_ARG_WEIGHTS, {0, 1}},
+                {DNNL_ARG_DST, {0}},
+                {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS, {0, 1}},
+                {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST, {0}}}));
+    } else {
+        CHECK(attr_scales_ok());
+    }
     CHECK(attr_zero_points_ok());
 
     CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+            weights_md_, dst_md_, bias_md_, attr_1x1_ref,
+            dnnl_get_max_threads(), with_dw_conv));
 
     brgs_ = std::make_shared<brgemm_containers::brgemm_desc_container_t>(32);
 
@@ -159,6 +184,73 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
         book_precomputed_scales(
                 scratchpad, attr()->scales_, OC(), jcp_.scale_adjust_factor);
 
+    if (with_dw_conv) {
+        CHECK(depthwise_po_init(engine, dw_po_index));
+
+        // The binary post-op inputs got their formats in the split
+        // attributes, reflect them in the primitive ones the user queries.
+        auto &entries = attr_.post_ops_.entry_;
+        for (int i = 0; i < dw_po_index; i++)
+            entries[i] = attr_1x1_.post_ops_.entry_[i];
+        const auto &dw_entries = dw_conv_pd_->attr()->post_ops_.entry_;
+        for (size_t i = 0; i < dw_entries.size(); i++)
+            entries[dw_po_index + 1 + i] = dw_entries[i];
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::depthwise_po_init(
+        engine_t *engine, int dw_po_index) {
+    using namespace memory_tracking;
+
+    // The expanded output of the 1x1 convolution is produced row by row into
+    // a per-thread buffer and consumed by the depthwise convolution while it
+    // is still in cache, so it never makes a round trip through memory.
+    VDISPATCH_CONV_IC(ndims() == 4 && jcp_.ngroups == 1,
+            VERBOSE_UNSUPPORTED_FEATURE, "fused depthwise convolution");
+    VDISPATCH_CONV_IC(!jcp_.is_os_blocking && !jcp_.is_rtus,
+            VERBOSE_BLOCKING_FAIL, "row-wise schedule is required");
+    VDISPATCH_CONV_IC(!jcp_.with_sum, VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV_IC(!jcp_.src_zero_point && !jcp_.dst_zero_point,
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    convolution_desc_t cd_dw;
+    primitive_attr_t attr_dw;
+    CHECK(get_depthwise_conv_desc(
+            cd_dw, dst_md_, *attr(), attr_dw, dw_po_index));
+
+    // Note: check `USING_INHERITED_IS_IMPOSSIBLE` comment in other files for
+    // details why the depthwise pd is created directly.
+    dw_conv_pd_ = std::make_shared<dw_pd_t>(&cd_dw, &attr_dw, nullptr);
+    CHECK(dw_conv_pd_->init(engine));
+
+    VDISPATCH_CONV_IC(dnnl_memory_desc_equal(&dst_md_, dw_conv_pd_->src_md(0)),
+            VERBOSE_INCONSISTENT_MDS, "dst_md", "dw_conv_pd_->src_md");
+    const auto &jcp_dw = dw_conv_pd_->jcp_;
+
+    // Pick the number of depthwise output rows per step so that the 1x1 rows
+    // they depend on fit into half of L2, leaving room for the weights, but
+    // keep enough steps to occupy all the threads.
+    const size_t row_size
+            = (size_t)jcp_.ow * jcp_.oc_without_padding * jcp_.dst_dsz;
+    const size_t l2_rows = platform::get_per_core_cache_size(2) / 2 / row_size;
+    const int max_oh_block = l2_rows > (size_t)jcp_dw.kh
+            ? (int)((l2_rows - jcp_dw.kh) / jcp_dw.stride_h) + 1
+            : 1;
+    const int thr_oh_block = nstl::max(1, jcp_dw.mb * jcp_dw.oh / jcp_.nthr);
+    dw_oh_block_ = nstl::min(jcp_dw.oh, nstl::min(max_oh_block, thr_oh_block));
+    dw_buffer_rows_ = (dw_oh_block_ - 1) * jcp_dw.stride_h + jcp_dw.kh;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    registrar_t dw_scratchpad(scratchpad, names::prefix_fusion);
+    dw_scratchpad.book(names::key_fusion_inout_buffer,
+            (size_t)jcp_.nthr * dw_buffer_rows_ * row_size, 1);
+    if (jcp_dw.with_scale)
+        book_precomputed_scales(
+                dw_scratchpad, dw_conv_pd_->attr()->scales_, dw_conv_pd_->OC());
+
     return status::success;
 }
 
@@ -221,11 +313,11 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
 
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
         auto LDD = jcp_.oc_without_padding;
-        const auto &p = attr()->post_ops_;
+        const auto &p = attr_1x1()->post_ops_;
         brg.with_sum = p.find(primitive_kind::sum) != -1;
         brg.with_weights_scale_adjust = jcp_.scale_adjust_factor != 1.0f;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
+                &brg, attr_1x1(), &dst_md_, LDD, jcp_.bia_dt));
         CHECK(brgemm_desc_finalize(&brg));
 
         jcp_.amx_buf_size_per_thread = nstl::max(
@@ -311,6 +403,11 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
             if (is_amx) brgemm_palettes_.insert(brg_idx, brg);
         }
     }
+
+    if (pd()->dw_conv_pd_) {
+        const primitive_desc_t *dw_pd = pd()->dw_conv_pd_.get();
+        CHECK(dw_pd->create_primitive(dw_conv_p_, engine));
+    }
     return status::success;
 }
 
@@ -409,11 +506,12 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
         int od, int oh, int ow, int icc, int *last_brg_idx,
         const float *oscales, int32_t src_zp_vals, int32_t *src_zp_comp,
         int32_t *dst_zp_vals, int32_t *s8s8_compensation,
-        const float *dst_scales, const bool is_last_os) const {
+        const float *dst_scales, const bool is_last_os,
+        char *const dst_row) const {
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper weights_d(pd()->weights_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper dst_d(pd()->dst_1x1_md());
     const size_t src_dt_size = types::data_type_size(src_d.data_type());
     const size_t wei_dt_size = types::data_type_size(weights_d.data_type());
     const size_t dst_dt_size = types::data_type_size(dst_d.data_type());
@@ -482,7 +580,12 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
     const auto dst_offset = dst_dt_size
             * (od * dst_h_sz + oh * dst_w_sz + ow * jcp.oc_without_padding);
 
-    const auto ptr_D = dst + dst_base + dst_offset;
+    // When the output row is redirected to `dst_row`, binary post-ops still
+    // derive the logical offset from the distance to the origin of the output.
+    char *const ptr_D = dst_row
+            ? dst_row + dst_dt_size * (g_oc + ow * jcp.oc_without_padding)
+            : dst + dst_base + dst_offset;
+    char *const dst_origin = dst_row ? ptr_D - (dst_base + dst_offset) : dst;
     char *const ptr_C = (jcp.use_buffer) ? c_buffer : (char *)ptr_D;
 
     const auto bias_w
@@ -534,7 +637,7 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
                     static_cast<const void *>(bias_w),
                     &oscales[jcp.is_oc_scale * g_oc],
                     post_ops_binary_rhs_arg_vec.data(),
-                    static_cast<size_t>(g_oc), 0, dst, 0,
+                    static_cast<size_t>(g_oc), 0, dst_origin, 0,
                     static_cast<void *>(src_zp_comp_ptr), nullptr,
                     static_cast<void *>(dst_zp_vals), false, src_zp_vals, false,
                     false, dst_scales};
@@ -713,6 +816,130 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
     });
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_1x1_convolution_fwd_t<isa>::execute_fused_dw(
+        const exec_ctx_t &ctx, const brgemm_exec_ctx_t &brgemm_ctx,
+        brgemm_batch_element_t *const brg_batch_global, const float *dst_scales,
+        const float *oscales, int32_t *s8s8_compensation,
+        char *const c_buffer_global) const {
+
+    const auto &jcp = pd()->jcp_;
+    const auto *dw_pd = pd()->dw_conv_pd_.get();
+    const auto &jcp_dw = dw_pd->jcp_;
+    const auto *dw_conv = static_cast<const brdgmm_dw_convolution_fwd_t *>(
+            dw_conv_p_.get());
+    const bool is_amx = brgemm_convolution_utils::is_amx(isa);
+
+    const memory_tracking::grantor_t dw_scratchpad(
+            ctx.get_scratchpad_grantor(), prefix_fusion);
+    char *const row_buffer_global
+            = dw_scratchpad.template get<char>(key_fusion_inout_buffer);
+
+    DEFINE_ARG_SCALES_BUFFER(
+            dw_wei_scales, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(
+            dw_dst_scales, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST);
+    // The depthwise convolution dequantizes the 1x1 output with the inverse
+    // of the destination scale the 1x1 part applies.
+    const float dw_src_scales[1] = {1.f / dst_scales[0]};
+    const int dw_wei_scale_mask
+            = dw_pd->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
+    const auto dw_post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(dw_pd->attr()->post_ops_,
+                    ctx, pd()->attr_1x1()->post_ops_.len() + 1);
+
+    brdgmm_dw_convolution_fwd_t::call_args_t dw_args;
+    dw_args.src = nullptr;
+    dw_args.weights = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    dw_args.bias = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+    dw_args.dst = brgemm_ctx.dst;
+    dw_args.post_ops_binary_rhs = dw_post_ops_binary_rhs_arg_vec.data();
+    dw_args.oscales = scale_utils::precompute_scales(dw_scratchpad,
+            dw_src_scales, dw_wei_scales, dw_pd->IC(), dw_pd->OC(), false,
+            dw_wei_scale_mask > 0, dw_pd->attr(), nullptr);
+    dw_args.dst_scales = dw_dst_scales;
+    dw_args.src_zero_point = nullptr;
+    dw_args.dst_zero_point = nullptr;
+
+    const int dw_oh_block = pd()->dw_oh_block_;
+    const int nb_dw_oh = div_up(jcp_dw.oh, dw_oh_block);
+    const int work_amount = jcp.mb * nb_dw_oh;
+    // Work items of the depthwise convolution per output row.
+    const int dw_row_work
+            = jcp_dw.nb_ow * div_up(jcp_dw.ngroups, jcp_dw.nb_ch_blocking);
+    const size_t row_size = dst_w_sz * jcp.dst_dsz;
+    const size_t buffer_size = pd()->dw_buffer_rows_ * row_size;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        if (ithr >= work_amount) return;
+        brgemm_batch_element_t *const brg_batch
+                = brg_batch_global + (size_t)ithr * jcp.adjusted_batch_size;
+        char *const c_buffer = (jcp.use_buffer)
+                ? c_buffer_global + ithr * acc_dsz * jcp.LDC * jcp.M
+                : nullptr;
+        char *const row_buffer = row_buffer_global + ithr * buffer_size;
+        int last_brg_idx = -1;
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        int n {0}, ohb {0};
+        nd_iterator_init(start, n, jcp.mb, ohb, nb_dw_oh);
+
+        // Rows [buf_ih_s, buf_ih_e) of image `buf_n` of the 1x1 output, kept
+        // at the beginning of the buffer.
+        int buf_n = -1, buf_ih_s = 0, buf_ih_e = 0;
+        for (auto work = start; work < end; work++) {
+            const int oh_s = ohb * dw_oh_block;
+            const int oh_e = nstl::min(jcp_dw.oh, oh_s + dw_oh_block);
+            const int ih_s
+                    = nstl::max(0, oh_s * jcp_dw.stride_h - jcp_dw.t_pad);
+            const int ih_e = nstl::min(OH,
+                    (oh_e - 1) * jcp_dw.stride_h - jcp_dw.t_pad + jcp_dw.kh);
+
+            // Rows shared with the previous step are moved instead of being
+            // computed again.
+            int ih_new = ih_s;
+            if (buf_n == n && ih_s >= buf_ih_s && ih_s < buf_ih_e) {
+                ih_new = nstl::min(buf_ih_e, ih_e);
+                std::memmove(row_buffer,
+                        row_buffer + (ih_s - buf_ih_s) * row_size,
+                        (ih_new - ih_s) * row_size);
+            }
+            for (int ih = ih_new; ih < ih_e; ih++) {
+                char *const dst_row = row_buffer + (ih - ih_s) * row_size;
+                for_(int ocb = 0; ocb < jcp.nb_oc; ocb++)
+                for_(int owb = 0; owb < jcp.nb_ow; owb++)
+                for (int icc = 0; icc < pd()->ic_chunks_; icc++) {
+                    exec_ker(brgemm_ctx, ithr, brg_batch, c_buffer, nullptr, 0,
+                            n, ocb, 0, ih, owb * jcp.ow_block, icc,
+                            &last_brg_idx, oscales, 0, nullptr, nullptr,
+                            s8s8_compensation, dst_scales, false, dst_row);
+                }
+            }
+            buf_n = n;
+            buf_ih_s = ih_s;
+            buf_ih_e = ih_e;
+
+            // The depthwise convolution addresses its source as a whole
+            // tensor: shift the buffer so that it starts at row `ih_s` of
+            // image `n`.
+            auto args = dw_args;
+            args.src = row_buffer
+                    - static_cast<ptrdiff_t>(
+                            (n * OH + ih_s) * static_cast<dim_t>(row_size));
+            const int dw_start = (n * jcp_dw.oh + oh_s) * dw_row_work;
+            dw_conv->execute_range(
+                    args, dw_start, dw_start + (oh_e - oh_s) * dw_row_work);
+
+            nd_iterator_step(n, jcp.mb, ohb, nb_dw_oh);
+        }
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
         const exec_ctx_t &ctx) const {
@@ -766,7 +993,10 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
             ? scratchpad.template get<uint8_t>(key_conv_brgemm_inp_buffer_mask)
             : nullptr;
 
-    if (jcp.is_os_blocking) {
+    if (pd()->dw_conv_pd_) {
+        CHECK(execute_fused_dw(ctx, brgemm_ctx, brg_batch_global, dst_scales,
+                oscales, s8s8_compensation, c_buffer_global));
+    } else if (jcp.is_os_blocking) {
         execute_os_blocking(brgemm_ctx, brg_batch_global, dst_scales, oscales,
                 src_zero_point, zp_compensation, dst_zp_vals, s8s8_compensation,
                 c_buffer_global, inp_buffer_base, inp_buffer_mask_base);
@@ -34,6 +34,7 @@
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/cpu_reducer.hpp"
 #include "cpu/x64/jit_avx512_core_scale_precompute.hpp"
+#include "cpu/x64/jit_brdgmm_dw_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv_trans_kernel.hpp"
 #include "cpu/x64/jit_brgemm_conv_utils.hpp"
 #include "cpu/x64/jit_brgemm_post_ops.hpp"
@@ -53,6 +54,51 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine);
 
+        const memory_desc_t *dst_1x1_md(int index = 0) const {
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        // NOLINTBEGIN(google-default-arguments)
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return dw_conv_pd_
+                    ? dw_conv_pd_->dst_md(index, user_input)
+                    : cpu_convolution_fwd_pd_t::dst_md(index, user_input);
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override {
+            if (dw_conv_pd_) {
+                switch (arg) {
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC:
+                        return cpu_convolution_fwd_pd_t::dst_md(0, user_input);
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
+                        return dw_conv_pd_->weights_md(0);
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
+                        return dw_conv_pd_->weights_md(1);
+                    default: break;
+                }
+            }
+            return convolution_fwd_pd_t::arg_md(arg, user_input);
+        }
+        // NOLINTEND(google-default-arguments)
+
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+                return dw_conv_pd_ ? arg_usage_t::input : arg_usage_t::unused;
+
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+                return attr_post_op_dw_inputs() > 1 ? arg_usage_t::input
+                                                    : arg_usage_t::unused;
+
+            return convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        // Attributes of the 1x1 part: post-ops up to the depthwise one.
+        const primitive_attr_t *attr_1x1() const {
+            return jcp_.is_fused_conv ? &attr_1x1_ : attr();
+        }
+
         struct brgemm_init_params_t {
             brgemm_init_params_t(int k_accum_idx, int m, int n, int k,
                     size_t lda, bool wary_tail_read)
@@ -76,8 +122,19 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 
         jit_brgemm_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
 
+        // Fused depthwise convolution. The pd is immutable once initialized,
+        // hence it is shared between copies of this pd.
+        using dw_pd_t = brdgmm_dw_convolution_fwd_t::pd_t;
+        std::shared_ptr<dw_pd_t> dw_conv_pd_;
+        primitive_attr_t attr_1x1_;
+        // Depthwise output rows computed per step and the capacity in rows of
+        // the per-thread buffer holding the 1x1 output they depend on.
+        int dw_oh_block_ = 0;
+        int dw_buffer_rows_ = 0;
+
     private:
         status_t init_brgemm_desc();
+        status_t depthwise_po_init(engine_t *engine, int dw_po_index);
     };
 
     brgemm_1x1_convolution_fwd_t(const pd_t *apd)
@@ -105,7 +162,7 @@ private:
             , bias(CTX_IN_MEM(const char *, DNNL_ARG_BIAS))
             , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST))
             , post_ops_binary_rhs_arg_vec(binary_injector::prepare_binary_args(
-                      pd->attr()->post_ops_, ctx))
+                      pd->attr_1x1()->post_ops_, ctx))
             , wsp_tile(ctx.get_scratchpad_grantor().template get<char>(
                       memory_tracking::names::key_conv_amx_tile_buffer)) {}
         const char *const __restrict src;
@@ -125,7 +182,8 @@ private:
             int od, int oh, int ow, int icc, int *last_brg_idx,
             const float *oscales, int32_t src_zp_vals, int32_t *src_zp_comp,
             int32_t *dst_zp_vals, int32_t *s8s8_compensation,
-            const float *dst_scales, const bool is_last_os = false) const;
+            const float *dst_scales, const bool is_last_os = false,
+            char *const dst_row = nullptr) const;
     void execute_os_blocking(const brgemm_exec_ctx_t &brgemm_ctx,
             brgemm_batch_element_t *const brg_batch_global,
             const float *dst_scales, const float *oscales, int32_t src_zp_vals,
@@ -137,6 +195,11 @@ private:
             const float *dst_scales, const float *oscales, int32_t src_zp_vals,
             int32_t *src_zp_comp, int32_t *dst_zp_vals,
             int32_t *s8s8_compensation, char *const c_buffer_global) const;
+    status_t execute_fused_dw(const exec_ctx_t &ctx,
+            const brgemm_exec_ctx_t &brgemm_ctx,
+            brgemm_batch_element_t *const brg_batch_global,
+            const float *dst_scales, const float *oscales,
+            int32_t *s8s8_compensation, char *const c_buffer_global) const;
 
     status_t execute_forward_all(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
@@ -186,6 +249,7 @@ private:
                     jit_avx512_core_brgemm_conv_rtus_kernel_t>
             rtus_kernel_;
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
+    std::shared_ptr<primitive_t> dw_conv_p_;
 
     const memory_desc_wrapper bias_d;
 
@@ -1501,7 +1501,8 @@ void brg_blocking_t::calc_blocks_1x1() {
     is_reduced_rtus = is_rtus && is_int8_convolution && ic > ic_without_padding
             && everyone_is(1, stride_d, stride_h, stride_w);
 
-    if (is_os_blocking_ok || is_rtus) {
+    // A fused depthwise convolution consumes the output row by row.
+    if (is_rtus || (is_os_blocking_ok && !is_fused_conv)) {
         sp = os;
         is_os_blocking = true;
     } else {
@@ -2445,7 +2446,8 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads) {
+        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads,
+        bool is_fused_conv) {
 
     using namespace prop_kind;
     // disabling verbose dispatch messages for unsupported isa for better readability
@@ -2453,6 +2455,7 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     CHECK(init_jcp(
             jcp, isa, cd, src_md, weights_md, dst_md, bias_md, attr, nthreads));
+    jcp.is_fused_conv = is_fused_conv;
 
     const memory_desc_wrapper src_d(&src_md);
     const memory_desc_wrapper weights_d(&weights_md);
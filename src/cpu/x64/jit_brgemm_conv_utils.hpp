@@ -46,10 +46,13 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
         memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads);
 
+// `is_fused_conv` requests a row-wise (non os-blocked) schedule for a 1x1
+// convolution whose output feeds a fused depthwise convolution.
 status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads);
+        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads,
+        bool is_fused_conv = false);
 
 void set_amx_wsp_per_thread(jit_brgemm_conv_conf_t &jcp);
 
@@ -0,0 +1,404 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace brgemm_wino;
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+    const bool is_f32 = isa == avx512_core;
+
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(
+            impl::is_dense_format_kind({src_md(), weights_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    // Winograd is never picked for `convolution_auto`: direct
+    // implementations are preferred for accuracy.
+    VDISPATCH_CONV(desc()->alg_kind == alg_kind::convolution_winograd,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(IMPLICATION(is_f32,
+                           expect_data_types(f32, f32, data_type::undef, f32,
+                                   data_type::undef)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(IMPLICATION(!is_f32,
+                           src_type == bf16 && wei_type == bf16
+                                   && one_of(dst_type, f32, bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(
+            one_of(bias_md_.data_type, data_type::undef, f32, src_type),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(
+                           skip_mask_t::post_ops | skip_mask_t::fpmath_mode,
+                           dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // Accuracy guard: rounding the transformed source to bf16 amplifies the
+    // error by the magnitude of the transform coefficients, so the bf16
+    // flavor requires an explicit opt-in for implicit bf16 down-conversions.
+    VDISPATCH_CONV(IMPLICATION(!is_f32,
+                           one_of(attr()->fpmath_.mode_, fpmath_mode::bf16,
+                                   fpmath_mode::any)),
+            VERBOSE_UNSUPPORTED_FPMATH_MODE);
+
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++) {
+        const auto &e = po.entry_[i];
+        VDISPATCH_CONV(e.is_eltwise() || e.is_sum(false, true),
+                VERBOSE_UNSUPPORTED_POSTOP);
+    }
+    VDISPATCH_CONV(po.check_sum_consistency(dst_type, /* is_int8 */ false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(KH() == r && KW() == r, VERBOSE_UNSUPPORTED_FEATURE,
+            "kernel size");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "strides");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations");
+    VDISPATCH_CONV(everyone_is(true, 0 <= padT(), padT() <= 1, 0 <= padL(),
+                           padL() <= 1, 0 <= padB(), padB() <= 1, 0 <= padR(),
+                           padR() <= 1),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "");
+
+    VDISPATCH_CONV(set_default_formats_common(nhwc, format_tag::any, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, nhwc)
+                    && memory_desc_matches_tag(dst_md_, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf());
+
+    memory_desc_t want_wei_md = weights_md_;
+    CHECK(init_weights_md(want_wei_md, OC(), IC(), wei_type, jcp_.oc_block));
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = want_wei_md;
+    VDISPATCH_CONV(weights_md_ == want_wei_md, VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_brgemm_desc());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_conf() {
+    auto &jcp = jcp_;
+
+    jcp.src_dt = src_md(0)->data_type;
+    jcp.wei_dt = weights_md(0)->data_type;
+    jcp.dst_dt = dst_md(0)->data_type;
+    jcp.bia_dt = with_bias() ? weights_md(1)->data_type : data_type::undef;
+    jcp.with_bias = with_bias();
+    jcp.with_sum = attr()->post_ops_.find(primitive_kind::sum) != -1;
+
+    jcp.mb = MB();
+    jcp.ic = IC();
+    jcp.oc = OC();
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.t_pad = padT();
+    jcp.l_pad = padL();
+
+    jcp.ic_pad = rnd_up(jcp.ic, vnni_granularity(jcp.wei_dt));
+    jcp.oc_block = jcp.oc >= 64 ? 64 : static_cast<int>(rnd_up(jcp.oc, 16));
+    jcp.nb_oc = static_cast<int>(div_up(jcp.oc, jcp.oc_block));
+
+    jcp.tiles_h = div_up(jcp.oh, m);
+    jcp.tiles_w = div_up(jcp.ow, m);
+    jcp.nb_tiles = jcp.mb * jcp.tiles_h * jcp.tiles_w;
+
+    // The transformed source of a block of tiles is reused for every oc
+    // block, keep it within half of L2.
+    const size_t wei_dsz = types::data_type_size(jcp.wei_dt);
+    const size_t L2 = platform::get_per_core_cache_size(2);
+    const dim_t max_tile_block
+            = (L2 / 2) / (n_points * jcp.ic_pad * wei_dsz);
+    jcp.tile_block = static_cast<int>(
+            nstl::min(jcp.nb_tiles, saturate<dim_t>(8, 32, max_tile_block)));
+    jcp.nb_tile_blocks = div_up(jcp.nb_tiles, jcp.tile_block);
+    jcp.tile_tail = static_cast<int>(jcp.nb_tiles % jcp.tile_block);
+
+    // Split oc blocks between threads only when there are not enough tile
+    // blocks; the source transform is then recomputed by every thread.
+    jcp.nthr = dnnl_get_max_threads();
+    jcp.nb_oc_chunks = jcp.nb_tile_blocks >= jcp.nthr
+            ? 1
+            : static_cast<int>(nstl::min<dim_t>(
+                    jcp.nb_oc, div_up(jcp.nthr, jcp.nb_tile_blocks)));
+
+    jcp.V_size = static_cast<size_t>(n_points) * jcp.tile_block * jcp.ic_pad;
+    jcp.M_size = static_cast<size_t>(n_points) * jcp.tile_block * jcp.oc_block;
+    // A row of zeros for the source points out of the source and a scratch
+    // row for the output pixels out of the destination.
+    jcp.stage_size = nstl::max<size_t>(jcp.ic_pad, jcp.oc_block);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
+    const auto &jcp = jcp_;
+
+    for (int is_M_tail = 0; is_M_tail < 2; is_M_tail++) {
+        const int M = is_M_tail ? jcp.tile_tail : jcp.tile_block;
+        if (M == 0) continue;
+
+        auto &brg = brgs_[is_M_tail];
+        const brgemm_strides_t strides {0, 0};
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_strd, jcp.wei_dt, jcp.wei_dt,
+                false, false, brgemm_row_major, 1.f, 0.f, jcp.ic_pad,
+                jcp.oc_block, jcp.oc_block, M, jcp.oc_block, jcp.ic_pad,
+                &strides));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = jcp_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.book(key_wino_V, jcp.nthr * jcp.V_size,
+            types::data_type_size(jcp.wei_dt));
+    scratchpad.book<float>(
+            key_wino_M, jcp.nthr * (jcp.M_size + jcp.stage_size));
+    if (jcp.bia_dt == data_type::bf16)
+        scratchpad.book<float>(key_conv_bias_bf16_convert_wsp, jcp.oc);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+
+    for (int is_M_tail = 0; is_M_tail < 2; is_M_tail++) {
+        const int M = is_M_tail ? jcp.tile_tail : jcp.tile_block;
+        if (M == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brgs_[is_M_tail]));
+        CHECK(safe_ptr_assign(brg_kernels_[is_M_tail], ker));
+    }
+
+    CHECK(safe_ptr_assign(src_trans_kernel_,
+            new brgemm_wino::jit_src_trans_kernel_t(jcp, isa)));
+    CHECK(src_trans_kernel_->create_kernel());
+
+    for (int is_oc_tail = 0; is_oc_tail < 2; is_oc_tail++) {
+        const int oc_len = is_oc_tail ? jcp.oc % jcp.oc_block : jcp.oc_block;
+        if (oc_len == 0) continue;
+
+        CHECK(safe_ptr_assign(dst_trans_kernels_[is_oc_tail],
+                new brgemm_wino::jit_dst_trans_kernel_t(jcp, oc_len,
+                        pd()->attr()->post_ops_, *pd()->dst_md(), isa)));
+        CHECK(dst_trans_kernels_[is_oc_tail]->create_kernel());
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_src(const void *src,
+        float *stage, void *V, dim_t tile_start, int n_tiles) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const size_t src_dsz = types::data_type_size(jcp.src_dt);
+    const size_t wei_dsz = types::data_type_size(jcp.wei_dt);
+
+    // Zero bytes are zeros of any of the source data types.
+    const float *zero = stage;
+    std::memset(stage, 0, jcp.ic_pad * sizeof(float));
+
+    for (int t = 0; t < n_tiles; t++) {
+        const dim_t tile = tile_start + t;
+        const dim_t n = tile / (jcp.tiles_h * jcp.tiles_w);
+        const dim_t th = (tile / jcp.tiles_w) % jcp.tiles_h;
+        const dim_t tw = tile % jcp.tiles_w;
+        const dim_t ih0 = th * m - jcp.t_pad;
+        const dim_t iw0 = tw * m - jcp.l_pad;
+
+        const void *d[n_points];
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            const int p = i * alpha + j;
+            const dim_t ih = ih0 + i, iw = iw0 + j;
+            if (ih < 0 || ih >= jcp.ih || iw < 0 || iw >= jcp.iw) {
+                d[p] = zero;
+                continue;
+            }
+            d[p] = static_cast<const char *>(src)
+                    + src_d.blk_off(n, 0, ih, iw) * src_dsz;
+        }
+
+        brgemm_wino::src_trans_call_args_t args;
+        args.src = d;
+        args.V = static_cast<char *>(V) + t * jcp.ic_pad * wei_dsz;
+        (*src_trans_kernel_)(&args);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_dst(const float *M,
+        float *stage, const float *bias, void *dst, dim_t tile_start,
+        int n_tiles, int ocb) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t dst_dsz = types::data_type_size(jcp.dst_dt);
+
+    const dim_t oc_start = ocb * jcp.oc_block;
+    const bool is_oc_tail = jcp.oc - oc_start < jcp.oc_block;
+    const auto *ker = dst_trans_kernels_[is_oc_tail].get();
+
+    for (int t = 0; t < n_tiles; t++) {
+        const dim_t tile = tile_start + t;
+        const dim_t n = tile / (jcp.tiles_h * jcp.tiles_w);
+        const dim_t th = (tile / jcp.tiles_w) % jcp.tiles_h;
+        const dim_t tw = tile % jcp.tiles_w;
+
+        void *y[m * m];
+        for_(int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            const int p = i * m + j;
+            const dim_t oh = th * m + i, ow = tw * m + j;
+            if (oh >= jcp.oh || ow >= jcp.ow) {
+                y[p] = stage;
+                continue;
+            }
+            y[p] = static_cast<char *>(dst)
+                    + dst_d.blk_off(n, oc_start, oh, ow) * dst_dsz;
+        }
+
+        brgemm_wino::dst_trans_call_args_t args;
+        args.M = M + t * jcp.oc_block;
+        args.bias = bias ? bias + oc_start : nullptr;
+        args.dst = y;
+        (*ker)(&args);
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *V_base = scratchpad.template get<char>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+
+    const float *bias_f32 = static_cast<const float *>(bias);
+    if (jcp.with_bias && jcp.bia_dt == data_type::bf16) {
+        float *bias_cvt = scratchpad.template get<float>(
+                key_conv_bias_bf16_convert_wsp);
+        cvt_bfloat16_to_float(
+                bias_cvt, static_cast<const bfloat16_t *>(bias), jcp.oc);
+        bias_f32 = bias_cvt;
+    }
+
+    const size_t wei_dsz = types::data_type_size(jcp.wei_dt);
+    const dim_t V_point_stride = jcp.tile_block * jcp.ic_pad * wei_dsz;
+    const dim_t M_point_stride = jcp.tile_block * jcp.oc_block;
+    const dim_t U_block_stride = jcp.ic_pad * jcp.oc_block * wei_dsz;
+    const dim_t work_amount = jcp.nb_tile_blocks * jcp.nb_oc_chunks;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *V = V_base + ithr * jcp.V_size * wei_dsz;
+        float *M = M_base + ithr * (jcp.M_size + jcp.stage_size);
+        float *stage = M + jcp.M_size;
+
+        dim_t tb {0}, occ {0}, last_tb {-1};
+        nd_iterator_init(start, tb, jcp.nb_tile_blocks, occ, jcp.nb_oc_chunks);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t tile_start = tb * jcp.tile_block;
+            const int n_tiles = static_cast<int>(
+                    nstl::min<dim_t>(jcp.tile_block, jcp.nb_tiles - tile_start));
+            if (tb != last_tb) {
+                transform_src(src, stage, V, tile_start, n_tiles);
+                last_tb = tb;
+            }
+
+            const auto *ker = brg_kernels_[n_tiles != jcp.tile_block].get();
+            int ocb_start {0}, ocb_end {0};
+            balance211(jcp.nb_oc, jcp.nb_oc_chunks, static_cast<int>(occ),
+                    ocb_start, ocb_end);
+            for (int ocb = ocb_start; ocb < ocb_end; ocb++) {
+                for (int p = 0; p < n_points; p++) {
+                    const char *U = weights
+                            + (p * jcp.nb_oc + ocb) * U_block_stride;
+                    brgemm_kernel_execute(ker, 1, V + p * V_point_stride, U,
+                            nullptr, M + p * M_point_stride);
+                }
+                transform_dst(M, stage, jcp.with_bias ? bias_f32 : nullptr,
+                        dst, tile_start, n_tiles, ocb);
+            }
+
+            nd_iterator_step(tb, jcp.nb_tile_blocks, occ, jcp.nb_oc_chunks);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_wino_convolution_fwd_t<avx512_core>;
+template struct brgemm_wino_convolution_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm_wino_reorders.hpp"
+#include "cpu/x64/jit_brgemm_wino_trans_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Forward Winograd F(4x4, 3x3) convolution for nhwc activations. Input tiles
+// are transformed to the Winograd domain (V = B^T * d * B), multiplied by the
+// pre-transformed weights U with one brgemm call per transformed point and the
+// result is transformed back (Y = A^T * M * A) with bias and post-ops applied.
+template <cpu_isa_t isa>
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_wino:", isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        brgemm_wino_conf_t jcp_ = utils::zero<decltype(jcp_)>();
+        // Indexed by `is_M_tail`.
+        brgemm_desc_t brgs_[2];
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_desc();
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    ~brgemm_wino_convolution_fwd_t() override = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void transform_src(const void *src, float *stage, void *V, dim_t tile_start,
+            int n_tiles) const;
+    void transform_dst(const float *M, float *stage, const float *bias,
+            void *dst, dim_t tile_start, int n_tiles, int ocb) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[2];
+    std::unique_ptr<brgemm_wino::jit_src_trans_kernel_t> src_trans_kernel_;
+    // Indexed by `is_oc_tail`.
+    std::unique_ptr<brgemm_wino::jit_dst_trans_kernel_t> dst_trans_kernels_[2];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
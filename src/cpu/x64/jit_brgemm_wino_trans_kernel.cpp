@@ -0,0 +1,364 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm_wino_reorders.hpp"
+#include "cpu/x64/jit_brgemm_wino_trans_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace brgemm_wino {
+
+using namespace Xbyak;
+
+namespace {
+
+constexpr int simd_w = 16;
+constexpr int vlen = simd_w * sizeof(float);
+
+void init_const(jit_generator_t *host, const Zmm &zmm, const Reg64 &reg_tmp,
+        float value) {
+    host->mov(reg_tmp.cvt32(), float2int(value));
+    host->vpbroadcastd(zmm, reg_tmp.cvt32());
+}
+
+void init_mask(jit_generator_t *host, const Opmask &k, const Reg64 &reg_tmp,
+        dim_t len) {
+    host->mov(reg_tmp.cvt32(), (1 << len) - 1);
+    host->kmovw(k, reg_tmp.cvt32());
+}
+
+} // namespace
+
+#define GET_OFF(field) offsetof(src_trans_call_args_t, field)
+
+jit_src_trans_kernel_t::jit_src_trans_kernel_t(
+        const brgemm_wino_conf_t &ajcp, cpu_isa_t isa)
+    : jit_generator_t(jit_name(), isa)
+    , jcp_(ajcp)
+    , src_dsz_(types::data_type_size(ajcp.src_dt))
+    , V_dsz_(types::data_type_size(ajcp.wei_dt))
+    , V_point_stride_(ajcp.tile_block * ajcp.ic_pad * V_dsz_) {}
+
+// One row of B^T * x, where
+// B^T = [[4,  0, -5,  0, 1, 0],
+//        [0, -4, -4,  1, 1, 0],
+//        [0,  4, -4, -1, 1, 0],
+//        [0, -2, -1,  2, 1, 0],
+//        [0,  2, -1, -2, 1, 0],
+//        [0,  4,  0, -5, 0, 1]]
+void jit_src_trans_kernel_t::transform(const Zmm *x, const Zmm *y) {
+    const Zmm s12(12), s34(13), d42(14), d13(15);
+
+    // y0 = x4 + 4 * x0 - 5 * x2
+    vmovups(y[0], x[4]);
+    vfmadd231ps(y[0], x[0], zmm_four);
+    vfnmadd231ps(y[0], x[2], zmm_five);
+    // y1 = x3 + x4 - 4 * (x1 + x2), y2 = x4 - x3 + 4 * (x1 - x2)
+    vaddps(s12, x[1], x[2]);
+    vaddps(s34, x[3], x[4]);
+    vmovups(y[1], s34);
+    vfnmadd231ps(y[1], s12, zmm_four);
+    vsubps(s12, x[1], x[2]);
+    vsubps(s34, x[4], x[3]);
+    vmovups(y[2], s34);
+    vfmadd231ps(y[2], s12, zmm_four);
+    // y3 = x4 - x2 - 2 * (x1 - x3), y4 = x4 - x2 + 2 * (x1 - x3)
+    vsubps(d42, x[4], x[2]);
+    vsubps(d13, x[1], x[3]);
+    vmovups(y[3], d42);
+    vfnmadd231ps(y[3], d13, zmm_two);
+    vmovups(y[4], d42);
+    vfmadd231ps(y[4], d13, zmm_two);
+    // y5 = x5 + 4 * x1 - 5 * x3
+    vmovups(y[5], x[5]);
+    vfmadd231ps(y[5], x[1], zmm_four);
+    vfnmadd231ps(y[5], x[3], zmm_five);
+}
+
+void jit_src_trans_kernel_t::compute_chunk(bool is_tail) {
+    const Zmm x[alpha] = {Zmm(0), Zmm(1), Zmm(2), Zmm(3), Zmm(4), Zmm(5)};
+    const Zmm y[alpha] = {Zmm(6), Zmm(7), Zmm(8), Zmm(9), Zmm(10), Zmm(11)};
+    const bool is_bf16_src = jcp_.src_dt == data_type::bf16;
+    const bool is_bf16_V = jcp_.wei_dt == data_type::bf16;
+
+    // The columns of d, the rows of B^T * d are kept on the stack.
+    for (int j = 0; j < alpha; j++) {
+        for (int i = 0; i < alpha; i++) {
+            mov(reg_src, ptr[reg_src_ptrs + (i * alpha + j) * sizeof(void *)]);
+            const auto addr = ptr[reg_src + reg_c * src_dsz_];
+            const auto zmm = is_tail ? x[i] | k_load | T_z : x[i];
+            if (is_bf16_src) {
+                vpmovzxwd(zmm, addr);
+                vpslld(x[i], x[i], 16);
+            } else {
+                vmovups(zmm, addr);
+            }
+        }
+        transform(x, y);
+        for (int i = 0; i < alpha; i++)
+            vmovups(ptr[rsp + (i * alpha + j) * vlen], y[i]);
+    }
+
+    // The rows of B^T * d times B.
+    for (int i = 0; i < alpha; i++) {
+        for (int j = 0; j < alpha; j++)
+            vmovups(x[j], ptr[rsp + (i * alpha + j) * vlen]);
+        transform(x, y);
+        for (int j = 0; j < alpha; j++) {
+            const auto addr = ptr[reg_V + reg_c * V_dsz_
+                    + (i * alpha + j) * V_point_stride_];
+            if (is_bf16_V) {
+                const Ymm ymm(y[j].getIdx());
+                vcvtneps2bf16(ymm, y[j]);
+                if (is_tail)
+                    vmovdqu16(addr | k_store, ymm);
+                else
+                    vmovdqu16(addr, ymm);
+            } else {
+                if (is_tail)
+                    vmovups(addr | k_store, y[j]);
+                else
+                    vmovups(addr, y[j]);
+            }
+        }
+    }
+}
+
+void jit_src_trans_kernel_t::generate() {
+    const dim_t n_full = jcp_.ic / simd_w;
+    const dim_t load_tail = jcp_.ic - n_full * simd_w;
+    const dim_t store_tail = jcp_.ic_pad - n_full * simd_w;
+    const int stack_size = n_points * vlen;
+
+    preamble();
+    sub(rsp, stack_size);
+
+    mov(reg_src_ptrs, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_V, ptr[reg_param + GET_OFF(V)]);
+    init_const(this, zmm_four, reg_tmp, 4.f);
+    init_const(this, zmm_five, reg_tmp, 5.f);
+    init_const(this, zmm_two, reg_tmp, 2.f);
+    xor_(reg_c, reg_c);
+
+    if (n_full > 0) {
+        Label loop;
+        mov(reg_loop, n_full);
+        L(loop);
+        compute_chunk(false);
+        add(reg_c, simd_w);
+        dec(reg_loop);
+        jnz(loop, T_NEAR);
+    }
+    // The padded channels are loaded as zeros and transformed to zeros.
+    if (store_tail > 0) {
+        init_mask(this, k_load, reg_tmp, load_tail);
+        init_mask(this, k_store, reg_tmp, store_tail);
+        compute_chunk(true);
+    }
+
+    add(rsp, stack_size);
+    postamble();
+}
+
+#undef GET_OFF
+#define GET_OFF(field) offsetof(dst_trans_call_args_t, field)
+
+jit_dst_trans_kernel_t::jit_dst_trans_kernel_t(const brgemm_wino_conf_t &ajcp,
+        int oc_len, const post_ops_t &post_ops, const memory_desc_t &dst_md,
+        cpu_isa_t isa)
+    : jit_generator_t(jit_name(), isa)
+    , jcp_(ajcp)
+    , oc_len_(oc_len)
+    , dst_d_(&dst_md)
+    , dst_dsz_(types::data_type_size(ajcp.dst_dt))
+    , M_point_stride_(ajcp.tile_block * ajcp.oc_block * sizeof(float)) {
+    if (post_ops.len() == 0) return;
+
+    const int sum_idx = post_ops.find(primitive_kind::sum);
+    if (sum_idx != -1) sum_scale_ = post_ops.entry_[sum_idx].sum.scale;
+
+    static constexpr bool preserve_gpr = true;
+    static constexpr bool preserve_vmm = true;
+    const eltwise_injector::static_params_t esp(true /*save_state*/,
+            reg_po_helper, k_po_helper, true /*is_fwd*/, false /*use_dst*/);
+    // Only eltwise and sum post-ops are supported, the binary injector is
+    // never used.
+    const binary_injector::rhs_arg_static_params_t rhs_sp {
+            static_cast<size_t>(zmm_po_tmp.getIdx()), r13, r14, r15,
+            preserve_gpr, preserve_vmm, 0, GET_OFF(dst), dst_d_};
+    const binary_injector::static_params_t bsp {reg_param, rhs_sp};
+
+    postops_injector_ = utils::make_unique<
+            injector::jit_uni_postops_injector_t<avx512_core>>(
+            this, post_ops, bsp, esp);
+}
+
+// One row of A^T * x, where
+// A^T = [[1, 1,  1, 1,  1, 0],
+//        [0, 1, -1, 2, -2, 0],
+//        [0, 1,  1, 4,  4, 0],
+//        [0, 1, -1, 8, -8, 1]]
+void jit_dst_trans_kernel_t::transform(const Zmm *x, const Zmm *y) {
+    const Zmm s12(18), d12(19), s34(20), d34(21);
+
+    vaddps(s12, x[1], x[2]);
+    vsubps(d12, x[1], x[2]);
+    vaddps(s34, x[3], x[4]);
+    vsubps(d34, x[3], x[4]);
+    // y0 = x0 + s12 + s34
+    vaddps(y[0], x[0], s12);
+    vaddps(y[0], y[0], s34);
+    // y1 = d12 + 2 * d34
+    vmovups(y[1], d12);
+    vfmadd231ps(y[1], d34, zmm_two);
+    // y2 = s12 + 4 * s34
+    vmovups(y[2], s12);
+    vfmadd231ps(y[2], s34, zmm_four);
+    // y3 = d12 + 8 * d34 + x5
+    vaddps(y[3], d12, x[5]);
+    vfmadd231ps(y[3], d34, zmm_eight);
+}
+
+void jit_dst_trans_kernel_t::load_dst(const Zmm &zmm, int j, bool is_tail) {
+    const auto addr = ptr[reg_dst[j] + reg_c * dst_dsz_];
+    const auto zmm_masked = is_tail ? zmm | k_tail | T_z : zmm;
+    if (jcp_.dst_dt == data_type::bf16) {
+        vpmovzxwd(zmm_masked, addr);
+        vpslld(zmm, zmm, 16);
+    } else {
+        vmovups(zmm_masked, addr);
+    }
+}
+
+void jit_dst_trans_kernel_t::store_dst(const Zmm &zmm, int j, bool is_tail) {
+    const auto addr = ptr[reg_dst[j] + reg_c * dst_dsz_];
+    if (jcp_.dst_dt == data_type::bf16) {
+        const Ymm ymm(zmm.getIdx());
+        vcvtneps2bf16(ymm, zmm);
+        if (is_tail)
+            vmovdqu16(addr | k_tail, ymm);
+        else
+            vmovdqu16(addr, ymm);
+    } else {
+        if (is_tail)
+            vmovups(addr | k_tail, zmm);
+        else
+            vmovups(addr, zmm);
+    }
+}
+
+void jit_dst_trans_kernel_t::compute_chunk(bool is_tail) {
+    const Zmm x[alpha] = {Zmm(12), Zmm(13), Zmm(14), Zmm(15), Zmm(16), Zmm(17)};
+    const Zmm y[m] = {Zmm(out_idx), Zmm(out_idx + 1), Zmm(out_idx + 2),
+            Zmm(out_idx + 3)};
+
+    // The columns of M, the rows of A^T * M are kept on the stack.
+    for (int j = 0; j < alpha; j++) {
+        for (int i = 0; i < alpha; i++) {
+            const auto addr = ptr[reg_M + reg_c * sizeof(float)
+                    + (i * alpha + j) * M_point_stride_];
+            vmovups(is_tail ? x[i] | k_tail | T_z : x[i], addr);
+        }
+        transform(x, y);
+        for (int i = 0; i < m; i++)
+            vmovups(ptr[rsp + (i * alpha + j) * vlen], y[i]);
+    }
+
+    if (jcp_.with_bias) {
+        const auto addr = ptr[reg_bias + reg_c * sizeof(float)];
+        vmovups(is_tail ? zmm_bias | k_tail | T_z : zmm_bias, addr);
+    }
+
+    if (jcp_.with_sum) {
+        postops_injector_->set_lambda_injector(
+                primitive_kind::sum, [this, is_tail, y]() {
+                    for (int j = 0; j < m; j++) {
+                        load_dst(zmm_prev, j, is_tail);
+                        if (sum_scale_ == 1.f)
+                            vaddps(y[j], y[j], zmm_prev);
+                        else
+                            vfmadd231ps(y[j], zmm_prev, zmm_sum_scale);
+                    }
+                });
+    }
+
+    // The rows of A^T * M times A are the rows of pixels of the tile.
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < alpha; j++)
+            vmovups(x[j], ptr[rsp + (i * alpha + j) * vlen]);
+        transform(x, y);
+        for (int j = 0; j < m; j++) {
+            if (jcp_.with_bias) vaddps(y[j], y[j], zmm_bias);
+            mov(reg_dst[j], ptr[reg_dst_ptrs + (i * m + j) * sizeof(void *)]);
+        }
+        if (postops_injector_)
+            postops_injector_->compute_vector_range(out_idx, out_idx + m);
+        for (int j = 0; j < m; j++)
+            store_dst(y[j], j, is_tail);
+    }
+}
+
+void jit_dst_trans_kernel_t::generate() {
+    const int n_full = oc_len_ / simd_w;
+    const int tail = oc_len_ % simd_w;
+    const int stack_size = m * alpha * vlen;
+
+    preamble();
+    sub(rsp, stack_size);
+
+    mov(reg_M, ptr[reg_param + GET_OFF(M)]);
+    if (jcp_.with_bias) mov(reg_bias, ptr[reg_param + GET_OFF(bias)]);
+    mov(reg_dst_ptrs, ptr[reg_param + GET_OFF(dst)]);
+    init_const(this, zmm_two, reg_tmp, 2.f);
+    init_const(this, zmm_four, reg_tmp, 4.f);
+    init_const(this, zmm_eight, reg_tmp, 8.f);
+    if (jcp_.with_sum && sum_scale_ != 1.f)
+        init_const(this, zmm_sum_scale, reg_tmp, sum_scale_);
+    xor_(reg_c, reg_c);
+
+    if (n_full > 0) {
+        Label loop;
+        mov(reg_loop, n_full);
+        L(loop);
+        compute_chunk(false);
+        add(reg_c, simd_w);
+        dec(reg_loop);
+        jnz(loop, T_NEAR);
+    }
+    if (tail > 0) {
+        init_mask(this, k_tail, reg_tmp, tail);
+        compute_chunk(true);
+    }
+
+    add(rsp, stack_size);
+    postamble();
+
+    if (postops_injector_) postops_injector_->prepare_table(true);
+}
+
+#undef GET_OFF
+
+} // namespace brgemm_wino
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_TRANS_KERNEL_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_TRANS_KERNEL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct brgemm_wino_conf_t {
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt;
+    dim_t mb, ic, oc, ih, iw, oh, ow;
+    dim_t t_pad, l_pad;
+
+    // Channels as seen by brgemm: ic is padded to the VNNI granularity, oc is
+    // split into blocks of `oc_block` which form the brgemm N dimension.
+    dim_t ic_pad;
+    int oc_block, nb_oc;
+
+    // Output tiles of m x m pixels, `tile_block` of them form the brgemm M
+    // dimension for every transformed point.
+    dim_t tiles_h, tiles_w, nb_tiles;
+    int tile_block, tile_tail;
+    dim_t nb_tile_blocks;
+    int nb_oc_chunks;
+
+    bool with_bias, with_sum;
+    int nthr;
+
+    // Per-thread scratchpad sizes in elements.
+    size_t V_size, M_size, stage_size;
+};
+
+namespace brgemm_wino {
+
+struct src_trans_call_args_t {
+    // The input points of a tile, the points out of the source point to a row
+    // of zeros.
+    const void *const *src;
+    // The tile in the transformed source.
+    void *V;
+};
+
+struct dst_trans_call_args_t {
+    // The tile in the brgemm output.
+    const float *M;
+    // The bias of the oc block in f32, unused without bias.
+    const float *bias;
+    // The output pixels of a tile, the pixels out of the destination point to
+    // a scratch row.
+    void *const *dst;
+};
+
+// Computes V = B^T * d * B for all the channels of one tile, 16 channels at a
+// time. The channels of V past `ic` are zeroed.
+struct jit_src_trans_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_src_trans_kernel_t)
+
+    jit_src_trans_kernel_t(const brgemm_wino_conf_t &ajcp, cpu_isa_t isa);
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+
+    const brgemm_wino_conf_t jcp_;
+    const dim_t src_dsz_, V_dsz_;
+    // The distance between two points of a tile in V, in bytes.
+    const dim_t V_point_stride_;
+
+    const reg64_t reg_param = abi_param1;
+    const reg64_t reg_src_ptrs = r8;
+    const reg64_t reg_V = r9;
+    const reg64_t reg_c = r10;
+    const reg64_t reg_loop = r11;
+    const reg64_t reg_src = r12;
+    const reg64_t reg_tmp = rax;
+
+    const Xbyak::Opmask k_load = k2;
+    const Xbyak::Opmask k_store = k3;
+
+    const Xbyak::Zmm zmm_four = Xbyak::Zmm(16);
+    const Xbyak::Zmm zmm_five = Xbyak::Zmm(17);
+    const Xbyak::Zmm zmm_two = Xbyak::Zmm(18);
+
+    void transform(const Xbyak::Zmm *x, const Xbyak::Zmm *y);
+    void compute_chunk(bool is_tail);
+    void generate() override;
+};
+
+// Computes Y = A^T * M * A + bias for the channels of an oc block of one tile,
+// applies the eltwise and sum post-ops and stores the pixels to the
+// destination.
+struct jit_dst_trans_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_dst_trans_kernel_t)
+
+    jit_dst_trans_kernel_t(const brgemm_wino_conf_t &ajcp, int oc_len,
+            const post_ops_t &post_ops, const memory_desc_t &dst_md,
+            cpu_isa_t isa);
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+
+    const brgemm_wino_conf_t jcp_;
+    const int oc_len_;
+    const memory_desc_wrapper dst_d_;
+    const dim_t dst_dsz_;
+    // The distance between two points of a tile in M, in bytes.
+    const dim_t M_point_stride_;
+    float sum_scale_ = 1.f;
+
+    const reg64_t reg_param = abi_param1;
+    const reg64_t reg_M = r8;
+    const reg64_t reg_bias = r9;
+    const reg64_t reg_dst_ptrs = r10;
+    const reg64_t reg_c = r11;
+    const reg64_t reg_loop = r12;
+    const reg64_t reg_dst[4] = {r13, r14, r15, rbx};
+    const reg64_t reg_po_helper = rdx;
+    const reg64_t reg_tmp = rax;
+
+    const Xbyak::Opmask k_tail = k2;
+    const Xbyak::Opmask k_po_helper = k1;
+
+    // The pixels of a row of the tile, the post-ops are applied to them.
+    static constexpr int out_idx = 8;
+    const Xbyak::Zmm zmm_two = Xbyak::Zmm(22);
+    const Xbyak::Zmm zmm_four = Xbyak::Zmm(23);
+    const Xbyak::Zmm zmm_eight = Xbyak::Zmm(24);
+    const Xbyak::Zmm zmm_sum_scale = Xbyak::Zmm(25);
+    const Xbyak::Zmm zmm_bias = Xbyak::Zmm(26);
+    const Xbyak::Zmm zmm_prev = Xbyak::Zmm(27);
+    const Xbyak::Zmm zmm_po_tmp = Xbyak::Zmm(28);
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<avx512_core>>
+            postops_injector_;
+
+    void transform(const Xbyak::Zmm *x, const Xbyak::Zmm *y);
+    void load_dst(const Xbyak::Zmm &zmm, int j, bool is_tail);
+    void store_dst(const Xbyak::Zmm &zmm, int j, bool is_tail);
+    void compute_chunk(bool is_tail);
+    void generate() override;
+};
+
+} // namespace brgemm_wino
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -953,9 +953,39 @@ struct jit_reduction_conf_t {
 
     alg_kind_t alg = alg_kind::undef;
     cpu_isa_t isa = isa_undef;
-
+    float p = 0.f;
+    float eps = 0.f;
+
+    // The tensors are viewed as a set of dense physical axes. The innermost
+    // axis is processed by the kernel: if it is reduced (horizontal case) the
+    // kernel reduces `reduce_size` contiguous elements into a scalar,
+    // otherwise (vertical case) it reduces `reduce_size` rows of
+    // `reduce_stride` elements apart into a vector of `inner_blk` elements.
+    bool is_vertical = false;
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
+    dim_t reduce_stride = 1;
+    dim_t inner_size = 1;
+    dim_t inner_blk = 1;
+    dim_t total_reduce_size = 0;
+
+    // Remaining axes, outermost first, iterated by the driver.
+    static constexpr int max_axes = 2 * DNNL_MAX_NDIMS;
+    int n_idle_axes = 0;
+    dim_t idle_dims[max_axes] = {0};
+    dim_t idle_src_strides[max_axes] = {0};
+    dim_t idle_dst_strides[max_axes] = {0};
+    int n_reduce_axes = 0;
+    dim_t reduce_dims[max_axes] = {0};
+    dim_t reduce_src_strides[max_axes] = {0};
+
+    // Partial results are kept in f32 buffers when the reduction is spread
+    // over several kernel calls or several threads.
+    bool with_partial_acc = false;
+    // The kernel combines f32 partial results instead of source values.
+    bool is_combine = false;
+    int nthr = 1;
+    int nthr_reduce = 1;
 
     bool is_saturation_needed = false;
 
@@ -972,6 +1002,10 @@ struct jit_uni_reduction_args_t {
     void *dst = nullptr;
     const void *post_ops_binary_rhs_arg_vec = nullptr;
     const void *dst_orig = nullptr;
+    float *acc = nullptr;
+    dim_t work = 0;
+    size_t load_acc = 0;
+    size_t store_dst = 0;
 };
 
 } // namespace x64
@@ -20,6 +20,8 @@
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -41,6 +43,8 @@ struct jit_args_t {
     const void *dst; // fwd: dst;  bwd: diff_src;
     const void *diff_dst; // fwd: nullptr;  bwd: diff_dst;
     size_t work_amount;
+    float *src_amax; // fwd: a vector of partial maxima or nullptr;
+    float *dst_amax; // fwd: a vector of partial maxima or nullptr;
 };
 
 struct jit_uni_eltwise_kernel_t : public jit_generator_t {
@@ -85,7 +89,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
                           : is_f8()   ? cpu_isa_traits_t<isa>::vlen / 4
                                       : cpu_isa_traits_t<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , with_src_amax_(is_fwd_ && pd_->attr()->amax_.has(DNNL_ARG_SRC))
+        , with_dst_amax_(is_fwd_ && pd_->attr()->amax_.has(DNNL_ARG_DST)) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
@@ -111,11 +117,13 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
 
     void compute_dst(const bool tail) {
         io_[data_type()]->load(ptr[reg_src], vmm_src, tail);
+        if (with_src_amax_) update_amax(vmm_src_amax, vmm_src, tail);
         eltwise_injector_->compute_vector(vmm_src.getIdx());
         if (!is_fwd_) {
             io_[data_type()]->load(ptr[reg_diff_dst], vmm_diff_dst, tail);
             uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
         }
+        if (with_dst_amax_) update_amax(vmm_dst_amax, vmm_src, tail);
         io_[data_type()]->store(vmm_src, ptr[reg_dst], tail);
     }
 
@@ -134,8 +142,10 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
             const auto vsrc = i == 0 ? vmm_src_even : vmm_src_odd;
             const auto vdiff_dst
                     = i == 0 ? vmm_diff_dst_even : vmm_diff_dst_odd;
+            if (with_src_amax_) update_amax(vmm_src_amax, vsrc, false);
             eltwise_injector_->compute_vector(vsrc.getIdx());
             if (!is_fwd_) uni_vmulps(vsrc, vsrc, vdiff_dst);
+            if (with_dst_amax_) update_amax(vmm_dst_amax, vsrc, false);
             io_[data_type()]->store(vsrc, ptr[reg_dst + i * vlen_], tail);
         }
     }
@@ -206,6 +216,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         if (is_bf16()) io_.init_bf16();
 
         Reg64 param = abi_param1;
+        mov(reg_param, param);
         mov(reg_src, ptr[param + GET_OFF(src)]);
         mov(reg_dst, ptr[param + GET_OFF(dst)]);
         if (!is_fwd_) mov(reg_diff_dst, ptr[param + GET_OFF(diff_dst)]);
@@ -222,8 +233,20 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel_t {
         // there's a restriction on certain blocked layouts, when this behavior
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
+        if (with_src_amax_) uni_vpxor(vmm_src_amax, vmm_src_amax, vmm_src_amax);
+        if (with_dst_amax_) uni_vpxor(vmm_dst_amax, vmm_dst_amax, vmm_dst_amax);
+
         compute();
 
+        if (with_src_amax_) {
+            mov(reg_tmp, ptr[reg_param + GET_OFF(src_amax)]);
+            uni_vmovups(ptr[reg_tmp], vmm_src_amax);
+        }
+        if (with_dst_amax_) {
+            mov(reg_tmp, ptr[reg_param + GET_OFF(dst_amax)]);
+            uni_vmovups(ptr[reg_tmp], vmm_dst_amax);
+        }
+
         postamble();
 
         eltwise_injector_->prepare_table();
@@ -238,6 +261,8 @@ private:
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    const bool with_src_amax_;
+    const bool with_dst_amax_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
@@ -247,6 +272,7 @@ private:
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
     Reg64 reg_tmp = r14;
+    Reg64 reg_param = r15;
 
     Opmask injector_mask = Opmask(1);
 
@@ -261,6 +287,10 @@ private:
     Vmm vmm_src_odd = Vmm(8);
     Vmm vmm_diff_dst_even = vmm_diff_dst;
     Vmm vmm_diff_dst_odd = Vmm(9);
+    // amax accumulators, out of the vregs the injector uses on fwd
+    Vmm vmm_src_amax = Vmm(10);
+    Vmm vmm_dst_amax = Vmm(11);
+    Vmm vmm_abs = Vmm(12);
     std::unique_ptr<jit_uni_eltwise_injector_t<injector_isa>> eltwise_injector_;
     io::jit_io_multi_dt_helper_t<Vmm> io_;
 
@@ -272,6 +302,20 @@ private:
     const int emu_zmm_5_idx_ = 29;
     const int tail_opmask_idx_ = 6;
     const int emu_kmask_aux_idx_ = 2;
+
+    // Accumulates the absolute values of `vmm` as integers: clearing the sign
+    // bit leaves the f32 values ordered as their bit patterns. Only the first
+    // lane holds a value on the tail.
+    void update_amax(const Vmm &vmm_amax, const Vmm &vmm, const bool tail) {
+        if (tail) {
+            uni_vpxor(vmm_abs, vmm_abs, vmm_abs);
+            uni_vmovss(Xmm(vmm_abs.getIdx()), Xmm(vmm.getIdx()));
+            uni_vpslld(vmm_abs, vmm_abs, 1);
+        } else
+            uni_vpslld(vmm_abs, vmm, 1);
+        uni_vpsrld(vmm_abs, vmm_abs, 1);
+        uni_vpmaxsd(vmm_amax, vmm_amax, vmm_abs);
+    }
 };
 
 } // namespace
@@ -307,7 +351,13 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     // refer to a comment in jit_uni_kernel why this is needed
     VDISPATCH_ELTWISE(IMPLICATION(!src_d.is_dense(), is_zero_preserved()),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
-    VDISPATCH_ELTWISE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ELTWISE(
+            attr()->has_default_values(primitive_attr_t::skip_mask_t::amax),
+            VERBOSE_UNSUPPORTED_ATTR);
+    // The maxima are accumulated with integer vector instructions.
+    VDISPATCH_ELTWISE(IMPLICATION(!attr()->amax_.has_default_values(),
+                              isa != avx),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_ELTWISE(set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_ELTWISE(src_d == memory_desc_wrapper(dst_md()),
             VERBOSE_INCONSISTENT_MDS, "src", "dst");
@@ -341,6 +391,9 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
+    amax_accumulator_t src_amax(ctx, pd()->attr(), DNNL_ARG_SRC);
+    amax_accumulator_t dst_amax(ctx, pd()->attr(), DNNL_ARG_DST);
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
@@ -349,13 +402,24 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         end = nstl::min(nelems, end * simd_w);
         if (start == end) return;
 
+        // The kernel stores a vector of partial maxima per thread.
+        alignas(64) float src_max[16] = {0};
+        alignas(64) float dst_max[16] = {0};
+
         jit_args_t args;
         args.src = src + start;
         args.dst = dst + start;
         args.diff_dst = nullptr;
         args.work_amount = end - start;
+        args.src_amax = src_max;
+        args.dst_amax = dst_max;
         (*kernel_)(&args);
+
+        if (src_amax.enabled()) src_amax.update(src_max, data_type::f32, 16);
+        if (dst_amax.enabled()) dst_amax.update(dst_max, data_type::f32, 16);
     });
+    src_amax.store();
+    dst_amax.store();
 
     return status::success;
 }
@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/x64/jit_uni_reduction.hpp"
@@ -49,6 +52,93 @@ static bool impl_supports_datatype(data_type_t data_type) {
     }
 }
 
+namespace {
+
+struct phys_axis_t {
+    dim_t size;
+    dim_t src_stride;
+    dim_t dst_stride;
+    bool is_reduced;
+};
+
+int get_simd_w(const jit_reduction_conf_t &conf) {
+    using namespace data_type;
+    if (is_superset(conf.isa, avx512_core)) return 16;
+    const bool is_i8 = utils::one_of(conf.src_type, s8, u8)
+            || utils::one_of(conf.dst_type, s8, u8);
+    if (is_superset(conf.isa, avx) && !is_i8) return 8;
+    return 4;
+}
+
+// Maximum number of vectors accumulated by a single vertical kernel call.
+int get_max_unroll(const jit_reduction_conf_t &conf) {
+    return is_superset(conf.isa, avx512_core) ? 16 : 4;
+}
+
+// Builds the list of physical axes of src sorted from outermost to innermost.
+// Axes that are adjacent in memory and of the same kind are merged. Returns
+// false if the layouts cannot be handled.
+bool init_phys_axes(const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &dst_d, std::vector<phys_axis_t> &axes) {
+    const int ndims = src_d.ndims();
+    const auto &src_blk = src_d.blocking_desc();
+    const auto &dst_blk = dst_d.blocking_desc();
+
+    if (src_blk.inner_nblks != dst_blk.inner_nblks) return false;
+    dims_t blocks = {0};
+    src_d.compute_blocks(blocks);
+
+    dim_t inner_stride = 1;
+    for (int i = src_blk.inner_nblks - 1; i >= 0; --i) {
+        const int d = src_blk.inner_idxs[i];
+        if (dst_blk.inner_idxs[i] != d
+                || dst_blk.inner_blks[i] != src_blk.inner_blks[i])
+            return false;
+        // Blocked reduced dimensions are not supported as vectors would
+        // mix reduced and non-reduced values.
+        if (src_d.dims()[d] != dst_d.dims()[d]) return false;
+        axes.push_back({src_blk.inner_blks[i], inner_stride, inner_stride,
+                false});
+        inner_stride *= src_blk.inner_blks[i];
+    }
+    for (int d = 0; d < ndims; ++d) {
+        const bool is_reduced = src_d.dims()[d] != dst_d.dims()[d];
+        axes.push_back({src_d.padded_dims()[d] / blocks[d],
+                src_blk.strides[d], is_reduced ? 0 : dst_blk.strides[d],
+                is_reduced});
+    }
+
+    axes.erase(std::remove_if(axes.begin(), axes.end(),
+                       [](const phys_axis_t &a) { return a.size == 1; }),
+            axes.end());
+    std::stable_sort(axes.begin(), axes.end(),
+            [](const phys_axis_t &a, const phys_axis_t &b) {
+                return a.src_stride > b.src_stride;
+            });
+
+    std::vector<phys_axis_t> merged;
+    for (auto it = axes.rbegin(); it != axes.rend(); ++it) {
+        if (!merged.empty()) {
+            auto &inner = merged.back();
+            const bool can_merge = it->is_reduced == inner.is_reduced
+                    && it->src_stride == inner.size * inner.src_stride
+                    && IMPLICATION(!it->is_reduced,
+                            it->dst_stride == inner.size * inner.dst_stride);
+            if (can_merge) {
+                inner.size *= it->size;
+                continue;
+            }
+        }
+        merged.push_back(*it);
+    }
+    axes.assign(merged.rbegin(), merged.rend());
+
+    return !axes.empty() && axes.back().src_stride == 1
+            && IMPLICATION(!axes.back().is_reduced, axes.back().dst_stride == 1);
+}
+
+} // namespace
+
 status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     using namespace alg_kind;
     using namespace data_type;
@@ -77,18 +167,84 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
             VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_REDUCTION(impl::is_dense_format_kind({src_md(), dst_md()}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_REDUCTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "src");
 
     const auto src_mdw = memory_desc_wrapper(src_md());
     const auto dst_mdw = memory_desc_wrapper(dst_md());
 
+    VDISPATCH_REDUCTION(src_mdw.is_blocking_desc() && dst_mdw.is_blocking_desc()
+                    && src_mdw.is_dense() && dst_mdw.is_dense(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    conf_.alg = desc()->alg_kind;
+    conf_.p = desc()->p;
+    conf_.eps = desc()->eps;
+    const bool is_norm = utils::one_of(conf_.alg, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+    VDISPATCH_REDUCTION(IMPLICATION(is_norm, utils::one_of(conf_.p, 1.f, 2.f)),
+            VERBOSE_BAD_ALGORITHM);
+
+    std::vector<phys_axis_t> axes;
+    VDISPATCH_REDUCTION(
+            init_phys_axes(src_mdw, dst_mdw, axes), VERBOSE_UNSUPPORTED_TAG);
+
+    conf_.total_reduce_size = 1;
+    for (const auto &a : axes)
+        if (a.is_reduced) conf_.total_reduce_size *= a.size;
+    VDISPATCH_REDUCTION(conf_.total_reduce_size > 1,
+            "dimensionality reduction not possible");
+
+    // The kernel takes the innermost axis and, in the vertical case, the
+    // innermost reduced axis. Everything else is iterated by the driver.
+    conf_.is_vertical = !axes.back().is_reduced;
+    int kernel_reduce_axis = (int)axes.size() - 1;
+    if (conf_.is_vertical) {
+        conf_.inner_size = axes.back().size;
+        while (!axes[kernel_reduce_axis].is_reduced)
+            --kernel_reduce_axis;
+    }
+    conf_.reduce_size = axes[kernel_reduce_axis].size;
+    conf_.reduce_stride = axes[kernel_reduce_axis].src_stride;
+
+    conf_.n_idle_axes = conf_.n_reduce_axes = 0;
+    conf_.idle_size = 1;
+    const int n_outer_axes = (int)axes.size() - (conf_.is_vertical ? 1 : 0);
+    for (int a = 0; a < n_outer_axes; ++a) {
+        if (a == kernel_reduce_axis) continue;
+        if (axes[a].is_reduced) {
+            conf_.reduce_dims[conf_.n_reduce_axes] = axes[a].size;
+            conf_.reduce_src_strides[conf_.n_reduce_axes] = axes[a].src_stride;
+            conf_.n_reduce_axes++;
+        } else {
+            conf_.idle_dims[conf_.n_idle_axes] = axes[a].size;
+            conf_.idle_src_strides[conf_.n_idle_axes] = axes[a].src_stride;
+            conf_.idle_dst_strides[conf_.n_idle_axes] = axes[a].dst_stride;
+            conf_.idle_size *= axes[a].size;
+            conf_.n_idle_axes++;
+        }
+    }
+
+    conf_.inner_blk = conf_.is_vertical
+            ? nstl::min(conf_.inner_size,
+                    (dim_t)get_max_unroll(conf_) * get_simd_w(conf_))
+            : 1;
+    init_reduce_split();
+
     const std::vector<injector::post_op_type> accepted_post_ops
             = {injector::sum, injector::eltwise, injector::binary};
     static constexpr bool sum_at_0_pos_only = false;
     static constexpr bool sum_requires_scale_one = false;
     static constexpr bool sum_requires_zp_zero = true;
     static constexpr bool sum_requires_same_params = false;
-    const bcast_set_t accepted_broadcasts
-            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+    // A vertical kernel stores several consecutive destination points at
+    // once, so only broadcasts that do not depend on the point position are
+    // supported.
+    const bcast_set_t accepted_broadcasts = conf_.is_vertical
+            ? bcast_set_t {broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::no_broadcast}
+            : bcast_set_t {broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::per_oc,
                     broadcasting_strategy_t::per_oc_spatial,
                     broadcasting_strategy_t::no_broadcast};
     injector::post_ops_ok_args_t post_ops_args(conf_.isa, accepted_post_ops,
@@ -114,56 +270,116 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     conf_.with_postops
             = conf_.with_eltwise || conf_.with_binary || conf_.with_sum;
 
-    const format_tag_t src_md_desired_format = memory_desc_matches_one_of_tag(
-            *src_md(), x, nc, ncw, nchw, ncdhw);
-    const format_tag_t dst_md_desired_format = memory_desc_matches_one_of_tag(
-            *dst_md(), x, nc, ncw, nchw, ncdhw);
-    VDISPATCH_REDUCTION(!(src_md_desired_format != dst_md_desired_format
-                                || src_md_desired_format == format_tag::undef),
-            VERBOSE_UNSUPPORTED_TAG);
+    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
 
-    const int ndims = src_mdw.ndims();
-    const auto &src_dims = src_mdw.dims();
-    const auto &dst_dims = dst_mdw.dims();
+    init_scratchpad();
 
-    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
+    return status::success;
+}
 
-    int num_of_reduced_dims = 0;
-    conf_.idle_size = dst_mdw.nelems();
-    conf_.reduce_size = 1;
-    for (int d = ndims - 1; d >= 0; --d) {
-        if (src_dims[d] != dst_dims[d]) {
-            num_of_reduced_dims++;
-            conf_.reduce_size *= src_dims[d];
-        } else
+void jit_uni_reduction_t::pd_t::init_reduce_split() {
+    conf_.nthr = dnnl_get_max_threads();
+    conf_.nthr_reduce = 1;
+
+    const dim_t work_amount = get_work_amount();
+    dim_t reduce_outer_size = 1;
+    for (int a = 0; a < conf_.n_reduce_axes; ++a)
+        reduce_outer_size *= conf_.reduce_dims[a];
+
+    // A long contiguous reduction with few outputs is viewed as a 2D one so
+    // that its outer part can be split between threads.
+    static constexpr dim_t min_horizontal_blk = 256;
+    if (!conf_.is_vertical && work_amount * reduce_outer_size < conf_.nthr) {
+        const dim_t q_start
+                = utils::div_up(conf_.nthr, work_amount * reduce_outer_size);
+        for (dim_t q = nstl::max(q_start, (dim_t)2);
+                q <= conf_.reduce_size / min_horizontal_blk; ++q) {
+            if (conf_.reduce_size % q) continue;
+            const dim_t blk = conf_.reduce_size / q;
+            conf_.reduce_dims[conf_.n_reduce_axes] = q;
+            conf_.reduce_src_strides[conf_.n_reduce_axes] = blk;
+            conf_.n_reduce_axes++;
+            conf_.reduce_size = blk;
+            reduce_outer_size *= q;
             break;
+        }
     }
 
-    VDISPATCH_REDUCTION(
-            num_of_reduced_dims != 0, "dimensionality reduction not possible");
+    // Threads are split between outputs first. When there are not enough
+    // outputs, the reduction itself is split, each thread producing partial
+    // results that are combined afterwards.
+    const dim_t reduce_steps
+            = reduce_outer_size * (conf_.is_vertical ? conf_.reduce_size : 1);
+    static constexpr dim_t min_elems_per_thr = 4096;
+    const dim_t elems_per_step = conf_.is_vertical
+            ? conf_.inner_blk
+            : conf_.reduce_size;
+    if (work_amount < conf_.nthr) {
+        const dim_t max_nthr_by_size = nstl::max((dim_t)1,
+                reduce_steps * elems_per_step / min_elems_per_thr);
+        conf_.nthr_reduce = (int)nstl::min(
+                nstl::min(conf_.nthr / work_amount, reduce_steps),
+                max_nthr_by_size);
+    }
 
-    for (int d = 0; d < ndims - num_of_reduced_dims; ++d)
-        if (src_dims[d] != dst_dims[d]) return status::unimplemented;
+    conf_.with_partial_acc = conf_.nthr_reduce > 1 || conf_.n_reduce_axes > 0;
+}
 
-    conf_.alg = desc()->alg_kind;
-    VDISPATCH_REDUCTION(
-            !(utils::one_of(conf_.alg, reduction_norm_lp_max,
-                    reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
-                    reduction_norm_lp_power_p_sum)),
-            VERBOSE_BAD_ALGORITHM);
+void jit_uni_reduction_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    if (!conf_.with_partial_acc) return;
 
-    return status::success;
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t acc_len = conf_.inner_blk;
+    if (conf_.nthr_reduce > 1)
+        scratchpad.template book<float>(key_reduction,
+                conf_.nthr_reduce * get_work_amount() * acc_len);
+    else
+        scratchpad.template book<float>(key_reduction, conf_.nthr * acc_len);
 }
 
-status_t jit_uni_reduction_t::init(engine_t *engine) {
-    using namespace format_tag;
+dim_t jit_uni_reduction_t::pd_t::get_work_amount() const {
+    return conf_.idle_size * utils::div_up(conf_.inner_size, conf_.inner_blk);
+}
 
+status_t jit_uni_reduction_t::init(engine_t *engine) {
     const memory_desc_t *dst_md = pd()->dst_md();
     const jit_reduction_conf_t &conf = pd()->get_conf();
 
-    CHECK(get_proper_kernel(dst_md, conf));
+    CHECK(get_proper_kernel(kernel_, dst_md, conf));
     CHECK(kernel_->create_kernel());
 
+    const dim_t inner_tail = conf.inner_size % conf.inner_blk;
+    if (conf.is_vertical && inner_tail) {
+        tail_conf_ = conf;
+        tail_conf_.inner_blk = inner_tail;
+        CHECK(get_proper_kernel(kernel_tail_, dst_md, tail_conf_));
+        CHECK(kernel_tail_->create_kernel());
+    }
+
+    if (conf.nthr_reduce > 1) {
+        // Partial results are combined by a vertical kernel reading f32 rows
+        // of [nthr_reduce][work_amount][inner_blk] buffer.
+        combine_conf_ = conf;
+        combine_conf_.src_type = data_type::f32;
+        combine_conf_.src_dt_size = sizeof(float);
+        combine_conf_.is_vertical = true;
+        combine_conf_.is_combine = true;
+        combine_conf_.with_partial_acc = false;
+        combine_conf_.reduce_size = conf.nthr_reduce;
+        combine_conf_.reduce_stride = pd()->get_work_amount() * conf.inner_blk;
+        CHECK(get_proper_kernel(combine_kernel_, dst_md, combine_conf_));
+        CHECK(combine_kernel_->create_kernel());
+
+        if (conf.is_vertical && inner_tail) {
+            combine_tail_conf_ = combine_conf_;
+            combine_tail_conf_.inner_blk = inner_tail;
+            CHECK(get_proper_kernel(
+                    combine_kernel_tail_, dst_md, combine_tail_conf_));
+            CHECK(combine_kernel_tail_->create_kernel());
+        }
+    }
+
     return status::success;
 }
 
@@ -171,75 +387,177 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
-    const dim_t idle_size = pd()->get_conf().idle_size;
-    const dim_t reduce_size = pd()->get_conf().reduce_size;
-    const std::size_t src_dt_size = pd()->get_conf().src_dt_size;
-    const std::size_t dst_dt_size = pd()->get_conf().dst_dt_size;
+    const auto &conf = pd()->get_conf();
+    const std::size_t src_dt_size = conf.src_dt_size;
+    const std::size_t dst_dt_size = conf.dst_dt_size;
     const auto &post_ops = pd()->attr()->post_ops_;
     const auto &post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(post_ops, ctx);
 
-    parallel_nd(idle_size, [&](dim_t i) {
-        const dim_t src_off = i * reduce_size * src_dt_size;
-        const dim_t dst_off = i * dst_dt_size;
+    const dim_t n_inner_blks = utils::div_up(conf.inner_size, conf.inner_blk);
+    const dim_t work_amount = pd()->get_work_amount();
+    const dim_t rows = conf.is_vertical ? conf.reduce_size : 1;
+    dim_t reduce_outer_size = 1;
+    for (int a = 0; a < conf.n_reduce_axes; ++a)
+        reduce_outer_size *= conf.reduce_dims[a];
+    const dim_t reduce_steps = reduce_outer_size * rows;
+
+    // Returns src and dst offsets of a work item, in elements.
+    const auto work_offsets = [&](dim_t iw, dim_t &src_off, dim_t &dst_off,
+                                      bool &is_tail) {
+        const dim_t iblk = iw % n_inner_blks;
+        dim_t idle_idx = iw / n_inner_blks;
+        src_off = dst_off = iblk * conf.inner_blk;
+        for (int a = conf.n_idle_axes - 1; a >= 0; --a) {
+            const dim_t i = idle_idx % conf.idle_dims[a];
+            idle_idx /= conf.idle_dims[a];
+            src_off += i * conf.idle_src_strides[a];
+            dst_off += i * conf.idle_dst_strides[a];
+        }
+        is_tail = conf.is_vertical && iblk == n_inner_blks - 1
+                && conf.inner_size % conf.inner_blk;
+    };
+
+    const auto reduce_offset = [&](dim_t reduce_idx) {
+        dim_t off = 0;
+        for (int a = conf.n_reduce_axes - 1; a >= 0; --a) {
+            off += (reduce_idx % conf.reduce_dims[a])
+                    * conf.reduce_src_strides[a];
+            reduce_idx /= conf.reduce_dims[a];
+        }
+        return off;
+    };
+
+    // Reduces steps [start, end) of the flattened reduction space of a work
+    // item. A step is a point of the outer reduced axes in the horizontal
+    // case and a row of such a point in the vertical case.
+    const auto reduce_range = [&](dim_t iw, dim_t start, dim_t end, float *acc,
+                                      bool store_dst) {
+        dim_t src_off = 0, dst_off = 0;
+        bool is_tail = false;
+        work_offsets(iw, src_off, dst_off, is_tail);
+        const auto &kernel = is_tail ? kernel_tail_ : kernel_;
+
+        bool load_acc = false;
+        while (start < end) {
+            const dim_t r = start % rows;
+            const dim_t n = nstl::min(rows - r, end - start);
+            const dim_t off = src_off + reduce_offset(start / rows)
+                    + r * conf.reduce_stride;
+            start += n;
+
+            jit_uni_reduction_args_t args;
+            args.src = src + off * src_dt_size;
+            args.dst = dst + dst_off * dst_dt_size;
+            args.dst_orig = dst;
+            args.post_ops_binary_rhs_arg_vec
+                    = post_ops_binary_rhs_arg_vec.data();
+            args.acc = acc;
+            args.work = n;
+            args.load_acc = load_acc;
+            args.store_dst = store_dst && start == end;
+
+            (*kernel)(&args);
+            load_acc = true;
+        }
+    };
+
+    if (conf.nthr_reduce == 1) {
+        if (!conf.with_partial_acc) {
+            parallel_nd(work_amount, [&](dim_t iw) {
+                reduce_range(iw, 0, reduce_steps, nullptr, true);
+            });
+            return status::success;
+        }
+
+        float *acc_base = ctx.get_scratchpad_grantor().template get<float>(
+                memory_tracking::names::key_reduction);
+        parallel(conf.nthr, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(work_amount, nthr, ithr, start, end);
+            float *acc = acc_base + ithr * conf.inner_blk;
+            for (dim_t iw = start; iw < end; ++iw)
+                reduce_range(iw, 0, reduce_steps, acc, true);
+        });
+        return status::success;
+    }
+
+    float *partial = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reduction);
+    const dim_t nthr_reduce = conf.nthr_reduce;
+    parallel_nd(work_amount, nthr_reduce, [&](dim_t iw, dim_t ir) {
+        dim_t start = 0, end = 0;
+        balance211(reduce_steps, nthr_reduce, ir, start, end);
+        float *acc = partial + (ir * work_amount + iw) * conf.inner_blk;
+        reduce_range(iw, start, end, acc, false);
+    });
+
+    parallel_nd(work_amount, [&](dim_t iw) {
+        dim_t src_off = 0, dst_off = 0;
+        bool is_tail = false;
+        work_offsets(iw, src_off, dst_off, is_tail);
+        const auto &kernel = is_tail ? combine_kernel_tail_ : combine_kernel_;
 
         jit_uni_reduction_args_t args;
-        args.src = src + src_off;
-        args.dst = dst + dst_off;
+        args.src = partial + iw * conf.inner_blk;
+        args.dst = dst + dst_off * dst_dt_size;
         args.dst_orig = dst;
         args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        args.work = nthr_reduce;
+        args.store_dst = true;
 
-        (*kernel_)(&args);
+        (*kernel)(&args);
     });
 
     return status::success;
 }
 
 status_t jit_uni_reduction_t::get_proper_kernel(
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
         const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_fp16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_fp16>(conf, dst_md));
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2_vnni_2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2>(
                                 conf, dst_md));
         } else if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
         }
     } else if (conf.isa == sse41)
         return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+                kernel, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
     else
         return status::runtime_error;
 }
@@ -42,8 +42,11 @@ struct jit_uni_reduction_t : public primitive_t {
 
         const jit_reduction_conf_t &get_conf() const { return conf_; };
 
+        dim_t get_work_amount() const;
+
     private:
-        bool fill_post_ops_conf();
+        void init_reduce_split();
+        void init_scratchpad();
 
         jit_reduction_conf_t conf_;
     };
@@ -57,11 +60,20 @@ struct jit_uni_reduction_t : public primitive_t {
 
 private:
     status_t get_proper_kernel(
+            std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
             const memory_desc_t *dst_md, const jit_reduction_conf_t &conf);
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
+    // Kernels keep a reference to their configuration.
+    jit_reduction_conf_t tail_conf_;
+    jit_reduction_conf_t combine_conf_;
+    jit_reduction_conf_t combine_tail_conf_;
+
     std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_tail_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> combine_kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> combine_kernel_tail_;
 };
 
 } // namespace x64
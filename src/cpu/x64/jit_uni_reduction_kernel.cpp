@@ -38,7 +38,10 @@ template <cpu_isa_t isa, typename Vmm>
 jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
         const jit_reduction_conf_t &conf, const memory_desc_t *dst_md)
     : jit_uni_reduction_kernel_base_t(conf)
-    , load_tail_size_(conf.reduce_size % simd_w_)
+    , load_tail_size_(conf.is_vertical ? conf.inner_blk % simd_w_
+                                       : conf.reduce_size % simd_w_)
+    , store_tail_size_(conf.is_vertical ? load_tail_size_ : 1)
+    , n_vecs_(conf.is_vertical ? utils::div_up(conf.inner_blk, simd_w_) : 1)
     , io_load_(this, isa, conf_.src_type, {false},
               io::io_tail_conf_t {simd_w_, load_tail_size_, k_tail_load_mask_,
                       vmm_tail_load_mask_.getIdx(), reg_tmp_},
@@ -52,7 +55,11 @@ jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
               io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
                       vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_},
               io::io_saturation_conf_t {vmm_zero_saturation_.getIdx(),
-                      vmm_saturation_ubound_.getIdx(), reg_tmp_}) {
+                      vmm_saturation_ubound_.getIdx(), reg_tmp_})
+    , io_acc_(this, isa, data_type::f32, {false},
+              io::io_tail_conf_t {simd_w_, load_tail_size_, k_tail_load_mask_,
+                      vmm_tail_load_mask_.getIdx(), reg_tmp_}) {
+    assert(n_vecs_ <= max_vertical_unroll_);
     init_compute_op();
     init_compute_scalar_op();
     if (conf_.with_postops) init_post_ops_injector(dst_md);
@@ -63,7 +70,6 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
     using namespace alg_kind;
     using namespace nstl;
 
-    const Xmm xmm_tmp_(vmm_tmp1_.getIdx());
     float starting_val = 0;
 
     switch (conf_.alg) {
@@ -74,12 +80,17 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
         case reduction_mean:
         case reduction_sum: starting_val = 0.f; break;
         case reduction_mul: starting_val = 1.f; break;
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum: starting_val = 0.f; break;
         default: assert(!"unknown alg");
     }
 
-    mov(reg_tmp_.cvt32(), float2int(starting_val));
-    uni_vmovd(xmm_tmp_, reg_tmp_.cvt32());
-    uni_vbroadcastss(vmm_acc_, xmm_tmp_);
+    const Vmm vmm_acc = conf_.is_vertical ? vmm_vertical_acc(0) : vmm_acc_;
+    uni_broadcast_f32(vmm_acc, starting_val);
+    for (int i = 1; i < n_vecs_; i++)
+        uni_vmovups(vmm_vertical_acc(i), vmm_acc);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -98,6 +109,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_op_ = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                 uni_vaddps(acc, acc, to_acc);
             };
@@ -130,6 +145,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_scalar_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_scalar_op_
                     = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                           addss(acc, to_acc);
@@ -271,6 +290,8 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
         cmp(reg_work_, 2);
         jl(label_work_tail_begin);
         io_load_.load_two_simdw_xf16(ptr[reg_src_], vmm_tmp1_, vmm_tmp2_);
+        apply_preop(vmm_tmp1_);
+        apply_preop(vmm_tmp2_);
 
         compute_op_(vmm_acc_, vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp2_);
@@ -286,6 +307,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
         cmp(reg_work_, 0);
         je(label_work_tail_end);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        apply_preop(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -297,6 +319,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        apply_preop(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -312,6 +335,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_base() {
         cmp(reg_work_, 0);
         je(label_work_end);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        apply_preop(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -323,6 +347,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_base() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        apply_preop(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -338,32 +363,105 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
         reduce_base();
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::uni_broadcast_f32(
+        const Vmm &vmm, const float val) {
+    const Xmm xmm(vmm.getIdx());
+    mov(reg_tmp_.cvt32(), float2int(val));
+    uni_vmovd(xmm, reg_tmp_.cvt32());
+    uni_vbroadcastss(vmm, xmm);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_preop(const Vmm &vmm) {
+    using namespace alg_kind;
+    // Partial results are already raised to the power of p.
+    if (conf_.is_combine
+            || !utils::one_of(conf_.alg, reduction_norm_lp_max,
+                    reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                    reduction_norm_lp_power_p_sum))
+        return;
+
+    if (conf_.p == 2.f)
+        uni_vmulps(vmm, vmm, vmm);
+    else
+        uni_vandps(vmm, vmm, vmm_abs_mask_);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_alg_finalization(
+        const int start_idx, const int n_vecs) {
+    using namespace alg_kind;
+
+    const bool is_lp = utils::one_of(
+            conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum);
+    const bool is_eps_max = utils::one_of(
+            conf_.alg, reduction_norm_lp_max, reduction_norm_lp_power_p_max);
+    const bool is_eps_sum = utils::one_of(
+            conf_.alg, reduction_norm_lp_sum, reduction_norm_lp_power_p_sum);
+
+    if (conf_.alg == reduction_mean)
+        uni_broadcast_f32(
+                vmm_tmp1_, static_cast<float>(conf_.total_reduce_size));
+    else if (is_eps_max || is_eps_sum)
+        uni_broadcast_f32(vmm_tmp1_, conf_.eps);
+    else
+        return;
+
+    for (int i = 0; i < n_vecs; i++) {
+        const Vmm vmm_acc(start_idx + i);
+        if (conf_.alg == reduction_mean)
+            uni_vdivps(vmm_acc, vmm_acc, vmm_tmp1_);
+        else if (is_eps_max)
+            uni_vmaxps(vmm_acc, vmm_acc, vmm_tmp1_);
+        else
+            uni_vaddps(vmm_acc, vmm_acc, vmm_tmp1_);
+        if (is_lp && conf_.p == 2.f) uni_vsqrtps(vmm_acc, vmm_acc);
+    }
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::load_params() {
     mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
     mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
-    mov(reg_work_, conf_.reduce_size / simd_w_);
+    if (conf_.with_partial_acc) mov(reg_acc_, ptr[reg_param_ + GET_OFF(acc)]);
+    if (conf_.is_vertical) {
+        mov(reg_work_, ptr[reg_param_ + GET_OFF(work)]);
+        mov(reg_src_stride_, conf_.reduce_stride * conf_.src_dt_size);
+    } else
+        mov(reg_work_, conf_.reduce_size / simd_w_);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+bool jit_uni_reduction_kernel_t<isa, Vmm>::is_store_tail(
+        const int vec_idx) const {
+    if (!conf_.is_vertical) return true;
+    return vec_idx == n_vecs_ - 1 && store_tail_size_ > 0;
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(const int data_idx) {
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(
+        const int start_idx, const int n_vecs) {
     if (conf_.with_sum) {
         assert(!conf_.sum_scales.empty()
                 && "No scales for sum post operation.");
-        const auto sum_injector = [this, data_idx]() {
+        const auto sum_injector = [this, start_idx, n_vecs]() {
             const Vmm vmm_prev_dst(vmm_tmp1_.getIdx());
-            const Vmm vmm_dst(data_idx);
-
-            io_store_.load(ptr[reg_dst_], vmm_prev_dst, true);
             const float sum_scale = sum_scales_.front();
-            if (sum_scale == 1.f)
-                uni_vaddps(vmm_dst, vmm_dst, vmm_prev_dst);
-            else {
+            if (sum_scale != 1.f) {
                 const Xmm xmm_sum_scale = Xmm(vmm_sum_scale_.getIdx());
                 mov(reg_tmp1_.cvt32(), float2int(sum_scale));
                 uni_vmovd(xmm_sum_scale, reg_tmp1_.cvt32());
                 uni_vbroadcastss(vmm_sum_scale_, xmm_sum_scale);
-                uni_vfmadd231ps(vmm_dst, vmm_prev_dst, vmm_sum_scale_);
+            }
+            for (int i = 0; i < n_vecs; i++) {
+                const Vmm vmm_dst(start_idx + i);
+                io_store_.load(ptr[reg_dst_ + i * simd_w_ * conf_.dst_dt_size],
+                        vmm_prev_dst, is_store_tail(i));
+                if (sum_scale == 1.f)
+                    uni_vaddps(vmm_dst, vmm_dst, vmm_prev_dst);
+                else
+                    uni_vfmadd231ps(vmm_dst, vmm_prev_dst, vmm_sum_scale_);
             }
             sum_scales_.push(sum_scale);
             sum_scales_.pop();
@@ -374,46 +472,64 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(const int data_idx) {
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(const int data_idx) {
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(
+        const int start_idx, const int n_vecs) {
     binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
 
-    if (conf_.with_sum) apply_sum(data_idx);
+    if (conf_.with_sum) apply_sum(start_idx, n_vecs);
 
     if (conf_.with_binary) {
-        rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idx, reg_dst_);
-        rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+        for (int i = 0; i < n_vecs; i++) {
+            const int data_idx = start_idx + i;
+            rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idx, reg_dst_);
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                    data_idx, i * simd_w_ * conf_.dst_dt_size);
+            if (is_store_tail(i)) rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+        }
     }
 
-    postops_injector_->compute_vector(data_idx, rhs_arg_params);
+    postops_injector_->compute_vector_range(
+            start_idx, start_idx + n_vecs, rhs_arg_params);
 }
 
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::finalize() {
+    const Xmm xmm_acc(vmm_acc_.getIdx());
+    const Xmm xmm_tmp(vmm_tmp1_.getIdx());
+    Label label_store_dst, label_end;
+
     if (static_cast<std::size_t>(conf_.reduce_size) > load_tail_size_) {
         reduce_vmm_to_scalar(
                 vmm_acc_, vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, simd_w_);
     }
 
-    if (conf_.alg == alg_kind::reduction_mean) {
-        const Xmm xmm_acc(vmm_acc_.getIdx());
-        const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
-        mov(reg_tmp_.cvt32(), float2int(static_cast<float>(conf_.reduce_size)));
-        uni_vmovd(xmm_reduce_size, reg_tmp_.cvt32());
-        uni_vdivss(xmm_acc, xmm_acc, xmm_reduce_size);
+    if (conf_.with_partial_acc) {
+        Label label_no_load_acc;
+        mov(reg_tmp1_, ptr[reg_param_ + GET_OFF(load_acc)]);
+        test(reg_tmp1_, reg_tmp1_);
+        jz(label_no_load_acc, T_NEAR);
+        uni_vmovss(xmm_tmp, ptr[reg_acc_]);
+        compute_scalar_op_(xmm_acc, xmm_tmp);
+        L(label_no_load_acc);
+
+        mov(reg_tmp1_, ptr[reg_param_ + GET_OFF(store_dst)]);
+        test(reg_tmp1_, reg_tmp1_);
+        jnz(label_store_dst, T_NEAR);
+        uni_vmovss(ptr[reg_acc_], xmm_acc);
+        jmp(label_end, T_NEAR);
     }
 
-    if (conf_.with_postops) apply_postops(vmm_acc_.getIdx());
+    L(label_store_dst);
+    apply_alg_finalization(vmm_acc_.getIdx(), 1);
+
+    if (conf_.with_postops) apply_postops(vmm_acc_.getIdx(), 1);
 
     io_store_.store(vmm_acc_, ptr[reg_dst_], true);
+    L(label_end);
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
-    preamble();
-
-    io_store_.init_bf16();
-    if (conf_.is_saturation_needed) io_store_.init_saturate_f32();
-
+void jit_uni_reduction_kernel_t<isa, Vmm>::generate_horizontal() {
     if (load_tail_size_ > 0) io_load_.prepare_tail_mask();
     io_store_.prepare_tail_mask();
 
@@ -421,6 +537,117 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
     init_acc();
     reduce();
     finalize();
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::init_vertical_acc() {
+    Label label_rows;
+
+    if (conf_.with_partial_acc) {
+        Label label_init;
+        mov(reg_tmp1_, ptr[reg_param_ + GET_OFF(load_acc)]);
+        test(reg_tmp1_, reg_tmp1_);
+        jz(label_init, T_NEAR);
+        for (int i = 0; i < n_vecs_; i++)
+            io_acc_.load(ptr[reg_acc_ + i * vlen_], vmm_vertical_acc(i),
+                    is_store_tail(i));
+        jmp(label_rows, T_NEAR);
+        L(label_init);
+    }
+
+    init_acc();
+    L(label_rows);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_vertical() {
+    static constexpr int n_tmp_vmms = 4;
+    Label label_work_begin, label_work_end;
+
+    L(label_work_begin);
+    {
+        cmp(reg_work_, 0);
+        je(label_work_end, T_NEAR);
+        for (int i = 0; i < n_vecs_; i++) {
+            const Vmm vmm_src(vmm_tmp1_.getIdx() + i % n_tmp_vmms);
+            io_load_.load(ptr[reg_src_ + i * simd_w_ * conf_.src_dt_size],
+                    vmm_src, is_store_tail(i));
+            apply_preop(vmm_src);
+            compute_op_(vmm_vertical_acc(i), vmm_src);
+        }
+
+        add(reg_src_, reg_src_stride_);
+
+        dec(reg_work_);
+        jmp(label_work_begin, T_NEAR);
+    }
+    L(label_work_end);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::finalize_vertical() {
+    Label label_end;
+
+    if (conf_.with_partial_acc) {
+        Label label_store_dst;
+        mov(reg_tmp1_, ptr[reg_param_ + GET_OFF(store_dst)]);
+        test(reg_tmp1_, reg_tmp1_);
+        jnz(label_store_dst, T_NEAR);
+        for (int i = 0; i < n_vecs_; i++)
+            io_acc_.store(vmm_vertical_acc(i), ptr[reg_acc_ + i * vlen_],
+                    is_store_tail(i));
+        jmp(label_end, T_NEAR);
+        L(label_store_dst);
+    }
+
+    apply_alg_finalization(vmm_vertical_acc_start_idx_, n_vecs_);
+
+    if (conf_.with_postops)
+        apply_postops(vmm_vertical_acc_start_idx_, n_vecs_);
+
+    for (int i = 0; i < n_vecs_; i++)
+        io_store_.store(vmm_vertical_acc(i),
+                ptr[reg_dst_ + i * simd_w_ * conf_.dst_dt_size],
+                is_store_tail(i));
+    L(label_end);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::generate_vertical() {
+    // Source, partial results and destination share the same tail.
+    if (load_tail_size_ > 0) {
+        io_load_.prepare_tail_mask();
+        io_store_.prepare_tail_mask();
+    }
+
+    load_params();
+    init_vertical_acc();
+    reduce_vertical();
+    finalize_vertical();
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
+    using namespace alg_kind;
+    preamble();
+
+    io_store_.init_bf16();
+    if (conf_.is_saturation_needed) io_store_.init_saturate_f32();
+
+    const bool is_norm = utils::one_of(conf_.alg, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+    if (is_norm && !conf_.is_combine && conf_.p == 1.f) {
+        const Xmm xmm_abs_mask(vmm_abs_mask_.getIdx());
+        mov(reg_tmp_.cvt32(), 0x7fffffff);
+        uni_vmovd(xmm_abs_mask, reg_tmp_.cvt32());
+        uni_vbroadcastss(vmm_abs_mask_, xmm_abs_mask);
+    }
+
+    if (conf_.is_vertical)
+        generate_vertical();
+    else
+        generate_horizontal();
 
     postamble();
 
@@ -85,10 +85,25 @@ private:
     void reduce_base();
     void reduce_ne_convert_xf16();
 
+    void uni_broadcast_f32(const Vmm &vmm, const float val);
+    void apply_preop(const Vmm &vmm);
+    void apply_alg_finalization(const int start_idx, const int n_vecs);
+
     void load_params();
-    void apply_sum(const int data_idx);
-    void apply_postops(const int data_idx);
+    bool is_store_tail(const int vec_idx) const;
+    void apply_sum(const int start_idx, const int n_vecs);
+    void apply_postops(const int start_idx, const int n_vecs);
     void finalize();
+    void generate_horizontal();
+
+    Vmm vmm_vertical_acc(const int vec_idx) const {
+        return Vmm(vmm_vertical_acc_start_idx_ + vec_idx);
+    }
+    void init_vertical_acc();
+    void reduce_vertical();
+    void finalize_vertical();
+    void generate_vertical();
+
     void generate() override;
 
     const Vmm vmm_tail_load_mask_ = Vmm(0);
@@ -102,6 +117,11 @@ private:
     const Vmm vmm_tmp4_ = Vmm(8);
     const Vmm vmm_sum_scale_ = Vmm(9);
     const Vmm rhs_dt_helper_vmm_ = Vmm(10);
+    static constexpr int vmm_vertical_acc_start_idx_ = 11;
+    static constexpr int max_vertical_unroll_
+            = std::is_same<Vmm, Xbyak::Zmm>::value ? 16 : 4;
+    const Vmm vmm_abs_mask_ = Vmm(
+            vmm_vertical_acc_start_idx_ + max_vertical_unroll_);
     const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
     const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
     const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
@@ -116,6 +136,8 @@ private:
     const Xbyak::Reg64 reg_param_ = abi_param1;
     const Xbyak::Reg64 reg_tmp_ = abi_not_param1;
     const Xbyak::Reg64 reg_tmp1_ = r13;
+    const Xbyak::Reg64 reg_acc_ = r8;
+    const Xbyak::Reg64 reg_src_stride_ = r9;
 
     static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
     static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
@@ -125,10 +147,13 @@ private:
     static constexpr std::size_t number_of_f32_in_ymm_ = 8;
     static constexpr std::size_t number_of_f32_in_zmm_ = 16;
     const std::size_t load_tail_size_;
-    static constexpr std::size_t store_tail_size_ = 1;
+    const std::size_t store_tail_size_;
+    // Number of vectors reduced at once by a vertical kernel.
+    const int n_vecs_;
 
     io::jit_io_helper_t<Vmm> io_load_;
     io::jit_io_helper_t<Vmm> io_store_;
+    io::jit_io_helper_t<Vmm> io_acc_;
 
     compute_fn_t compute_op_;
     compute_fn_t compute_scalar_op_;
@@ -2383,6 +2383,57 @@ status_t jit_uni_reorder_t::pd_t::init_scratchpad() {
     return status::success;
 }
 
+// The kernels do not compute the maxima requested with the amax attribute, a
+// vectorized pass over the dense source does. The destination maximum before
+// its scales follows from the source one when the reorder only multiplies the
+// source values by a common scale: the rounded product is monotonic in them.
+static status_t check_amax(const primitive_attr_t *attr,
+        const memory_desc_t &imd, const memory_desc_t &omd) {
+    using namespace data_type;
+    if (attr->amax_.has_default_values()) return status::success;
+
+    const memory_desc_wrapper im_d(imd), om_d(omd);
+    VDISPATCH_REORDER_IC(im_d.is_dense(true), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_REORDER_IC(utils::one_of(im_d.data_type(), f32, bf16, f16,
+                                 f8_e5m2, f8_e4m3, s32, s8, u8),
+            VERBOSE_UNSUPPORTED_ATTR);
+    if (attr->amax_.has(DNNL_ARG_DST)) {
+        const auto &scales = attr->scales_;
+        VDISPATCH_REORDER_IC(scales.has_default_values(DNNL_ARG_SRC)
+                        || scales.get_mask(DNNL_ARG_SRC) == 0,
+                VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_REORDER_IC(attr->zero_points_.has_default_values()
+                        && attr->post_ops_.len() == 0
+                        && om_d.extra().flags == memory_extra_flags::none,
+                VERBOSE_UNSUPPORTED_ATTR);
+    }
+    return status::success;
+}
+
+static void compute_amax(const exec_ctx_t &ctx, const reorder_pd_t *pd,
+        const char *in, const float *src_scales) {
+    amax_accumulator_t src_amax(ctx, pd->attr(), DNNL_ARG_SRC);
+    amax_accumulator_t dst_amax(ctx, pd->attr(), DNNL_ARG_DST);
+    if (!src_amax.enabled() && !dst_amax.enabled()) return;
+
+    const memory_desc_wrapper im_d(pd->src_md());
+    const auto dt = im_d.data_type();
+    const dim_t nelems = im_d.nelems(true);
+    const char *src = in + im_d.offset0() * im_d.data_type_size();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nelems, nthr, ithr, start, end);
+        if (start < end)
+            src_amax.update(
+                    src + start * im_d.data_type_size(), dt, end - start);
+    });
+    if (dst_amax.enabled())
+        dst_amax.update(src_amax.value() * (src_scales ? src_scales[0] : 1.f));
+    src_amax.store();
+    dst_amax.store();
+}
+
 status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
         engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
         const memory_desc_t *src_md, engine_t *dst_engine,
@@ -2393,6 +2444,7 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
     if (prb_init_status != status::success) return prb_init_status;
+    CHECK(check_amax(attr, *src_md, *dst_md));
 
     prb_block_for_cache(prb);
     DEBUG({
@@ -2806,6 +2858,7 @@ status_t jit_uni_reorder_t::execute(const exec_ctx_t &ctx) const {
     DEFINE_ZERO_POINT_VALUE(dst_zp, DNNL_ARG_TO);
 
     omp_driver(in, out, src_scales, dst_scales, src_zp, dst_zp, scratchpad);
+    compute_amax(ctx, pd(), in, src_scales);
 
     return status::success;
 }
@@ -2820,6 +2873,7 @@ status_t jit_blk_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
     if (prb_init_status != status::success) return prb_init_status;
+    CHECK(check_amax(attr, *src_md, *dst_md));
     // only uni_reorder supports tail processing now
     // TODO: Add tail processing support in blk_reorder
     VDISPATCH_REORDER_IC(
@@ -2890,6 +2944,7 @@ status_t jit_blk_reorder_t::execute(const exec_ctx_t &ctx) const {
         auto *o = out + (bh_b + fl_b * o1) * otype_sz_;
         (*kernel_)(i, o, n1 - fl_b < block_sz, src_zp, dst_zp);
     });
+    compute_amax(ctx, pd(), in, nullptr);
 
     return status::success;
 }
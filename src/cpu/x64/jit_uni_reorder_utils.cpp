@@ -211,8 +211,9 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     using smask_t = primitive_attr_t::skip_mask_t;
-    VDISPATCH_REORDER_IC(attr->has_default_values(smask_t::scales
-                                 | smask_t::zero_points | smask_t::post_ops),
+    VDISPATCH_REORDER_IC(
+            attr->has_default_values(smask_t::scales | smask_t::zero_points
+                    | smask_t::post_ops | smask_t::amax),
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_REORDER_IC(check_post_ops(attr), VERBOSE_UNSUPPORTED_POSTOP);
 
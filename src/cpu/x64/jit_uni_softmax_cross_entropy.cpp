@@ -0,0 +1,254 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_uni_softmax_cross_entropy.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace ukernel;
+
+namespace {
+
+row_kernel_conf_t max_conf() {
+    row_kernel_conf_t conf;
+    conf.reduction_alg = alg_kind::reduction_max;
+    return conf;
+}
+
+row_kernel_conf_t sum_conf() {
+    row_kernel_conf_t conf;
+    conf.reduction_alg = alg_kind::reduction_sum;
+    return conf;
+}
+
+row_kernel_conf_t exp_sum_conf() {
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = alg_kind::eltwise_exp;
+    conf.with_shift = true;
+    conf.reduction_alg = alg_kind::reduction_sum;
+    return conf;
+}
+
+// The probabilities are stored as f32, the targets are subtracted before the
+// conversion to the data type of the gradient.
+row_kernel_conf_t prob_conf() {
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = alg_kind::eltwise_exp;
+    conf.with_shift = true;
+    conf.with_store = true;
+    return conf;
+}
+
+// Rows of non-f32 logits and of non-f32 gradients go through f32 buffers.
+dim_t buf_per_thr(const cpu_softmax_cross_entropy_pd_t *pd) {
+    const bool cvt_src = pd->src_md()->data_type != data_type::f32;
+    const bool cvt_diff_src = pd->is_training()
+            && pd->diff_src_md()->data_type != data_type::f32;
+    return (cvt_src + cvt_diff_src) * pd->C();
+}
+
+} // namespace
+
+status_t jit_uni_softmax_cross_entropy_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_SOFTMAX_CROSS_ENTROPY(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    CHECK(init_plain(engine));
+    VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+            utils::one_of(src_md()->data_type, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+            IMPLICATION(is_training(),
+                    utils::one_of(diff_src_md()->data_type, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
+    for (const auto &conf : {max_conf(), sum_conf(), exp_sum_conf()})
+        VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+                row_kernel_supported(conf), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_SOFTMAX_CROSS_ENTROPY(
+            IMPLICATION(is_training(), row_kernel_supported(prob_conf())),
+            VERBOSE_UNSUPPORTED_ISA);
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_uni_softmax_cross_entropy_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    const dim_t buf_size = buf_per_thr(this);
+    if (buf_size == 0) return;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(
+            key_softmax_interim_store, dnnl_get_max_threads() * buf_size);
+}
+
+status_t jit_uni_softmax_cross_entropy_t::init(engine_t *engine) {
+    CHECK(create_row_kernel(max_kernel_, max_conf()));
+    CHECK(create_row_kernel(sum_kernel_, sum_conf()));
+    CHECK(create_row_kernel(exp_sum_kernel_, exp_sum_conf()));
+    if (pd()->is_training())
+        CHECK(create_row_kernel(prob_kernel_, prob_conf()));
+    return status::success;
+}
+
+status_t jit_uni_softmax_cross_entropy_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto labels = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto diff_src = pd()->is_training()
+            ? CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC)
+            : nullptr;
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper labels_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+
+    const dim_t N = pd()->N();
+    const dim_t C = pd()->C();
+    const float eps = pd()->label_smoothing();
+    const float eps_c = eps / C;
+    const dim_t ignore_index = pd()->ignore_index();
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const auto diff_src_dt = diff_src_d.data_type();
+    const size_t src_dt_size = types::data_type_size(src_dt);
+    const size_t diff_src_dt_size = types::data_type_size(diff_src_dt);
+
+    const dim_t buf_size = buf_per_thr(pd());
+    float *buf_base = buf_size > 0
+            ? ctx.get_scratchpad_grantor().template get<float>(
+                    key_softmax_interim_store)
+            : nullptr;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(N, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *src_buf = buf_base + ithr * buf_size;
+        float *diff_src_buf = src_buf + (src_dt == f32 ? 0 : C);
+
+        for (dim_t n = start; n < end; ++n) {
+            const void *x_row = src + src_d.off(n, 0) * src_dt_size;
+            void *dx = diff_src
+                    ? diff_src + diff_src_d.off(n, 0) * diff_src_dt_size
+                    : nullptr;
+            const dim_t label = labels[labels_d.off(n)];
+            const dim_t dst_off = dst_d.off(n);
+
+            if (label == ignore_index) {
+                io::store_float_value(dst_dt, 0.f, dst, dst_off);
+                if (dx) std::memset(dx, 0, C * diff_src_dt_size);
+                continue;
+            }
+            // The loss of a label outside of the classes is undefined.
+            if (label < 0 || label >= C) {
+                const float nan = std::numeric_limits<float>::quiet_NaN();
+                io::store_float_value(dst_dt, nan, dst, dst_off);
+                for (dim_t c = 0; dx && c < C; ++c)
+                    io::store_float_value(diff_src_dt, nan, dx, c);
+                continue;
+            }
+
+            const float *x = static_cast<const float *>(x_row);
+            if (src_dt == bf16) {
+                cvt_bfloat16_to_float(
+                        src_buf, static_cast<const bfloat16_t *>(x_row), C);
+                x = src_buf;
+            } else if (src_dt == f16) {
+                cvt_float16_to_float(
+                        src_buf, static_cast<const float16_t *>(x_row), C);
+                x = src_buf;
+            }
+
+            float m = 0.f, sum_x = 0.f, s = 0.f;
+            row_kernel_args_t args;
+            args.src = x;
+            args.dst = nullptr;
+            args.shift = &m;
+            args.work_amount = C;
+            args.reduce = &m;
+            (*max_kernel_)(&args);
+            // Only the label smoothing needs the sum of the logits.
+            if (eps_c != 0.f) {
+                args.reduce = &sum_x;
+                (*sum_kernel_)(&args);
+            }
+            args.reduce = &s;
+            (*exp_sum_kernel_)(&args);
+
+            // loss = m + log(s) - (1 - eps) * x_label - eps / C * sum(x_c),
+            // see the simple implementation.
+            const float log_s = m + ::logf(s);
+            const float loss = log_s - (1.f - eps) * x[label] - eps_c * sum_x;
+            io::store_float_value(dst_dt, loss, dst, dst_off);
+
+            if (!dx) continue;
+
+            // The gradient p - t with p = exp(x - m - log(s)).
+            float *p = diff_src_dt == f32 ? static_cast<float *>(dx)
+                                          : diff_src_buf;
+            args.dst = p;
+            args.shift = &log_s;
+            args.reduce = nullptr;
+            (*prob_kernel_)(&args);
+            if (eps_c != 0.f) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; ++c)
+                    p[c] -= eps_c;
+            }
+            p[label] -= 1.f - eps;
+
+            if (diff_src_dt == bf16)
+                cvt_float_to_bfloat16(static_cast<bfloat16_t *>(dx), p, C);
+            else if (diff_src_dt == f16)
+                cvt_float_to_float16(static_cast<float16_t *>(dx), p, C);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
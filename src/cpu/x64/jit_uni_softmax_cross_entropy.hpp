@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SOFTMAX_CROSS_ENTROPY_HPP
+#define CPU_X64_JIT_UNI_SOFTMAX_CROSS_ENTROPY_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_softmax_cross_entropy_pd.hpp"
+
+#include "cpu/x64/ukernel/jit_uni_row_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Softmax cross-entropy loss over the rows of a matrix of logits with the
+// passes over a row done by JIT row kernels. The row, converted to f32 if
+// needed, is reduced to its maximum and to the sum of exp(x - max), and to the
+// sum of its logits with label smoothing. The loss follows from these values
+// as in the simple implementation. For training, the probabilities
+// exp(x - max - log(sum)) are stored by another kernel and the targets are
+// subtracted in place.
+struct jit_uni_softmax_cross_entropy_t : public primitive_t {
+    struct pd_t : public cpu_softmax_cross_entropy_pd_t {
+        using cpu_softmax_cross_entropy_pd_t::cpu_softmax_cross_entropy_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:uni", jit_uni_softmax_cross_entropy_t);
+
+        status_t init(engine_t *engine);
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_softmax_cross_entropy_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    std::unique_ptr<ukernel::jit_row_kernel_t> max_kernel_;
+    std::unique_ptr<ukernel::jit_row_kernel_t> sum_kernel_;
+    std::unique_ptr<ukernel::jit_row_kernel_t> exp_sum_kernel_;
+    std::unique_ptr<ukernel::jit_row_kernel_t> prob_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
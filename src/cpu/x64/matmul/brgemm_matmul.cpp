@@ -14,9 +14,18 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+#include <limits>
+
+#include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory.hpp"
 #include "common/memory_tracking.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/profiler.hpp"
+#include "common/resource.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -28,6 +37,7 @@
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_tuning.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -87,6 +97,121 @@ int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail,
     return idx;
 }
 
+// Returns the best time in milliseconds of a few executions of a matmul with
+// a given blocking on zero-filled buffers, or infinity if the matmul can't be
+// created or executed with the blocking.
+template <cpu_isa_t isa>
+double benchmark_blocking(engine_t *engine, const op_desc_t *adesc,
+        const primitive_attr_t *attr,
+        const brgemm_matmul_tuned_blocking_t &blocking) {
+    using pd_t = typename brgemm_matmul_t<isa>::pd_t;
+    const double failed = std::numeric_limits<double>::infinity();
+
+    std::unique_ptr<primitive_desc_t> cand_pd;
+    {
+        tuning::forced_blocking_guard_t guard(blocking);
+        if (pd_t::create_candidate(cand_pd, adesc, attr, engine)
+                != status::success)
+            return failed;
+    }
+    const auto &pd = *utils::downcast<const pd_t *>(cand_pd.get());
+    brgemm_matmul_t<isa> prim(&pd);
+    if (prim.init(engine) != status::success) return failed;
+
+    auto create_storage = [&](std::unique_ptr<memory_storage_t> &storage,
+                                  size_t size) {
+        memory_storage_t *mem_storage = nullptr;
+        if (engine->create_memory_storage(&mem_storage, size)
+                != status::success)
+            return false;
+        storage.reset(mem_storage);
+        void *ptr = nullptr;
+        storage->get_data_handle(&ptr);
+        if (ptr) std::memset(ptr, 0, size);
+        return ptr != nullptr;
+    };
+
+    std::vector<std::unique_ptr<memory_t, memory_deleter_t>> mems;
+    exec_args_t args;
+    auto add_arg = [&](int arg, const memory_desc_t *md, bool is_const) {
+        const size_t size = memory_desc_wrapper(md).size();
+        if (size == 0) return true;
+        std::unique_ptr<memory_storage_t> storage;
+        if (!create_storage(storage, size)) return false;
+        mems.emplace_back(new memory_t(engine, md, std::move(storage)));
+        args[arg] = {mems.back().get(), is_const};
+        return true;
+    };
+    const bool args_ok = add_arg(DNNL_ARG_SRC, pd.src_md(), true)
+            && add_arg(DNNL_ARG_WEIGHTS, pd.weights_md(0), true)
+            && add_arg(DNNL_ARG_BIAS, pd.weights_md(1), true)
+            && add_arg(DNNL_ARG_DST, pd.dst_md(), false);
+    if (!args_ok) return failed;
+
+    std::unique_ptr<memory_storage_t> scratchpad;
+    const size_t scratchpad_size = pd.scratchpad_registry().size();
+    if (scratchpad_size && !create_storage(scratchpad, scratchpad_size))
+        return failed;
+
+    exec_ctx_t ctx(nullptr, std::move(args));
+    auto scratchpad_grantor
+            = pd.scratchpad_registry().grantor(scratchpad.get(), ctx);
+    ctx.set_scratchpad_grantor(&scratchpad_grantor);
+    resource_mapper_t resource_mapper;
+    ctx.set_resource_mapper(&resource_mapper);
+
+    // The first execution warms up the caches and isn't timed. The number of
+    // timed executions is bounded by a time budget for the large problems.
+    if (prim.execute(ctx) != status::success) return failed;
+    const int max_runs = 10;
+    const double budget_ms = 100.;
+    double best_ms = failed, total_ms = 0.;
+    for (int run = 0; run < max_runs && total_ms < budget_ms; run++) {
+        const double start_ms = get_msec();
+        if (prim.execute(ctx) != status::success) return failed;
+        const double duration_ms = get_msec() - start_ms;
+        best_ms = nstl::min(best_ms, duration_ms);
+        total_ms += duration_ms;
+    }
+    return best_ms;
+}
+
+// Benchmarks the candidate blockings of a problem missing in the tuning
+// database and stores the fastest one there, to be picked up by the
+// initialization of the configuration.
+template <cpu_isa_t isa>
+void maybe_tune_blocking(engine_t *engine, const op_desc_t *adesc,
+        const primitive_attr_t *attr) {
+    using pd_t = typename brgemm_matmul_t<isa>::pd_t;
+    // The candidates are created with a forced blocking and don't recurse.
+    if (!tuning::is_enabled() || tuning::get_forced_blocking()) return;
+
+    const auto &mmd = *op_desc_t::to_desc<matmul_desc_t>(adesc);
+    if (!tuning::is_tunable(mmd, *attr)) return;
+    const std::string key = tuning::get_key(isa, mmd, *attr);
+    brgemm_matmul_tuned_blocking_t blocking;
+    if (tuning::find_blocking(key, blocking)) return;
+
+    // The blocking of the heuristics is the starting point of the search.
+    std::unique_ptr<primitive_desc_t> heuristic_pd;
+    {
+        const brgemm_matmul_tuned_blocking_t heuristic_blocking;
+        tuning::forced_blocking_guard_t guard(heuristic_blocking);
+        if (pd_t::create_candidate(heuristic_pd, adesc, attr, engine)
+                != status::success)
+            return;
+    }
+    const auto &bgmmc = utils::downcast<const pd_t *>(heuristic_pd.get())
+                                ->get_brgemm_matmul_conf();
+    if (bgmmc.is_macro_heuristics) return;
+
+    blocking = tuning::search_blocking(
+            bgmmc, [&](const brgemm_matmul_tuned_blocking_t &cand) {
+                return benchmark_blocking<isa>(engine, adesc, attr, cand);
+            });
+    tuning::store_blocking(key, blocking);
+}
+
 } // anonymous namespace
 
 template <cpu_isa_t isa>
@@ -98,6 +223,17 @@ int brgemm_matmul_t<isa>::pd_t::get_brg_kernel_idx(bool is_bs_tail,
             m_ker_idx, n_ker_idx, is_K_tail, bs);
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::create_candidate(
+        std::unique_ptr<primitive_desc_t> &pd, const op_desc_t *adesc,
+        const primitive_attr_t *attr, engine_t *engine) {
+    primitive_desc_t *candidate = nullptr;
+    CHECK(primitive_desc_t::create<pd_t>(
+            &candidate, adesc, attr, engine, nullptr));
+    pd.reset(candidate);
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::pd_t::maybe_set_LDB2() {
     if (bgmmc_.LDB < bgmmc_.N_blk
@@ -237,7 +373,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::src_norm
+                            | primitive_attr_t::skip_mask_t::amax,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
     const auto &po = attr()->post_ops_;
@@ -256,6 +394,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_reduce(), VERBOSE_UNSUPPORTED_FEATURE,
             "reduce is not supported");
 
+    maybe_tune_blocking<isa>(engine, op_desc(), attr());
+
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
@@ -490,6 +630,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             pd()->N(), wei_scale_per_k, wei_scale_per_n, pd()->attr(),
             jit_scale_precompute_.get(), 1.f, bgmmc.req_transpose_scales);
 
+    if (bgmmc.with_src_norm) compute_src_norm_stats(ctx);
+
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
             wei_zero_point, dst_zero_point, dst_scales, helper);
 
@@ -633,6 +775,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     maybe_reduce_and_convert_partial_results_A(brgmm_ctx);
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
 
+    if (bgmmc.with_src_amax || bgmmc.with_dst_amax) compute_amax(ctx);
+
     return status::success;
 }
 
@@ -723,7 +867,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                    brgmm_ctx.get_dst_amax_ptr(ithr)};
             brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
                     &leading_dimensions);
@@ -778,7 +923,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                    brgmm_ctx.get_dst_amax_ptr(ithr)};
 
             brgemm_kernel_execute_postops(brg_kernel_k_tail, 1, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
@@ -1086,7 +1232,8 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 static_cast<const void *>(zp_comp_b),
                                 static_cast<const void *>(zp_c_val_ptr),
                                 skip_accumulation, 1, false, false,
-                                brgmm_ctx.get_dst_scales_ptr()};
+                                brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                                brgmm_ctx.get_dst_amax_ptr(ithr)};
 
                         brgemm_kernel_execute_postops(brg_kernel, 0, nullptr,
                                 (void *)ptr_C, (void *)ptr_D, post_ops_data,
@@ -1126,6 +1273,12 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     ctx.zp_b_neg_value_ptr = (void *)brgmm_ctx.get_zp_b_neg_val_ptr();
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
     ctx.dynamic_src_ld = brgmm_ctx.get_src_stride();
+    if (bgmmc.with_src_norm) {
+        ctx.src_norm_stats_ptr = brgmm_ctx.get_src_norm_stats_ptr(
+                brgmm_ctx.get_data_A_mk_ptr(A_data_batch_ptr, m, 0));
+        ctx.src_norm_scale_ptr = brgmm_ctx.get_src_norm_scale_ptr();
+        ctx.src_norm_shift_ptr = brgmm_ctx.get_src_norm_shift_ptr();
+    }
 
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
@@ -1150,6 +1303,107 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::compute_amax(const exec_ctx_t &ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+
+    amax_accumulator_t src_amax(ctx, pd()->attr(), DNNL_ARG_SRC);
+    if (src_amax.enabled()) {
+        // The source is dense, it is checked at creation time.
+        const memory_desc_wrapper src_d(pd()->src_md());
+        const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC)
+                + src_d.offset0() * bgmmc.a_dt_sz;
+        const dim_t nelems = src_d.nelems(true);
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(nelems, nthr, ithr, start, end);
+            if (start < end)
+                src_amax.update(src + start * bgmmc.a_dt_sz,
+                        src_d.data_type(), end - start);
+        });
+    }
+    src_amax.store();
+
+    // The kernels merged the destination values into per-thread vectors.
+    amax_accumulator_t dst_amax(ctx, pd()->attr(), DNNL_ARG_DST);
+    if (dst_amax.enabled()) {
+        const float *partial = ctx.get_scratchpad_grantor().template get<float>(
+                key_matmul_dst_amax);
+        dst_amax.update(partial, data_type::f32,
+                static_cast<dim_t>(bgmmc.nthr) * dst_amax_per_thr_sz);
+    }
+    dst_amax.store();
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::compute_src_norm_stats(const exec_ctx_t &ctx) const {
+    const auto &src_norm = pd()->attr()->src_norm_;
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto mean = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_MEAN);
+    const auto var = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_VARIANCE);
+    float *stats = ctx.get_scratchpad_grantor().template get<float>(
+            key_matmul_src_norm_stats);
+
+    // The source is dense and row-major, it is checked at creation time.
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const data_type_t src_dt = src_d.data_type();
+    const dim_t K = pd()->K();
+    const dim_t rows = src_d.nelems() / K;
+
+    // The rows of bf16 and f16 sources are converted to f32 by chunks for the
+    // vectorized reductions.
+    constexpr dim_t cvt_chunk = 256;
+
+    parallel_nd(rows, [&](dim_t r) {
+        float row_mean = 0.f, row_var = 0.f;
+        if (src_norm.use_global_stats()) {
+            row_mean = src_norm.rms_norm() ? 0.f : mean[r];
+            row_var = var[r];
+        } else {
+            const char *row = src + r * K * src_d.data_type_size();
+            float buf[cvt_chunk];
+            const auto get_chunk = [&](dim_t k, dim_t len) -> const float * {
+                switch (src_dt) {
+                    case data_type::bf16:
+                        cvt_bfloat16_to_float(buf,
+                                reinterpret_cast<const bfloat16_t *>(row) + k,
+                                len);
+                        return buf;
+                    case data_type::f16:
+                        cvt_float16_to_float(buf,
+                                reinterpret_cast<const float16_t *>(row) + k,
+                                len);
+                        return buf;
+                    default: return reinterpret_cast<const float *>(row) + k;
+                }
+            };
+
+            if (!src_norm.rms_norm()) {
+                for (dim_t k0 = 0; k0 < K; k0 += cvt_chunk) {
+                    const dim_t len = nstl::min(cvt_chunk, K - k0);
+                    const float *x = get_chunk(k0, len);
+                    PRAGMA_OMP_SIMD(reduction(+ : row_mean))
+                    for (dim_t k = 0; k < len; k++)
+                        row_mean += x[k];
+                }
+                row_mean /= K;
+            }
+            for (dim_t k0 = 0; k0 < K; k0 += cvt_chunk) {
+                const dim_t len = nstl::min(cvt_chunk, K - k0);
+                const float *x = get_chunk(k0, len);
+                PRAGMA_OMP_SIMD(reduction(+ : row_var))
+                for (dim_t k = 0; k < len; k++) {
+                    const float d = x[k] - row_mean;
+                    row_var += d * d;
+                }
+            }
+            row_var /= K;
+        }
+        stats[2 * r] = row_mean;
+        stats[2 * r + 1] = 1.f / sqrtf(row_var + src_norm.epsilon_);
+    });
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *B_data_batch_ptr,
@@ -1299,6 +1553,21 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                         key_brgemm_primitive_buffer_reduce)
                 : nullptr;
 
+        if (bgmmc.with_dst_amax) {
+            dst_amax_ptr_ = scratchpad.template get<float>(key_matmul_dst_amax);
+            utils::array_set(dst_amax_ptr_, 0.f,
+                    static_cast<size_t>(bgmmc.nthr) * dst_amax_per_thr_sz);
+        }
+
+        if (bgmmc.with_src_norm) {
+            src_norm_stats_ptr_ = scratchpad.template get<float>(
+                    key_matmul_src_norm_stats);
+            src_norm_scale_ptr_
+                    = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_SCALE);
+            src_norm_shift_ptr_
+                    = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_SHIFT);
+        }
+
         is_amx_ = is_superset(isa, avx512_core_amx);
         wsp_tile_ptr_ = is_amx_
                 ? ctx.get_scratchpad_grantor().template get<char>(
@@ -1624,6 +1893,15 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return batch_ptr + A_strides_[1] * m + A_strides_[0] * k;
     }
 
+    // Returns the statistics of the source row `A_ptr` belongs to.
+    const float *get_src_norm_stats_ptr(const char *A_ptr) const {
+        const dim_t row = (A_ptr - data_A_ptr_) / (bgmmc_.K * bgmmc_.a_dt_sz);
+        return src_norm_stats_ptr_ + 2 * row;
+    }
+
+    const float *get_src_norm_scale_ptr() const { return src_norm_scale_ptr_; }
+    const float *get_src_norm_shift_ptr() const { return src_norm_shift_ptr_; }
+
     dim_t get_data_B_kn_off(int k, int n) const {
         int dt_b_k_blk = bgmmc_.is_bf32
                 ? data_type_vnni_simd_elems(f32, bgmmc_.isa)
@@ -1914,6 +2192,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const float *get_dst_scales_ptr() const { return dst_scales_ptr_; }
 
+    float *get_dst_amax_ptr(int ithr) const {
+        return dst_amax_ptr_ ? dst_amax_ptr_ + ithr * dst_amax_per_thr_sz
+                             : nullptr;
+    }
+
     const int32_t *get_zp_a_neg_val_ptr() const {
         return &zero_point_a_negative_val_;
     }
@@ -2260,10 +2543,15 @@ private:
     char *buf_D_ptr_;
     char *buf_reduce_ptr_;
 
+    const float *src_norm_stats_ptr_ = nullptr;
+    const float *src_norm_scale_ptr_ = nullptr;
+    const float *src_norm_shift_ptr_ = nullptr;
+
     char *wsp_tile_ptr_;
     const char *bias_ptr_;
     const float *oscales_ptr_;
     const float *dst_scales_ptr_;
+    float *dst_amax_ptr_ = nullptr;
     int32_t *s8s8_compensation_ptr_;
 
     int32_t *zero_point_a_compensations_ptr_;
@@ -69,6 +69,12 @@ struct brgemm_matmul_t : public primitive_t {
 
         void maybe_set_LDB2();
 
+        // Creates a descriptor of this implementation only, bypassing the
+        // dispatching. Used to benchmark the candidates of the tuning.
+        static status_t create_candidate(std::unique_ptr<primitive_desc_t> &pd,
+                const op_desc_t *adesc, const primitive_attr_t *attr,
+                engine_t *engine);
+
     private:
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
@@ -95,6 +101,8 @@ private:
     void copy_a_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *A_data_batch_ptr, int ithr, int m_blk_idx,
             int k_blk_idx) const;
+    void compute_src_norm_stats(const exec_ctx_t &ctx) const;
+    void compute_amax(const exec_ctx_t &ctx) const;
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *B_data_batch_ptr, int ithr, int b_idx, int n_blk_idx,
             int k_blk_idx) const;
@@ -5089,10 +5089,302 @@ status_t create_brgemm_matmul_copy_b(
     return copy_ker->create_kernel();
 }
 
+// Copies a block of plain A to the buffer normalizing every row on the fly:
+// a = (a - mean) * rstd * scale + shift. The result is rounded to the source
+// data type as if the normalized tensor was materialized and then converted
+// to the data type of the brgemm kernel. The rest of the buffer row up to LDA
+// is zeroed to keep the K padding required by the kernel.
+template <typename Vmm>
+struct jit_brgemm_matmul_copy_a_src_norm_t : public jit_brgemm_matmul_copy_a_t,
+                                             public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_src_norm_t)
+
+    jit_brgemm_matmul_copy_a_src_norm_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator_t(jit_name())
+        , src_dt_(conf_->orig_src_dt)
+        , tr_src_dt_(conf_->src_dt)
+        , typesize_(conf_->a_dt_sz)
+        , tr_typesize_(conf_->tr_a_dt_sz)
+        , src_stride_(conf_->K * typesize_)
+        , tr_src_stride_(conf_->LDA * tr_typesize_) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+    // The register holding a half of a vector of f32 values in 16 bits.
+    using Vmm_half = typename std::conditional<std::is_same<Vmm, Zmm>::value,
+            Ymm, Xmm>::type;
+
+    static constexpr int vlen_ = vreg_traits_t<Vmm>::vlen;
+    static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
+    static constexpr int simd_w_ = vlen_ / sizeof(float);
+
+    const data_type_t src_dt_;
+    const data_type_t tr_src_dt_;
+    const int typesize_;
+    const int tr_typesize_;
+    const dim_t src_stride_;
+    const dim_t tr_src_stride_;
+
+    opmask_t kTail = k7;
+    opmask_t kPad = k6;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_tmp = abi_not_param1;
+    reg64_t reg_k = rdx;
+    reg64_t reg_K_blk = rsi;
+
+    reg64_t reg_M_blk = r8;
+    reg64_t reg_stats = r9;
+    reg64_t reg_scale = r10;
+    reg64_t reg_shift = r11;
+    reg64_t reg_aux_src = r12;
+    reg64_t reg_aux_tr_src = r13;
+    reg64_t reg_aux_scale = r14;
+    reg64_t reg_aux_shift = r15;
+
+    const Vmm vmm_mean = Vmm(0);
+    const Vmm vmm_rstd = Vmm(1);
+    const Vmm vmm_zero = Vmm(2);
+    const Vmm vmm_data = Vmm(3);
+    const Vmm vmm_aux = Vmm(4);
+
+    // Loads `tail` (or a full vector if 0) values of `dt` as f32.
+    void load(const Vmm &vmm, const Address &addr, data_type_t dt, int tail);
+    // Stores `tail` (or a full vector if 0) f32 values as `dt`.
+    void store(const Address &addr, const Vmm &vmm, data_type_t dt, int tail);
+    void normalize(int tail);
+    void zero_pad(dim_t offset, dim_t bytes);
+    void copy_M_loop(int K_blk);
+    void generate() override;
+};
+
+template <typename Vmm>
+void jit_brgemm_matmul_copy_a_src_norm_t<Vmm>::load(
+        const Vmm &vmm, const Address &addr, data_type_t dt, int tail) {
+    const Vmm_half vmm_half(vmm.getIdx());
+    // Without masks the tail is loaded into the lower part of the register
+    // and extended in place.
+    const bool load_bytes_tail = tail && is_ymm_;
+    if (load_bytes_tail) {
+        const int dt_sz = types::data_type_size(dt);
+        if (dt == data_type::f32)
+            load_bytes(Ymm(vmm.getIdx()), addr, tail * dt_sz);
+        else
+            load_bytes(Xmm(vmm.getIdx()), addr, tail * dt_sz);
+    }
+
+    switch (dt) {
+        case data_type::f32:
+            if (load_bytes_tail) break;
+            if (tail)
+                vmovups(vmm | kTail | T_z, addr);
+            else
+                vmovups(vmm, addr);
+            break;
+        case data_type::bf16:
+            if (load_bytes_tail)
+                vpmovzxwd(vmm, vmm_half);
+            else if (tail)
+                vpmovzxwd(vmm | kTail | T_z, addr);
+            else
+                vpmovzxwd(vmm, addr);
+            uni_vpslld(vmm, vmm, 16);
+            break;
+        case data_type::f16:
+            if (load_bytes_tail)
+                vcvtph2ps(vmm, vmm_half);
+            else if (tail)
+                vcvtph2ps(vmm | kTail | T_z, addr);
+            else
+                vcvtph2ps(vmm, addr);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <typename Vmm>
+void jit_brgemm_matmul_copy_a_src_norm_t<Vmm>::store(
+        const Address &addr, const Vmm &vmm, data_type_t dt, int tail) {
+    const Vmm_half vmm_half(vmm.getIdx());
+    if (dt == data_type::f32) {
+        if (!tail)
+            vmovups(addr, vmm);
+        else if (!is_ymm_)
+            vmovups(addr, vmm | kTail);
+        else
+            store_bytes(Ymm(vmm.getIdx()), addr, tail * sizeof(float));
+        return;
+    }
+
+    if (dt == data_type::bf16)
+        vcvtneps2bf16(vmm_half, vmm, get_encoding());
+    else
+        vcvtps2ph(vmm_half, vmm, _op_mxcsr);
+
+    if (!tail)
+        vmovdqu(addr, vmm_half);
+    else if (!is_ymm_)
+        vmovdqu16(addr, vmm_half | kTail);
+    else
+        store_bytes(Xmm(vmm.getIdx()), addr, tail * sizeof(int16_t));
+}
+
+template <typename Vmm>
+void jit_brgemm_matmul_copy_a_src_norm_t<Vmm>::normalize(int tail) {
+    load(vmm_data, ptr[reg_aux_src], src_dt_, tail);
+    uni_vsubps(vmm_data, vmm_data, vmm_mean);
+    uni_vmulps(vmm_data, vmm_data, vmm_rstd);
+    // The scale and the shift are loaded with the tail of the row to not
+    // read past the end of the vectors.
+    if (conf_->with_src_norm_scale) {
+        load(vmm_aux, ptr[reg_aux_scale], data_type::f32, tail);
+        uni_vmulps(vmm_data, vmm_data, vmm_aux);
+    }
+    if (conf_->with_src_norm_shift) {
+        load(vmm_aux, ptr[reg_aux_shift], data_type::f32, tail);
+        uni_vaddps(vmm_data, vmm_data, vmm_aux);
+    }
+
+    // Round to the source data type if the kernel one is wider.
+    if (src_dt_ != tr_src_dt_ && src_dt_ != data_type::f32) {
+        const Vmm_half vmm_half(vmm_aux.getIdx());
+        if (src_dt_ == data_type::bf16) {
+            vcvtneps2bf16(vmm_half, vmm_data, get_encoding());
+            vpmovzxwd(vmm_data, vmm_half);
+            uni_vpslld(vmm_data, vmm_data, 16);
+        } else {
+            vcvtps2ph(vmm_half, vmm_data, _op_mxcsr);
+            vcvtph2ps(vmm_data, vmm_half);
+        }
+    }
+
+    store(ptr[reg_aux_tr_src], vmm_data, tr_src_dt_, tail);
+}
+
+template <typename Vmm>
+void jit_brgemm_matmul_copy_a_src_norm_t<Vmm>::zero_pad(
+        dim_t offset, dim_t bytes) {
+    for (; bytes >= vlen_; bytes -= vlen_, offset += vlen_)
+        vmovups(ptr[reg_tr_src + offset], vmm_zero);
+    if (bytes == 0) return;
+
+    if (is_ymm_) {
+        store_bytes(Ymm(vmm_zero.getIdx()), reg_tr_src, offset, bytes);
+    } else {
+        mov(reg_tmp, size_t((1ULL << bytes) - 1));
+        kmovq(kPad, reg_tmp);
+        vmovdqu8(ptr[reg_tr_src + offset], vmm_zero | kPad);
+    }
+}
+
+template <typename Vmm>
+void jit_brgemm_matmul_copy_a_src_norm_t<Vmm>::copy_M_loop(int K_blk) {
+    const int n_vecs = K_blk / simd_w_;
+    const int tail = K_blk % simd_w_;
+    if (tail && !is_ymm_) {
+        mov(reg_tmp.cvt32(), (1 << tail) - 1);
+        kmovw(kTail, reg_tmp.cvt32());
+    }
+
+    Label loop_M;
+    L(loop_M);
+    {
+        uni_vbroadcastss(vmm_mean, ptr[reg_stats]);
+        uni_vbroadcastss(vmm_rstd, ptr[reg_stats + sizeof(float)]);
+
+        mov(reg_aux_src, reg_src);
+        mov(reg_aux_tr_src, reg_tr_src);
+        if (conf_->with_src_norm_scale) mov(reg_aux_scale, reg_scale);
+        if (conf_->with_src_norm_shift) mov(reg_aux_shift, reg_shift);
+
+        if (n_vecs > 0) {
+            Label loop_K;
+            mov(reg_k, n_vecs);
+            L(loop_K);
+            {
+                normalize(0);
+                add(reg_aux_src, simd_w_ * typesize_);
+                add(reg_aux_tr_src, simd_w_ * tr_typesize_);
+                if (conf_->with_src_norm_scale)
+                    add(reg_aux_scale, simd_w_ * sizeof(float));
+                if (conf_->with_src_norm_shift)
+                    add(reg_aux_shift, simd_w_ * sizeof(float));
+                dec(reg_k);
+                jnz(loop_K, T_NEAR);
+            }
+        }
+        if (tail) normalize(tail);
+
+        zero_pad(K_blk * tr_typesize_, (conf_->LDA - K_blk) * tr_typesize_);
+
+        add(reg_src, src_stride_);
+        add(reg_tr_src, tr_src_stride_);
+        add(reg_stats, 2 * sizeof(float));
+        dec(reg_M_blk);
+        jnz(loop_M, T_NEAR);
+    }
+}
+
+template <typename Vmm>
+void jit_brgemm_matmul_copy_a_src_norm_t<Vmm>::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_stats, ptr[param1 + GET_OFF(src_norm_stats_ptr)]);
+
+    // The scale and the shift are indexed from the first K of the block.
+    mov(reg_tmp, ptr[param1 + GET_OFF(current_K_start)]);
+    if (conf_->with_src_norm_scale) {
+        mov(reg_scale, ptr[param1 + GET_OFF(src_norm_scale_ptr)]);
+        lea(reg_scale, ptr[reg_scale + reg_tmp * sizeof(float)]);
+    }
+    if (conf_->with_src_norm_shift) {
+        mov(reg_shift, ptr[param1 + GET_OFF(src_norm_shift_ptr)]);
+        lea(reg_shift, ptr[reg_shift + reg_tmp * sizeof(float)]);
+    }
+
+    uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+    // A block is either a full one or the K tail.
+    const int K_blk = static_cast<int>(nstl::min(conf_->K_blk, conf_->K));
+    const int K_tail = static_cast<int>(conf_->K % conf_->K_blk);
+    Label done;
+    if (K_tail > 0 && K_tail != K_blk) {
+        Label not_K_tail;
+        cmp(reg_K_blk, K_tail);
+        jne(not_K_tail, T_NEAR);
+        copy_M_loop(K_tail);
+        jmp(done, T_NEAR);
+        L(not_K_tail);
+    }
+    copy_M_loop(K_blk);
+    L(done);
+
+    postamble();
+}
+
 status_t create_brgemm_matmul_copy_a(
         std::unique_ptr<jit_brgemm_matmul_copy_a_t> &copy_ker,
         const brgemm_matmul_conf_t *conf) {
-    if (conf->transposed_A) {
+    if (conf->with_src_norm) {
+        if (is_superset(conf->isa, avx512_core))
+            CHECK(safe_ptr_assign(copy_ker,
+                    new jit_brgemm_matmul_copy_a_src_norm_t<Zmm>(conf)));
+        else
+            CHECK(safe_ptr_assign(copy_ker,
+                    new jit_brgemm_matmul_copy_a_src_norm_t<Ymm>(conf)));
+    } else if (conf->transposed_A) {
         if (utils::one_of(conf->src_dt, data_type::s8, data_type::u8))
             CHECK(safe_ptr_assign(copy_ker,
                     new jit_brgemm_matmul_copy_a_transposed_int8_impl_t(conf)));
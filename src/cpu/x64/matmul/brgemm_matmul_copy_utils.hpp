@@ -60,6 +60,12 @@ struct jit_brgemm_matmul_copy_a_t {
         const void *zp_a_compensation_result_ptr;
         const void *zp_b_neg_value_ptr;
         const void *zp_ab_comp_ptr;
+        // Source normalization: mean and inverse standard deviation of the
+        // first row of the block followed by the ones of the next rows, and
+        // per-K scale and shift (may be null).
+        const float *src_norm_stats_ptr;
+        const float *src_norm_scale_ptr;
+        const float *src_norm_shift_ptr;
 
         dim_t current_K_start;
         dim_t current_K_blk;
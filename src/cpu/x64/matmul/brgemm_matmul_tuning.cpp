@@ -0,0 +1,298 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_attr.hpp"
+
+#include "cpu/x64/matmul/brgemm_matmul_tuning.hpp"
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+brgemm_matmul_tuned_blocking_t brgemm_matmul_tuned_blocking_t::from_conf(
+        const brgemm_matmul_conf_t &bgmmc) {
+    brgemm_matmul_tuned_blocking_t blocking;
+    blocking.M_blk = bgmmc.M_blk;
+    blocking.M_chunk_size = bgmmc.M_chunk_size;
+    blocking.N_chunk_size = bgmmc.N_chunk_size;
+    blocking.nthr_k = bgmmc.nthr_k;
+    return blocking;
+}
+
+bool brgemm_matmul_tuned_blocking_t::apply(brgemm_matmul_conf_t &bgmmc) const {
+    // The blocking of the macro heuristics is tied to its thread grid, which
+    // the tuning doesn't vary.
+    if (M_blk == 0 || bgmmc.is_macro_heuristics || bgmmc.is_runtime_M)
+        return false;
+    // Fewer threads over K keep the buffers selected by the heuristics
+    // sufficient, more threads may not.
+    const bool ok = M_blk <= bgmmc.M && M_chunk_size > 0 && N_chunk_size > 0
+            && nthr_k > 0 && nthr_k <= nstl::max(bgmmc.nthr_k, 1);
+    if (!ok) return false;
+
+    bgmmc.M_blk = M_blk;
+    bgmmc.M_chunk_size = M_chunk_size;
+    bgmmc.N_chunk_size = N_chunk_size;
+    bgmmc.nthr_k = nthr_k;
+    return true;
+}
+
+namespace tuning {
+
+namespace {
+
+std::string get_db_path() {
+    // The path is case-sensitive, hence no `getenv_string_user()`.
+    char buf[4096];
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        const std::string name = std::string(prefix) + "CPU_MATMUL_TUNING_DB";
+        if (getenv(name.c_str(), buf, sizeof(buf)) > 0) return buf;
+    }
+    return std::string();
+}
+
+struct db_t {
+    std::mutex mutex;
+    std::string path;
+    std::unordered_map<std::string, brgemm_matmul_tuned_blocking_t> entries;
+    // Set once the first entry is added. Lets the lookups of every matmul
+    // creation skip the lock while the database is empty.
+    std::atomic<bool> has_entries {false};
+};
+
+// Each line of the file holds a key followed by the tuned blocking:
+// `<key> <M_blk> <M_chunk_size> <N_chunk_size> <nthr_k>`. The lines which
+// don't parse are ignored, the last entry of a key wins.
+void load(db_t &db) {
+    if (db.path.empty()) return;
+    std::ifstream file(db.path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream ss(line);
+        std::string key;
+        brgemm_matmul_tuned_blocking_t b;
+        if (ss >> key >> b.M_blk >> b.M_chunk_size >> b.N_chunk_size
+                >> b.nthr_k)
+            db.entries[key] = b;
+    }
+    db.has_entries = !db.entries.empty();
+}
+
+db_t &db() {
+    // Never destroyed: primitives may be created from static objects of the
+    // application.
+    static db_t *d = [] {
+        auto *d = new db_t();
+        d->path = get_db_path();
+        load(*d);
+        return d;
+    }();
+    return *d;
+}
+
+bool is_db_empty() {
+    return !db().has_entries.load(std::memory_order_acquire);
+}
+
+void append_md(std::string &key, const char *name, const memory_desc_t &md) {
+    key += std::string(",") + name + ":" + dnnl_dt2str(md.data_type);
+    for (int d = 0; d < md.ndims; d++)
+        key += (d == 0 ? ":" : "x") + std::to_string(md.dims[d]);
+
+    if (md.format_kind != format_kind::blocked) {
+        key += std::string(":") + dnnl_fmt_kind2str(md.format_kind);
+        return;
+    }
+    const auto &blk = md.format_desc.blocking;
+    for (int d = 0; d < md.ndims; d++)
+        key += (d == 0 ? ":" : "s") + std::to_string(blk.strides[d]);
+    for (int i = 0; i < blk.inner_nblks; i++)
+        key += "b" + std::to_string(blk.inner_idxs[i])
+                + std::to_string(blk.inner_blks[i]);
+}
+
+thread_local const brgemm_matmul_tuned_blocking_t *forced_blocking = nullptr;
+
+} // namespace
+
+bool is_enabled() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // The candidates are benchmarked without a stream, hence without the
+    // threadpool of the application.
+    return false;
+#else
+    static const bool enabled = getenv_int_user("CPU_MATMUL_TUNING", 0) != 0;
+    return enabled;
+#endif
+}
+
+bool is_tunable(const matmul_desc_t &mmd, const primitive_attr_t &attr) {
+    for (const auto *md : {&mmd.src_desc, &mmd.weights_desc, &mmd.bias_desc,
+                 &mmd.dst_desc}) {
+        if (md->format_kind == format_kind::sparse) return false;
+        if (memory_desc_wrapper(md).has_runtime_dims_or_strides())
+            return false;
+    }
+    if (mmd.reduce_desc.format_kind != format_kind::undef) return false;
+
+    using smask_t = primitive_attr_t::skip_mask_t;
+    if (!attr.has_default_values(smask_t::post_ops | smask_t::sum_dt
+                | smask_t::fpmath_mode))
+        return false;
+    for (const auto &e : attr.post_ops_.entry_)
+        if (!e.is_eltwise() && !e.is_sum(false)) return false;
+    return true;
+}
+
+std::string get_key(cpu_isa_t isa, const matmul_desc_t &mmd,
+        const primitive_attr_t &attr) {
+    std::string key = JIT_IMPL_NAME_HELPER("", isa, "");
+    key += ",nthr:" + std::to_string(dnnl_get_max_threads());
+    append_md(key, "src", mmd.src_desc);
+    append_md(key, "wei", mmd.weights_desc);
+    append_md(key, "bia", mmd.bias_desc);
+    append_md(key, "dst", mmd.dst_desc);
+    key += std::string(",fpmath:") + dnnl_fpmath_mode2str(attr.fpmath_.mode_);
+    key += ",po:";
+    for (const auto &e : attr.post_ops_.entry_)
+        key += std::string(e.is_eltwise() ? dnnl_alg_kind2str(e.eltwise.alg)
+                                          : dnnl_prim_kind2str(e.kind))
+                + "+";
+    return key;
+}
+
+bool find_blocking(
+        const std::string &key, brgemm_matmul_tuned_blocking_t &blocking) {
+    auto &d = db();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    const auto it = d.entries.find(key);
+    if (it == d.entries.end()) return false;
+    blocking = it->second;
+    return true;
+}
+
+void store_blocking(const std::string &key,
+        const brgemm_matmul_tuned_blocking_t &blocking) {
+    auto &d = db();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    d.entries[key] = blocking;
+    d.has_entries.store(true, std::memory_order_release);
+    if (d.path.empty()) return;
+
+    std::ofstream file(d.path, std::ios::app);
+    file << key << " " << blocking.M_blk << " " << blocking.M_chunk_size << " "
+         << blocking.N_chunk_size << " " << blocking.nthr_k << std::endl;
+}
+
+brgemm_matmul_tuned_blocking_t search_blocking(
+        const brgemm_matmul_conf_t &bgmmc, const benchmark_t &benchmark) {
+    auto best = brgemm_matmul_tuned_blocking_t::from_conf(bgmmc);
+    double best_time = benchmark(best);
+    if (best_time == std::numeric_limits<double>::infinity()) return best;
+
+    // Requires a candidate to be noticeably faster to filter out the noise of
+    // the measurements.
+    const double min_gain = 0.98;
+    auto try_candidate = [&](const brgemm_matmul_tuned_blocking_t &cand) {
+        if (cand == best) return;
+        const double time = benchmark(cand);
+        if (time < best_time * min_gain) {
+            best = cand;
+            best_time = time;
+        }
+    };
+
+    const dim_t M_blk = best.M_blk;
+    for (dim_t m_blk : {M_blk / 4, M_blk / 2, M_blk * 2, M_blk * 4}) {
+        if (m_blk < 1) continue;
+        auto cand = best;
+        cand.M_blk = nstl::min(m_blk, bgmmc.M);
+        try_candidate(cand);
+    }
+
+    const dim_t num_M_blocks = utils::div_up(bgmmc.M, best.M_blk);
+    const dim_t num_N_blocks = utils::div_up(bgmmc.N, bgmmc.N_blk);
+    for (int chunk_size : {1, 2, 4, 8}) {
+        if (chunk_size > num_M_blocks) break;
+        auto cand = best;
+        cand.M_chunk_size = chunk_size;
+        try_candidate(cand);
+    }
+    for (int chunk_size : {1, 2, 4, 8}) {
+        if (chunk_size > num_N_blocks) break;
+        auto cand = best;
+        cand.N_chunk_size = chunk_size;
+        try_candidate(cand);
+    }
+    for (int nthr_k = bgmmc.nthr_k / 2; nthr_k >= 1; nthr_k /= 2) {
+        auto cand = best;
+        cand.nthr_k = nthr_k;
+        try_candidate(cand);
+    }
+    return best;
+}
+
+void apply_blocking(cpu_isa_t isa, const matmul_desc_t &mmd,
+        const primitive_attr_t &attr, brgemm_matmul_conf_t &bgmmc) {
+    if (forced_blocking) {
+        forced_blocking->apply(bgmmc);
+        return;
+    }
+    // An empty database, the common case, costs neither a key nor a lock.
+    if (bgmmc.is_macro_heuristics || bgmmc.is_runtime_M || is_db_empty())
+        return;
+
+    brgemm_matmul_tuned_blocking_t blocking;
+    if (find_blocking(get_key(isa, mmd, attr), blocking))
+        blocking.apply(bgmmc);
+}
+
+const brgemm_matmul_tuned_blocking_t *get_forced_blocking() {
+    return forced_blocking;
+}
+
+forced_blocking_guard_t::forced_blocking_guard_t(
+        const brgemm_matmul_tuned_blocking_t &blocking)
+    : prev_(forced_blocking) {
+    forced_blocking = &blocking;
+}
+
+forced_blocking_guard_t::~forced_blocking_guard_t() {
+    forced_blocking = prev_;
+}
+
+} // namespace tuning
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
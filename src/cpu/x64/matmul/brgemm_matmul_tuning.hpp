@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_TUNING_HPP
+#define CPU_X64_MATMUL_BRGEMM_MATMUL_TUNING_HPP
+
+#include <functional>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// The blocking parameters of the brgemm-based matmul that the empirical
+// tuning varies. The other parameters follow from the heuristics.
+struct brgemm_matmul_tuned_blocking_t {
+    // Zero stands for the blocking chosen by the heuristics.
+    dim_t M_blk = 0;
+    int M_chunk_size = 1;
+    int N_chunk_size = 1;
+    int nthr_k = 1;
+
+    static brgemm_matmul_tuned_blocking_t from_conf(
+            const brgemm_matmul_conf_t &bgmmc);
+
+    // Overrides the blocking of a configuration computed by the heuristics.
+    // Returns false and leaves the configuration intact if the blocking
+    // doesn't apply to it.
+    bool apply(brgemm_matmul_conf_t &bgmmc) const;
+
+    bool operator==(const brgemm_matmul_tuned_blocking_t &rhs) const {
+        return M_blk == rhs.M_blk && M_chunk_size == rhs.M_chunk_size
+                && N_chunk_size == rhs.N_chunk_size && nthr_k == rhs.nthr_k;
+    }
+};
+
+namespace tuning {
+
+// Returns whether the creation of a matmul benchmarks the candidate blockings
+// of the problems missing in the tuning database. Controlled by the
+// ONEDNN_CPU_MATMUL_TUNING environment variable.
+bool is_enabled();
+
+// Returns whether a problem can be benchmarked at creation: the dimensions
+// are known and the execution doesn't take any argument but the source,
+// weights, bias and destination.
+bool is_tunable(const matmul_desc_t &mmd, const primitive_attr_t &attr);
+
+// Returns the key of a problem in the tuning database, built from the shapes,
+// data types and layouts of the problem, the attributes affecting the
+// performance, the ISA and the number of threads.
+std::string get_key(cpu_isa_t isa, const matmul_desc_t &mmd,
+        const primitive_attr_t &attr);
+
+// Looks up a problem in the tuning database, which is loaded from the file
+// set with the ONEDNN_CPU_MATMUL_TUNING_DB environment variable on the first
+// call.
+bool DNNL_API find_blocking(
+        const std::string &key, brgemm_matmul_tuned_blocking_t &blocking);
+
+// Adds a problem to the tuning database and appends it to the file, if any.
+void store_blocking(const std::string &key,
+        const brgemm_matmul_tuned_blocking_t &blocking);
+
+// Returns the execution time of a blocking, infinite if it doesn't apply.
+using benchmark_t
+        = std::function<double(const brgemm_matmul_tuned_blocking_t &)>;
+
+// Searches the fastest blocking around the one of the heuristics, one
+// parameter at a time, keeping the best value of the parameters visited
+// before.
+brgemm_matmul_tuned_blocking_t search_blocking(
+        const brgemm_matmul_conf_t &bgmmc, const benchmark_t &benchmark);
+
+// Applies the blocking forced on the calling thread, if any, or the one
+// stored in the tuning database for the problem to a configuration computed
+// by the heuristics.
+void apply_blocking(cpu_isa_t isa, const matmul_desc_t &mmd,
+        const primitive_attr_t &attr, brgemm_matmul_conf_t &bgmmc);
+
+// Returns the blocking forced on the configurations initialized by the
+// calling thread, or nullptr.
+const brgemm_matmul_tuned_blocking_t *get_forced_blocking();
+
+// Forces a blocking on the configurations initialized by the calling thread
+// during the lifetime of the guard. Used to create the candidates of the
+// tuning.
+struct forced_blocking_guard_t {
+    forced_blocking_guard_t(const brgemm_matmul_tuned_blocking_t &blocking);
+    ~forced_blocking_guard_t();
+
+private:
+    const brgemm_matmul_tuned_blocking_t *prev_;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(forced_blocking_guard_t);
+};
+
+} // namespace tuning
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -23,6 +23,7 @@
 #include "cpu/platform.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/matmul/amx_blocking_heuristics.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_tuning.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
 
@@ -1294,6 +1295,12 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     VCONDCHECK_BG(!(bgmmc.with_dst_scales && dst_scales.get_mask() > 0),
             VERBOSE_UNSUPPORTED_SCALES_CFG);
 
+    bgmmc.with_src_amax = attr.amax_.has(DNNL_ARG_SRC);
+    bgmmc.with_dst_amax = attr.amax_.has(DNNL_ARG_DST);
+    // The kernels merge the maximum with masked integer instructions.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_dst_amax, isa_has_masks(bgmmc.isa)),
+            VERBOSE_UNSUPPORTED_ATTR);
+
     const auto &p = attr.post_ops_;
     bgmmc.with_sum = p.find(primitive_kind::sum) != -1;
     const int eltwise_ind = p.find(primitive_kind::eltwise);
@@ -1488,6 +1495,31 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.use_buffer_a = is_copy_a_required;
 
+    // Source normalization is applied by the copy A routine, which locates
+    // rows by their offset in a dense row-major source.
+    bgmmc.with_src_norm = !attr.src_norm_.has_default_values();
+    if (bgmmc.with_src_norm) {
+        const auto &src_strides = src_d.blocking_desc().strides;
+        VCONDCHECK_BG(!src_d.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.transposed_A && src_d.is_dense()
+                        && src_strides[bgmmc.ndims - 1] == 1
+                        && src_strides[bgmmc.ndims - 2] == bgmmc.K,
+                VERBOSE_UNSUPPORTED_TAG);
+        VCONDCHECK_BG(one_of(bgmmc.orig_src_dt, f32, bf16, f16)
+                        && one_of(bgmmc.src_dt, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        bgmmc.with_src_norm_scale = attr.src_norm_.use_scale();
+        bgmmc.with_src_norm_shift = attr.src_norm_.use_shift();
+        bgmmc.use_buffer_a = true;
+    }
+
+    // The source amax is reduced over the source buffer as a whole.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_amax,
+                          !src_d.has_runtime_dims_or_strides()
+                                  && src_d.is_dense()),
+            VERBOSE_UNSUPPORTED_ATTR);
+
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
     // show worse performance for it in comparison with copy whole A approach
@@ -1530,6 +1562,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // - nthr_K
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL, "");
+    // The blocking found by the empirical tuning, if any, takes precedence.
+    tuning::apply_blocking(isa, mmd, attr, bgmmc);
 
     if (bgmmc.wei_n_blk > bgmmc.N_blk
             && IMPLICATION(
@@ -1905,7 +1939,7 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
             bgmmc.with_eltwise, bgmmc.with_binary, bgmmc.acc_dt != bgmmc.dst_dt,
             bgmmc.s8s8_compensation_required, bgmmc.has_zero_point_a,
             bgmmc.has_zero_point_b, bgmmc.has_zero_point_c,
-            bgmmc.with_dst_scales);
+            bgmmc.with_dst_scales, bgmmc.with_dst_amax);
 
     bgmmc.zp_a_comp_shift_n = bgmmc.wei_n_blk;
     bgmmc.zp_a_comp_elems_per_thr
@@ -1935,6 +1969,17 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_a,
                 bgmmc.nthr * bgmmc.buffer_a_per_thread_sz, default_data_align);
 
+    if (bgmmc.with_src_norm) {
+        // Mean and inverse standard deviation of every source row. A source
+        // never has more rows than the destination.
+        scratchpad.template book<float>(
+                key_matmul_src_norm_stats, 2 * bgmmc.batch * bgmmc.M);
+    }
+
+    if (bgmmc.with_dst_amax)
+        scratchpad.template book<float>(key_matmul_dst_amax,
+                static_cast<size_t>(bgmmc.nthr) * dst_amax_per_thr_sz);
+
     if (bgmmc.use_buffer_b) {
         scratchpad.book(key_brgemm_primitive_buffer_b,
                 bgmmc.nthr * bgmmc.buffer_b_per_thread_sz, default_data_align);
@@ -32,6 +32,8 @@ namespace x64 {
 namespace matmul {
 
 constexpr int max_batch_ndims = DNNL_MAX_NDIMS - 2;
+// Floats in the vector every thread merges the destination amax into.
+constexpr int dst_amax_per_thr_sz = 16;
 
 struct brgemm_matmul_bcast_desc_t {
 
@@ -112,6 +114,14 @@ struct brgemm_matmul_conf_t {
     bool packed_sparse_weights;
     bool req_transpose_scales;
     bool with_wei_decompression;
+    // Source rows are normalized while A is copied to the buffer.
+    bool with_src_norm;
+    bool with_src_norm_scale;
+    bool with_src_norm_shift;
+    // The destination amax is merged by the brgemm store epilogue, the source
+    // one is taken in a separate pass over the dense source.
+    bool with_src_amax;
+    bool with_dst_amax;
     brgemm_broadcast_t src_zp_type;
     brgemm_broadcast_t wei_zp_type;
     brgemm_broadcast_t dst_zp_type;
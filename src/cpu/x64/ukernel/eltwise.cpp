@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/math_utils.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/x64/ukernel/eltwise.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::cpu::ukernel;
+
+#define VCHECK_ELTWISE(cond, status, msg, ...) \
+    VCONDCHECK(ukernel, create, check, eltwise, (cond), status, msg, \
+            ##__VA_ARGS__)
+
+dnnl_ukernel_eltwise::dnnl_ukernel_eltwise(dim_t M, dim_t N, dim_t ld_src,
+        dim_t ld_dst, data_type_t dst_dt, alg_kind_t alg, float alpha,
+        float beta)
+    : M_(M)
+    , N_(N)
+    , ld_src_(ld_src)
+    , ld_dst_(ld_dst)
+    , dst_dt_(dst_dt)
+    , alg_(alg)
+    , alpha_(alpha)
+    , beta_(beta) {}
+
+status_t eltwise_t::generate() {
+    // Re-generation won't take any effect.
+    if (kernel_ != nullptr) return status::success;
+
+    cpu::x64::ukernel::row_kernel_conf_t conf;
+    conf.eltwise_alg = alg_;
+    conf.alpha = alpha_;
+    conf.beta = beta_;
+    conf.with_store = true;
+    conf.dst_dt = dst_dt_;
+    CHECK(cpu::x64::ukernel::create_row_kernel(kernel_, conf));
+
+    // Generate a verbose info string at the point where configuration is done.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        CHECK(create_verbose_info());
+    }
+    return status::success;
+}
+
+status_t eltwise_t::execute(const void *src, void *dst) const {
+    if (kernel_ == nullptr) return status::runtime_error;
+
+    double start_ms = 0;
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        start_ms = get_msec();
+
+    const float *src_ptr = reinterpret_cast<const float *>(src);
+    uint8_t *dst_ptr = reinterpret_cast<uint8_t *>(dst);
+    const size_t dst_row_size = ld_dst_ * types::data_type_size(dst_dt_);
+
+    cpu::x64::ukernel::row_kernel_args_t args {};
+    args.work_amount = N_;
+    for (dim_t m = 0; m < M_; m++) {
+        args.src = src_ptr + m * ld_src_;
+        args.dst = dst_ptr + m * dst_row_size;
+        (*kernel_)(&args);
+    }
+
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double duration_ms = get_msec() - start_ms;
+
+        std::stringstream ss;
+        ss << "cpu,eltwise,,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    }
+    return status::success;
+}
+
+status_t eltwise_t::create_verbose_info() {
+#if defined(DISABLE_VERBOSE)
+    return status::success;
+#endif
+
+    std::stringstream ss;
+
+    memory_desc_t src_md;
+    const dims_t dims = {M_, N_};
+    const dims_t src_strides = {ld_src_, 1};
+    CHECK(memory_desc_init_by_strides(
+            src_md, 2, dims, data_type::f32, src_strides));
+
+    memory_desc_t dst_md;
+    const dims_t dst_strides = {ld_dst_, 1};
+    CHECK(memory_desc_init_by_strides(dst_md, 2, dims, dst_dt_, dst_strides));
+
+    ss << md2fmt_str("src", &src_md, format_kind::undef) << " ";
+    ss << md2fmt_str("dst", &dst_md, format_kind::undef);
+    ss << ",,alg:" << dnnl_alg_kind2str(alg_) << " alpha:" << alpha_
+       << " beta:" << beta_ << "," << md2dim_str(&src_md);
+
+    verbose_info_ = ss.str();
+    return status::success;
+}
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_eltwise_create(eltwise_t **eltwise, dim_t M, dim_t N,
+        dim_t ld_src, dim_t ld_dst, data_type_t dst_dt, alg_kind_t alg,
+        float alpha, float beta) {
+    if (eltwise == nullptr) return status::invalid_arguments;
+    VCHECK_ELTWISE(M > 0 && N > 0, status::invalid_arguments,
+            VERBOSE_BAD_PARAM, "M or N");
+    VCHECK_ELTWISE(ld_src >= N && ld_dst >= N, status::invalid_arguments,
+            VERBOSE_BAD_PARAM, "ld_src or ld_dst");
+    VCHECK_ELTWISE(math::is_eltwise_ok(data_type::f32, alg, alpha, beta),
+            status::invalid_arguments, VERBOSE_BAD_ALGORITHM);
+    VCHECK_ELTWISE(utils::one_of(dst_dt, data_type::f32, data_type::bf16,
+                           data_type::f16),
+            status::unimplemented, VERBOSE_UNSUPPORTED_DT);
+
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = alg;
+    conf.with_store = true;
+    conf.dst_dt = dst_dt;
+    VCHECK_ELTWISE(row_kernel_supported(conf), status::unimplemented,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    *eltwise = new eltwise_t(M, N, ld_src, ld_dst, dst_dt, alg, alpha, beta);
+    return status::success;
+}
+
+status_t dnnl_ukernel_eltwise_generate(eltwise_t *eltwise) {
+    if (eltwise == nullptr) return status::invalid_arguments;
+
+    CHECK(eltwise->generate());
+    return status::success;
+}
+
+status_t dnnl_ukernel_eltwise_execute(
+        const eltwise_t *eltwise, const void *src_ptr, void *dst_ptr) {
+    if (utils::any_null(eltwise, src_ptr, dst_ptr))
+        return status::invalid_arguments;
+
+    CHECK(eltwise->execute(src_ptr, dst_ptr));
+    return status::success;
+}
+
+status_t dnnl_ukernel_eltwise_destroy(eltwise_t *eltwise) {
+    delete eltwise;
+    return status::success;
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
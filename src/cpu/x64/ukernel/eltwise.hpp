@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_ELTWISE_HPP
+#define CPU_X64_UKERNEL_ELTWISE_HPP
+
+#include <memory>
+#include <string>
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#include "cpu/x64/ukernel/jit_uni_row_kernel.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+struct dnnl_ukernel_eltwise : public dnnl::impl::c_compatible {
+    dnnl_ukernel_eltwise(dnnl::impl::dim_t M, dnnl::impl::dim_t N,
+            dnnl::impl::dim_t ld_src, dnnl::impl::dim_t ld_dst,
+            dnnl::impl::data_type_t dst_dt, dnnl::impl::alg_kind_t alg,
+            float alpha, float beta);
+
+    // Generates an eltwise kernel.
+    dnnl::impl::status_t generate();
+
+    // Executes an eltwise kernel.
+    dnnl::impl::status_t execute(const void *src, void *dst) const;
+
+private:
+    // User's inputs.
+    dnnl::impl::dim_t M_, N_;
+    dnnl::impl::dim_t ld_src_, ld_dst_;
+    dnnl::impl::data_type_t dst_dt_;
+    dnnl::impl::alg_kind_t alg_;
+    float alpha_, beta_;
+
+    // A kernel processing a single row.
+    std::unique_ptr<dnnl::impl::cpu::x64::ukernel::jit_row_kernel_t> kernel_;
+
+    // Creates a `verbose_info_` string once during `generate()` call, and calls
+    // it during execute(). This is done to avoid string re-creation.
+    dnnl::impl::status_t create_verbose_info();
+    std::string verbose_info_;
+};
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_eltwise_create(dnnl_ukernel_eltwise **eltwise, dim_t M,
+        dim_t N, dim_t ld_src, dim_t ld_dst, data_type_t dst_dt,
+        alg_kind_t alg, float alpha, float beta);
+
+status_t dnnl_ukernel_eltwise_generate(dnnl_ukernel_eltwise *eltwise);
+
+status_t dnnl_ukernel_eltwise_execute(const dnnl_ukernel_eltwise *eltwise,
+        const void *src_ptr, void *dst_ptr);
+
+status_t dnnl_ukernel_eltwise_destroy(dnnl_ukernel_eltwise *eltwise);
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
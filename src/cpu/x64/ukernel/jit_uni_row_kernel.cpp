@@ -0,0 +1,299 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/ukernel/jit_uni_row_kernel.hpp"
+
+#define GET_OFF(field) offsetof(row_kernel_args_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+using namespace Xbyak;
+
+namespace {
+
+cpu_isa_t get_max_isa() {
+    if (mayiuse(avx512_core)) return avx512_core;
+    if (mayiuse(avx2)) return avx2;
+    return isa_undef;
+}
+
+template <cpu_isa_t isa>
+struct jit_uni_row_kernel_t : public jit_row_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_row_kernel)
+
+    jit_uni_row_kernel_t(const row_kernel_conf_t &conf)
+        : jit_row_kernel_t(jit_name(), isa, conf) {
+        if (conf_.eltwise_alg != alg_kind::undef) {
+            // The kernel doesn't keep any state in the first registers, the
+            // injector is free to use them without saving.
+            eltwise_injector_.reset(new jit_uni_eltwise_injector_t<isa>(this,
+                    conf_.eltwise_alg, conf_.alpha, conf_.beta, 1.f,
+                    data_type::f32, /* save_state = */ false, reg_table,
+                    Opmask(1)));
+        }
+
+        io::io_conf_t io_conf;
+        // The tail mask is set at run time, the tail size only bounds it.
+        io::io_tail_conf_t io_tail_conf(simd_w_, simd_w_ - 1,
+                tail_opmask_idx_, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(emu_zmm_1_idx_, emu_zmm_2_idx_,
+                emu_zmm_3_idx_, reg_tmp, emu_zmm_4_idx_);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, get_io_isa(),
+                {data_type::f32, conf_.dst_dt}, io_conf, io_tail_conf,
+                io_bf16_conf);
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+
+    static constexpr int vlen_ = cpu_isa_traits_t<isa>::vlen;
+    static constexpr int simd_w_ = vlen_ / sizeof(float);
+
+    bool is_bf16() const { return conf_.dst_dt == data_type::bf16; }
+    bool is_f16() const { return conf_.dst_dt == data_type::f16; }
+    bool with_reduction() const {
+        return conf_.reduction_alg != alg_kind::undef;
+    }
+    bool is_max() const {
+        return conf_.reduction_alg == alg_kind::reduction_max;
+    }
+
+    cpu_isa_t get_io_isa() const {
+        if (is_bf16() && mayiuse(avx512_core_bf16)) return avx512_core_bf16;
+        if (is_f16()) return avx512_core_fp16;
+        return isa;
+    }
+
+    // Keeps away from r15 which the injector takes as an auxiliary register.
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_work_amount = r10;
+    const Reg64 reg_table = r11;
+    const Reg64 reg_tmp = r12;
+    const Reg64 reg_mask_table = r13;
+
+    const Vmm vmm_src = Vmm(1);
+    const Vmm vmm_shift = Vmm(10);
+    const Vmm vmm_acc = Vmm(11);
+    const Vmm vmm_tmp = Vmm(12);
+    const Vmm vmm_neutral = Vmm(13);
+    const Vmm vmm_tail_mask = Vmm(14);
+
+    const int emu_zmm_1_idx_ = 25;
+    const int emu_zmm_2_idx_ = 26;
+    const int emu_zmm_3_idx_ = 27;
+    const int emu_zmm_4_idx_ = 28;
+    const int tail_opmask_idx_ = 6;
+
+    Label tail_mask_table_;
+
+    std::unique_ptr<jit_uni_eltwise_injector_t<isa>> eltwise_injector_;
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    template <typename T>
+    void reduce(const T &acc, const T &src) {
+        if (is_max())
+            uni_vmaxps(acc, acc, src);
+        else
+            uni_vaddps(acc, acc, src);
+    }
+
+    // Sets the mask of the first `reg_work_amount` lanes, with
+    // `0 < reg_work_amount < simd_w_`, from a table of `simd_w_` set lanes
+    // followed by `simd_w_` clear lanes.
+    void prepare_tail_mask() {
+        mov(reg_mask_table, tail_mask_table_);
+        mov(reg_tmp, reg_work_amount);
+        neg(reg_tmp);
+        uni_vmovups(vmm_tail_mask,
+                ptr[reg_mask_table + reg_tmp * sizeof(float) + vlen_]);
+        if (is_superset(isa, avx512_core))
+            vpmovd2m(Opmask(tail_opmask_idx_), Zmm(vmm_tail_mask.getIdx()));
+    }
+
+    void compute(bool tail) {
+        io_[data_type::f32]->load(ptr[reg_src], vmm_src, tail);
+        if (conf_.with_shift) uni_vsubps(vmm_src, vmm_src, vmm_shift);
+        if (eltwise_injector_)
+            eltwise_injector_->compute_vector(vmm_src.getIdx());
+        // The reduction goes first since the store may convert the values
+        // in place.
+        // The lanes past the tail don't hold values of the row, they are
+        // left out of the reduction.
+        if (with_reduction()) {
+            if (!tail)
+                reduce(vmm_acc, vmm_src);
+            else if (is_superset(isa, avx512_core)) {
+                const auto vmm_acc_masked = vmm_acc | Opmask(tail_opmask_idx_);
+                if (is_max())
+                    vmaxps(vmm_acc_masked, vmm_acc, vmm_src);
+                else
+                    vaddps(vmm_acc_masked, vmm_acc, vmm_src);
+            } else {
+                vblendvps(vmm_src, vmm_neutral, vmm_src, vmm_tail_mask);
+                reduce(vmm_acc, vmm_src);
+            }
+        }
+        if (conf_.with_store)
+            io_[conf_.dst_dt]->store(vmm_src, ptr[reg_dst], tail);
+    }
+
+    void compute_loop() {
+        const int dst_dt_size = types::data_type_size(conf_.dst_dt);
+        Label vectorized_loop_start, tail_start, loop_end;
+
+        cmp(reg_work_amount, simd_w_);
+        jl(tail_start, T_NEAR);
+
+        L(vectorized_loop_start);
+        {
+            compute(false);
+            add(reg_src, vlen_);
+            if (conf_.with_store) add(reg_dst, simd_w_ * dst_dt_size);
+
+            sub(reg_work_amount, simd_w_);
+            cmp(reg_work_amount, simd_w_);
+            jge(vectorized_loop_start, T_NEAR);
+        }
+
+        // The remaining `N % simd_w_` values go in a single masked iteration.
+        L(tail_start);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end, T_NEAR);
+
+            prepare_tail_mask();
+            compute(true);
+        }
+        L(loop_end);
+    }
+
+    // Reduces the lanes of the vector accumulator to its lowest lane.
+    void horizontal_reduce() {
+        const Xmm xmm_acc(vmm_acc.getIdx());
+        const Xmm xmm_tmp(vmm_tmp.getIdx());
+        if (is_superset(isa, avx512_core)) {
+            const Ymm ymm_acc(vmm_acc.getIdx());
+            const Ymm ymm_tmp(vmm_tmp.getIdx());
+            vextractf64x4(ymm_tmp, Zmm(vmm_acc.getIdx()), 1);
+            reduce(ymm_acc, ymm_tmp);
+        }
+        vextractf128(xmm_tmp, Ymm(vmm_acc.getIdx()), 1);
+        reduce(xmm_acc, xmm_tmp);
+        uni_vshufps(xmm_tmp, xmm_acc, xmm_acc, 0x4E);
+        reduce(xmm_acc, xmm_tmp);
+        uni_vshufps(xmm_tmp, xmm_acc, xmm_acc, 0xB1);
+        reduce(xmm_acc, xmm_tmp);
+    }
+
+    void generate() override {
+        preamble();
+
+        if (is_bf16()) io_.init_bf16();
+
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        if (conf_.with_store) mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_param + GET_OFF(work_amount)]);
+        if (conf_.with_shift) {
+            mov(reg_tmp, ptr[reg_param + GET_OFF(shift)]);
+            uni_vbroadcastss(vmm_shift, ptr[reg_tmp]);
+        }
+        if (with_reduction()) {
+            const float init = is_max()
+                    ? -std::numeric_limits<float>::infinity()
+                    : 0.f;
+            init_vmm(vmm_acc, reg_tmp, init);
+            if (!is_superset(isa, avx512_core))
+                init_vmm(vmm_neutral, reg_tmp, init);
+        }
+        if (eltwise_injector_) eltwise_injector_->load_table_addr();
+
+        compute_loop();
+
+        if (with_reduction()) {
+            horizontal_reduce();
+            mov(reg_tmp, ptr[reg_param + GET_OFF(reduce)]);
+            uni_vmovss(ptr[reg_tmp], Xmm(vmm_acc.getIdx()));
+        }
+
+        postamble();
+
+        align(vlen_);
+        L(tail_mask_table_);
+        for (int i = 0; i < 2 * simd_w_; i++)
+            dd(i < simd_w_ ? 0xFFFFFFFF : 0);
+
+        if (eltwise_injector_) eltwise_injector_->prepare_table();
+    }
+};
+
+} // namespace
+
+bool row_kernel_supported(const row_kernel_conf_t &conf) {
+    using namespace data_type;
+    const cpu_isa_t isa = get_max_isa();
+    if (isa == isa_undef) return false;
+
+    if (conf.eltwise_alg != alg_kind::undef
+            && !eltwise_injector::is_supported(isa, conf.eltwise_alg, f32))
+        return false;
+    if (!utils::one_of(conf.reduction_alg, alg_kind::undef,
+                alg_kind::reduction_max, alg_kind::reduction_sum))
+        return false;
+    if (!conf.with_store) return true;
+
+    switch (conf.dst_dt) {
+        case f32: return true;
+        case bf16: return mayiuse(avx512_core);
+        case f16: return mayiuse(avx512_core_fp16);
+        default: return false;
+    }
+}
+
+status_t create_row_kernel(std::unique_ptr<jit_row_kernel_t> &kernel,
+        const row_kernel_conf_t &conf) {
+    if (!row_kernel_supported(conf)) return status::unimplemented;
+
+    switch (get_max_isa()) {
+        case avx512_core:
+            kernel.reset(new jit_uni_row_kernel_t<avx512_core>(conf));
+            break;
+        case avx2: kernel.reset(new jit_uni_row_kernel_t<avx2>(conf)); break;
+        default: return status::unimplemented;
+    }
+    return kernel->create_kernel();
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
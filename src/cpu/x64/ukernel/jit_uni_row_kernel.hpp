@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_JIT_UNI_ROW_KERNEL_HPP
+#define CPU_X64_UKERNEL_JIT_UNI_ROW_KERNEL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+// A kernel processing a row of f32 values, such as a row of a brgemm
+// accumulation buffer. For every value `x` of the row, it computes
+// `y = alg(x - shift)`, stores `y` converted to `dst_dt` if `with_store` is
+// set and reduces the values of `y` to a single value with `reduction_alg`
+// if it is defined. An undefined `eltwise_alg` stands for the identity.
+struct row_kernel_conf_t {
+    alg_kind_t eltwise_alg = alg_kind::undef;
+    float alpha = 0.f;
+    float beta = 0.f;
+    bool with_shift = false;
+    bool with_store = false;
+    data_type_t dst_dt = data_type::f32;
+    // Either `reduction_max`, `reduction_sum` or undefined.
+    alg_kind_t reduction_alg = alg_kind::undef;
+};
+
+struct row_kernel_args_t {
+    const float *src;
+    void *dst;
+    const float *shift;
+    float *reduce;
+    size_t work_amount;
+};
+
+struct jit_row_kernel_t : public jit_generator_t {
+    jit_row_kernel_t(
+            const char *name, cpu_isa_t isa, const row_kernel_conf_t &conf)
+        : jit_generator_t(name, isa), conf_(conf) {}
+
+    void operator()(const row_kernel_args_t *args) const {
+        jit_generator_t::operator()(args);
+    }
+
+protected:
+    const row_kernel_conf_t conf_;
+};
+
+// Checks whether a row kernel with a given configuration can be created on
+// the target system.
+bool DNNL_API row_kernel_supported(const row_kernel_conf_t &conf);
+
+// Creates and generates a row kernel for the best ISA of the target system.
+status_t DNNL_API create_row_kernel(
+        std::unique_ptr<jit_row_kernel_t> &kernel,
+        const row_kernel_conf_t &conf);
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/verbose.hpp"
+
+#include "cpu/x64/ukernel/reduction.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::cpu::ukernel;
+
+#define VCHECK_REDUCTION(cond, status, msg, ...) \
+    VCONDCHECK(ukernel, create, check, reduction, (cond), status, msg, \
+            ##__VA_ARGS__)
+
+dnnl_ukernel_reduction::dnnl_ukernel_reduction(
+        dim_t M, dim_t N, dim_t ld_src, alg_kind_t alg)
+    : M_(M), N_(N), ld_src_(ld_src), alg_(alg) {}
+
+status_t reduction_t::generate() {
+    // Re-generation won't take any effect.
+    if (kernel_ != nullptr) return status::success;
+
+    cpu::x64::ukernel::row_kernel_conf_t conf;
+    conf.reduction_alg = alg_;
+    CHECK(cpu::x64::ukernel::create_row_kernel(kernel_, conf));
+
+    // Generate a verbose info string at the point where configuration is done.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        CHECK(create_verbose_info());
+    }
+    return status::success;
+}
+
+status_t reduction_t::execute(const void *src, float *dst) const {
+    if (kernel_ == nullptr) return status::runtime_error;
+
+    double start_ms = 0;
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        start_ms = get_msec();
+
+    const float *src_ptr = reinterpret_cast<const float *>(src);
+
+    cpu::x64::ukernel::row_kernel_args_t args {};
+    args.work_amount = N_;
+    for (dim_t m = 0; m < M_; m++) {
+        args.src = src_ptr + m * ld_src_;
+        args.reduce = dst + m;
+        (*kernel_)(&args);
+    }
+
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double duration_ms = get_msec() - start_ms;
+
+        std::stringstream ss;
+        ss << "cpu,reduction,,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    }
+    return status::success;
+}
+
+status_t reduction_t::create_verbose_info() {
+#if defined(DISABLE_VERBOSE)
+    return status::success;
+#endif
+
+    std::stringstream ss;
+
+    memory_desc_t src_md;
+    const dims_t dims = {M_, N_};
+    const dims_t src_strides = {ld_src_, 1};
+    CHECK(memory_desc_init_by_strides(
+            src_md, 2, dims, data_type::f32, src_strides));
+
+    memory_desc_t dst_md;
+    const dims_t dst_dims = {M_, 1};
+    const dims_t dst_strides = {1, 1};
+    CHECK(memory_desc_init_by_strides(
+            dst_md, 2, dst_dims, data_type::f32, dst_strides));
+
+    ss << md2fmt_str("src", &src_md, format_kind::undef) << " ";
+    ss << md2fmt_str("dst", &dst_md, format_kind::undef);
+    ss << ",,alg:" << dnnl_alg_kind2str(alg_) << "," << md2dim_str(&src_md);
+
+    verbose_info_ = ss.str();
+    return status::success;
+}
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_reduction_create(reduction_t **reduction, dim_t M,
+        dim_t N, dim_t ld_src, alg_kind_t alg) {
+    if (reduction == nullptr) return status::invalid_arguments;
+    VCHECK_REDUCTION(M > 0 && N > 0, status::invalid_arguments,
+            VERBOSE_BAD_PARAM, "M or N");
+    VCHECK_REDUCTION(ld_src >= N, status::invalid_arguments,
+            VERBOSE_BAD_PARAM, "ld_src");
+    VCHECK_REDUCTION(utils::one_of(alg, alg_kind::reduction_max,
+                             alg_kind::reduction_sum),
+            status::invalid_arguments, VERBOSE_BAD_ALGORITHM);
+
+    row_kernel_conf_t conf;
+    conf.reduction_alg = alg;
+    VCHECK_REDUCTION(row_kernel_supported(conf), status::unimplemented,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    *reduction = new reduction_t(M, N, ld_src, alg);
+    return status::success;
+}
+
+status_t dnnl_ukernel_reduction_generate(reduction_t *reduction) {
+    if (reduction == nullptr) return status::invalid_arguments;
+
+    CHECK(reduction->generate());
+    return status::success;
+}
+
+status_t dnnl_ukernel_reduction_execute(
+        const reduction_t *reduction, const void *src_ptr, float *dst_ptr) {
+    if (utils::any_null(reduction, src_ptr, dst_ptr))
+        return status::invalid_arguments;
+
+    CHECK(reduction->execute(src_ptr, dst_ptr));
+    return status::success;
+}
+
+status_t dnnl_ukernel_reduction_destroy(reduction_t *reduction) {
+    delete reduction;
+    return status::success;
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,243 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include "common/dnnl_thread.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/x64/ukernel/softmax.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::cpu::ukernel;
+
+#define VCHECK_SOFTMAX(cond, status, msg, ...) \
+    VCONDCHECK(ukernel, create, check, softmax, (cond), status, msg, \
+            ##__VA_ARGS__)
+
+dnnl_ukernel_softmax::dnnl_ukernel_softmax(dim_t M, dim_t N, dim_t ld_s,
+        dim_t ld_p, data_type_t p_dt, dim_t N_o, dim_t ld_o)
+    : M_(M)
+    , N_(N)
+    , ld_s_(ld_s)
+    , ld_p_(ld_p)
+    , p_dt_(p_dt)
+    , N_o_(N_o)
+    , ld_o_(ld_o) {}
+
+status_t softmax_t::generate() {
+    // Re-generation won't take any effect.
+    if (max_kernel_ != nullptr && exp_kernel_ != nullptr)
+        return status::success;
+
+    cpu::x64::ukernel::row_kernel_conf_t max_conf;
+    max_conf.reduction_alg = alg_kind::reduction_max;
+    CHECK(cpu::x64::ukernel::create_row_kernel(max_kernel_, max_conf));
+
+    cpu::x64::ukernel::row_kernel_conf_t exp_conf;
+    exp_conf.eltwise_alg = alg_kind::eltwise_exp;
+    exp_conf.with_shift = true;
+    exp_conf.with_store = true;
+    exp_conf.dst_dt = p_dt_;
+    exp_conf.reduction_alg = alg_kind::reduction_sum;
+    CHECK(cpu::x64::ukernel::create_row_kernel(exp_kernel_, exp_conf));
+
+    // Generate a verbose info string at the point where configuration is done.
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        CHECK(create_verbose_info());
+    }
+    return status::success;
+}
+
+status_t softmax_t::execute(
+        const void *S, void *P, float *max, float *sum, float *O) const {
+    if (max_kernel_ == nullptr || exp_kernel_ == nullptr)
+        return status::runtime_error;
+
+    double start_ms = 0;
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel))
+        start_ms = get_msec();
+
+    const float *S_ptr = reinterpret_cast<const float *>(S);
+    uint8_t *P_ptr = reinterpret_cast<uint8_t *>(P);
+    const size_t p_row_size = ld_p_ * types::data_type_size(p_dt_);
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    cpu::x64::ukernel::row_kernel_args_t args {};
+    args.work_amount = N_;
+    for (dim_t m = 0; m < M_; m++) {
+        float block_max = neg_inf;
+        args.src = S_ptr + m * ld_s_;
+        args.reduce = &block_max;
+        (*max_kernel_)(&args);
+
+        // A row with all the scores equal to -inf so far keeps the running
+        // maximum at -inf, the shift is zeroed not to produce NaNs.
+        const float max_old = max[m];
+        const float max_new = nstl::max(max_old, block_max);
+        const float shift = max_new == neg_inf ? 0.f : max_new;
+
+        float block_sum = 0.f;
+        args.dst = P_ptr + m * p_row_size;
+        args.shift = &shift;
+        args.reduce = &block_sum;
+        (*exp_kernel_)(&args);
+
+        // The statistics and the output of the first block are not read, so
+        // they don't have to be initialized by the user.
+        const float factor
+                = max_old == neg_inf ? 0.f : ::expf(max_old - max_new);
+        sum[m] = max_old == neg_inf ? block_sum : sum[m] * factor + block_sum;
+        max[m] = max_new;
+
+        if (N_o_ == 0) continue;
+        float *O_row = O + m * ld_o_;
+        if (max_old == neg_inf) {
+            for (dim_t n = 0; n < N_o_; n++)
+                O_row[n] = 0.f;
+        } else if (factor != 1.f) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t n = 0; n < N_o_; n++)
+                O_row[n] *= factor;
+        }
+    }
+
+    if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
+        double duration_ms = get_msec() - start_ms;
+
+        std::stringstream ss;
+        ss << "cpu,softmax,online,undef," << verbose_info_;
+        VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
+                duration_ms);
+    }
+    return status::success;
+}
+
+status_t softmax_t::finalize(const float *sum, float *O) const {
+    for (dim_t m = 0; m < M_; m++) {
+        // A row without a single finite score has no meaningful output.
+        const float scale = sum[m] > 0.f ? 1.f / sum[m] : 0.f;
+        float *O_row = O + m * ld_o_;
+        PRAGMA_OMP_SIMD()
+        for (dim_t n = 0; n < N_o_; n++)
+            O_row[n] *= scale;
+    }
+    return status::success;
+}
+
+status_t softmax_t::create_verbose_info() {
+#if defined(DISABLE_VERBOSE)
+    return status::success;
+#endif
+
+    std::stringstream ss;
+
+    memory_desc_t src_md;
+    const dims_t dims = {M_, N_};
+    const dims_t src_strides = {ld_s_, 1};
+    CHECK(memory_desc_init_by_strides(
+            src_md, 2, dims, data_type::f32, src_strides));
+
+    memory_desc_t dst_md;
+    const dims_t dst_strides = {ld_p_, 1};
+    CHECK(memory_desc_init_by_strides(dst_md, 2, dims, p_dt_, dst_strides));
+
+    ss << md2fmt_str("src", &src_md, format_kind::undef) << " ";
+    ss << md2fmt_str("dst", &dst_md, format_kind::undef);
+    ss << ",,N_o:" << N_o_ << " ld_o:" << ld_o_ << ","
+       << md2dim_str(&src_md);
+
+    verbose_info_ = ss.str();
+    return status::success;
+}
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_softmax_create(softmax_t **softmax, dim_t M, dim_t N,
+        dim_t ld_s, dim_t ld_p, data_type_t p_dt, dim_t N_o, dim_t ld_o) {
+    if (softmax == nullptr) return status::invalid_arguments;
+    VCHECK_SOFTMAX(M > 0 && N > 0 && N_o >= 0, status::invalid_arguments,
+            VERBOSE_BAD_PARAM, "M, N or N_o");
+    VCHECK_SOFTMAX(ld_s >= N && ld_p >= N && ld_o >= N_o,
+            status::invalid_arguments, VERBOSE_BAD_PARAM,
+            "ld_s, ld_p or ld_o");
+    VCHECK_SOFTMAX(utils::one_of(p_dt, data_type::f32, data_type::bf16,
+                           data_type::f16),
+            status::unimplemented, VERBOSE_UNSUPPORTED_DT);
+
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = alg_kind::eltwise_exp;
+    conf.with_shift = true;
+    conf.with_store = true;
+    conf.dst_dt = p_dt;
+    conf.reduction_alg = alg_kind::reduction_sum;
+    VCHECK_SOFTMAX(row_kernel_supported(conf), status::unimplemented,
+            VERBOSE_UNSUPPORTED_ISA);
+
+    *softmax = new softmax_t(M, N, ld_s, ld_p, p_dt, N_o, ld_o);
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_generate(softmax_t *softmax) {
+    if (softmax == nullptr) return status::invalid_arguments;
+
+    CHECK(softmax->generate());
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_execute(const softmax_t *softmax,
+        const void *S_ptr, void *P_ptr, float *max_ptr, float *sum_ptr,
+        float *O_ptr) {
+    if (utils::any_null(softmax, S_ptr, P_ptr, max_ptr, sum_ptr))
+        return status::invalid_arguments;
+    if (softmax->get_N_o() > 0 && O_ptr == nullptr)
+        return status::invalid_arguments;
+
+    CHECK(softmax->execute(S_ptr, P_ptr, max_ptr, sum_ptr, O_ptr));
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_finalize(
+        const softmax_t *softmax, const float *sum_ptr, float *O_ptr) {
+    if (utils::any_null(softmax, sum_ptr, O_ptr))
+        return status::invalid_arguments;
+
+    CHECK(softmax->finalize(sum_ptr, O_ptr));
+    return status::success;
+}
+
+status_t dnnl_ukernel_softmax_destroy(softmax_t *softmax) {
+    delete softmax;
+    return status::success;
+}
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_UKERNEL_SOFTMAX_HPP
+#define CPU_X64_UKERNEL_SOFTMAX_HPP
+
+#include <memory>
+#include <string>
+
+#include "cpu/ukernel/c_types_map.hpp"
+
+#include "cpu/x64/ukernel/jit_uni_row_kernel.hpp"
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+// An online softmax step: processes a block of columns of the scores and
+// updates the running statistics of the rows and the output accumulated with
+// the previous blocks.
+struct dnnl_ukernel_softmax : public dnnl::impl::c_compatible {
+    dnnl_ukernel_softmax(dnnl::impl::dim_t M, dnnl::impl::dim_t N,
+            dnnl::impl::dim_t ld_s, dnnl::impl::dim_t ld_p,
+            dnnl::impl::data_type_t p_dt, dnnl::impl::dim_t N_o,
+            dnnl::impl::dim_t ld_o);
+
+    // Generates softmax kernels.
+    dnnl::impl::status_t generate();
+
+    // Executes a softmax step.
+    dnnl::impl::status_t execute(const void *S, void *P, float *max,
+            float *sum, float *O) const;
+
+    // Normalizes the output with the final sums.
+    dnnl::impl::status_t finalize(const float *sum, float *O) const;
+
+    dnnl::impl::dim_t get_N_o() const { return N_o_; }
+
+private:
+    // User's inputs.
+    dnnl::impl::dim_t M_, N_;
+    dnnl::impl::dim_t ld_s_, ld_p_;
+    dnnl::impl::data_type_t p_dt_;
+    dnnl::impl::dim_t N_o_, ld_o_;
+
+    // A kernel computing the maximum of a row of the scores.
+    std::unique_ptr<dnnl::impl::cpu::x64::ukernel::jit_row_kernel_t>
+            max_kernel_;
+    // A kernel computing `exp(s - max)` for a row of the scores and its sum.
+    std::unique_ptr<dnnl::impl::cpu::x64::ukernel::jit_row_kernel_t>
+            exp_kernel_;
+
+    // Creates a `verbose_info_` string once during `generate()` call, and calls
+    // it during execute(). This is done to avoid string re-creation.
+    dnnl::impl::status_t create_verbose_info();
+    std::string verbose_info_;
+};
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace ukernel {
+
+status_t dnnl_ukernel_softmax_create(dnnl_ukernel_softmax **softmax, dim_t M,
+        dim_t N, dim_t ld_s, dim_t ld_p, data_type_t p_dt, dim_t N_o,
+        dim_t ld_o);
+
+status_t dnnl_ukernel_softmax_generate(dnnl_ukernel_softmax *softmax);
+
+status_t dnnl_ukernel_softmax_execute(const dnnl_ukernel_softmax *softmax,
+        const void *S_ptr, void *P_ptr, float *max_ptr, float *sum_ptr,
+        float *O_ptr);
+
+status_t dnnl_ukernel_softmax_finalize(const dnnl_ukernel_softmax *softmax,
+        const float *sum_ptr, float *O_ptr);
+
+status_t dnnl_ukernel_softmax_destroy(dnnl_ukernel_softmax *softmax);
+
+} // namespace ukernel
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -111,6 +111,10 @@ public:
         auto &pass_registry = get_pass_registry();
         graph::pass::pass_manager_t pm(pass_registry);
 
+        // Pattern passes do not add or remove ops, so one index of the ops
+        // by kind serves all of them.
+        agraph.build_op_index();
+
 #ifdef DNNL_ENABLE_GRAPH_DUMP
         std::string pass_config_json = "dnnl_graph_passes.json";
         std::ifstream fs(pass_config_json.c_str());
@@ -130,6 +134,7 @@ public:
 #else
         pm.run_passes(agraph, "", policy, dnnl_pass_filter);
 #endif
+        agraph.clear_op_index();
         return status::success;
     }
 
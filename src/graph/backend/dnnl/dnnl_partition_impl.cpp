@@ -114,6 +114,39 @@ status_t dnnl_partition_impl_t::compile(
         const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs,
         const engine_t *g_engine) const {
+    // Inputs with unknown dimensions are resolved at execution, when the
+    // partition is specialized for the shapes of the given tensors.
+    bool has_unknown_dims = false;
+    for (const auto &in : inputs) {
+        if (logical_tensor_wrapper_t(in).is_shape_unknown())
+            has_unknown_dims = true;
+    }
+
+    if (has_unknown_dims) {
+        std::vector<logical_tensor_t> ordered_inputs;
+        std::vector<logical_tensor_t> ordered_outputs;
+        CHECK(get_ordered_inputs_outputs(inputs_, inputs, ordered_inputs));
+        CHECK(get_ordered_inputs_outputs(outputs_, outputs, ordered_outputs));
+
+        auto part = std::dynamic_pointer_cast<const dnnl_partition_impl_t>(
+                this->clone());
+        auto pimpl = std::make_shared<dnnl_dynamic_compiled_partition_impl_t>(
+                *g_engine, ordered_inputs, ordered_outputs, part);
+        compiled_partition->init(pimpl);
+        return status::success;
+    }
+
+    std::shared_ptr<dnnl_compiled_partition_impl_t> pimpl;
+    CHECK(compile_kernel(inputs, outputs, g_engine, pimpl));
+    compiled_partition->init(pimpl);
+
+    return status::success;
+}
+
+status_t dnnl_partition_impl_t::compile_kernel(
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs, const engine_t *g_engine,
+        std::shared_ptr<dnnl_compiled_partition_impl_t> &pimpl) const {
     // compile will transform the subgraph in partition, so we make
     // a copy
     auto part = std::dynamic_pointer_cast<dnnl_partition_impl_t>(this->clone());
@@ -163,9 +196,8 @@ status_t dnnl_partition_impl_t::compile(
     if (status::success != ret) return ret;
 
     // wrapper kernel to dnnl_compiled_partition_impl_t
-    auto pimpl = std::make_shared<dnnl_compiled_partition_impl_t>(
+    pimpl = std::make_shared<dnnl_compiled_partition_impl_t>(
             *g_engine, ordered_inputs, ordered_outputs, kernel);
-    compiled_partition->init(pimpl);
 
     return status::success;
 }
@@ -178,6 +210,84 @@ status_t dnnl_partition_impl_t::infer_shape(
     return status::success;
 }
 
+status_t dnnl_dynamic_compiled_partition_impl_t::get_or_compile(
+        const std::vector<tensor_t> &inputs,
+        std::shared_ptr<dnnl_compiled_partition_impl_t> &pimpl) {
+    // The number of specializations kept per compiled partition.
+    static const int capacity = graph::utils::getenv_int_internal(
+            "GRAPH_DYNAMIC_SHAPE_CACHE_CAPACITY", 1024);
+
+    // Resolve the unknown dimensions from the given tensors. The key is made
+    // of the concrete shapes and strides of all inputs.
+    key_t key;
+    std::vector<logical_tensor_t> concrete_inputs;
+    concrete_inputs.reserve(inputs_.size());
+    for (const auto &expected : inputs_) {
+        const tensor_t *given = nullptr;
+        for (const auto &t : inputs) {
+            if (t.get_logical_tensor().id == expected.id) {
+                given = &t;
+                break;
+            }
+        }
+        if (!given) return status::invalid_arguments;
+
+        const logical_tensor_t &lt = given->get_logical_tensor();
+        const logical_tensor_wrapper_t ltw(lt);
+        if (ltw.is_shape_unknown() || lt.data_type != expected.data_type)
+            return status::invalid_arguments;
+        if (expected.ndims >= 0) {
+            if (lt.ndims != expected.ndims) return status::invalid_arguments;
+            for (int d = 0; d < lt.ndims; d++) {
+                if (expected.dims[d] >= 0 && expected.dims[d] != lt.dims[d])
+                    return status::invalid_arguments;
+            }
+        }
+
+        logical_tensor_t in = expected;
+        in.ndims = lt.ndims;
+        in.layout_type = lt.layout_type;
+        in.layout = lt.layout;
+        for (int d = 0; d < lt.ndims; d++)
+            in.dims[d] = lt.dims[d];
+        concrete_inputs.push_back(in);
+
+        key.push_back(lt.ndims);
+        key.insert(key.end(), lt.dims, lt.dims + lt.ndims);
+        if (lt.layout_type == layout_type::strided)
+            key.insert(key.end(), lt.layout.strides,
+                    lt.layout.strides + lt.ndims);
+        else
+            key.push_back(static_cast<dim_t>(lt.layout.layout_id));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.second);
+        pimpl = it->second.first;
+        return status::success;
+    }
+
+    // A copy of the outputs with unknown dimensions, the kernel compilation
+    // infers them in place.
+    std::vector<logical_tensor_t> concrete_outputs = outputs_;
+    CHECK(part_->compile_kernel(
+            concrete_inputs, concrete_outputs, engine_, pimpl));
+
+    if (capacity > 0) {
+        if (cache_.size() >= static_cast<size_t>(capacity)) {
+            cache_.erase(lru_.back());
+            lru_.pop_back();
+        }
+        lru_.push_front(key);
+        cache_.emplace(key, entry_t {pimpl, lru_.begin()});
+    }
+
+    return status::success;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
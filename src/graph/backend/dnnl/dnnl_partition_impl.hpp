@@ -17,7 +17,10 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -82,12 +85,17 @@ public:
 
     std::string str() const override { return kernel_->str(); }
 
+    size_t get_internal_temporary_size() const override {
+        return kernel_->get_internal_temporary_size();
+    }
+
 private:
     kernel_ptr kernel_;
 };
 
 class dnnl_partition_impl_t : public partition_impl_t {
     friend class dnnl_backend_t;
+    friend class dnnl_dynamic_compiled_partition_impl_t;
 
 public:
     dnnl_partition_impl_t(engine_kind_t engine_kind,
@@ -123,9 +131,86 @@ public:
             std::vector<logical_tensor_t *> &outputs) const override;
 
 private:
+    // Compiles a kernel for the given inputs, which must have known shapes.
+    // The kernels infer the output shapes in place although `outputs` is a
+    // const reference (see the FIXME in the definition), the compiled
+    // partition is then created from the inferred outputs.
+    status_t compile_kernel(const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            const engine_t *g_engine,
+            std::shared_ptr<dnnl_compiled_partition_impl_t> &pimpl) const;
+
     FCreateKernel kernel_creator_;
 };
 
+// A compiled partition for inputs with unknown dimensions. The dimensions are
+// resolved from the tensors given at execution: the partition is specialized
+// for every new combination of input shapes and the specialized partitions
+// are kept in a LRU cache, so repeated shapes are not compiled again.
+class dnnl_dynamic_compiled_partition_impl_t
+    : public compiled_partition_impl_t {
+public:
+    dnnl_dynamic_compiled_partition_impl_t(const engine_t &engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs,
+            const std::shared_ptr<const dnnl_partition_impl_t> &part)
+        : compiled_partition_impl_t(engine, inputs, outputs, {})
+        , part_(part) {}
+
+    status_t execute(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        std::shared_ptr<dnnl_compiled_partition_impl_t> pimpl;
+        CHECK(get_or_compile(inputs, pimpl));
+        return pimpl->execute(g_stream, inputs, outputs);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t execute_sycl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        std::shared_ptr<dnnl_compiled_partition_impl_t> pimpl;
+        CHECK(get_or_compile(inputs, pimpl));
+        return pimpl->execute_sycl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t execute_ocl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &ocl_deps,
+            cl_event *ocl_event) override {
+        std::shared_ptr<dnnl_compiled_partition_impl_t> pimpl;
+        CHECK(get_or_compile(inputs, pimpl));
+        return pimpl->execute_ocl(
+                g_stream, inputs, outputs, ocl_deps, ocl_event);
+    }
+#endif
+
+    std::string str() const override { return "dynamic"; }
+
+private:
+    using key_t = std::vector<dim_t>;
+    using entry_t = std::pair<std::shared_ptr<dnnl_compiled_partition_impl_t>,
+            std::list<key_t>::iterator>;
+
+    // Returns the partition specialized for the shapes of `inputs`, compiling
+    // it on the first use of these shapes.
+    status_t get_or_compile(const std::vector<tensor_t> &inputs,
+            std::shared_ptr<dnnl_compiled_partition_impl_t> &pimpl);
+
+    std::shared_ptr<const dnnl_partition_impl_t> part_;
+
+    std::mutex mutex_;
+    std::map<key_t, entry_t> cache_;
+    // Keys from the most to the least recently used.
+    std::list<key_t> lru_;
+};
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
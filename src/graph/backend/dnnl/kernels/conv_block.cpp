@@ -0,0 +1,434 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/dnnl_thread.hpp"
+#include "cpu/platform.hpp"
+
+#include "graph/utils/utils.hpp"
+
+#include "graph/backend/dnnl/kernels/conv_block.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+using tag = dnnl::memory::format_tag;
+
+// Returns the descriptor of `rows` spatial rows of one image of a dense NHWC
+// tensor.
+dnnl::memory::desc make_tile_md(
+        const dnnl::memory::desc &md, dim_t rows, dnnl::memory::data_type dt) {
+    auto dims = md.get_dims();
+    dims[0] = 1;
+    dims[2] = rows;
+    return dnnl::memory::desc(dims, dt, tag::nhwc);
+}
+
+// The recomputed halo rows must not make the block more expensive than
+// executing it op by op.
+constexpr dim_t max_recompute_ratio = 2;
+
+} // namespace
+
+status_t conv_block_kernel_t::compile_impl(const dnnl_partition_impl_t *part,
+        const engine_t *g_engine, const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    BACKEND_DNNL_CHECK(larger_partition_kernel_t::compile_impl(
+            part, g_engine, inputs, outputs));
+
+    if (!init_tiling()) {
+        tensors_.clear();
+        convs_.clear();
+        prologue_.clear();
+        tiles_.clear();
+        tile_buffer_size_ = 0;
+    }
+    return status::success;
+}
+
+bool conv_block_kernel_t::init_tiling() {
+    if (!graph::utils::getenv_int_internal("GRAPH_CONV_BLOCK_TILING", 1))
+        return false;
+    if (p_engine_.get_kind() != dnnl::engine::kind::cpu) return false;
+
+    const auto &args_set = memory_planner_.get_exec_args_set();
+    const auto &exec_args = args_set.get_exec_args();
+    if (args_set.get_mems_use_external_outputs().size() != 1) return false;
+
+    std::unordered_set<dnnl_memory_t> externals;
+    for (const auto &mem_idx : args_set.get_mems_use_external_inputs())
+        externals.insert(mem_idx.first.get());
+    for (const auto &mem_idx : args_set.get_mems_use_external_outputs())
+        externals.insert(mem_idx.first.get());
+
+    std::unordered_map<dnnl_memory_t, int> tensor_idx;
+    auto get_tensor = [&](size_t exec_idx, int arg) -> int {
+        const auto it = exec_args[exec_idx].find(arg);
+        if (it == exec_args[exec_idx].end()) return -1;
+        const dnnl::memory &mem = it->second;
+        const auto found = tensor_idx.find(mem.get());
+        if (found != tensor_idx.end()) return found->second;
+
+        const auto md = mem.get_desc();
+        if (md.get_ndims() != 4) return -1;
+        const auto dims = md.get_dims();
+        if (md != dnnl::memory::desc(dims, md.get_data_type(), tag::nhwc))
+            return -1;
+        if (batch_ == 0) batch_ = dims[0];
+        if (dims[0] != batch_ || dims[2] <= 0) return -1;
+
+        tensor_info_t t;
+        t.md = md;
+        t.rows = dims[2];
+        t.row_size = md.get_size() / static_cast<size_t>(dims[0] * dims[2]);
+        t.is_external = externals.count(mem.get()) != 0;
+        t.exec_idx = exec_idx;
+        t.arg = arg;
+        tensors_.push_back(t);
+        const int idx = static_cast<int>(tensors_.size()) - 1;
+        tensor_idx.emplace(mem.get(), idx);
+        return idx;
+    };
+
+    for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+        if (subgraph_->is_constant_[i]) continue;
+        const auto *conv = dynamic_cast<const conv_fwd_executable_t *>(
+                subgraph_->execs_[i].get());
+        // Ops which don't touch the activations (eg. weight reorders when
+        // the constant cache is disabled) are executed before the tiles.
+        if (!conv) {
+            prologue_.push_back(i);
+            continue;
+        }
+
+        conv_info_t c;
+        c.exec_idx = i;
+        c.pd = conv->get_primitive_desc();
+        c.src = get_tensor(i, DNNL_ARG_SRC);
+        c.dst = get_tensor(i, DNNL_ARG_DST);
+        if (c.src < 0 || c.dst < 0) return false;
+        if (conv->with_sum()) {
+            c.psrc = get_tensor(i, DNNL_GRAPH_ARG_POST_SRC);
+            if (c.psrc < 0) return false;
+        }
+        if (tensors_[c.dst].producer != -1) return false;
+        tensors_[c.dst].producer = static_cast<int>(convs_.size());
+
+        const auto wei_dims = c.pd.weights_desc().get_dims();
+        const auto strides = c.pd.get_strides();
+        const auto dilates = c.pd.get_dilations();
+        const auto pad_l = c.pd.get_padding_l();
+        if (strides.size() != 2) return false;
+        c.kh = wei_dims[wei_dims.size() - 2];
+        c.sh = strides[0];
+        c.dh = dilates[0];
+        c.pt = pad_l[0];
+
+        // Binary post-ops with a spatially varying operand would need the
+        // operand to be tiled as well.
+        const auto po = c.pd.get_primitive_attr().get_post_ops();
+        for (int k = 0; k < po.len(); k++) {
+            if (po.kind(k) == dnnl::primitive::kind::convolution) return false;
+            if (po.kind(k) != dnnl::primitive::kind::binary) continue;
+            dnnl::algorithm alg;
+            dnnl::memory::desc src1_md;
+            po.get_params_binary(k, alg, src1_md);
+            if (src1_md.get_ndims() > 2 && src1_md.get_dims()[2] != 1)
+                return false;
+        }
+        convs_.push_back(c);
+    }
+    if (convs_.empty()) return false;
+
+    for (size_t i : prologue_) {
+        for (const auto &arg : exec_args[i])
+            if (tensor_idx.count(arg.second.get())) return false;
+    }
+
+    // The block is tiled on the spatial rows of its only output, which is
+    // produced by the last convolution. All the other activations are either
+    // inputs of the partition or intermediates which only live in the tile
+    // buffer.
+    const int out = convs_.back().dst;
+    if (!tensors_[out].is_external) return false;
+    for (size_t t = 0; t < tensors_.size(); t++) {
+        if (static_cast<int>(t) == out) continue;
+        const bool is_input = tensors_[t].producer == -1;
+        if (tensors_[t].is_external != is_input) return false;
+    }
+    for (const auto &c : convs_) {
+        if (c.src == out || c.psrc == out) return false;
+    }
+
+    // Pick the largest tile whose intermediates fit the aggregate L2 cache.
+    const size_t l2_size = static_cast<size_t>(
+            cpu::platform::get_per_core_cache_size(2) * dnnl_get_max_threads());
+    const dim_t out_rows = tensors_[out].rows;
+    const auto buffer_size = [&](const std::vector<dim_t> &buf_rows) {
+        size_t size = 0;
+        for (size_t t = 0; t < tensors_.size(); t++) {
+            tensors_[t].buf_offset = size;
+            size += impl::utils::rnd_up(
+                    buf_rows[t] * tensors_[t].row_size, 64);
+        }
+        return size;
+    };
+
+    std::vector<dim_t> buf_rows;
+    dim_t computed_rows = 0;
+    dim_t tile_rows = out_rows;
+    do {
+        tile_rows = impl::utils::div_up(tile_rows, 2);
+        if (!init_tiles(tile_rows, tiles_, buf_rows, computed_rows))
+            return false;
+        tile_buffer_size_ = buffer_size(buf_rows);
+    } while (tile_buffer_size_ > l2_size && tile_rows > 1);
+    if (tile_buffer_size_ > l2_size || tiles_.size() < 2) return false;
+
+    dim_t full_rows = 0;
+    for (const auto &c : convs_)
+        full_rows += tensors_[c.dst].rows;
+    if (computed_rows > max_recompute_ratio * full_rows) return false;
+
+    // Create the convolutions of each tile. The edge tiles carry the original
+    // top and bottom padding, the others only see real rows.
+    for (auto &tile : tiles_) {
+        for (auto &step : tile.steps) {
+            const auto &c = convs_[step.conv];
+            const auto &full = c.pd;
+            const auto &src_t = tensors_[c.src];
+            const auto &dst_t = tensors_[c.dst];
+
+            const dim_t pad_t = step.src_row - (step.dst_row * c.sh - c.pt);
+            const dim_t pad_b = (step.dst_rows - 1) * c.sh
+                    + (c.kh - 1) * (c.dh + 1) + 1 - step.src_rows - pad_t;
+            auto pad_l = full.get_padding_l();
+            auto pad_r = full.get_padding_r();
+            pad_l[0] = pad_t;
+            pad_r[0] = pad_b;
+
+            step.src_md = make_tile_md(
+                    src_t.md, step.src_rows, src_t.md.get_data_type());
+            step.dst_md = make_tile_md(
+                    dst_t.md, step.dst_rows, dst_t.md.get_data_type());
+
+            const auto attr = full.get_primitive_attr();
+            const auto bias_md = full.bias_desc();
+            dnnl::convolution_forward::primitive_desc pd;
+            if (bias_md.is_zero()) {
+                pd = dnnl::convolution_forward::primitive_desc(p_engine_,
+                        full.get_prop_kind(), full.get_algorithm(),
+                        step.src_md, full.weights_desc(), step.dst_md,
+                        full.get_strides(), full.get_dilations(), pad_l, pad_r,
+                        attr, true);
+            } else {
+                pd = dnnl::convolution_forward::primitive_desc(p_engine_,
+                        full.get_prop_kind(), full.get_algorithm(),
+                        step.src_md, full.weights_desc(), bias_md,
+                        step.dst_md, full.get_strides(), full.get_dilations(),
+                        pad_l, pad_r, attr, true);
+            }
+            // The tile convolution must consume the weights prepared for the
+            // full one and fit into its scratchpad.
+            if (!pd || pd.weights_desc() != full.weights_desc()) return false;
+            if (pd.scratchpad_desc().get_size()
+                    > full.scratchpad_desc().get_size())
+                return false;
+            step.prim = dnnl::convolution_forward(pd);
+
+            if (c.psrc < 0) continue;
+            // Same as the op by op execution: a s8 post-src is copied as is
+            // into the u8 destination.
+            const auto &psrc_t = tensors_[c.psrc];
+            const auto psrc_dt = psrc_t.md.get_data_type();
+            step.psrc_md = make_tile_md(psrc_t.md, step.dst_rows, psrc_dt);
+            step.sum_to_md = psrc_dt == dnnl::memory::data_type::s8
+                            && dst_t.md.get_data_type()
+                                    == dnnl::memory::data_type::u8
+                    ? make_tile_md(dst_t.md, step.dst_rows, psrc_dt)
+                    : step.dst_md;
+            step.sum_reorder = dnnl::reorder(dnnl::reorder::primitive_desc(
+                    p_engine_, step.psrc_md, p_engine_, step.sum_to_md));
+        }
+    }
+
+    return true;
+}
+
+bool conv_block_kernel_t::init_tiles(dim_t tile_rows,
+        std::vector<tile_t> &tiles, std::vector<dim_t> &buf_rows,
+        dim_t &computed_rows) const {
+    const int out = convs_.back().dst;
+    const dim_t out_rows = tensors_[out].rows;
+
+    tiles.clear();
+    buf_rows.assign(tensors_.size(), 0);
+    computed_rows = 0;
+
+    for (dim_t start = 0; start < out_rows; start += tile_rows) {
+        // Rows [lo, hi) of each tensor needed to compute the tile.
+        std::vector<dim_t> lo(tensors_.size()), hi(tensors_.size(), 0);
+        for (size_t t = 0; t < tensors_.size(); t++)
+            lo[t] = tensors_[t].rows;
+        lo[out] = start;
+        hi[out] = std::min(start + tile_rows, out_rows);
+        const auto extend = [&](int t, dim_t from, dim_t to) {
+            lo[t] = std::min(lo[t], from);
+            hi[t] = std::max(hi[t], to);
+        };
+
+        tile_t tile;
+        tile.steps.resize(convs_.size());
+        // All the consumers of a tensor come after its producer, so walking
+        // the convolutions backward gives the final row range of each
+        // destination before its producer is visited.
+        for (size_t i = convs_.size(); i-- > 0;) {
+            const auto &c = convs_[i];
+            if (lo[c.dst] >= hi[c.dst]) return false;
+
+            auto &step = tile.steps[i];
+            step.conv = i;
+            step.dst_row = lo[c.dst];
+            step.dst_rows = hi[c.dst] - lo[c.dst];
+
+            const dim_t in_lo = step.dst_row * c.sh - c.pt;
+            const dim_t in_hi = (hi[c.dst] - 1) * c.sh - c.pt
+                    + (c.kh - 1) * (c.dh + 1) + 1;
+            step.src_row = std::max(in_lo, dim_t(0));
+            step.src_rows
+                    = std::min(in_hi, tensors_[c.src].rows) - step.src_row;
+            if (step.src_rows <= 0) return false;
+
+            extend(c.src, step.src_row, step.src_row + step.src_rows);
+            if (c.psrc >= 0) extend(c.psrc, step.dst_row, hi[c.dst]);
+            computed_rows += step.dst_rows;
+        }
+
+        for (size_t t = 0; t < tensors_.size(); t++) {
+            if (tensors_[t].is_external) continue;
+            buf_rows[t] = std::max(buf_rows[t], hi[t] - lo[t]);
+        }
+        tile.buf_row = std::move(lo);
+        tiles.push_back(std::move(tile));
+    }
+    return true;
+}
+
+std::shared_ptr<conv_block_kernel_t::tile_args_t>
+conv_block_kernel_t::create_tile_args(const execution_args_set_t *res) const {
+    auto targs = std::make_shared<tile_args_t>();
+    for (const auto &tile : tiles_) {
+        std::vector<exec_args> conv_args, sum_args;
+        for (const auto &step : tile.steps) {
+            const auto &c = convs_[step.conv];
+            // Weights, bias, scales, zero points and scratchpad are shared
+            // with the full-size execution args.
+            exec_args args = res->get_exec_args()[c.exec_idx];
+            args.erase(DNNL_GRAPH_ARG_POST_SRC);
+            args[DNNL_ARG_SRC]
+                    = dnnl::memory(step.src_md, p_engine_, DNNL_MEMORY_NONE);
+            args[DNNL_ARG_DST]
+                    = dnnl::memory(step.dst_md, p_engine_, DNNL_MEMORY_NONE);
+            conv_args.push_back(std::move(args));
+
+            exec_args sargs;
+            if (c.psrc >= 0) {
+                sargs[DNNL_ARG_FROM] = dnnl::memory(
+                        step.psrc_md, p_engine_, DNNL_MEMORY_NONE);
+                sargs[DNNL_ARG_TO] = dnnl::memory(
+                        step.sum_to_md, p_engine_, DNNL_MEMORY_NONE);
+            }
+            sum_args.push_back(std::move(sargs));
+        }
+        targs->conv_args.push_back(std::move(conv_args));
+        targs->sum_args.push_back(std::move(sum_args));
+    }
+    return targs;
+}
+
+void *conv_block_kernel_t::get_tile_ptr(const execution_args_set_t *res,
+        char *tile_buffer, const tile_t &tile, int tensor, dim_t n,
+        dim_t row) const {
+    const auto &t = tensors_[tensor];
+    if (t.is_external) {
+        const auto &mem = res->get_exec_args()[t.exec_idx].at(t.arg);
+        return static_cast<char *>(mem.get_data_handle())
+                + (n * t.rows + row) * t.row_size;
+    }
+    return tile_buffer + t.buf_offset
+            + (row - tile.buf_row[tensor]) * t.row_size;
+}
+
+status_t conv_block_kernel_t::execute_ops(
+        const dnnl::stream &p_stream, execution_args_set_t *res) {
+    if (tiles_.empty())
+        return larger_partition_kernel_t::execute_ops(p_stream, res);
+
+    for (size_t i : prologue_)
+        subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+
+    thread_local_cache_t<tile_args_t> tile_cache;
+    tile_args_t *targs = tile_cache.get_or_add(reinterpret_cast<size_t>(this),
+            [&]() { return create_tile_args(res); });
+
+    temporary_scratchpad_t tile_buffer(tile_buffer_size_, p_engine_, *g_alloc_);
+    assertm(tile_buffer.size() >= tile_buffer_size_,
+            "no enough memory for the tile buffer");
+    char *buf = tile_buffer.get_buffer();
+
+    for (dim_t n = 0; n < batch_; n++) {
+        for (size_t k = 0; k < tiles_.size(); k++) {
+            const auto &tile = tiles_[k];
+            for (size_t j = 0; j < tile.steps.size(); j++) {
+                const auto &step = tile.steps[j];
+                const auto &c = convs_[step.conv];
+                void *dst
+                        = get_tile_ptr(res, buf, tile, c.dst, n, step.dst_row);
+
+                if (c.psrc >= 0) {
+                    const auto &sargs = targs->sum_args[k][j];
+                    sargs.at(DNNL_ARG_FROM)
+                            .set_data_handle(get_tile_ptr(
+                                    res, buf, tile, c.psrc, n, step.dst_row));
+                    sargs.at(DNNL_ARG_TO).set_data_handle(dst);
+                    step.sum_reorder.execute(p_stream, sargs);
+                }
+
+                const auto &args = targs->conv_args[k][j];
+                args.at(DNNL_ARG_SRC)
+                        .set_data_handle(get_tile_ptr(
+                                res, buf, tile, c.src, n, step.src_row));
+                args.at(DNNL_ARG_DST).set_data_handle(dst);
+                step.prim.execute(p_stream, args);
+            }
+        }
+    }
+
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_CONV_BLOCK_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_CONV_BLOCK_HPP
+
+#include <memory>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Kernel for residual convolution block partitions (ResNet-like stages).
+//
+// The subgraph is compiled exactly like a larger partition. When all the
+// non-constant ops are forward convolutions on dense NHWC activations, the
+// block is executed depth-first instead of op by op: the spatial rows of the
+// partition output are split into tiles and each tile is computed through all
+// the convolutions of the block, recomputing the halo rows needed by the
+// spatial kernels. Intermediate activations only live in a small tile buffer
+// sized to stay in the aggregate L2 cache, so they never stream through
+// memory. Any other subgraph falls back to the op by op execution.
+class conv_block_kernel_t : public larger_partition_kernel_t {
+public:
+    conv_block_kernel_t() {
+        thread_local_cache_t<tile_args_t> tile_cache;
+        tile_cache.retain();
+    }
+
+    ~conv_block_kernel_t() override {
+        thread_local_cache_t<tile_args_t> tile_cache;
+        tile_cache.remove_if_exist(reinterpret_cast<size_t>(this));
+        tile_cache.release();
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_ops(
+            const dnnl::stream &p_stream, execution_args_set_t *res) override;
+
+    DEF_KERNEL_METHOD_STR(conv_block_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(conv_block_kernel_t)
+
+private:
+    // A dense NHWC activation consumed or produced by the block.
+    struct tensor_info_t {
+        dnnl::memory::desc md;
+        dim_t rows = 0; // spatial height
+        size_t row_size = 0; // bytes of one spatial row of one image
+        bool is_external = false;
+        int producer = -1;
+        // Where the full-size memory of the tensor is bound in the
+        // execution args, used to get the user buffer of external tensors.
+        size_t exec_idx = 0;
+        int arg = 0;
+        // Offset of the tile buffer of an intermediate tensor.
+        size_t buf_offset = 0;
+    };
+
+    // A convolution of the block, in execution order.
+    struct conv_info_t {
+        size_t exec_idx = 0;
+        int src = -1, dst = -1, psrc = -1;
+        dnnl::convolution_forward::primitive_desc pd;
+        dim_t kh = 0, sh = 0, dh = 0, pt = 0;
+    };
+
+    // A convolution of the block computed for one tile.
+    struct tile_step_t {
+        size_t conv = 0;
+        dim_t src_row = 0, src_rows = 0;
+        dim_t dst_row = 0, dst_rows = 0;
+        dnnl::memory::desc src_md, dst_md, psrc_md, sum_to_md;
+        dnnl::convolution_forward prim;
+        dnnl::reorder sum_reorder;
+    };
+
+    struct tile_t {
+        std::vector<tile_step_t> steps;
+        // First row held by the tile buffer of each tensor.
+        std::vector<dim_t> buf_row;
+    };
+
+    // Per-thread execution args of all the tile steps. The full-size
+    // arguments (weights, scales, scratchpad...) are shared with the
+    // execution args set of the same thread.
+    struct tile_args_t {
+        std::vector<std::vector<exec_args>> conv_args;
+        std::vector<std::vector<exec_args>> sum_args;
+    };
+
+    bool init_tiling();
+    bool init_tiles(dim_t tile_rows, std::vector<tile_t> &tiles,
+            std::vector<dim_t> &buf_rows, dim_t &computed_rows) const;
+    std::shared_ptr<tile_args_t> create_tile_args(
+            const execution_args_set_t *res) const;
+    void *get_tile_ptr(const execution_args_set_t *res, char *tile_buffer,
+            const tile_t &tile, int tensor, dim_t n, dim_t row) const;
+
+    std::vector<tensor_info_t> tensors_;
+    std::vector<conv_info_t> convs_;
+    std::vector<size_t> prologue_;
+    std::vector<tile_t> tiles_;
+    dim_t batch_ = 0;
+    size_t tile_buffer_size_ = 0;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
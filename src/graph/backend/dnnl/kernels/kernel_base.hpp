@@ -24,6 +24,8 @@
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/logical_tensor.hpp"
 
+#include "graph/backend/dnnl/passes/memory_planning.hpp"
+
 // required for dnnl::engine
 #include "oneapi/dnnl/dnnl.hpp"
 
@@ -108,9 +110,15 @@ struct kernel_base_t {
 
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
+    // Size of the temporary buffer the kernel requests at each execution.
+    virtual size_t get_internal_temporary_size() const {
+        return memory_planner_.total_internal_temporary_size();
+    }
+
 protected:
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
+    memory_planner_t memory_planner_;
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
@@ -21,11 +21,13 @@
 #include "graph/backend/dnnl/kernels/binary.hpp"
 #include "graph/backend/dnnl/kernels/concat.hpp"
 #include "graph/backend/dnnl/kernels/conv.hpp"
+#include "graph/backend/dnnl/kernels/conv_block.hpp"
 #include "graph/backend/dnnl/kernels/conv_transpose.hpp"
 #include "graph/backend/dnnl/kernels/dummy.hpp"
 #include "graph/backend/dnnl/kernels/eltwise.hpp"
 #include "graph/backend/dnnl/kernels/gen_index.hpp"
 #include "graph/backend/dnnl/kernels/group_norm.hpp"
+#include "graph/backend/dnnl/kernels/kv_quantize.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/layer_norm.hpp"
 #include "graph/backend/dnnl/kernels/log_softmax.hpp"
@@ -0,0 +1,367 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/dnnl_thread.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "graph/backend/dnnl/kernels/kv_quantize.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#endif
+
+#define VCHECK_KV_QUANT(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, kv_quantize_t, (cond), status, msg, \
+            ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+
+// Returns the index of the partition port holding the logical tensor of val.
+bool find_port(const std::vector<logical_tensor_t> &lts, const value_t *val,
+        size_t &idx) {
+    const size_t id = val->get_logical_tensor().id;
+    for (size_t i = 0; i < lts.size(); ++i) {
+        if (lts[i].id != id) continue;
+        idx = i;
+        return true;
+    }
+    return false;
+}
+
+// Quantizes one group to a byte data type.
+template <typename T>
+void quantize_group(const float *src, dim_t group, float inv_scale, T *dst,
+        dim_t dst_stride) {
+    for (dim_t i = 0; i < group; ++i)
+        dst[i * dst_stride]
+                = cpu::q10n::saturate_and_round<T>(src[i] * inv_scale);
+}
+
+// Quantizes one group to a 4-bit data type, two values per byte with the
+// even element in the low nibble. The group is dense and starts on a byte.
+void quantize_group_int4(const float *src, dim_t group, float inv_scale,
+        bool is_signed, uint8_t *dst) {
+    const float lo = is_signed ? -8.f : 0.f;
+    const float hi = is_signed ? 7.f : 15.f;
+    const auto q = [&](float v) {
+        const float r = nstl::min(hi, nstl::max(lo, nearbyintf(v)));
+        return static_cast<uint8_t>(static_cast<int>(r) & 0xF);
+    };
+    for (dim_t i = 0; i < group; i += 2)
+        dst[i / 2] = static_cast<uint8_t>(q(src[i] * inv_scale)
+                | (q(src[i + 1] * inv_scale) << 4));
+}
+
+} // namespace
+
+status_t kv_quantize_t::compile_impl(const dnnl_partition_impl_t *part,
+        const engine_t *g_engine, const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+    VCHECK_KV_QUANT(p_engine_.get_kind() == engine::kind::cpu,
+            status::unimplemented, "only cpu engine is supported");
+
+    std::shared_ptr<op_t> mm, reduce, div, quant, reshape;
+    for (const auto &op : part->get_ops()) {
+        switch (op->get_kind()) {
+            case graph::op_kind::MatMul: mm = op; break;
+            case graph::op_kind::ReduceMax: reduce = op; break;
+            case graph::op_kind::Divide: div = op; break;
+            case graph::op_kind::DynamicQuantize: quant = op; break;
+            case graph::op_kind::StaticReshape: reshape = op; break;
+            default: break;
+        }
+    }
+    VCHECK_KV_QUANT(mm && reduce && div && quant, status::unimplemented,
+            "unexpected ops in the kv quantization partition");
+
+    VCHECK_KV_QUANT(find_port(inputs, mm->get_input_value(0).get(), src_idx_)
+                    && find_port(
+                            inputs, mm->get_input_value(1).get(), wei_idx_),
+            status::unimplemented, "matmul inputs should be partition inputs");
+    with_bias_ = mm->num_inputs() > 2;
+    VCHECK_KV_QUANT(!with_bias_
+                    || find_port(
+                            inputs, mm->get_input_value(2).get(), bias_idx_),
+            status::unimplemented, "matmul bias should be a partition input");
+    VCHECK_KV_QUANT(
+            find_port(inputs, div->get_input_value(1).get(), divisor_idx_),
+            status::unimplemented,
+            "scale divisor should be a partition input");
+    VCHECK_KV_QUANT(
+            find_port(outputs, quant->get_output_value(0).get(), dst_idx_),
+            status::unimplemented,
+            "quantized tensor should be a partition output");
+    with_scales_output_ = find_port(
+            outputs, div->get_output_value(0).get(), scales_idx_);
+
+    const auto &divisor = inputs[divisor_idx_];
+    VCHECK_KV_QUANT(ltw(divisor).nelems() == 1
+                    && divisor.data_type == data_type::f32,
+            status::unimplemented, "scale divisor should be a f32 scalar");
+
+    // The reduction runs over the last dimension of the (reshaped) matmul
+    // output, which gives one scale per group of channels.
+    const auto &dst = outputs[dst_idx_];
+    const int ndims = dst.ndims;
+    VCHECK_KV_QUANT(ndims >= 2 && !ltw(dst).has_zero_dim()
+                    && ltw(dst).nelems() > 0,
+            status::unimplemented, "unsupported quantized tensor shape");
+    const auto dst_dims = ltw(dst).vdims();
+    channels_ = dst_dims.back();
+
+    group_ = channels_;
+    if (quant->get_attr<std::string>(op_attr::qtype) == "per_group") {
+        const auto group_shape
+                = quant->get_attr<std::vector<int64_t>>(op_attr::group_shape);
+        VCHECK_KV_QUANT(static_cast<int>(group_shape.size()) == ndims
+                        && std::all_of(group_shape.begin(),
+                                group_shape.end() - 1,
+                                [](int64_t g) { return g == 1; }),
+                status::unimplemented,
+                "only groups along the last dimension are supported");
+        group_ = group_shape.back();
+    }
+    VCHECK_KV_QUANT(group_ > 0 && channels_ % group_ == 0,
+            status::unimplemented, "channels should be divisible by group");
+    const dim_t ngroups = channels_ / group_;
+
+    const auto axes = reduce->get_attr<std::vector<int64_t>>(op_attr::axes);
+    const int reduce_ndims = reshape ? ndims + 1 : ndims;
+    VCHECK_KV_QUANT(axes.size() == 1
+                    && (axes[0] == -1 || axes[0] == reduce_ndims - 1),
+            status::unimplemented,
+            "reduction should be over the last dimension");
+    if (reshape) {
+        const auto shape
+                = reshape->get_attr<std::vector<int64_t>>(op_attr::shape);
+        VCHECK_KV_QUANT(static_cast<int>(shape.size()) == ndims + 1
+                        && shape.back() == group_,
+                status::unimplemented,
+                "reshape should split the channels in groups");
+    } else {
+        VCHECK_KV_QUANT(ngroups == 1, status::unimplemented,
+                "per group scales require a reshape before the reduction");
+    }
+
+    dst_dt_ = static_cast<memory::data_type>(dst.data_type);
+    VCHECK_KV_QUANT(impl::utils::one_of(dst_dt_, memory::data_type::s8,
+                            memory::data_type::u8, memory::data_type::s4,
+                            memory::data_type::u4),
+            status::unimplemented, "unsupported quantized data type");
+
+    // Outputs with any layout are dense, otherwise the strides of the output
+    // are honored so that the quantized values land in the cache slot.
+    if (ltw(dst).is_any()) {
+        auto &out = const_cast<logical_tensor_t &>(dst);
+        out.layout_type = layout_type::strided;
+        const auto strides = get_dense_strides(dst_dims);
+        std::copy(strides.begin(), strides.end(), out.layout.strides);
+    }
+    VCHECK_KV_QUANT(ltw(dst).is_strided(), status::unimplemented,
+            "quantized tensor should be strided");
+    const auto dst_strides = ltw(dst).vstrides();
+    row_dims_.assign(dst_dims.begin(), dst_dims.end() - 1);
+    dst_strides_.assign(dst_strides.begin(), dst_strides.end() - 1);
+    dst_channel_stride_ = dst_strides.back();
+    rows_ = 1;
+    for (auto d : row_dims_)
+        rows_ *= d;
+
+    const bool is_int4 = impl::utils::one_of(
+            dst_dt_, memory::data_type::s4, memory::data_type::u4);
+    if (is_int4) {
+        VCHECK_KV_QUANT(dst_channel_stride_ == 1 && group_ % 2 == 0
+                        && std::all_of(dst_strides_.begin(),
+                                dst_strides_.end(),
+                                [](dim_t s) { return s % 2 == 0; }),
+                status::unimplemented,
+                "4-bit groups should be dense and byte aligned");
+    }
+
+    // The scales have the shape of the quantized tensor with the channels
+    // replaced by the groups, or no channel dimension for per-token scales.
+    if (with_scales_output_) {
+        const auto &scales = outputs[scales_idx_];
+        VCHECK_KV_QUANT(scales.data_type == data_type::f32,
+                status::unimplemented, "scales should be f32");
+        if (ltw(scales).is_any()) {
+            auto &out = const_cast<logical_tensor_t &>(scales);
+            out.layout_type = layout_type::strided;
+            const auto strides = get_dense_strides(ltw(scales).vdims());
+            std::copy(strides.begin(), strides.end(), out.layout.strides);
+        }
+        VCHECK_KV_QUANT(ltw(scales).is_strided()
+                        && ltw(scales).nelems() == rows_ * ngroups,
+                status::unimplemented, "unexpected scales shape");
+        const auto scales_strides = ltw(scales).vstrides();
+        if (scales.ndims == ndims) {
+            scales_strides_.assign(
+                    scales_strides.begin(), scales_strides.end() - 1);
+            scales_group_stride_ = scales_strides.back();
+        } else {
+            VCHECK_KV_QUANT(scales.ndims == ndims - 1 && ngroups == 1,
+                    status::unimplemented, "unexpected scales shape");
+            scales_strides_ = scales_strides;
+            scales_group_stride_ = 0;
+        }
+    }
+
+    // The projection is computed in f32 into the temporary buffer.
+    src_md_ = make_dnnl_memory_desc(inputs[src_idx_]);
+    wei_md_ = make_dnnl_memory_desc(inputs[wei_idx_]);
+    if (mm->has_attr(op_attr::transpose_a)
+            && mm->get_attr<bool>(op_attr::transpose_a)) {
+        const int nd = src_md_.get_ndims();
+        src_md_ = transpose(src_md_, nd - 2, nd - 1);
+    }
+    if (mm->has_attr(op_attr::transpose_b)
+            && mm->get_attr<bool>(op_attr::transpose_b)) {
+        const int nd = wei_md_.get_ndims();
+        wei_md_ = transpose(wei_md_, nd - 2, nd - 1);
+    }
+    if (src_md_.get_ndims() < ndims) src_md_ = expand(src_md_, ndims);
+    if (wei_md_.get_ndims() < ndims) wei_md_ = expand(wei_md_, ndims);
+    if (with_bias_) {
+        bias_md_ = make_dnnl_memory_desc(inputs[bias_idx_]);
+        if (bias_md_.get_ndims() < ndims) bias_md_ = expand(bias_md_, ndims);
+    }
+    mm_dst_md_ = memory::desc(
+            dst_dims, memory::data_type::f32, get_dense_strides(dst_dims));
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const auto fpmath = part->get_fpmath_mode();
+    attr.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+    const auto pd = with_bias_
+            ? dnnl::matmul::primitive_desc(
+                    p_engine_, src_md_, wei_md_, bias_md_, mm_dst_md_, attr)
+            : dnnl::matmul::primitive_desc(
+                    p_engine_, src_md_, wei_md_, mm_dst_md_, attr);
+    matmul_ = dnnl::matmul(pd);
+    scratchpad_md_ = pd.scratchpad_desc();
+    mm_dst_size_ = impl::utils::rnd_up(mm_dst_md_.get_size(), 64);
+
+    return status::success;
+}
+
+status_t kv_quantize_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+    temporary_scratchpad_t scratchpad(
+            get_internal_temporary_size(), p_engine_, *g_alloc_);
+    assertm(scratchpad.size() >= get_internal_temporary_size(),
+            "no enough scratchpad memory");
+    char *buffer = scratchpad.get_buffer();
+
+    exec_args args;
+    args.insert({DNNL_ARG_SRC,
+            make_dnnl_memory(
+                    src_md_, p_engine_, inputs[src_idx_].get_data_handle())});
+    args.insert({DNNL_ARG_WEIGHTS,
+            make_dnnl_memory(
+                    wei_md_, p_engine_, inputs[wei_idx_].get_data_handle())});
+    if (with_bias_)
+        args.insert({DNNL_ARG_BIAS,
+                make_dnnl_memory(bias_md_, p_engine_,
+                        inputs[bias_idx_].get_data_handle())});
+    args.insert({DNNL_ARG_DST,
+            make_dnnl_memory(mm_dst_md_, p_engine_, buffer)});
+    args.insert({DNNL_ARG_SCRATCHPAD,
+            make_dnnl_memory(
+                    scratchpad_md_, p_engine_, buffer + mm_dst_size_)});
+    matmul_.execute(p_stream, args);
+
+    const float *mm_dst = reinterpret_cast<const float *>(buffer);
+    const float divisor = *static_cast<const float *>(
+            inputs[divisor_idx_].get_data_handle());
+    char *dst = static_cast<char *>(outputs[dst_idx_].get_data_handle());
+    float *scales = with_scales_output_
+            ? static_cast<float *>(outputs[scales_idx_].get_data_handle())
+            : nullptr;
+    const dim_t ngroups = channels_ / group_;
+    const int nrow_dims = static_cast<int>(row_dims_.size());
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+#endif
+    parallel_nd(rows_, ngroups, [&](dim_t r, dim_t g) {
+        dim_t dst_off = 0, scales_off = 0;
+        dim_t rem = r;
+        for (int d = nrow_dims - 1; d >= 0; --d) {
+            const dim_t idx = rem % row_dims_[d];
+            rem /= row_dims_[d];
+            dst_off += idx * dst_strides_[d];
+            if (scales) scales_off += idx * scales_strides_[d];
+        }
+
+        const float *src = mm_dst + r * channels_ + g * group_;
+        float amax = 0.f;
+        for (dim_t i = 0; i < group_; ++i)
+            amax = nstl::max(amax, std::fabs(src[i]));
+        const float scale = amax / divisor;
+        if (scales) scales[scales_off + g * scales_group_stride_] = scale;
+        const float inv_scale = scale != 0.f ? 1.f / scale : 0.f;
+
+        dst_off += g * group_ * dst_channel_stride_;
+        switch (dst_dt_) {
+            case memory::data_type::s8:
+                quantize_group(src, group_, inv_scale,
+                        reinterpret_cast<int8_t *>(dst) + dst_off,
+                        dst_channel_stride_);
+                break;
+            case memory::data_type::u8:
+                quantize_group(src, group_, inv_scale,
+                        reinterpret_cast<uint8_t *>(dst) + dst_off,
+                        dst_channel_stride_);
+                break;
+            default:
+                quantize_group_int4(src, group_, inv_scale,
+                        dst_dt_ == memory::data_type::s4,
+                        reinterpret_cast<uint8_t *>(dst) + dst_off / 2);
+                break;
+        }
+    });
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_KV_QUANTIZE_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_KV_QUANTIZE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Kernel for the KV cache write pattern: a K/V projection matmul followed by
+// a dynamic quantization whose per-token or per-group scales are computed
+// from the absolute maximum of the projection output.
+//
+// The matmul output is kept in a temporary buffer and quantized in a single
+// pass which computes the scale of each group and writes both the quantized
+// values and the scales through the strides of the partition outputs. A cache
+// slot at any position can be targeted by passing outputs which alias the
+// preallocated cache with its strides.
+struct kv_quantize_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    dnnl::matmul matmul_;
+    memory::desc src_md_, wei_md_, bias_md_, mm_dst_md_, scratchpad_md_;
+
+    // Indices of the partition inputs and outputs used by the kernel.
+    size_t src_idx_ = 0, wei_idx_ = 0, bias_idx_ = 0, divisor_idx_ = 0;
+    size_t dst_idx_ = 0, scales_idx_ = 0;
+    bool with_bias_ = false, with_scales_output_ = false;
+
+    // The quantized tensor is viewed as rows of channels_ elements split in
+    // groups of group_ elements, each with its own scale.
+    dims row_dims_;
+    dims dst_strides_, scales_strides_;
+    dim_t rows_ = 0, channels_ = 0, group_ = 0;
+    dim_t dst_channel_stride_ = 0, scales_group_stride_ = 0;
+    memory::data_type dst_dt_ = memory::data_type::undef;
+
+    size_t mm_dst_size_ = 0;
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+    size_t get_internal_temporary_size() const override {
+        return mm_dst_size_ + scratchpad_md_.get_size();
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(kv_quantize_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -307,6 +307,11 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
         }
     }
 
+    return execute_ops(p_stream, res);
+}
+
+status_t larger_partition_kernel_t::execute_ops(
+        const dnnl::stream &p_stream, execution_args_set_t *res) {
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
         if (subgraph_->is_constant_[i]) continue;
         subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
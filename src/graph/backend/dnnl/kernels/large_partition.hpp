@@ -44,7 +44,6 @@ protected:
     allocator_t *g_alloc_ = nullptr;
 
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
@@ -94,6 +93,11 @@ public:
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override;
 
+    // Executes the non-constant ops of the compiled subgraph once all the
+    // arguments in `res` are bound to their buffers.
+    virtual status_t execute_ops(
+            const dnnl::stream &p_stream, execution_args_set_t *res);
+
 #ifdef DNNL_WITH_SYCL
     status_t sycl_execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -43,7 +43,6 @@ struct logsoftmax_fwd_t : public kernel_base_t {
 private:
     allocator_t *g_alloc_ = nullptr;
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
 public:
@@ -102,7 +101,6 @@ private:
     allocator_t *g_alloc_ = nullptr;
 
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
@@ -77,6 +77,10 @@ public:
 #endif
     }
 
+    size_t get_internal_temporary_size() const override {
+        return kernel->get_internal_temporary_size();
+    }
+
     status_t execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override {
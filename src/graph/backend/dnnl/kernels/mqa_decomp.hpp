@@ -49,7 +49,6 @@ private:
     // used for mqa internal memory planning
     registry_t mqa_registry_;
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
     subgraph_visualizer_t vis_;
 
     // MQA-related params
@@ -76,6 +75,10 @@ public:
             const size_t block_size,
             std::unordered_map<dnnl_memory_t, std::vector<memory>> &mem_map);
 
+    size_t get_internal_temporary_size() const override {
+        return mqa_registry_.size() * mqa_cfg_.nthr;
+    }
+
     status_t execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override;
@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <numeric>
+
+#include "common/bfloat16.hpp"
+#include "common/float16.hpp"
+#include "common/nstl.hpp"
+
 #include "graph/backend/dnnl/kernels/sdp_decomp.hpp"
 
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
@@ -36,6 +43,43 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+
+namespace {
+
+// Returns the number of leading kv tokens which are not masked off by an
+// additive attention mask in at least one query row. Masked off tokens hold
+// -inf or the lowest value of the data type and don't contribute to the
+// softmax, so they can be skipped. A row masking off all the tokens gets a
+// uniform softmax over the full length, which is returned as well as soon as
+// the length exceeds max_len.
+template <typename T>
+dim_t get_valid_kv_len(const T *mask, dim_t rows, dim_t cols,
+        dim_t row_stride, dim_t col_stride, dim_t max_len) {
+    const float lowest = static_cast<float>(nstl::numeric_limits<T>::lowest());
+    const auto is_valid = [&](dim_t r, dim_t c) {
+        return !(static_cast<float>(mask[r * row_stride + c * col_stride])
+                <= lowest);
+    };
+    dim_t len = 0;
+    for (dim_t r = 0; r < rows; r++) {
+        dim_t c = cols - 1;
+        while (c >= len && !is_valid(r, c))
+            c--;
+        if (c >= len) {
+            len = c + 1;
+            if (len > max_len) return cols;
+            continue;
+        }
+        bool has_valid = false;
+        for (c = 0; c < len && !has_valid; c++)
+            has_valid = is_valid(r, c);
+        if (!has_valid) return cols;
+    }
+    return len == 0 ? cols : len;
+}
+
+} // namespace
+
 template <bool quantized, memory::data_type dt>
 status_t sdp_decomp_kernel_t<quantized, dt>::compile_impl(
         const dnnl_partition_impl_t *part, const engine_t *g_engine,
@@ -200,11 +244,33 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
         return memory::data_type_size(m.get_desc().get_data_type());
     };
 
-    const auto loop = [&](int tid, int nthr, dim_t bo, dim_t bi) {
+    const size_t group_head = sdp_cfg_.num_head_q / sdp_cfg_.num_head_kv;
+    const tensor_t &mask_input = sdp_cfg_.has_attention_mask
+            ? inputs[sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_add]]
+            : inputs[0];
+    const auto mask_strides = ltw(mask_input.get_logical_tensor()).vstrides();
+    const auto mask_dims = ltw(mask_input.get_logical_tensor()).vdims();
+    const auto get_mask_offset = [&](dim_t bo, dim_t bi) {
+        size_t mask_offset = 0;
+        if (mask_dims.size() == 4) {
+            if (mask_dims[0] != 1) mask_offset += bo * mask_strides[0];
+            if (mask_dims[1] != 1) mask_offset += bi * mask_strides[1];
+        } else if (mask_dims.size() == 5) {
+            if (mask_dims[0] != 1) mask_offset += bo * mask_strides[0];
+            if (mask_dims[1] != 1)
+                mask_offset += bi / group_head * mask_strides[1];
+            if (mask_dims[2] != 1)
+                mask_offset += bi % group_head * mask_strides[2];
+        }
+        return mask_offset;
+    };
+
+    // bucket is the kv length bucket to execute, nullptr for the full length.
+    const auto loop = [&](int tid, dim_t bo, dim_t bi,
+                              const sdp_decomp_config_t::kv_bucket_t *bucket) {
         // prepare execution args and allocate real memory
         prepare_sub_args(var_grantor, tid, block_size, res->mem_map);
 
-        const size_t group_head = sdp_cfg_.num_head_q / sdp_cfg_.num_head_kv;
         const size_t wei_head_offset = bi / group_head;
         const size_t group_id = bi % group_head;
 
@@ -239,25 +305,10 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
             auto &sub_mm1_post_add_tid
                     = res->mem_map[sdp_cfg_.sub_mm1_post_mem[start_index++]
                                            .get()][tid];
-            const auto &mask_input = inputs
-                    [sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_add]];
-            const auto mask_strides
-                    = ltw(mask_input.get_logical_tensor()).vstrides();
-            const auto mask_dims = ltw(mask_input.get_logical_tensor()).vdims();
-            size_t mask_offset = 0;
-            if (mask_dims.size() == 4) {
-                if (mask_dims[0] != 1) mask_offset += bo * mask_strides[0];
-                if (mask_dims[1] != 1) mask_offset += bi * mask_strides[1];
-            } else if (mask_dims.size() == 5) {
-                if (mask_dims[0] != 1) mask_offset += bo * mask_strides[0];
-                if (mask_dims[1] != 1)
-                    mask_offset += wei_head_offset * mask_strides[1];
-                if (mask_dims[2] != 1)
-                    mask_offset += group_id * mask_strides[2];
-            }
             sub_mm1_post_add_tid.set_data_handle(
                     static_cast<char *>(mask_input.get_data_handle())
-                    + mask_offset * get_mem_dt_size(sub_mm1_post_add_tid));
+                    + get_mask_offset(bo, bi)
+                            * get_mem_dt_size(sub_mm1_post_add_tid));
         }
         if (sdp_cfg_.has_select) {
             auto &sub_select_cond_tid
@@ -369,24 +420,119 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
                     dst2_user_pointer + sub_dst_user_offset);
         }
 
+        const auto &sub_reorder1
+                = bucket ? bucket->sub_reorder1 : sdp_cfg_.sub_reorder1;
+        const auto &sub_mm1_prim
+                = bucket ? bucket->sub_mm1_prim : sdp_cfg_.sub_mm1_prim;
+        const auto &sub_softmax_prim
+                = bucket ? bucket->sub_softmax_prim : sdp_cfg_.sub_softmax_prim;
+        const auto &sub_reorder2
+                = bucket ? bucket->sub_reorder2 : sdp_cfg_.sub_reorder2;
+        const auto &sub_mm2_prim
+                = bucket ? bucket->sub_mm2_prim : sdp_cfg_.sub_mm2_prim;
+
         // in parallel region - these primitives should use single thread.
         sdp_cfg_.sub_reorder0.execute(strm, res->sub_reorder0_args[tid]);
-        sdp_cfg_.sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
-        sdp_cfg_.sub_mm1_prim.execute(strm, res->sub_mm1_args[tid]);
+        sub_reorder1.execute(strm, res->sub_reorder1_args[tid]);
+        sub_mm1_prim.execute(strm, res->sub_mm1_args[tid]);
         if (sdp_cfg_.has_select)
             sdp_cfg_.sub_select_prim.execute(strm, res->sub_select_args[tid]);
-        sdp_cfg_.sub_softmax_prim.execute(strm, res->sub_softmax_args[tid]);
+        sub_softmax_prim.execute(strm, res->sub_softmax_args[tid]);
 
-        sdp_cfg_.sub_reorder2.execute(strm, res->sub_reorder2_args[tid]);
+        sub_reorder2.execute(strm, res->sub_reorder2_args[tid]);
 
-        sdp_cfg_.sub_mm2_prim.execute(strm, res->sub_mm2_args[tid]);
+        sub_mm2_prim.execute(strm, res->sub_mm2_args[tid]);
         sdp_cfg_.sub_reorder3.execute(strm, res->sub_reorder3_args[tid]);
     };
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     tp_stream->before_exec_hook();
 #endif
 
-    parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, loop);
+    // Find the kv length bucket of each job from the padded tokens of the
+    // attention mask.
+    const auto &kv_buckets = sdp_cfg_.kv_buckets;
+    std::vector<int> job_bucket;
+    if (!kv_buckets.empty()) {
+        job_bucket.resize(MBO * MBI, -1);
+        const dim_t rows = mask_dims[mask_dims.size() - 2];
+        const dim_t row_stride = mask_strides[mask_strides.size() - 2];
+        const dim_t col_stride = mask_strides.back();
+        const dim_t max_len = kv_buckets.back().seq_len_kv;
+        parallel_nd(MBO, MBI, [&](dim_t bo, dim_t bi) {
+            const auto mask_dt = mask_input.get_logical_tensor().data_type;
+            const char *mask
+                    = static_cast<const char *>(mask_input.get_data_handle())
+                    + get_mask_offset(bo, bi)
+                            * memory::data_type_size(
+                                    static_cast<memory::data_type>(mask_dt));
+            dim_t len = sdp_cfg_.seq_len_kv;
+            switch (mask_dt) {
+                case graph::data_type::f32:
+                    len = get_valid_kv_len(
+                            reinterpret_cast<const float *>(mask), rows,
+                            sdp_cfg_.seq_len_kv, row_stride, col_stride,
+                            max_len);
+                    break;
+                case graph::data_type::bf16:
+                    len = get_valid_kv_len(
+                            reinterpret_cast<const bfloat16_t *>(mask), rows,
+                            sdp_cfg_.seq_len_kv, row_stride, col_stride,
+                            max_len);
+                    break;
+                case graph::data_type::f16:
+                    len = get_valid_kv_len(
+                            reinterpret_cast<const float16_t *>(mask), rows,
+                            sdp_cfg_.seq_len_kv, row_stride, col_stride,
+                            max_len);
+                    break;
+                default: break;
+            }
+            for (size_t k = 0; k < kv_buckets.size(); k++) {
+                if (kv_buckets[k].seq_len_kv < len) continue;
+                job_bucket[bo * MBI + bi] = static_cast<int>(k);
+                break;
+            }
+        });
+    }
+
+    if (std::all_of(job_bucket.begin(), job_bucket.end(),
+                [](int k) { return k < 0; })) {
+        parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI,
+                [&](int tid, int nthr, dim_t bo, dim_t bi) {
+                    loop(tid, bo, bi, nullptr);
+                });
+    } else {
+        // The work is partitioned by actual tokens: the jobs are sorted by
+        // decreasing kv length and each is assigned to the least loaded
+        // thread.
+        const auto job_len = [&](dim_t j) {
+            return job_bucket[j] < 0 ? sdp_cfg_.seq_len_kv
+                                     : kv_buckets[job_bucket[j]].seq_len_kv;
+        };
+        std::vector<dim_t> jobs(MBO * MBI);
+        std::iota(jobs.begin(), jobs.end(), 0);
+        std::stable_sort(jobs.begin(), jobs.end(), [&](dim_t a, dim_t b) {
+            return job_len(a) > job_len(b);
+        });
+        const int nthr = sdp_cfg_.nthr;
+        std::vector<std::vector<dim_t>> thr_jobs(nthr);
+        std::vector<dim_t> thr_load(nthr, 0);
+        for (const dim_t j : jobs) {
+            const auto t = std::min_element(thr_load.begin(), thr_load.end())
+                    - thr_load.begin();
+            thr_jobs[t].push_back(j);
+            thr_load[t] += job_len(j);
+        }
+        parallel(nthr, [&](int ithr, int nthr_) {
+            for (int t = ithr; t < nthr; t += nthr_) {
+                for (const dim_t j : thr_jobs[t]) {
+                    const int k = job_bucket[j];
+                    loop(ithr, j / MBI, j % MBI,
+                            k < 0 ? nullptr : &kv_buckets[k]);
+                }
+            }
+        });
+    }
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     tp_stream->after_exec_hook();
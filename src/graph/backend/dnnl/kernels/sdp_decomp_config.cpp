@@ -335,6 +335,79 @@ impl::status_t sdp_decomp_config_t::construct_params(
     auto sub_reorder3_pd = reorder::primitive_desc(
             p_engine, sub_dst_md, p_engine, sub_dst_user_md, sub_reorder3_attr);
     sub_reorder3.init(sub_reorder3_pd);
+
+    // kv length buckets: same primitives with a shorter kv sequence
+    std::vector<memory::desc> kv_bucket_scratchpads;
+    kv_buckets.clear();
+    for (const dim_t kv_len : get_kv_bucket_lens(inputs)) {
+        kv_bucket_t bucket;
+        bucket.seq_len_kv = kv_len;
+
+        const memory::desc kv_wei1_user_md(
+                {head_size_qk, kv_len}, dt_wei_user,
+                {wei1_strides[second_last_dim], wei1_strides[last_dim]});
+        const memory::desc kv_wei1_md(
+                {head_size_qk, kv_len}, dt_wei, format_tag::ba);
+        auto kv_reorder1_pd = reorder::primitive_desc(p_engine,
+                kv_wei1_user_md, p_engine, kv_wei1_md, sub_reorder1_attr);
+        bucket.sub_reorder1.init(kv_reorder1_pd);
+
+        // the attention mask is read through its strides, only its kv
+        // dimension shrinks
+        dnnl::post_ops kv_mm1_pops;
+        const auto mm1_pops = sub_matmul1_attr.get_post_ops();
+        for (int i = 0; i < mm1_pops.len(); i++) {
+            if (mm1_pops.kind(i) == primitive::kind::binary) {
+                algorithm alg;
+                memory::desc post_md;
+                mm1_pops.get_params_binary(i, alg, post_md);
+                const auto post_dims = post_md.get_dims();
+                if (post_dims[1] == seq_len_kv)
+                    post_md = memory::desc({post_dims[0], kv_len},
+                            post_md.get_data_type(), post_md.get_strides());
+                kv_mm1_pops.append_binary(alg, post_md);
+            } else {
+                algorithm alg;
+                float alpha, beta;
+                mm1_pops.get_params_eltwise(i, alg, alpha, beta);
+                kv_mm1_pops.append_eltwise(alg, alpha, beta);
+            }
+        }
+        dnnl::primitive_attr kv_mm1_attr = make_primitive_attr(sdp_op[1], mgr);
+        kv_mm1_attr.set_post_ops(kv_mm1_pops);
+        const memory::desc kv_mm1_dst_md(
+                {seq_len_q, kv_len}, dt_inter, format_tag::ab);
+        auto kv_mm1_pd = matmul::primitive_desc(p_engine, sub_mm1_src_md,
+                kv_wei1_md, kv_mm1_dst_md, kv_mm1_attr);
+        bucket.sub_mm1_prim = matmul(kv_mm1_pd);
+
+        const memory::desc kv_softmax_dst_md(
+                {seq_len_q, kv_len}, dt_src_user, format_tag::ab);
+        auto kv_softmax_pd = softmax_forward::primitive_desc(p_engine,
+                prop_kind::forward_inference, algo, kv_mm1_dst_md,
+                kv_softmax_dst_md, 1, sub_softmax_attr);
+        bucket.sub_softmax_prim = softmax_forward(kv_softmax_pd);
+
+        const memory::desc kv_wei2_user_md({kv_len, head_size_v}, dt_wei_user,
+                {wei2_strides[second_last_dim], wei2_strides[last_dim]});
+        const memory::desc kv_wei2_md(
+                {kv_len, head_size_v}, dt_wei, format_tag::ab);
+        auto kv_reorder2_pd = reorder::primitive_desc(p_engine,
+                kv_wei2_user_md, p_engine, kv_wei2_md, sub_reorder2_attr);
+        bucket.sub_reorder2.init(kv_reorder2_pd);
+
+        auto kv_mm2_pd = matmul::primitive_desc(p_engine, kv_softmax_dst_md,
+                kv_wei2_md, sub_mm2_dst_md, sub_matmul2_attr);
+        bucket.sub_mm2_prim = matmul(kv_mm2_pd);
+
+        kv_bucket_scratchpads.insert(kv_bucket_scratchpads.end(),
+                {kv_reorder1_pd.scratchpad_desc(),
+                        kv_mm1_pd.scratchpad_desc(),
+                        kv_softmax_pd.scratchpad_desc(),
+                        kv_reorder2_pd.scratchpad_desc(),
+                        kv_mm2_pd.scratchpad_desc()});
+        kv_buckets.emplace_back(std::move(bucket));
+    }
     ////////////////////////////////////////////////////////////////////////
     /////////////// End Creating primitives ////////////////////////////////
     ////////////////////////////////////////////////////////////////////////
@@ -345,11 +418,12 @@ impl::status_t sdp_decomp_config_t::construct_params(
     memory::desc max_scratchpad_md, sub_max_src1_src2_md, sub_max_dst1_wei2_md;
     size_t max_scratchpad_size = 0;
     // all the scratchpads required by the primitives.
-    const std::vector<memory::desc> scratchpads {
-            sub_reorder0_pd.scratchpad_desc(),
+    std::vector<memory::desc> scratchpads {sub_reorder0_pd.scratchpad_desc(),
             sub_reorder1_pd.scratchpad_desc(), sub_mm1_pd.scratchpad_desc(),
             sub_softmax_pd.scratchpad_desc(), sub_reorder2_pd.scratchpad_desc(),
             sub_mm2_pd.scratchpad_desc(), sub_reorder3_pd.scratchpad_desc()};
+    scratchpads.insert(scratchpads.end(), kv_bucket_scratchpads.begin(),
+            kv_bucket_scratchpads.end());
 
     for (auto &sp : scratchpads) {
         const size_t size = sp.get_size();
@@ -482,6 +556,30 @@ impl::status_t sdp_decomp_config_t::construct_params(
     return status::success;
 }
 
+std::vector<dim_t> sdp_decomp_config_t::get_kv_bucket_lens(
+        const std::vector<logical_tensor_t> &inputs) const {
+    // The padded tokens are found from an additive mask with a kv dimension,
+    // a select in the pattern may also drop tokens so it's not supported.
+    if (!has_attention_mask || has_select) return {};
+    const auto &mask = inputs[graph_inport[mm1_add]];
+    if (ltw(mask).vdims().back() != seq_len_kv
+            || !impl::utils::one_of(ltw(mask).data_type(), data_type::f32,
+                    data_type::bf16, data_type::f16))
+        return {};
+
+    // Evenly spaced lengths, at least min_step tokens apart.
+    constexpr dim_t max_buckets = 8, min_step = 64, len_align = 16;
+    const dim_t nbuckets = std::min(max_buckets, seq_len_kv / min_step);
+    std::vector<dim_t> lens;
+    for (dim_t i = 1; i < nbuckets; i++) {
+        const dim_t len = impl::utils::rnd_up(
+                impl::utils::div_up(seq_len_kv * i, nbuckets), len_align);
+        if (len < seq_len_kv && (lens.empty() || len > lens.back()))
+            lens.push_back(len);
+    }
+    return lens;
+}
+
 op_ptr sdp_decomp_config_t::get_post_op(const op_ptr &op) const {
     const auto out_val = op->get_output_value(0);
     const auto &consumers = out_val->get_consumers();
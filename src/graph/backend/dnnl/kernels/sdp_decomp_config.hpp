@@ -135,6 +135,21 @@ public:
     // shared memory
     memory sub_max_src1_src2, sub_max_dst1_wei2;
 
+    // Primitives created for shorter kv sequence lengths. With continuous
+    // batching, the kv sequences of a batch are padded to the longest one
+    // and the padding is removed by the attention mask. When the mask drops
+    // the tail of the kv sequence of a batch, the shortest bucket covering
+    // the remaining tokens is executed instead of the full length
+    // primitives. The buckets share the memory objects of the full length
+    // primitives: the buffers are large enough and the strides are kept.
+    struct kv_bucket_t {
+        dim_t seq_len_kv = 0;
+        sdp_reorder_t sub_reorder1, sub_reorder2;
+        primitive sub_mm1_prim, sub_softmax_prim, sub_mm2_prim;
+    };
+    // Sorted by increasing kv sequence length, all shorter than seq_len_kv.
+    std::vector<kv_bucket_t> kv_buckets;
+
     bool has_scale = false, has_attention_mask = false, has_select = false,
          has_soft_capping = false;
     // Used to record the ops from select
@@ -176,6 +191,11 @@ private:
 
     void memory_planning(registry_t &sdp_registry);
 
+    // Returns the kv sequence lengths of the buckets, empty if the attention
+    // mask can't be used to skip the padded tokens.
+    std::vector<dim_t> get_kv_bucket_lens(
+            const std::vector<logical_tensor_t> &inputs) const;
+
     impl::status_t prepare_sdp_scales_zps(const fusion_info_mgr_t &mgr,
             std::shared_ptr<op_t> &op, int index,
             std::unordered_map<int, memory> &args,
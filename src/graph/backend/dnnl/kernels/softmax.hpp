@@ -43,7 +43,6 @@ struct softmax_fwd_t : public kernel_base_t {
 private:
     allocator_t *g_alloc_ = nullptr;
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
     size_t const_md_hash_ = 0;
@@ -104,7 +103,6 @@ private:
     allocator_t *g_alloc_ = nullptr;
 
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
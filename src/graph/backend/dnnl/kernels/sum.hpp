@@ -44,7 +44,6 @@ private:
     allocator_t *g_alloc_ = nullptr;
 
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     // function to create execution arguments for primitive
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
@@ -657,6 +657,16 @@ struct conv_fwd_executable_t : public op_executable_t {
     }
 #endif
 
+    dnnl::convolution_forward::primitive_desc get_primitive_desc() const {
+        dnnl_primitive_desc_t pd = nullptr;
+        dnnl::error::wrap_c_api(
+                dnnl_primitive_desc_clone(&pd, prim_.get_primitive_desc()),
+                "could not clone a primitive descriptor");
+        return dnnl::convolution_forward::primitive_desc(pd);
+    }
+
+    bool with_sum() const { return with_sum_; }
+
 private:
     dnnl::convolution_forward prim_;
     bool with_sum_ {false};
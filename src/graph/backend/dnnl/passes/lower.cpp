@@ -487,6 +487,46 @@ static status_t static_dequant_handler(
     return status::success;
 }
 
+// Checks the scales shape of a group (de)quantization op and returns the mask
+// of the dimensions being grouped.
+static status_t get_group_mask(const std::shared_ptr<op_t> &cur_op,
+        const value_ptr &src, const value_ptr &scales, int64_t &group_mask) {
+    const auto &group_shape
+            = cur_op->get_attr<std::vector<int64_t>>(op_attr::group_shape);
+    const auto src_lt = src->get_logical_tensor();
+    const auto scale_lt = scales->get_logical_tensor();
+
+    const auto ndims = ltw(src_lt).ndims();
+    VCHECK_INVALID_ARGUMENT((static_cast<size_t>(ndims) == group_shape.size()),
+            "group shape size should match the number of dimensions of "
+            "src");
+    const auto &src_dims = ltw(src_lt).vdims();
+    const auto &scale_dims = ltw(scale_lt).vdims();
+
+    for (int idx = 0; idx < ndims - 2; ++idx) {
+        VCHECK_INVALID_ARGUMENT((src_dims[idx] == scale_dims[idx]),
+                "the scale shape should match the input shape on the "
+                "dimensions where no quantization is applied");
+    }
+
+    group_mask = 0;
+    for (int idx = 0; idx < ndims; ++idx) {
+        VCHECK_INVALID_ARGUMENT(
+                (src_dims[idx] == scale_dims[idx] * group_shape[idx]),
+                "unsupported scale shape and group shape on dimension %d, "
+                "src dim: %d, scale shape: %d, group shape: %d",
+                idx, static_cast<int>(src_dims[idx]),
+                static_cast<int>(scale_dims[idx]),
+                static_cast<int>(group_shape[idx]));
+
+        if (group_shape[idx] != 1) {
+            group_mask += 1ULL << idx;
+            //Currently group quantization only happens on one dimension
+        }
+    }
+    return status::success;
+}
+
 static status_t dynamic_quant_handler(
         const std::shared_ptr<op_t> &cur_op, subgraph_rewriter_t &rewriter) {
     const auto &qtype = cur_op->get_attr<std::string>(op_attr::qtype);
@@ -502,10 +542,16 @@ static status_t dynamic_quant_handler(
 
     // DynamicQuantize has optional zps
     bool has_zps = in_vals.size() == 3;
+    bool is_group_quantization = (qtype == "per_group");
 
     value_ptr src = in_vals[0], scales = in_vals[1], dst = out_vals[0], zps;
     if (has_zps) zps = in_vals[2];
 
+    int64_t group_mask = 0;
+    if (is_group_quantization) {
+        CHECK(get_group_mask(cur_op, src, scales, group_mask));
+    }
+
     // int8 = f32 / scales + zps
     op_ptr mul_scales = std::make_shared<op_t>(op_kind::dnnl_mul_scales);
 
@@ -513,6 +559,11 @@ static status_t dynamic_quant_handler(
     scales->remove_consumer(*cur_op, 1);
     mul_scales->set_attr<int64_t>(op_attr::axis, axis);
     mul_scales->set_attr<std::string>(op_attr::qtype, qtype);
+    if (is_group_quantization) {
+        mul_scales->set_attr<std::vector<int64_t>>(op_attr::group_shape,
+                cur_op->get_attr<std::vector<int64_t>>(op_attr::group_shape));
+        mul_scales->set_attr<int64_t>(op_attr::group_mask, group_mask);
+    }
     mul_scales->set_attr<bool>(op_attr::with_runtime_scales, true);
 
     // connect mul_scales to subgraph
@@ -537,6 +588,12 @@ static status_t dynamic_quant_handler(
         zps->remove_consumer(*cur_op, 2);
         add_zps->set_attr<int64_t>(op_attr::axis, axis);
         add_zps->set_attr<std::string>(op_attr::qtype, qtype);
+        if (is_group_quantization) {
+            add_zps->set_attr<std::vector<int64_t>>(op_attr::group_shape,
+                    cur_op->get_attr<std::vector<int64_t>>(
+                            op_attr::group_shape));
+            add_zps->set_attr<int64_t>(op_attr::group_mask, group_mask);
+        }
         add_zps->set_attr<bool>(op_attr::with_runtime_zps, true);
 
         // connect add_zps to subgraph
@@ -570,40 +627,7 @@ static status_t dynamic_dequant_handler(
 
     int64_t group_mask = 0;
     if (is_group_quantization) {
-
-        const auto &group_shape
-                = cur_op->get_attr<std::vector<int64_t>>(op_attr::group_shape);
-        const auto src_lt = src->get_logical_tensor();
-        const auto scale_lt = scales->get_logical_tensor();
-
-        const auto ndims = ltw(src_lt).ndims();
-        VCHECK_INVALID_ARGUMENT(
-                (static_cast<size_t>(ndims) == group_shape.size()),
-                "group shape size should match the number of dimensions of "
-                "src");
-        const auto &src_dims = ltw(src_lt).vdims();
-        const auto &scale_dims = ltw(scale_lt).vdims();
-
-        for (int idx = 0; idx < ndims - 2; ++idx) {
-            VCHECK_INVALID_ARGUMENT((src_dims[idx] == scale_dims[idx]),
-                    "the scale shape should match the input shape on the "
-                    "dimensions where no quantization is applied");
-        }
-
-        for (int idx = 0; idx < ndims; ++idx) {
-            VCHECK_INVALID_ARGUMENT(
-                    (src_dims[idx] == scale_dims[idx] * group_shape[idx]),
-                    "unsupported scale shape and group shape on dimension %d, "
-                    "src dim: %d, scale shape: %d, group shape: %d",
-                    idx, static_cast<int>(src_dims[idx]),
-                    static_cast<int>(scale_dims[idx]),
-                    static_cast<int>(group_shape[idx]));
-
-            if (group_shape[idx] != 1) {
-                group_mask += 1ULL << idx;
-                //Currently group quantization only happens on one dimension
-            }
-        }
+        CHECK(get_group_mask(cur_op, src, scales, group_mask));
     }
 
     const int64_t scales_data_type = scales->get_logical_tensor().data_type;
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "graph/backend/dnnl/kernels/kv_quantize.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/matmul.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
@@ -33,6 +34,36 @@ using in_edges_t = pm::in_edges_t;
 using pb_graph_t = pm::pb_graph_t;
 using FCreatePattern = graph::pass::FCreatePattern;
 
+namespace {
+
+// Appends the per-token or per-group scales computation and the dynamic
+// quantization of the matmul output for the KV cache write pattern.
+void append_kv_scales_and_quantize(const std::shared_ptr<pb_graph_t> &pgraph,
+        pm::pb_op_t *pmatmul, pm::pb_op_t *pabs, bool grouped) {
+    pm::pb_op_t *preduce = pgraph->append_op(
+            graph::op_kind::ReduceMax, in_edges_t {in_edge(0, pabs, 0)});
+    // grouped scales drop the reduced dimension to match the groups
+    if (grouped) {
+        preduce->append_decision_function([](op_t *op) -> bool {
+            return !op->has_attr(op_attr::keep_dims)
+                    || !op->get_attr<bool>(op_attr::keep_dims);
+        });
+    }
+    pm::pb_op_t *pdiv = pgraph->append_op(
+            graph::op_kind::Divide, in_edges_t {in_edge(0, preduce, 0)});
+    // the scales are also written into the cache
+    pdiv->allow_external_outputs();
+    pm::pb_op_t *pquant = pgraph->append_op(graph::op_kind::DynamicQuantize,
+            in_edges_t {in_edge(0, pmatmul, 0), in_edge(1, pdiv, 0)});
+    pquant->append_decision_function(check_input_num<2>);
+    pquant->append_decision_function([](op_t *op) -> bool {
+        return op->has_attr(op_attr::qtype)
+                && op->get_attr<std::string>(op_attr::qtype) == "per_group";
+    });
+}
+
+} // namespace
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(matmul_post_ops)
 
 /*
@@ -1025,6 +1056,56 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
             return std::make_shared<quantized_matmul>();
         });
 
+/*
+    KV cache write: the K/V projection is quantized with scales computed on
+    the fly from the absolute maximum of each token or each group of channels.
+    The quantized values and the scales are written into the preallocated cache
+    slots described by the strides of the partition outputs.
+
+                \     /
+                 matmul
+                /      \
+    [StaticReshape]*    |
+           |            |
+          abs           |
+           |            |
+       reduce_max       |
+           |            |
+         divide         |
+           |   \        |
+           |    dynamic_quantize
+           |            |
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, kv_cache_quantize_fusion)
+        .set_priority(10.7f)
+        .set_kind(partition_kind_t::quantized_matmul_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+                    pm::pb_op_t *pabs = pgraph->append_op(graph::op_kind::Abs,
+                            in_edges_t {in_edge(0, pmatmul, 0)});
+                    append_kv_scales_and_quantize(
+                            pgraph, pmatmul, pabs, false);
+                })
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+                    // split the channels into groups
+                    pm::pb_op_t *preshape
+                            = pgraph->append_op(graph::op_kind::StaticReshape,
+                                    in_edges_t {in_edge(0, pmatmul, 0)});
+                    pm::pb_op_t *pabs = pgraph->append_op(graph::op_kind::Abs,
+                            in_edges_t {in_edge(0, preshape, 0)});
+                    append_kv_scales_and_quantize(
+                            pgraph, pmatmul, pabs, true);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<kv_quantize_t>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
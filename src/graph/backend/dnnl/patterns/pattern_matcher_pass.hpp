@@ -17,6 +17,7 @@
 #ifndef GRAPH_BACKEND_DNNL_PATTERNS_PATTERN_MATCHER_PASS_HPP
 #define GRAPH_BACKEND_DNNL_PATTERNS_PATTERN_MATCHER_PASS_HPP
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -54,6 +55,32 @@ public:
 inline void pattern_utils_t::match(graph_t &backend_graph,
         std::shared_ptr<graph::utils::pm::pb_graph_t> pgraph,
         std::vector<std::vector<op_t *>> &fusion_ops) {
+    // With an op index, only visit the ops of the kinds the pattern starts
+    // from, in the same topological order as the full traversal.
+    std::vector<op_kind_t> root_kinds;
+    if (backend_graph.has_op_index() && pgraph->get_root_op_kinds(root_kinds)) {
+        std::sort(root_kinds.begin(), root_kinds.end());
+        root_kinds.erase(std::unique(root_kinds.begin(), root_kinds.end()),
+                root_kinds.end());
+
+        std::vector<std::pair<size_t, op_t *>> candidates;
+        for (op_kind_t kind : root_kinds) {
+            const auto &ops = backend_graph.get_indexed_ops(kind);
+            candidates.insert(candidates.end(), ops.begin(), ops.end());
+        }
+        if (root_kinds.size() > 1)
+            std::sort(candidates.begin(), candidates.end());
+
+        for (const auto &candidate : candidates) {
+            std::vector<op_t *> candidate_fusion;
+            if (!graph::utils::pm::match_pattern(
+                        candidate.second, pgraph, candidate_fusion))
+                continue;
+            fusion_ops.emplace_back(candidate_fusion);
+        }
+        return;
+    }
+
     // dfs_visit graph, do pattern matching
     topo_order_visit(backend_graph.get_output_ops(), [&](op_t *cur_op) {
         std::vector<op_t *> candidate_fusion;
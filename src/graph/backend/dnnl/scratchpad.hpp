@@ -21,6 +21,7 @@
 #include <unordered_map>
 
 #include "graph/interface/allocator.hpp"
+#include "graph/interface/memory_plan.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
 
@@ -43,7 +44,9 @@ public:
 };
 
 // The buffer is allocated when creating the temporary_scratchpad_t and
-// deallocated when destroying the temporary_scratchpad_t
+// deallocated when destroying the temporary_scratchpad_t. When the partition is
+// executed through a memory plan, the buffer is taken from the plan arena and
+// is not owned by the temporary_scratchpad_t.
 class temporary_scratchpad_t : public scratchpad_t {
 public:
     temporary_scratchpad_t(
@@ -56,7 +59,11 @@ public:
         , ocl_e_(nullptr)
 #endif
     {
-        if (size > 0) {
+        if (size > 0 && eng.get_kind() == dnnl::engine::kind::cpu) {
+            buffer_ = temporary_arena_t::acquire(size);
+            from_arena_ = buffer_ != nullptr;
+        }
+        if (size > 0 && !buffer_) {
             buffer_ = reinterpret_cast<char *>(dnnl_allocator_t::malloc(
                     size, eng, &alloc, allocator_t::mem_type_t::temp));
         }
@@ -64,7 +71,9 @@ public:
     }
 
     ~temporary_scratchpad_t() override {
-        if (eng_->get_kind() == dnnl::engine::kind::cpu) {
+        if (from_arena_) {
+            // The buffer belongs to the memory plan arena.
+        } else if (eng_->get_kind() == dnnl::engine::kind::cpu) {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
             dnnl_allocator_t::free(buffer_, *eng_, alloc_, e_);
 #else
@@ -103,6 +112,7 @@ private:
     size_t size_;
     const dnnl::engine *eng_;
     const allocator_t *alloc_;
+    bool from_arena_ = false;
 #ifdef DNNL_WITH_SYCL
     ::sycl::event e_;
 #endif
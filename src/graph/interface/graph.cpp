@@ -112,6 +112,21 @@ status_t dnnl_graph_graph::get_ordered_partitions(
     return ret;
 }
 
+status_t dnnl_graph_graph::build_op_index() {
+    clear_op_index();
+    size_t pos = 0;
+    auto ret = topo_order_visit(get_output_ops(), [&](op_t *op) {
+        op_index_[op->get_kind()].emplace_back(pos++, op);
+        return status::success;
+    });
+    if (ret != status::success) {
+        clear_op_index();
+        return ret;
+    }
+    has_op_index_ = true;
+    return status::success;
+}
+
 status_t dnnl_graph_graph::finalize() {
     // if the graph is already built, return directly.
     // TODO(xxx): actually we may need to a verification here.
@@ -83,6 +83,12 @@ private:
     /*! \brief num of ops that have not been partitioned */
     size_t num_unpartitioned_ops_ {0};
 
+    /*! \brief ops grouped by kind, in topological order */
+    std::unordered_map<graph::op_kind_t,
+            std::vector<std::pair<size_t, op_t *>>>
+            op_index_;
+    bool has_op_index_ {false};
+
 public:
     dnnl_graph_graph(graph::engine_kind_t kind = graph::engine_kind::cpu)
         : engine_kind_(kind) {
@@ -178,6 +184,32 @@ public:
     /*! \brief how many ops in the graph have not been partitioned */
     size_t num_unpartitioned_ops() const { return num_unpartitioned_ops_; }
 
+    /*!
+     * \brief Index the ops by kind. Every list of the index follows the
+     * topological order of the graph, so pattern matching can visit only
+     * the ops a pattern may start from. The index is not updated when ops
+     * are added or removed: it must be cleared before the graph changes.
+     */
+    graph::status_t build_op_index();
+
+    void clear_op_index() {
+        op_index_.clear();
+        has_op_index_ = false;
+    }
+
+    bool has_op_index() const { return has_op_index_; }
+
+    /*!
+     * \brief Get the indexed ops of a kind, each paired with its position in
+     * the topological order of the graph.
+     */
+    const std::vector<std::pair<size_t, op_t *>> &get_indexed_ops(
+            graph::op_kind_t kind) const {
+        static const std::vector<std::pair<size_t, op_t *>> empty;
+        auto it = op_index_.find(kind);
+        return it == op_index_.end() ? empty : it->second;
+    }
+
     /*!
      * \brief Get the output ops of this graph.
      * \return vector of output op pointers
@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <unordered_set>
+
+#include "oneapi/dnnl/dnnl_graph.h"
+
+#include "common/stream.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/logical_tensor.hpp"
+#include "graph/interface/memory_plan.hpp"
+#include "graph/interface/partition.hpp"
+#include "graph/interface/tensor.hpp"
+
+#include "graph/utils/utils.hpp"
+
+using namespace dnnl::impl::graph;
+
+namespace {
+
+thread_local temporary_arena_t *active_arena = nullptr;
+
+// A buffer that lives from step `first` to step `last` of the schedule.
+struct buffer_t {
+    size_t size;
+    size_t first;
+    size_t last;
+    size_t offset;
+
+    bool overlaps(const buffer_t &other) const {
+        return first <= other.last && other.first <= last;
+    }
+};
+
+// Assigns offsets to buffers so that buffers with overlapping lifetimes never
+// share memory. Buffers are placed from the largest one into the lowest gap
+// that fits, which keeps the arena close to the peak of live memory. Returns
+// the size of the arena.
+size_t assign_offsets(std::vector<buffer_t> &buffers, size_t alignment) {
+    std::vector<size_t> order(buffers.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return buffers[a].size > buffers[b].size;
+    });
+
+    size_t total = 0;
+    std::vector<const buffer_t *> placed, live;
+    for (size_t idx : order) {
+        auto &buf = buffers[idx];
+        live.clear();
+        for (const auto *p : placed)
+            if (p->overlaps(buf)) live.push_back(p);
+        std::sort(live.begin(), live.end(),
+                [](const buffer_t *a, const buffer_t *b) {
+                    return a->offset < b->offset;
+                });
+
+        size_t offset = 0;
+        for (const auto *p : live) {
+            if (offset + buf.size <= p->offset) break;
+            offset = std::max(offset,
+                    utils::rnd_up(p->offset + p->size, alignment));
+        }
+        buf.offset = offset;
+        total = std::max(total, offset + buf.size);
+        placed.push_back(&buf);
+    }
+
+    return utils::rnd_up(total, alignment);
+}
+
+} // namespace
+
+temporary_arena_t::temporary_arena_t(char *base, size_t size)
+    : base_(base), size_(size), prev_(active_arena) {
+    active_arena = this;
+}
+
+temporary_arena_t::~temporary_arena_t() {
+    active_arena = prev_;
+}
+
+char *temporary_arena_t::acquire(size_t size) {
+    auto *arena = active_arena;
+    if (!arena || !arena->base_ || arena->used_ + size > arena->size_)
+        return nullptr;
+
+    char *ptr = arena->base_ + arena->used_;
+    arena->used_ = utils::rnd_up(
+            arena->used_ + size, dnnl_graph_memory_plan::alignment);
+    return ptr;
+}
+
+status_t dnnl_graph_memory_plan::init(
+        const std::vector<const compiled_partition_t *> &schedule,
+        const std::vector<size_t> &output_ids) {
+    if (schedule.empty()) return status::invalid_arguments;
+    for (const auto *cp : schedule) {
+        if (!cp || !cp->is_initialized()) return status::invalid_arguments;
+        if (cp->get_engine() != schedule[0]->get_engine())
+            return status::invalid_arguments;
+    }
+
+    const std::unordered_set<size_t> user_managed(
+            output_ids.begin(), output_ids.end());
+
+    // Lifetimes of tensors produced inside the schedule.
+    std::unordered_map<size_t, buffer_t> tensors;
+    for (size_t step = 0; step < schedule.size(); step++) {
+        for (const auto &lt : schedule[step]->get_inputs()) {
+            auto it = tensors.find(lt.id);
+            if (it != tensors.end()) it->second.last = step;
+        }
+        for (const auto &lt : schedule[step]->get_outputs()) {
+            if (tensors.count(lt.id)) return status::invalid_arguments;
+            const size_t size = logical_tensor_wrapper_t(lt).size();
+            tensors.emplace(lt.id, buffer_t {size, step, step, 0});
+        }
+    }
+
+    std::vector<buffer_t> buffers;
+    std::vector<size_t> tensor_ids;
+    for (const auto &kv : tensors) {
+        const auto &buf = kv.second;
+        // Tensors that are not consumed inside the schedule are outputs of
+        // the model.
+        if (buf.last == buf.first || buf.size == 0) continue;
+        if (user_managed.count(kv.first)) continue;
+        tensor_ids.push_back(kv.first);
+        buffers.push_back(buf);
+    }
+    const size_t n_tensors = buffers.size();
+
+    for (size_t step = 0; step < schedule.size(); step++) {
+        const size_t size = schedule[step]->get_internal_temporary_size();
+        buffers.push_back(buffer_t {size, step, step, 0});
+    }
+
+    size_ = assign_offsets(buffers, alignment);
+
+    schedule_ = schedule;
+    tensor_offsets_.clear();
+    for (size_t i = 0; i < n_tensors; i++)
+        tensor_offsets_.emplace(tensor_ids[i], buffers[i].offset);
+    temporary_offsets_.resize(schedule.size());
+    temporary_sizes_.resize(schedule.size());
+    for (size_t step = 0; step < schedule.size(); step++) {
+        temporary_offsets_[step] = buffers[n_tensors + step].offset;
+        temporary_sizes_[step] = buffers[n_tensors + step].size;
+    }
+
+    return status::success;
+}
+
+status_t dnnl_graph_memory_plan::get_offset(size_t tid, size_t *offset) const {
+    auto it = tensor_offsets_.find(tid);
+    if (it == tensor_offsets_.end()) return status::invalid_arguments;
+    *offset = it->second;
+    return status::success;
+}
+
+status_t dnnl_graph_memory_plan::execute(size_t index, const stream_t *astream,
+        void *arena, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) const {
+    if (index >= schedule_.size()) return status::invalid_arguments;
+    if (size_ > 0 && !arena) return status::invalid_arguments;
+    if (reinterpret_cast<uintptr_t>(arena) % alignment != 0)
+        return status::invalid_arguments;
+    // The arena is host memory: device engines keep allocating temporaries
+    // with the engine allocator.
+    if (astream->engine()->kind() != engine_kind::cpu)
+        return status::unimplemented;
+
+    char *base = static_cast<char *>(arena);
+    const auto bind = [&](std::vector<tensor_t> &args) {
+        for (auto &t : args) {
+            if (t.get_data_handle() != nullptr) continue;
+            auto it = tensor_offsets_.find(t.get_logical_tensor().id);
+            if (it != tensor_offsets_.end())
+                t.set_data_handle(base + it->second);
+        }
+    };
+    std::vector<tensor_t> ins(inputs), outs(outputs);
+    bind(ins);
+    bind(outs);
+
+    temporary_arena_t temporaries(
+            base + temporary_offsets_[index], temporary_sizes_[index]);
+    return schedule_[index]->execute(astream, ins, outs);
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_create(memory_plan_t **memory_plan,
+        size_t num_partitions, const compiled_partition_t **partitions,
+        size_t num_output_ids, const size_t *output_ids) {
+    if (utils::any_null(memory_plan, partitions)
+            || (num_output_ids > 0 && output_ids == nullptr))
+        return status::invalid_arguments;
+
+    std::vector<const compiled_partition_t *> schedule(
+            partitions, partitions + num_partitions);
+    std::vector<size_t> ids;
+    if (num_output_ids > 0) ids.assign(output_ids, output_ids + num_output_ids);
+
+    auto plan = utils::make_unique<memory_plan_t>();
+    if (!plan) return status::out_of_memory;
+    CHECK(plan->init(schedule, ids));
+    *memory_plan = plan.release();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_destroy(memory_plan_t *memory_plan) {
+    delete memory_plan;
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_get_size(
+        const memory_plan_t *memory_plan, size_t *size) {
+    if (utils::any_null(memory_plan, size)) return status::invalid_arguments;
+    *size = memory_plan->get_size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_get_offset(
+        const memory_plan_t *memory_plan, size_t tid, size_t *offset) {
+    if (utils::any_null(memory_plan, offset)) return status::invalid_arguments;
+    return memory_plan->get_offset(tid, offset);
+}
+
+status_t DNNL_API dnnl_graph_memory_plan_execute(
+        const memory_plan_t *memory_plan, size_t index, stream_t *stream,
+        void *arena, size_t num_inputs, const tensor_t **inputs,
+        size_t num_outputs, const tensor_t **outputs) {
+    if (utils::any_null(memory_plan, stream, inputs, outputs))
+        return status::invalid_arguments;
+
+    std::vector<tensor_t> ins, outs;
+    ins.reserve(num_inputs);
+    outs.reserve(num_outputs);
+    for (size_t i = 0; i < num_inputs; ++i)
+        ins.emplace_back(*inputs[i]);
+    for (size_t i = 0; i < num_outputs; ++i)
+        outs.emplace_back(*outputs[i]);
+
+    return memory_plan->execute(index, stream, arena, ins, outs);
+}
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_MEMORY_PLAN_HPP
+#define GRAPH_INTERFACE_MEMORY_PLAN_HPP
+
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+
+#include "graph/interface/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// A region of a memory plan arena reserved for internal temporaries of the
+// compiled partition executed by the current thread. While a region is
+// active, backends take temporary buffers from it and fall back to the engine
+// allocator once it is exhausted.
+class temporary_arena_t {
+public:
+    temporary_arena_t(char *base, size_t size);
+    ~temporary_arena_t();
+
+    temporary_arena_t(const temporary_arena_t &) = delete;
+    temporary_arena_t &operator=(const temporary_arena_t &) = delete;
+
+    // Returns a buffer of `size` bytes from the active region of the current
+    // thread or nullptr if there is no active region or it has no room.
+    static char *acquire(size_t size);
+
+private:
+    char *base_;
+    size_t size_;
+    size_t used_ = 0;
+    temporary_arena_t *prev_;
+};
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+struct dnnl_graph_memory_plan {
+public:
+    // Offsets are aligned to this value relative to the arena base.
+    static constexpr size_t alignment = 64;
+
+    dnnl_graph_memory_plan() = default;
+
+    dnnl::impl::graph::status_t init(
+            const std::vector<const dnnl::impl::graph::compiled_partition_t *>
+                    &schedule,
+            const std::vector<size_t> &output_ids);
+
+    size_t get_size() const { return size_; }
+
+    dnnl::impl::graph::status_t get_offset(size_t tid, size_t *offset) const;
+
+    dnnl::impl::graph::status_t execute(size_t index,
+            const dnnl::impl::graph::stream_t *astream, void *arena,
+            const std::vector<dnnl::impl::graph::tensor_t> &inputs,
+            const std::vector<dnnl::impl::graph::tensor_t> &outputs) const;
+
+private:
+    std::vector<const dnnl::impl::graph::compiled_partition_t *> schedule_;
+    // Offsets of intermediate tensors, keyed by logical tensor id.
+    std::unordered_map<size_t, size_t> tensor_offsets_;
+    // Offsets and sizes of internal temporaries, one per schedule step.
+    std::vector<size_t> temporary_offsets_;
+    std::vector<size_t> temporary_sizes_;
+    size_t size_ = 0;
+};
+
+#endif
@@ -1287,10 +1287,13 @@ DNNL_GRAPH_OP_SCHEMA(DynamicQuantize, 1,
                 .set_attr(
                         op_attr::qtype, false, attribute_kind::s, "per_tensor")
                 .set_attr(op_attr::axis, false, attribute_kind::i, int64_t(1))
+                .set_attr(op_attr::group_shape, false, attribute_kind::is)
                 .set_type_constraints("T1", {data_type::f32})
                 .set_type_constraints(
                         "T2", {data_type::u8, data_type::s8, data_type::s32})
-                .set_type_constraints("T3", {data_type::u8, data_type::s8})
+                .set_type_constraints("T3",
+                        {data_type::u8, data_type::s8, data_type::s4,
+                                data_type::u4})
                 .set_shape_inference_function(infer_identity_output_shape)
                 .set_op_def_constraint_function(
                         check_dyn_quant_dequant_scales_zps))
@@ -206,6 +206,10 @@ public:
 
     const graph::engine_t *get_engine() const { return pimpl_->get_engine(); }
 
+    size_t get_internal_temporary_size() const {
+        return pimpl_->get_internal_temporary_size();
+    }
+
     std::vector<graph::logical_tensor_t> &get_mutable_inputs() {
         return pimpl_->get_mutable_inputs();
     }
@@ -286,6 +286,10 @@ public:
 
     virtual std::string str() const { return "n/a"; }
 
+    /// The size of the temporary buffer requested at each execution. It is
+    /// used by the memory plan to reserve space for it in the arena
+    virtual size_t get_internal_temporary_size() const { return 0; }
+
     /// The getters for engine_, which is used in C API implementation
     const engine_t *get_engine() const { return engine_; }
 
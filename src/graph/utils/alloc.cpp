@@ -16,6 +16,8 @@
 
 #include "graph/utils/alloc.hpp"
 
+#include "common/huge_pages.hpp"
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "graph/utils/ocl_usm_utils.hpp"
 #endif
@@ -59,24 +61,18 @@ void sycl_allocator_t::free(
 }
 #endif
 
+// The buffers of the default allocator, such as the cached constant tensors,
+// are owned by the library and follow the CPU huge pages policy.
 void *cpu_allocator_t::malloc(size_t size, size_t alignment) {
-    void *ptr = nullptr;
     const size_t align = alignment == 0 ? DEFAULT_ALIGNMENT : alignment;
-#ifdef _WIN32
-    ptr = _aligned_malloc(size, align);
-    int rc = ((ptr) ? 0 : errno);
-#else
-    int rc = ::posix_memalign(&ptr, align, size);
-#endif /* _WIN32 */
-    return (rc == 0) ? ptr : nullptr;
+    // The free() of the allocator doesn't know the buffer, the registry
+    // tells the tracked buffers apart.
+    bool is_tracked = false;
+    return impl::huge_pages::malloc(size, static_cast<int>(align), is_tracked);
 }
 
 void cpu_allocator_t::free(void *p) {
-#ifdef _WIN32
-    _aligned_free((void *)p);
-#else
-    ::free((void *)p);
-#endif /* _WIN32 */
+    impl::huge_pages::free(p);
 }
 
 } // namespace utils
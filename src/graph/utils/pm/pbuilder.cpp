@@ -254,28 +254,29 @@ pb_op_t *pb_graph_t::append_op(
 
 pb_op_t *pb_graph_t::append_op(
         dnnl::impl::graph::op_kind_t p_kind, const in_edges_t &p_in_edges) {
-    return append_op(kind(p_kind), p_in_edges,
+    pb_op_t *p_op = append_op(kind(p_kind), p_in_edges,
             dnnl::impl::graph::op_t::kind2str(p_kind)
                     + std::to_string(nodes_.size()));
+    if (p_kind != op_kind::Wildcard) p_op->op_kinds_ = {p_kind};
+    return p_op;
 }
 
 pb_op_t *pb_graph_t::append_op(dnnl::impl::graph::op_kind_t p_kind) {
-    return append_op(kind(p_kind), {},
-            dnnl::impl::graph::op_t::kind2str(p_kind)
-                    + std::to_string(nodes_.size()));
+    return append_op(p_kind, {});
 }
 
 pb_op_t *pb_graph_t::append_alternation(
         const std::vector<dnnl::impl::graph::op_kind_t> &p_kind,
         const in_edges_t &p_in_edges) {
-    return append_op(one_of_kind(p_kind), p_in_edges,
+    pb_op_t *p_op = append_op(one_of_kind(p_kind), p_in_edges,
             "alternation" + std::to_string(nodes_.size()));
+    p_op->op_kinds_ = p_kind;
+    return p_op;
 }
 
 pb_op_t *pb_graph_t::append_alternation(
         const std::vector<dnnl::impl::graph::op_kind_t> &p_kind) {
-    return append_op(one_of_kind(p_kind), {},
-            "alternation" + std::to_string(nodes_.size()));
+    return append_alternation(p_kind, {});
 }
 
 alternation_t *pb_graph_t::append_alternation(
@@ -352,6 +353,31 @@ repetition_t *pb_graph_t::append_optional(
     return append_optional(p_node, {});
 }
 
+bool pb_graph_t::get_root_op_kinds(
+        std::vector<dnnl::impl::graph::op_kind_t> &kinds) {
+    // Matching binds the first op to the first node of the graph.
+    if (nodes_.empty()) return false;
+    pb_node_t *node = nodes_.front().get();
+    switch (node->get_node_kind()) {
+        case pb_node_kind::PB_NODE_KIND_OP: {
+            const auto &op_kinds = static_cast<pb_op_t *>(node)->get_op_kinds();
+            if (op_kinds.empty()) return false;
+            kinds.insert(kinds.end(), op_kinds.begin(), op_kinds.end());
+            return true;
+        }
+        case pb_node_kind::PB_NODE_KIND_ALTERNATION: {
+            for (auto *alt :
+                    static_cast<alternation_t *>(node)->get_alternatives()) {
+                if (!alt->get_root_op_kinds(kinds)) return false;
+            }
+            return true;
+        }
+        // A repetition may match zero times, so the first op can belong to
+        // the nodes that follow it.
+        default: return false;
+    }
+}
+
 alternation_t::alternation_t(std::vector<std::shared_ptr<pb_graph_t>> p_nodes)
     : alternatives_ {std::move(p_nodes)}, min_op_num_ {0} {
     node_kind_ = pb_node_kind::PB_NODE_KIND_ALTERNATION;
@@ -134,10 +134,18 @@ public:
         return accept_internal_inputs_;
     };
 
+    // The op kinds accepted by the kind check of this node. Empty if the
+    // node accepts any kind or uses a custom type checker.
+    const std::vector<dnnl::impl::graph::op_kind_t> &get_op_kinds() const {
+        return op_kinds_;
+    }
+
 protected:
     friend class pb_graph_t;
     pb_op_t(const decision_function &p_fn);
 
+    std::vector<dnnl::impl::graph::op_kind_t> op_kinds_;
+
     /*
         The outputs could link to ops outside the pattern.
         Explained by the following example.
@@ -318,6 +326,10 @@ public:
 
     size_t get_min_op_num() const { return min_op_num_; }
 
+    // Collects the kinds of the ops a match of this graph can start from.
+    // Returns false if any op kind can start a match.
+    bool get_root_op_kinds(std::vector<dnnl::impl::graph::op_kind_t> &kinds);
+
 protected:
     pb_op_t *append_op(const decision_function &type_checker,
             const in_edges_t &p_in_edges, std::string name = "");
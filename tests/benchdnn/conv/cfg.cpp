@@ -37,7 +37,7 @@ cfg_t::cfg_t(const prb_t *prb, const std::vector<data_kind_t> &kinds) {
             set_range_max(SRC, 128);
             set_range_min(WEI, 2);
             set_range_max(WEI, 64);
-        } else if (prb->dt[0] == dnnl_f16) {
+        } else if (prb->dt[0] == dnnl_f16 || prb->dt[0] == dnnl_bf16) {
             set_range_min(SRC, -2);
             set_range_max(SRC, 16);
             set_range_min(WEI, 1);
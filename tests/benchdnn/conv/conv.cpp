@@ -444,7 +444,9 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
 
     float trh = 0.f;
     if (prb->alg & WINO) {
-        trh = prb->dt[1] == dnnl_f16 ? 7e-3f : 2e-5f;
+        trh = prb->dt[1] == dnnl_f16 ? 7e-3f
+                : prb->dt[1] == dnnl_bf16 ? 2e-2f
+                                          : 2e-5f;
         if (prb->dir & FLAG_WEI) {
             // This is an empirical equation derived by observing growth error
             // with increasing 'k' dimension in gemm of winograd
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2023 Intel Corporation
+* Copyright 2021-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl_graph.hpp"
 
 #include "test_api_common.hpp"
@@ -941,3 +945,122 @@ TEST_P(test_bn_compile_t, Test_BatchNorm_Compile) {
 
 INSTANTIATE_TEST_SUITE_P(Test_BatchNorm_Compile, test_bn_compile_t,
         ::testing::Values(bn_params_t {{1, 3, 3, 10}, 0.001f, "NXC"}));
+
+TEST(APICompile, MemoryPlan) {
+    using namespace dnnl::graph;
+    SKIP_IF(api_test_engine_kind != dnnl_cpu,
+            "memory plan execution is only supported on cpu");
+
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    dnnl::stream strm {eng};
+
+    const std::vector<int64_t> dims {2, 3, 4, 5};
+    const size_t nelems = 2 * 3 * 4 * 5;
+    logical_tensor src {0, logical_tensor::data_type::f32, dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor mid {1, logical_tensor::data_type::f32, dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {2, logical_tensor::data_type::f32, dims,
+            logical_tensor::layout_type::strided};
+
+    // Two partitions chained through `mid`, compiled separately.
+    std::vector<compiled_partition> cps;
+    for (const auto &io :
+            {std::make_pair(src, mid), std::make_pair(mid, dst)}) {
+        graph g(engine_kind);
+        op relu(cps.size(), op::kind::ReLU, {io.first}, {io.second}, "relu");
+        g.add_op(relu);
+        g.finalize();
+        auto partitions = g.get_partitions();
+        ASSERT_EQ(partitions.size(), 1U);
+        cps.push_back(partitions[0].compile({io.first}, {io.second}, eng));
+    }
+
+    memory_plan plan(cps);
+    const size_t size = plan.get_size();
+    ASSERT_GE(size, nelems * sizeof(float));
+    ASSERT_EQ(plan.get_offset(1) % 64, 0U);
+    EXPECT_THROW(plan.get_offset(0), dnnl::error);
+    EXPECT_THROW(plan.get_offset(2), dnnl::error);
+
+    // Excluding the intermediate tensor leaves only the temporaries.
+    memory_plan plan_no_mid(cps, {1});
+    EXPECT_THROW(plan_no_mid.get_offset(1), dnnl::error);
+
+    std::vector<float> src_data(nelems), dst_data(nelems, 0.f);
+    for (size_t i = 0; i < nelems; i++)
+        src_data[i] = static_cast<float>(i % 7) - 3.f;
+
+    // The arena must be aligned to 64 bytes.
+    std::vector<char> arena_buf(size + 64);
+    void *arena = arena_buf.data();
+    size_t space = arena_buf.size();
+    ASSERT_NE(std::align(64, size, arena, space), nullptr);
+    tensor ts_src(src, eng, src_data.data());
+    tensor ts_mid(mid, eng, nullptr);
+    tensor ts_dst(dst, eng, dst_data.data());
+    plan.execute(0, strm, arena, {ts_src}, {ts_mid});
+    plan.execute(1, strm, arena, {ts_mid}, {ts_dst});
+    strm.wait();
+
+    for (size_t i = 0; i < nelems; i++)
+        ASSERT_EQ(dst_data[i], std::max(src_data[i], 0.f));
+}
+
+TEST(APICompile, UnknownDims) {
+    using namespace dnnl::graph;
+    SKIP_IF(api_test_engine_kind != dnnl_cpu,
+            "dynamic shape execution is only tested on cpu");
+
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    dnnl::stream strm {eng};
+
+    const int64_t unk = DNNL_GRAPH_UNKNOWN_DIM;
+    logical_tensor src {0, logical_tensor::data_type::f32, {unk, 3, 4},
+            logical_tensor::layout_type::strided};
+    logical_tensor dst {1, logical_tensor::data_type::f32, {unk, 3, 4},
+            logical_tensor::layout_type::strided};
+
+    graph g(engine_kind);
+    op relu(0, op::kind::ReLU, {src}, {dst}, "relu");
+    g.add_op(relu);
+    g.finalize();
+    auto partitions = g.get_partitions();
+    ASSERT_EQ(partitions.size(), 1U);
+
+    // Compiled once, executed with several batch sizes.
+    compiled_partition cp = partitions[0].compile({src}, {dst}, eng);
+    ASSERT_EQ(cp.query_logical_tensor(1).get_dims()[0], unk);
+
+    for (int64_t mb : {2, 5, 2}) {
+        const size_t nelems = static_cast<size_t>(mb) * 3 * 4;
+        logical_tensor src_mb {0, logical_tensor::data_type::f32, {mb, 3, 4},
+                logical_tensor::layout_type::strided};
+        logical_tensor dst_mb {1, logical_tensor::data_type::f32, {mb, 3, 4},
+                logical_tensor::layout_type::strided};
+
+        std::vector<float> src_data(nelems), dst_data(nelems, 0.f);
+        for (size_t i = 0; i < nelems; i++)
+            src_data[i] = static_cast<float>(i % 7) - 3.f;
+
+        tensor ts_src(src_mb, eng, src_data.data());
+        tensor ts_dst(dst_mb, eng, dst_data.data());
+        cp.execute(strm, {ts_src}, {ts_dst});
+        strm.wait();
+
+        for (size_t i = 0; i < nelems; i++)
+            ASSERT_EQ(dst_data[i], std::max(src_data[i], 0.f));
+    }
+
+    // The known dimensions must match the ones given on compilation.
+    logical_tensor src_bad {0, logical_tensor::data_type::f32, {2, 3, 5},
+            logical_tensor::layout_type::strided};
+    std::vector<float> buf(2 * 3 * 5);
+    tensor ts_bad(src_bad, eng, buf.data());
+    tensor ts_out(src_bad, eng, buf.data());
+    EXPECT_THROW(cp.execute(strm, {ts_bad}, {ts_out}), dnnl::error);
+}
@@ -52,6 +52,58 @@ static void fill_data(
     }
 }
 
+// A ResNet-50 stage 2 like block on NXC activations with the bottleneck
+// convolutions having a 3x3 kernel, so the spatial rows of the intermediates
+// depend on their neighbours.
+static void construct_int8_nxc_resnet50_stage2_block(graph::graph_t *agraph,
+        utils::id_generator_t &id_gen, int64_t channels, int64_t spatial,
+        size_t three_conv_block_num = 3) {
+    const int64_t ic = channels, oc = channels;
+    std::vector<int64_t> src_shape {1, spatial, spatial, ic};
+
+    const float scale_src = 1 / 255.f, scale_out = 0.05f;
+    const int64_t zp_src = 78, zp_out = 78;
+    std::vector<float> scale_wei(oc, 1 / 127.f);
+
+    auto src = utils::logical_tensor_init(
+            id_gen.get_id(), src_shape, graph::data_type::u8);
+
+    auto conv = [&](const graph::logical_tensor_t &in, int64_t ks,
+                        bool with_relu, bool quantize_dst) {
+        const int64_t pad = ks / 2;
+        return utils::create_int8_convolution(id_gen, *agraph, in, ic, ks, oc,
+                1, {1, 1}, {1, 1}, {pad, pad}, {pad, pad}, "NXC", "OIX", true,
+                false, 1e-6f, with_relu, scale_src, zp_src, scale_out, zp_out,
+                scale_wei, graph::data_type::u8, quantize_dst);
+    };
+    auto add_relu = [&](const graph::logical_tensor_t &lhs,
+                            const graph::logical_tensor_t &rhs) {
+        auto dq = utils::create_dequantize(
+                id_gen, *agraph, rhs, "per_tensor", {zp_out}, {scale_out}, 0);
+        auto add = utils::create_add(id_gen, *agraph, lhs, dq);
+        auto relu = utils::create_relu(id_gen, *agraph, add);
+        return utils::create_quantize(id_gen, *agraph, relu,
+                graph::data_type::u8, "per_tensor",
+                std::vector<int64_t> {zp_out}, std::vector<float> {scale_out},
+                0);
+    };
+
+    // 4-conv block
+    auto conv0 = conv(src, 1, true, true);
+    auto conv1 = conv(conv0, 3, true, true);
+    auto conv2 = conv(src, 1, false, true);
+    auto conv3 = conv(conv1, 1, false, false);
+    graph::logical_tensor_t tmp = add_relu(conv3, conv2);
+
+    // 3-conv blocks
+    for (size_t i = 0; i < three_conv_block_num; i++) {
+        auto conv0 = conv(tmp, 1, true, true);
+        auto conv1 = conv(conv0, 3, true, true);
+        auto conv2 = conv(conv1, 1, false, false);
+        tmp = add_relu(conv2, tmp);
+    }
+}
+
 TEST(test_large_partition_execute, Int8Resnet50Stage2Block) {
     SKIP_IF_NV_GPU("not supported on NVIDIA GPU");
     graph::engine_t *eng = get_engine();
@@ -120,6 +172,69 @@ TEST(test_large_partition_execute, Int8Resnet50Stage2Block) {
                     /*atol*/ 1.f));
 }
 
+// The activations of the block exceed the L2 cache, so the block is executed
+// tile by tile, with the halo rows of the 3x3 convolutions recomputed. The
+// result must match the op by op execution of the graph.
+TEST(test_large_partition_execute, Int8Resnet50Stage2BlockNxcTiled) {
+    SKIP_IF_NV_GPU("not supported on NVIDIA GPU");
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    utils::id_generator_t id_gen;
+    graph::graph_t g(eng->kind());
+    construct_int8_nxc_resnet50_stage2_block(&g, id_gen, 32, 224);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("int8_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    std::vector<test_tensor_t> inputs_ts, outputs_ts, ref_outputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<uint8_t>();
+    }
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        outputs_ts.emplace_back(compiled_output, eng);
+        ref_outputs_ts.emplace_back(compiled_output, eng);
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                      test_tensor_t::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(
+            allclose<uint8_t>(outputs_ts[0], ref_outputs_ts[0], /*rtol*/ 0.01f,
+                    /*atol*/ 1.f));
+}
+
 TEST(test_large_partition_execute, Int8Resnet50Stage2BlockWithZeroZps) {
     SKIP_IF_NV_GPU("not supported on NVIDIA GPU");
     graph::engine_t *eng = get_engine();
@@ -8183,3 +8183,208 @@ TEST(test_matmul_execute_subgraph_int8, NoShareCachedWeight) {
     dnnl::graph::set_constant_tensor_cache_capacity(
             static_cast<engine::kind>(engine->kind()), 0);
 }
+
+namespace {
+
+// Projects two new tokens and writes them quantized at position 1 of a cache
+// holding 4 tokens, with one scale for each group of G channels. With G equal
+// to the number of channels the scales are per token and the pattern has no
+// reshape before the reduction.
+void check_kv_cache_quantize(graph::data_type_t dst_dt, int64_t G) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const int64_t T = 2, IC = 4, OC = 8, L = 4, pos = 1;
+    const bool per_token = G == OC;
+    const bool is_int4 = dst_dt == graph::data_type::s4
+            || dst_dt == graph::data_type::u4;
+    const bool is_signed = dst_dt == graph::data_type::s8
+            || dst_dt == graph::data_type::s4;
+    const int64_t bits = is_int4 ? 4 : 8;
+    const float q_lo = is_signed ? -(1 << (bits - 1)) : 0.f;
+    const float q_hi = is_signed ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+
+    std::vector<float> src_data(T * IC), wei_data(IC * OC);
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> f32_distribution(-1.0f, 1.0f);
+    std::generate(src_data.begin(), src_data.end(),
+            [&]() { return f32_distribution(generator); });
+    std::generate(wei_data.begin(), wei_data.end(),
+            [&]() { return f32_distribution(generator); });
+    std::vector<float> qmax_data {q_hi};
+
+    // the scales keep the reduced dimension of per token scales
+    const graph::dims scales_dims
+            = per_token ? graph::dims {1, T, 1} : graph::dims {1, T, OC / G};
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {1, T, IC}, graph::data_type::f32);
+    graph::logical_tensor_t wei_lt
+            = utils::logical_tensor_init(1, {IC, OC}, graph::data_type::f32);
+    graph::logical_tensor_t mm_lt
+            = utils::logical_tensor_init(2, {1, T, OC}, graph::data_type::f32);
+    graph::logical_tensor_t reshape_lt = utils::logical_tensor_init(
+            3, {1, T, OC / G, G}, graph::data_type::f32);
+    graph::logical_tensor_t abs_lt = utils::logical_tensor_init(4,
+            per_token ? graph::dims {1, T, OC} : graph::dims {1, T, OC / G, G},
+            graph::data_type::f32);
+    graph::logical_tensor_t amax_lt
+            = utils::logical_tensor_init(5, scales_dims, graph::data_type::f32);
+    graph::logical_tensor_t qmax_lt
+            = utils::logical_tensor_init(6, {1}, graph::data_type::f32);
+    graph::logical_tensor_t scales_lt
+            = utils::logical_tensor_init(7, scales_dims, graph::data_type::f32);
+    // the quantized tokens are a strided view of the cache
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            8, {1, T, OC}, {L * OC, OC, 1}, dst_dt);
+    // the cache is allocated as bytes, two 4-bit values share a byte
+    graph::logical_tensor_t cache_lt = utils::logical_tensor_init(
+            9, {L * OC * bits / 8}, graph::data_type::u8);
+
+    graph::op_t matmul_op(0, graph::op_kind::MatMul, "matmul");
+    graph::op_t reshape_op(1, graph::op_kind::StaticReshape, "reshape");
+    reshape_op.set_attr<std::vector<int64_t>>(
+            graph::op_attr::shape, {1, T, OC / G, G});
+    reshape_op.set_attr<bool>(graph::op_attr::special_zero, false);
+    graph::op_t abs_op(2, graph::op_kind::Abs, "abs");
+    graph::op_t reduce_op(3, graph::op_kind::ReduceMax, "reduce_max");
+    reduce_op.set_attr<std::vector<int64_t>>(graph::op_attr::axes, {-1});
+    reduce_op.set_attr<bool>(graph::op_attr::keep_dims, per_token);
+    graph::op_t div_op(4, graph::op_kind::Divide, "divide");
+    graph::op_t quant_op(5, graph::op_kind::DynamicQuantize, "quantize");
+    quant_op.set_attr<std::string>(graph::op_attr::qtype, "per_group");
+    quant_op.set_attr<std::vector<int64_t>>(
+            graph::op_attr::group_shape, {1, 1, G});
+
+    matmul_op.add_input(src_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(mm_lt);
+    if (per_token) {
+        abs_op.add_input(mm_lt);
+    } else {
+        reshape_op.add_input(mm_lt);
+        reshape_op.add_output(reshape_lt);
+        abs_op.add_input(reshape_lt);
+    }
+    abs_op.add_output(abs_lt);
+    reduce_op.add_input(abs_lt);
+    reduce_op.add_output(amax_lt);
+    div_op.add_input(amax_lt);
+    div_op.add_input(qmax_lt);
+    div_op.add_output(scales_lt);
+    quant_op.add_input(mm_lt);
+    quant_op.add_input(scales_lt);
+    quant_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&matmul_op), graph::status::success);
+    if (!per_token) {
+        ASSERT_EQ(g.add_op(&reshape_op), graph::status::success);
+    }
+    ASSERT_EQ(g.add_op(&abs_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&reduce_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&div_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&quant_op), graph::status::success);
+    ASSERT_EQ(g.finalize(), graph::status::success);
+
+    graph::pass::pass_base_ptr apass = get_pass("kv_cache_quantize_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_outputs().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &wei_lt, &qmax_lt};
+    std::vector<const graph::logical_tensor_t *> outputs;
+    for (const auto &lt : part->get_outputs())
+        outputs.emplace_back(lt.id == dst_lt.id ? &dst_lt : &scales_lt);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    test_tensor_t src_ts(src_lt, engine, src_data);
+    test_tensor_t wei_ts(wei_lt, engine, wei_data);
+    test_tensor_t qmax_ts(qmax_lt, engine, qmax_data);
+    test_tensor_t scales_ts(scales_lt, engine);
+    test_tensor_t cache_ts(
+            cache_lt, engine, std::vector<uint8_t>(L * OC * bits / 8, 0));
+    graph::tensor_t dst_ts(dst_lt, engine,
+            static_cast<uint8_t *>(cache_ts.get().get_data_handle())
+                    + pos * OC * bits / 8);
+
+    std::vector<graph::tensor_t> output_ts;
+    for (const auto &lt : part->get_outputs())
+        output_ts.emplace_back(
+                lt.id == dst_lt.id ? dst_ts : scales_ts.get());
+    ASSERT_EQ(cp.execute(strm, {src_ts.get(), wei_ts.get(), qmax_ts.get()},
+                      output_ts),
+            graph::status::success);
+    strm->wait();
+
+    const auto cache = cache_ts.as_vec_type<uint8_t>();
+    const auto scales = scales_ts.as_vec_type<float>();
+    // returns the quantized value of the element at index i of the cache
+    const auto cache_value = [&](int64_t i) -> float {
+        if (!is_int4)
+            return is_signed ? static_cast<int8_t>(cache[i]) : cache[i];
+        const int v = (cache[i / 2] >> (4 * (i % 2))) & 0xF;
+        return is_signed && v > 7 ? v - 16 : v;
+    };
+    for (int64_t t = 0; t < T; ++t) {
+        for (int64_t g = 0; g < OC / G; ++g) {
+            std::vector<float> ref(G);
+            float amax = 0.f;
+            for (int64_t c = 0; c < G; ++c) {
+                for (int64_t k = 0; k < IC; ++k)
+                    ref[c] += src_data[t * IC + k]
+                            * wei_data[k * OC + g * G + c];
+                amax = std::max(amax, std::fabs(ref[c]));
+            }
+            const float scale = amax / qmax_data[0];
+            ASSERT_NEAR(scales[t * (OC / G) + g], scale, 1e-6f);
+            for (int64_t c = 0; c < G; ++c) {
+                const float q = std::min(q_hi,
+                        std::max(q_lo, std::nearbyint(ref[c] / scale)));
+                ASSERT_NEAR(cache_value((pos + t) * OC + g * G + c), q, 1.f);
+            }
+        }
+    }
+    // the other tokens of the cache are left untouched
+    for (int64_t b = 0; b < OC * bits / 8; ++b) {
+        ASSERT_EQ(cache[b], 0);
+        ASSERT_EQ(cache[(L - 1) * OC * bits / 8 + b], 0);
+    }
+}
+
+} // namespace
+
+TEST(test_matmul_execute_subgraph_int8, KvCacheQuantizePerGroup_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip kv cache quantization test for GPU device.");
+    check_kv_cache_quantize(graph::data_type::s8, 4);
+}
+
+TEST(test_matmul_execute_subgraph_int8, KvCacheQuantizePerToken_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip kv cache quantization test for GPU device.");
+    check_kv_cache_quantize(graph::data_type::s8, 8);
+}
+
+TEST(test_matmul_execute_subgraph_int8, KvCacheQuantizePerGroupU8_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip kv cache quantization test for GPU device.");
+    check_kv_cache_quantize(graph::data_type::u8, 4);
+}
+
+TEST(test_matmul_execute_subgraph_int8, KvCacheQuantizePerGroupS4_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip kv cache quantization test for GPU device.");
+    check_kv_cache_quantize(graph::data_type::s4, 4);
+}
+
+TEST(test_matmul_execute_subgraph_int8, KvCacheQuantizePerTokenU4_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip kv cache quantization test for GPU device.");
+    check_kv_cache_quantize(graph::data_type::u4, 8);
+}
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <functional>
+#include <limits>
 #include <random>
 
 #include "oneapi/dnnl/dnnl_graph.hpp"
@@ -1595,3 +1596,78 @@ TEST(test_sdp_decomp_execute, MultithreaSdpDecompCorr_CPU) {
         t2.join();
     }
 }
+
+TEST(test_sdp_decomp_execute, F32SdpRaggedBatchCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // The kv sequences of the batch are padded to seq_len and the padding is
+    // masked off, so the decomposed kernel only computes the valid tokens.
+    int batch_size = 16, seq_len = 384, num_head = 16, head_dim = 1024;
+    graph::graph_t g(eng->kind());
+    utils::construct_dnnl_float_MHA(&g, dnnl::impl::data_type::f32,
+            batch_size, seq_len, num_head, head_dim, false, true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    // the attention mask is the first logical tensor of the graph
+    std::vector<float> mask(batch_size * seq_len, 0.f);
+    for (int b = 0; b < batch_size; ++b) {
+        const int valid_len = seq_len * (b + 1) / batch_size;
+        for (int s = valid_len; s < seq_len; ++s)
+            mask[b * seq_len + s] = -std::numeric_limits<float>::infinity();
+    }
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        if (lt->id == 0)
+            inputs_ts.back().fill<float>(mask);
+        else
+            inputs_ts.back().fill<float>();
+    }
+
+    std::vector<std::vector<test_tensor_t>> outputs_ts(2);
+    for (int force_primitive = 0; force_primitive < 2; ++force_primitive) {
+        custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE",
+                force_primitive ? "1" : "0", 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts[force_primitive].emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(
+                                  outputs_ts[force_primitive])),
+                graph::status::success);
+        strm->wait();
+    }
+    custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", "0", 1);
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0][0], outputs_ts[1][0],
+            /*rtol*/ 0.01f,
+            /*atol*/ 1e-6f));
+}
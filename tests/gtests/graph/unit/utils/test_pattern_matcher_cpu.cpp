@@ -106,6 +106,44 @@ TEST(test_utils_pattern_matcher, GraphAppendLeafOp) {
     ASSERT_NE(op0, nullptr);
 }
 
+//
+// The kinds of the ops a match can start from are known for patterns that
+// begin with a kind check, possibly nested in alternations.
+//
+TEST(test_utils_pattern_matcher, GraphRootOpKinds) {
+    std::vector<op_kind_t> kinds;
+
+    auto pgraph = std::make_shared<pb_graph_t>();
+    auto pconv = pgraph->append_op(Convolution);
+    pgraph->append_op(ReLU, {in_edge(IN0, pconv, OUT0)});
+    ASSERT_TRUE(pgraph->get_root_op_kinds(kinds));
+    ASSERT_EQ(kinds, std::vector<op_kind_t> {Convolution});
+
+    auto alt0 = std::make_shared<pb_graph_t>();
+    auto pmatmul = alt0->append_op(MatMul);
+    alt0->create_input_port(IN0, pmatmul, IN0);
+    alt0->create_output_port(OUT0, pmatmul, OUT0);
+    auto alt1 = std::make_shared<pb_graph_t>();
+    auto pact = alt1->append_alternation({Elu, Tanh});
+    alt1->create_input_port(IN0, pact, IN0);
+    alt1->create_output_port(OUT0, pact, OUT0);
+    auto palt = std::make_shared<pb_graph_t>();
+    palt->append_alternation({alt0, alt1});
+    kinds.clear();
+    ASSERT_TRUE(palt->get_root_op_kinds(kinds));
+    ASSERT_EQ(kinds, (std::vector<op_kind_t> {MatMul, Elu, Tanh}));
+
+    // A match can start from any op.
+    auto pany = std::make_shared<pb_graph_t>();
+    pany->append_op(Wildcard);
+    ASSERT_FALSE(pany->get_root_op_kinds(kinds));
+
+    // An optional node may be skipped, so the next node can start a match.
+    auto popt = std::make_shared<pb_graph_t>();
+    popt->append_optional(alt0);
+    ASSERT_FALSE(popt->get_root_op_kinds(kinds));
+}
+
 //
 // Convolution + BiasAdd
 // A vector of all in coming edges to the new op can passed to
@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "src/cpu/x64/matmul/brgemm_matmul_tuning.hpp"
+
+namespace {
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+std::vector<std::string> read_lines(const std::string &path) {
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line))
+        lines.push_back(line);
+    return lines;
+}
+
+} // namespace
+
+namespace dnnl {
+
+using impl::cpu::x64::matmul::brgemm_matmul_tuned_blocking_t;
+using impl::cpu::x64::matmul::tuning::find_blocking;
+
+// The tuning mode and the database are set up once per process by the
+// environment variables, hence the single test and the separate binary.
+//
+// The database is loaded from the file on the first creation of a matmul,
+// the tuning of a new problem appends a line to the file and the creation of
+// the same problem then finds it in the database.
+TEST(matmul_tuning_test_t, TestDatabaseRoundTrip) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Tuning is supported on CPU only.");
+
+    const std::string path = "test_matmul_tuning_db.txt";
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "loaded_key 16 2 1 1" << std::endl;
+        file << "malformed_key 16 two" << std::endl;
+    }
+    custom_setenv("ONEDNN_CPU_MATMUL_TUNING", "1", 1);
+    custom_setenv("ONEDNN_CPU_MATMUL_TUNING_DB", path.c_str(), 1);
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim M = 96, K = 80, N = 112;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    const std::string impl_name = pd.impl_info_str();
+
+    // The file is loaded, the malformed lines are skipped.
+    brgemm_matmul_tuned_blocking_t loaded;
+    ASSERT_TRUE(find_blocking("loaded_key", loaded));
+    EXPECT_EQ(loaded.M_blk, 16);
+    EXPECT_EQ(loaded.M_chunk_size, 2);
+    EXPECT_EQ(loaded.N_chunk_size, 1);
+    EXPECT_EQ(loaded.nthr_k, 1);
+    EXPECT_FALSE(find_blocking("malformed_key", loaded));
+
+    const auto lines = read_lines(path);
+    if (impl_name.find("brg") == std::string::npos) {
+        // Other implementations are not tuned.
+        EXPECT_EQ(lines.size(), 2u);
+        std::remove(path.c_str());
+        return;
+    }
+
+    // The tuned blocking is appended to the file and added to the database.
+    ASSERT_EQ(lines.size(), 3u);
+    std::istringstream ss(lines.back());
+    std::string key;
+    brgemm_matmul_tuned_blocking_t tuned;
+    ASSERT_TRUE(static_cast<bool>(ss >> key >> tuned.M_blk
+            >> tuned.M_chunk_size >> tuned.N_chunk_size >> tuned.nthr_k));
+    brgemm_matmul_tuned_blocking_t found;
+    ASSERT_TRUE(find_blocking(key, found));
+    EXPECT_TRUE(found == tuned);
+
+    // The problem isn't tuned again.
+    auto pd2 = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    EXPECT_EQ(read_lines(path).size(), 3u);
+
+    // The matmul with the tuned blocking computes the right result.
+    memory src_m(src_md, eng), wei_m(wei_md, eng), dst_m(dst_md, eng);
+    auto *src = static_cast<float *>(src_m.get_data_handle());
+    auto *wei = static_cast<float *>(wei_m.get_data_handle());
+    auto *dst = static_cast<float *>(dst_m.get_data_handle());
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = static_cast<float>(i % 13) - 6.f;
+    for (memory::dim i = 0; i < K * N; i++)
+        wei[i] = static_cast<float>(i % 7) - 3.f;
+
+    matmul(pd2).execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m}});
+    strm.wait();
+
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float ref = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            ref += src[m * K + k] * wei[k * N + n];
+        // The products are small integers, the sums are exact.
+        ASSERT_EQ(dst[m * N + n], ref) << "m = " << m << " n = " << n;
+    }
+
+    std::remove(path.c_str());
+}
+
+} // namespace dnnl
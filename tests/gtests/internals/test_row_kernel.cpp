@@ -0,0 +1,278 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+#include "oneapi/dnnl/dnnl_ukernel.hpp"
+#endif
+
+#include "src/common/bfloat16.hpp"
+#include "src/common/float16.hpp"
+#include "src/common/type_helpers.hpp"
+
+#include "src/cpu/x64/ukernel/jit_uni_row_kernel.hpp"
+
+namespace dnnl {
+
+using namespace impl::cpu::x64::ukernel;
+using impl::alg_kind_t;
+using impl::data_type_t;
+
+namespace {
+
+// The row lengths cover rows shorter than a vector and the tails of both avx2
+// and avx512 vectors.
+const std::vector<size_t> row_lengths = {1, 3, 7, 8, 15, 16, 17, 33, 100};
+
+std::vector<float> make_row(size_t N, size_t seed) {
+    std::vector<float> row(N);
+    for (size_t n = 0; n < N; n++)
+        row[n] = static_cast<float>((n * 37 + seed * 11) % 17) / 2.f - 4.f;
+    return row;
+}
+
+float ref_eltwise(alg_kind_t alg, float x) {
+    switch (alg) {
+        case impl::alg_kind::eltwise_exp: return ::expf(x);
+        case impl::alg_kind::eltwise_relu: return x > 0.f ? x : 0.f;
+        default: return x;
+    }
+}
+
+float load_value(data_type_t dt, const std::vector<char> &buf, size_t n) {
+    switch (dt) {
+        case impl::data_type::bf16:
+            return reinterpret_cast<const impl::bfloat16_t *>(buf.data())[n];
+        case impl::data_type::f16:
+            return reinterpret_cast<const impl::float16_t *>(buf.data())[n];
+        default: return reinterpret_cast<const float *>(buf.data())[n];
+    }
+}
+
+float tolerance(data_type_t dt) {
+    switch (dt) {
+        case impl::data_type::bf16: return 8e-3f;
+        case impl::data_type::f16: return 1e-3f;
+        default: return 1e-5f;
+    }
+}
+
+// Runs a row kernel over rows of all the lengths and compares the stored
+// values and the reduction with a scalar reference. The bytes past the end of
+// the destination row must stay untouched.
+void check_row_kernel(const row_kernel_conf_t &conf) {
+    if (!row_kernel_supported(conf)) GTEST_SKIP();
+
+    std::unique_ptr<jit_row_kernel_t> kernel;
+    ASSERT_EQ(create_row_kernel(kernel, conf), impl::status::success);
+
+    const size_t dt_size = impl::types::data_type_size(conf.dst_dt);
+    const char guard = 0x5a;
+    const bool is_max = conf.reduction_alg == impl::alg_kind::reduction_max;
+    const float shift = conf.with_shift ? 0.75f : 0.f;
+
+    for (size_t N : row_lengths) {
+        SCOPED_TRACE("N = " + std::to_string(N));
+        const auto src = make_row(N, N);
+        std::vector<char> dst((N + 16) * dt_size, guard);
+        float reduce = 42.f;
+
+        row_kernel_args_t args {};
+        args.src = src.data();
+        args.dst = dst.data();
+        args.shift = &shift;
+        args.reduce = &reduce;
+        args.work_amount = N;
+        (*kernel)(&args);
+
+        float ref_reduce
+                = is_max ? -std::numeric_limits<float>::infinity() : 0.f;
+        for (size_t n = 0; n < N; n++) {
+            const float y = ref_eltwise(conf.eltwise_alg, src[n] - shift);
+            ref_reduce = is_max ? std::max(ref_reduce, y) : ref_reduce + y;
+            if (!conf.with_store) continue;
+            const float tol = tolerance(conf.dst_dt) * std::max(1.f, fabsf(y));
+            ASSERT_NEAR(load_value(conf.dst_dt, dst, n), y, tol)
+                    << "n = " << n;
+        }
+        for (size_t b = conf.with_store ? N * dt_size : 0; b < dst.size(); b++)
+            ASSERT_EQ(dst[b], guard) << "byte = " << b;
+
+        if (conf.reduction_alg == impl::alg_kind::undef) continue;
+        // The sum of the exponents is of the order of N * e^4.
+        const float tol = 1e-5f * std::max(1.f, fabsf(ref_reduce));
+        ASSERT_NEAR(reduce, ref_reduce, tol);
+    }
+}
+
+} // namespace
+
+class row_kernel_test_t
+    : public ::testing::TestWithParam<std::tuple<alg_kind_t, data_type_t>> {
+};
+
+TEST_P(row_kernel_test_t, Store) {
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = std::get<0>(GetParam());
+    conf.with_shift = true;
+    conf.with_store = true;
+    conf.dst_dt = std::get<1>(GetParam());
+    check_row_kernel(conf);
+}
+
+TEST_P(row_kernel_test_t, StoreAndSum) {
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = std::get<0>(GetParam());
+    conf.with_shift = true;
+    conf.with_store = true;
+    conf.dst_dt = std::get<1>(GetParam());
+    conf.reduction_alg = impl::alg_kind::reduction_sum;
+    check_row_kernel(conf);
+}
+
+INSTANTIATE_TEST_SUITE_P(Eltwise, row_kernel_test_t,
+        ::testing::Combine(::testing::Values(impl::alg_kind::undef,
+                                   impl::alg_kind::eltwise_relu,
+                                   impl::alg_kind::eltwise_exp),
+                ::testing::Values(impl::data_type::f32, impl::data_type::bf16,
+                        impl::data_type::f16)));
+
+TEST(row_kernel_reduction_test_t, Max) {
+    row_kernel_conf_t conf;
+    conf.reduction_alg = impl::alg_kind::reduction_max;
+    check_row_kernel(conf);
+}
+
+// The maximum of a row of negative values checks the lanes past the tail
+// don't take part in the reduction.
+TEST(row_kernel_reduction_test_t, MaxOfNegativeRow) {
+    row_kernel_conf_t conf;
+    conf.reduction_alg = impl::alg_kind::reduction_max;
+    if (!row_kernel_supported(conf)) GTEST_SKIP();
+
+    std::unique_ptr<jit_row_kernel_t> kernel;
+    ASSERT_EQ(create_row_kernel(kernel, conf), impl::status::success);
+
+    for (size_t N : row_lengths) {
+        SCOPED_TRACE("N = " + std::to_string(N));
+        std::vector<float> src(N);
+        for (size_t n = 0; n < N; n++)
+            src[n] = -1.f - n;
+        float max = 0.f;
+
+        row_kernel_args_t args {};
+        args.src = src.data();
+        args.reduce = &max;
+        args.work_amount = N;
+        (*kernel)(&args);
+        ASSERT_EQ(max, -1.f);
+    }
+}
+
+TEST(row_kernel_reduction_test_t, ExpSum) {
+    row_kernel_conf_t conf;
+    conf.eltwise_alg = impl::alg_kind::eltwise_exp;
+    conf.with_shift = true;
+    conf.reduction_alg = impl::alg_kind::reduction_sum;
+    check_row_kernel(conf);
+}
+
+#ifdef DNNL_EXPERIMENTAL_UKERNEL
+
+class ukernel_softmax_test_t
+    : public ::testing::TestWithParam<memory::data_type> {};
+
+// Computes `O = softmax(S) * V` for the rows of `S` split in blocks of
+// columns, as in an attention with the scores computed block by block, and
+// compares it with the softmax of the whole rows.
+TEST_P(ukernel_softmax_test_t, MultiBlock) {
+    using dt = memory::data_type;
+    const dt p_dt = GetParam();
+    const data_type_t p_impl_dt = memory::convert_to_c(p_dt);
+
+    // The blocks have a tail on any ISA.
+    const memory::dim M = 5, N_blk = 17, nblocks = 3, N_o = 9;
+    const memory::dim N = N_blk * nblocks;
+    const memory::dim ld_s = N, ld_p = N_blk + 3, ld_o = N_o + 1;
+
+    ukernel::softmax softmax(
+            M, N_blk, ld_s, ld_p, p_dt, N_o, ld_o, /* allow_empty = */ true);
+    if (!softmax) GTEST_SKIP();
+    softmax.generate();
+
+    std::vector<float> S(M * ld_s), V(N * N_o);
+    for (memory::dim m = 0; m < M; m++) {
+        const auto row = make_row(N, m);
+        std::copy(row.begin(), row.end(), S.begin() + m * ld_s);
+    }
+    for (memory::dim i = 0; i < N * N_o; i++)
+        V[i] = static_cast<float>(i % 7) - 3.f;
+
+    const size_t p_dt_size = impl::types::data_type_size(p_impl_dt);
+    std::vector<char> P(M * ld_p * p_dt_size);
+    std::vector<float> max(M, -std::numeric_limits<float>::infinity());
+    std::vector<float> sum(M, 0.f), O(M * ld_o, 0.f);
+
+    for (memory::dim b = 0; b < nblocks; b++) {
+        softmax.execute(S.data() + b * N_blk, P.data(), max.data(), sum.data(),
+                O.data());
+        // O += P * V_b with the probabilities as the user would read them.
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N_blk; n++) {
+            const float p = load_value(p_impl_dt, P, m * ld_p + n);
+            for (memory::dim j = 0; j < N_o; j++)
+                O[m * ld_o + j] += p * V[(b * N_blk + n) * N_o + j];
+        }
+    }
+    softmax.finalize(sum.data(), O.data());
+
+    for (memory::dim m = 0; m < M; m++) {
+        const float *s = S.data() + m * ld_s;
+        const float ref_max = *std::max_element(s, s + N);
+        float ref_sum = 0.f;
+        for (memory::dim n = 0; n < N; n++)
+            ref_sum += ::expf(s[n] - ref_max);
+        ASSERT_EQ(max[m], ref_max);
+        ASSERT_NEAR(sum[m], ref_sum, 1e-5f * ref_sum);
+
+        for (memory::dim j = 0; j < N_o; j++) {
+            float ref_o = 0.f;
+            for (memory::dim n = 0; n < N; n++)
+                ref_o += ::expf(s[n] - ref_max) / ref_sum * V[n * N_o + j];
+            // The values of V are at most 3 in magnitude.
+            ASSERT_NEAR(O[m * ld_o + j], ref_o, 3.f * tolerance(p_impl_dt))
+                    << "m = " << m << " j = " << j;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(DataTypes, ukernel_softmax_test_t,
+        ::testing::Values(memory::data_type::f32, memory::data_type::bf16,
+                memory::data_type::f16));
+
+#endif
+
+} // namespace dnnl
@@ -0,0 +1,349 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+
+struct embedding_test_params_t {
+    algorithm aalgorithm;
+    dt src_dt;
+    dt dst_dt;
+    memory::dim table_rows;
+    memory::dim emb_dim;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    bool with_weights;
+    // The masks of the source scales and zero points, -1 for none.
+    int scales_mask;
+    int zp_mask;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class embedding_test_t
+    : public ::testing::TestWithParam<embedding_test_params_t> {
+private:
+    embedding_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<embedding_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(p.src_dt, p.dst_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    bool is_int4() const { return p.src_dt == dt::s4 || p.src_dt == dt::u4; }
+    bool is_signed() const { return p.src_dt != dt::u4 && p.src_dt != dt::u8; }
+
+    // Small integer values, exactly representable by every table data type.
+    int table_value(memory::dim r, memory::dim c) const {
+        const int v = static_cast<int>((r * 7 + c * 3) % 15);
+        return is_signed() ? v - 7 : v;
+    }
+    float scale_value(memory::dim r) const {
+        if (p.scales_mask == 0) return 0.5f;
+        return 0.25f * static_cast<float>(r % 4 + 1);
+    }
+    int zp_value(memory::dim r) const {
+        return p.zp_mask == 0 ? 2 : static_cast<int>(r % 3);
+    }
+    float weight_value(size_t i) const {
+        return 0.5f * static_cast<float>(i % 3) + 0.5f;
+    }
+
+    void fill_table(memory &mem) const {
+        if (is_int4()) {
+            auto ptr = map_memory<uint8_t>(mem);
+            for (memory::dim r = 0; r < p.table_rows; ++r)
+                for (memory::dim c = 0; c < p.emb_dim; c += 2) {
+                    const int lo = table_value(r, c) & 0xf;
+                    const int hi = table_value(r, c + 1) & 0xf;
+                    ptr[(r * p.emb_dim + c) / 2]
+                            = static_cast<uint8_t>(lo | (hi << 4));
+                }
+            return;
+        }
+        switch (p.src_dt) {
+            case dt::f32: fill_table<float>(mem); break;
+            case dt::bf16: fill_table<bfloat16_t>(mem); break;
+            case dt::f16: fill_table<float16_t>(mem); break;
+            case dt::s8: fill_table<int8_t>(mem); break;
+            case dt::u8: fill_table<uint8_t>(mem); break;
+            default: FAIL() << "unexpected data type";
+        }
+    }
+
+    template <typename data_t>
+    void fill_table(memory &mem) const {
+        auto ptr = map_memory<data_t>(mem);
+        for (memory::dim r = 0; r < p.table_rows; ++r)
+            for (memory::dim c = 0; c < p.emb_dim; ++c)
+                ptr[r * p.emb_dim + c]
+                        = static_cast<data_t>(static_cast<float>(
+                                table_value(r, c)));
+    }
+
+    template <typename data_t>
+    static std::vector<float> read_dst(const memory &mem, memory::dim n) {
+        std::vector<float> res(n);
+        auto ptr = map_memory<data_t>(mem);
+        for (memory::dim i = 0; i < n; ++i)
+            res[i] = static_cast<float>(ptr[i]);
+        return res;
+    }
+
+    std::vector<float> read_dst(const memory &mem, memory::dim n) const {
+        switch (p.dst_dt) {
+            case dt::bf16: return read_dst<bfloat16_t>(mem, n);
+            case dt::f16: return read_dst<float16_t>(mem, n);
+            default: return read_dst<float>(mem, n);
+        }
+    }
+
+    void Test() {
+        using pd_t = embedding::primitive_desc;
+        const bool is_bag = p.aalgorithm != algorithm::embedding_gather;
+        const memory::dim nindices = static_cast<memory::dim>(p.indices.size());
+        const memory::dim nbags = is_bag
+                ? static_cast<memory::dim>(p.offsets.size())
+                : nindices;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        primitive_attr attr;
+        if (p.scales_mask >= 0)
+            attr.set_scales_mask(DNNL_ARG_SRC, p.scales_mask);
+        if (p.zp_mask >= 0) attr.set_zero_points_mask(DNNL_ARG_SRC, p.zp_mask);
+
+        auto src_md = memory::desc(
+                {p.table_rows, p.emb_dim}, p.src_dt, memory::format_tag::ab);
+        auto ind_md = memory::desc({nindices}, dt::s32, memory::format_tag::a);
+        auto off_md = memory::desc({nbags}, dt::s32, memory::format_tag::a);
+        auto wei_md = memory::desc({nindices}, dt::f32, memory::format_tag::a);
+        auto dst_md = memory::desc(
+                {nbags, p.emb_dim}, p.dst_dt, memory::format_tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctors
+        if (!is_bag)
+            pd = pd_t(eng, src_md, ind_md, dst_md, attr);
+        else if (p.with_weights)
+            pd = pd_t(eng, p.aalgorithm, src_md, ind_md, off_md, wei_md,
+                    dst_md, attr);
+        else
+            pd = pd_t(eng, p.aalgorithm, src_md, ind_md, off_md, dst_md, attr);
+
+        // test a pd constructed from the C API primitive descriptor
+        pd = pd_t(pd.get());
+
+        EXPECT_ANY_THROW(embedding(pd, {}));
+        // default primitive ctor
+        auto prim = embedding();
+        // regular primitive ctor
+        prim = embedding(pd);
+
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_md);
+        ASSERT_TRUE(pd.indices_desc() == ind_md);
+        if (is_bag) { ASSERT_TRUE(pd.offsets_desc() == off_md); }
+        if (p.with_weights) { ASSERT_TRUE(pd.weights_desc() == wei_md); }
+        const auto dst_desc = pd.dst_desc();
+        ASSERT_EQ(dst_desc.get_format_kind(), memory::format_kind::blocked);
+
+        const auto test_engine = pd.get_engine();
+        auto mem_src = test::make_memory(src_md, test_engine);
+        auto mem_ind = test::make_memory(ind_md, test_engine);
+        auto mem_off = test::make_memory(off_md, test_engine);
+        auto mem_wei = test::make_memory(wei_md, test_engine);
+        auto mem_dst = test::make_memory(dst_desc, test_engine);
+        auto mem_scales = test::make_memory(
+                {{p.scales_mask > 0 ? p.table_rows : 1}, dt::f32,
+                        memory::format_tag::a},
+                test_engine);
+        auto mem_zp = test::make_memory({{p.zp_mask > 0 ? p.table_rows : 1},
+                                                dt::s32, memory::format_tag::a},
+                test_engine);
+
+        fill_table(mem_src);
+        {
+            auto ind = map_memory<int32_t>(mem_ind);
+            for (memory::dim i = 0; i < nindices; ++i)
+                ind[i] = p.indices[i];
+            auto off = map_memory<int32_t>(mem_off);
+            for (memory::dim b = 0; is_bag && b < nbags; ++b)
+                off[b] = p.offsets[b];
+            auto wei = map_memory<float>(mem_wei);
+            for (memory::dim i = 0; i < nindices; ++i)
+                wei[i] = weight_value(i);
+            auto scales = map_memory<float>(mem_scales);
+            auto zp = map_memory<int32_t>(mem_zp);
+            for (memory::dim r = 0; r < p.table_rows; ++r) {
+                if (r == 0 || p.scales_mask > 0) scales[r] = scale_value(r);
+                if (r == 0 || p.zp_mask > 0) zp[r] = zp_value(r);
+            }
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_SRC_1, mem_ind}, {DNNL_ARG_DST, mem_dst}};
+        if (is_bag) args.insert({DNNL_ARG_SRC_2, mem_off});
+        if (p.with_weights) args.insert({DNNL_ARG_WEIGHTS, mem_wei});
+        if (p.scales_mask >= 0)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, mem_scales});
+        if (p.zp_mask >= 0)
+            args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, mem_zp});
+        prim.execute(strm, args);
+        strm.wait();
+
+        const auto dst = read_dst(mem_dst, nbags * p.emb_dim);
+        const float eps = p.dst_dt == dt::f32 ? 1e-6f : 1e-2f;
+        for (memory::dim b = 0; b < nbags; ++b) {
+            const memory::dim beg = is_bag ? p.offsets[b] : b;
+            const memory::dim end = !is_bag ? b + 1
+                    : b + 1 < nbags         ? p.offsets[b + 1]
+                                            : nindices;
+            for (memory::dim c = 0; c < p.emb_dim; ++c) {
+                float ref = 0.f;
+                memory::dim nrows = 0;
+                for (memory::dim i = beg; i < end; ++i) {
+                    const memory::dim r = p.indices[i];
+                    if (r < 0 || r >= p.table_rows) continue;
+                    nrows++;
+                    float v = static_cast<float>(table_value(r, c));
+                    if (p.zp_mask >= 0) v -= static_cast<float>(zp_value(r));
+                    if (p.scales_mask >= 0) v *= scale_value(r);
+                    if (p.with_weights) v *= weight_value(i);
+                    ref += v;
+                }
+                if (p.aalgorithm == algorithm::embedding_bag_mean && nrows > 0)
+                    ref /= static_cast<float>(nrows);
+                const float tol = eps * std::max(1.f, std::fabs(ref));
+                ASSERT_NEAR(dst[b * p.emb_dim + c], ref, tol)
+                        << "bag: " << b << " column: " << c;
+            }
+        }
+    }
+};
+
+static std::vector<int32_t> iota_indices(int n, int table_rows) {
+    std::vector<int32_t> res(n);
+    for (int i = 0; i < n; ++i)
+        res[i] = (i * 37) % table_rows;
+    return res;
+}
+
+static std::vector<int32_t> bag_offsets(int nbags, int bag_size) {
+    std::vector<int32_t> res(nbags);
+    for (int b = 0; b < nbags; ++b)
+        res[b] = b * bag_size;
+    return res;
+}
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            embedding_test_params_t {algorithm::eltwise_relu, dt::f32,
+                    dt::f32, 10, 4, {1, 2}, {0}, false, -1, -1, true,
+                    dnnl_invalid_arguments},
+            // integer destination
+            embedding_test_params_t {algorithm::embedding_gather, dt::s8,
+                    dt::s8, 10, 4, {1, 2}, {}, false, -1, -1, true,
+                    dnnl_invalid_arguments},
+            // odd row length of a 4-bit table
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::u4,
+                    dt::f32, 10, 5, {1, 2}, {0}, false, -1, -1, true,
+                    dnnl_unimplemented},
+            // scales along the embedding dimension
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::s8,
+                    dt::f32, 10, 4, {1, 2}, {0}, false, 2, -1, true,
+                    dnnl_unimplemented},
+            // zero points of a floating-point table
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::f32,
+                    dt::f32, 10, 4, {1, 2}, {0}, false, -1, 0, true,
+                    dnnl_unimplemented});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(
+            embedding_test_params_t {algorithm::embedding_gather, dt::f32,
+                    dt::f32, 10, 4, {}, {}, false, -1, -1},
+            // bags without indices are zeroed
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::f32,
+                    dt::f32, 10, 4, {}, {0, 0, 0}, false, -1, -1});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            embedding_test_params_t {algorithm::embedding_gather, dt::f32,
+                    dt::f32, 50, 16, iota_indices(20, 50), {}, false, -1, -1},
+            embedding_test_params_t {algorithm::embedding_gather, dt::s8,
+                    dt::f32, 50, 17, iota_indices(20, 50), {}, false, 1, 1},
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::f32,
+                    dt::f32, 100, 32, iota_indices(64, 100),
+                    bag_offsets(8, 8), false, -1, -1},
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::f32,
+                    dt::f32, 100, 32, iota_indices(64, 100),
+                    bag_offsets(8, 8), true, -1, -1},
+            embedding_test_params_t {algorithm::embedding_bag_mean, dt::bf16,
+                    dt::bf16, 100, 32, iota_indices(64, 100),
+                    bag_offsets(8, 8), false, -1, -1},
+            embedding_test_params_t {algorithm::embedding_bag_mean, dt::f16,
+                    dt::f32, 100, 32, iota_indices(64, 100),
+                    bag_offsets(8, 8), true, 0, -1},
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::u8,
+                    dt::f32, 1000, 64, iota_indices(300, 1000),
+                    bag_offsets(30, 10), true, 1, 1},
+            embedding_test_params_t {algorithm::embedding_bag_mean, dt::s8,
+                    dt::f16, 1000, 64, iota_indices(300, 1000),
+                    bag_offsets(30, 10), false, 1, 0},
+            embedding_test_params_t {algorithm::embedding_bag_sum, dt::s4,
+                    dt::f32, 1000, 64, iota_indices(300, 1000),
+                    bag_offsets(30, 10), false, 1, -1},
+            embedding_test_params_t {algorithm::embedding_bag_mean, dt::u4,
+                    dt::f32, 1000, 66, iota_indices(300, 1000),
+                    bag_offsets(30, 10), true, 1, 1},
+            // empty bags and out of range indices
+            embedding_test_params_t {algorithm::embedding_bag_mean, dt::f32,
+                    dt::f32, 10, 8, {1, -1, 3, 10, 4, 5}, {0, 0, 2, 6}, false,
+                    -1, -1});
+};
+
+TEST_P(embedding_test_t, TestsEmbedding) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestEmbeddingEF, embedding_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingZero, embedding_test_t, zero_dim());
+INSTANTIATE_TEST_SUITE_P(
+        TestEmbeddingSimple, embedding_test_t, simple_cases());
+
+} // namespace dnnl
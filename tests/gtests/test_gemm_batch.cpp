@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+#if DNNL_X64
+#include "tests/test_isa_common.hpp"
+#endif
+
+namespace dnnl {
+
+struct gemm_batch_test_params_t {
+    char transa;
+    char transb;
+    memory::dim M;
+    memory::dim N;
+    memory::dim K;
+    memory::dim batch_size;
+    float beta;
+};
+
+// The matrices hold small integers, which are exact in all the data types,
+// and so are the products, so the results are compared for equality.
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_test_params_t> {
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<gemm_batch_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "GEMM API is available on CPU only.");
+
+        const bool is_ta = p.transa == 't' || p.transa == 'T';
+        const bool is_tb = p.transb == 't' || p.transb == 'T';
+        lda = is_ta ? p.M + 1 : p.K + 2;
+        ldb = is_tb ? p.K + 3 : p.N + 1;
+        ldc = p.N + 2;
+        stride_a = (is_ta ? p.K : p.M) * lda + 5;
+        stride_b = (is_tb ? p.N : p.K) * ldb + 3;
+        stride_c = p.M * ldc + 1;
+
+        a.resize(p.batch_size * stride_a);
+        b.resize(p.batch_size * stride_b);
+        c_init.resize(p.batch_size * stride_c);
+        for (size_t i = 0; i < a.size(); i++)
+            a[i] = float((int)(i % 7) - 3);
+        for (size_t i = 0; i < b.size(); i++)
+            b[i] = float((int)(i % 5) - 2);
+        for (size_t i = 0; i < c_init.size(); i++)
+            c_init[i] = float((int)(i % 3) - 1);
+
+        c_ref = c_init;
+        for (memory::dim ib = 0; ib < p.batch_size; ib++)
+            for (memory::dim m = 0; m < p.M; m++)
+                for (memory::dim n = 0; n < p.N; n++) {
+                    float acc = 0.f;
+                    for (memory::dim k = 0; k < p.K; k++) {
+                        const float va = a[ib * stride_a
+                                + (is_ta ? k * lda + m : m * lda + k)];
+                        const float vb = b[ib * stride_b
+                                + (is_tb ? n * ldb + k : k * ldb + n)];
+                        acc += va * vb;
+                    }
+                    float &vc = c_ref[ib * stride_c + m * ldc + n];
+                    vc = acc + p.beta * vc;
+                }
+    }
+
+    void check(const std::vector<float> &c) const {
+        for (memory::dim ib = 0; ib < p.batch_size; ib++)
+            for (memory::dim m = 0; m < p.M; m++)
+                for (memory::dim n = 0; n < p.N; n++) {
+                    const memory::dim off = ib * stride_c + m * ldc + n;
+                    ASSERT_EQ(c[off], c_ref[off]);
+                }
+    }
+
+    // Runs the strided and the pointer-array batched entry points on
+    // matrices A and B converted to the data type of the entry points.
+    template <typename data_t, typename convert_t, typename strided_t,
+            typename batch_t>
+    void test(const convert_t &convert, const strided_t &gemm_strided,
+            const batch_t &gemm_batch) const {
+        std::vector<data_t> a_dt(a.size()), b_dt(b.size());
+        for (size_t i = 0; i < a.size(); i++)
+            a_dt[i] = convert(a[i]);
+        for (size_t i = 0; i < b.size(); i++)
+            b_dt[i] = convert(b[i]);
+
+        std::vector<float> c = c_init;
+        ASSERT_EQ(gemm_strided(p.transa, p.transb, p.M, p.N, p.K, 1.f,
+                          a_dt.data(), lda, stride_a, b_dt.data(), ldb,
+                          stride_b, p.beta, c.data(), ldc, stride_c,
+                          p.batch_size),
+                dnnl_success);
+        check(c);
+
+        std::vector<const data_t *> a_ptrs, b_ptrs;
+        std::vector<float *> c_ptrs;
+        c = c_init;
+        for (memory::dim ib = 0; ib < p.batch_size; ib++) {
+            a_ptrs.push_back(a_dt.data() + ib * stride_a);
+            b_ptrs.push_back(b_dt.data() + ib * stride_b);
+            c_ptrs.push_back(c.data() + ib * stride_c);
+        }
+        ASSERT_EQ(gemm_batch(p.transa, p.transb, p.M, p.N, p.K, 1.f,
+                          a_ptrs.data(), lda, b_ptrs.data(), ldb, p.beta,
+                          c_ptrs.data(), ldc, p.batch_size),
+                dnnl_success);
+        check(c);
+    }
+
+    gemm_batch_test_params_t p;
+    memory::dim lda, ldb, ldc, stride_a, stride_b, stride_c;
+    std::vector<float> a, b, c_init, c_ref;
+};
+
+TEST_P(gemm_batch_test_t, TestF32) {
+    test<float>([](float v) { return v; }, dnnl_sgemm_batch_strided,
+            dnnl_sgemm_batch);
+}
+
+TEST_P(gemm_batch_test_t, TestBF16) {
+#if DNNL_X64
+    SKIP_IF(!dnnl::mayiuse(cpu_isa::avx512_core),
+            "Skip test for systems that do not support avx512_core.");
+#endif
+    test<uint16_t>([](float v) { return bfloat16_t(v).raw_bits_; },
+            dnnl_gemm_bf16bf16f32_batch_strided, dnnl_gemm_bf16bf16f32_batch);
+}
+
+TEST_P(gemm_batch_test_t, TestF16) {
+    test<uint16_t>([](float v) { return float16_t(v).raw; },
+            dnnl_gemm_f16f16f32_batch_strided, dnnl_gemm_f16f16f32_batch);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(
+                gemm_batch_test_params_t {'n', 'n', 3, 4, 5, 1, 0.f},
+                gemm_batch_test_params_t {'n', 't', 8, 16, 33, 7, 0.5f},
+                gemm_batch_test_params_t {'t', 'n', 17, 5, 64, 64, 1.f},
+                gemm_batch_test_params_t {'t', 't', 32, 32, 32, 100, 0.f},
+                gemm_batch_test_params_t {'n', 'n', 1, 1, 1, 300, 2.f},
+                gemm_batch_test_params_t {'n', 'n', 4, 4, 4, 0, 0.f},
+                gemm_batch_test_params_t {'n', 'n', 0, 4, 4, 3, 0.5f}));
+
+} // namespace dnnl
@@ -63,14 +63,6 @@
     CPU_INST_TEST_CASE_( \
             CONCAT_WITH_UNDERSCORE(str, TEST_CASE_NAME_PREFIX), __VA_ARGS__)
 
-// Declare bfloat16 GEMM interfaces for testing
-extern "C" {
-dnnl_status_t dnnl_gemm_bf16bf16f32(char transa, char transb, dnnl_dim_t M,
-        dnnl_dim_t N, dnnl_dim_t K, float alpha, const bfloat16_t *A,
-        dnnl_dim_t lda, const bfloat16_t *B, dnnl_dim_t ldb, float beta,
-        float *C, dnnl_dim_t ldc);
-}
-
 // Declare packed GEMM interfaces for testing
 #include "src/cpu/gemm/gemm_pack.hpp"
 
@@ -116,69 +108,47 @@ struct dnnl_gemm_t<float, float, float> {
     static dnnl_status_t call_packed(const test_params_t &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
+        char trans_a = p.transA, trans_b = p.transB;
 
         std::vector<float> a_pack_buf, b_pack_buf;
-        float *A = map_memory<float>(b_mem), *a_eff = A;
-        float *B = map_memory<float>(a_mem), *b_eff = B;
+        float *A = map_memory<float>(a_mem), *a_eff = A;
+        float *B = map_memory<float>(b_mem), *b_eff = B;
         float *C = map_memory<float>(c_mem);
 
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
-
         dnnl_status_t status = dnnl_success;
 
-        if (pack_a) {
+        if (p.pack_params.pack_a) {
             size_t a_sz;
-            status = sgemm_pack_get_size("A", &trans_a, &trans_b, &m, &n, &k,
-                    &lda, &ldb, &a_sz, &pack_a);
+            status = dnnl_sgemm_pack_get_size('A', p.transA, p.transB, p.M, p.N,
+                    p.K, p.lda, p.ldb, &a_sz);
             if (status != dnnl_success) return status;
 
-            if (pack_a) {
-                a_pack_buf.resize(a_sz / sizeof(float));
-                a_eff = a_pack_buf.data();
-
-                status = sgemm_pack("A", &trans_a, &trans_b, &m, &n, &k, &lda,
-                        &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
+            a_pack_buf.resize(a_sz / sizeof(*a_eff));
+            a_eff = a_pack_buf.data();
+            status = dnnl_sgemm_pack('A', p.transA, p.transB, p.M, p.N, p.K,
+                    p.lda, p.ldb, A, a_eff);
+            if (status != dnnl_success) return status;
+            trans_a = 'P';
         }
 
-        if (pack_b) {
+        if (p.pack_params.pack_b) {
             size_t b_sz;
-            status = sgemm_pack_get_size("B", &trans_a, &trans_b, &m, &n, &k,
-                    &lda, &ldb, &b_sz, &pack_b);
+            status = dnnl_sgemm_pack_get_size('B', p.transA, p.transB, p.M, p.N,
+                    p.K, p.lda, p.ldb, &b_sz);
             if (status != dnnl_success) return status;
 
-            if (pack_b) {
-                b_pack_buf.resize(b_sz / sizeof(float));
-                b_eff = b_pack_buf.data();
-
-                status = sgemm_pack("B", &trans_a, &trans_b, &m, &n, &k, &lda,
-                        &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
+            b_pack_buf.resize(b_sz / sizeof(*b_eff));
+            b_eff = b_pack_buf.data();
+            status = dnnl_sgemm_pack('B', p.transA, p.transB, p.M, p.N, p.K,
+                    p.lda, p.ldb, B, b_eff);
+            if (status != dnnl_success) return status;
+            trans_b = 'P';
         }
 
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = sgemm_compute(&trans_a, &trans_b, &m, &n, &k, a_eff, &lda,
-                b_eff, &ldb, &p.beta, C, &ldc);
-
-        return status;
+        return dnnl_sgemm_compute(trans_a, trans_b, p.M, p.N, p.K, a_eff, p.lda,
+                b_eff, p.ldb, p.beta, C, p.ldc);
     }
 
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
@@ -461,7 +431,11 @@ struct dnnl_gemm_t<float16_t, float16_t, float> {
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
             const test_memory &b_mem, const test_memory &c_mem,
             const test_memory &) {
-        return dnnl_unimplemented;
+        auto A = map_memory<uint16_t>(a_mem);
+        auto B = map_memory<uint16_t>(b_mem);
+        auto C = map_memory<float>(c_mem);
+        return dnnl_gemm_f16f16f32(p.transA, p.transB, p.M, p.N, p.K, p.alpha,
+                A, p.lda, B, p.ldb, p.beta, C, p.ldc);
     }
 };
 
@@ -470,69 +444,47 @@ struct dnnl_gemm_t<bfloat16_t, bfloat16_t, float> {
     static dnnl_status_t call_packed(const test_params_t &p,
             const test_memory &a_mem, const test_memory &b_mem,
             const test_memory &c_mem) {
-        /* Alas, the internal API still uses Fortran notation.
-         * So in addition to the changes for pack API, we also need to take
-         * care of conversions and layouts */
-
-        using namespace dnnl::impl::cpu;
-
         assert(p.alpha == 1.f);
 
-        /* Prepare for Fortran style, hence A <-> B */
-        char trans_a = p.transB, trans_b = p.transA;
-
-        int64_t m = p.N, n = p.M, k = p.K;
-        int64_t lda = p.ldb, ldb = p.lda, ldc = p.ldc;
+        char trans_a = p.transA, trans_b = p.transB;
 
-        std::vector<bfloat16_t> a_pack_buf, b_pack_buf;
-        bfloat16_t *A = map_memory<bfloat16_t>(b_mem), *a_eff = A;
-        bfloat16_t *B = map_memory<bfloat16_t>(a_mem), *b_eff = B;
+        std::vector<uint16_t> a_pack_buf, b_pack_buf;
+        uint16_t *A = map_memory<uint16_t>(a_mem), *a_eff = A;
+        uint16_t *B = map_memory<uint16_t>(b_mem), *b_eff = B;
         float *C = map_memory<float>(c_mem);
 
-        bool pack_a = p.pack_params.pack_b;
-        bool pack_b = p.pack_params.pack_a;
-
         dnnl_status_t status = dnnl_success;
 
-        if (pack_a) {
+        if (p.pack_params.pack_a) {
             size_t a_sz;
-            status = gemm_bf16bf16f32_pack_get_size("A", &trans_a, &trans_b, &m,
-                    &n, &k, &lda, &ldb, &a_sz, &pack_a);
+            status = dnnl_gemm_bf16bf16f32_pack_get_size('A', p.transA,
+                    p.transB, p.M, p.N, p.K, p.lda, p.ldb, &a_sz);
             if (status != dnnl_success) return status;
 
-            if (pack_a) {
-                a_pack_buf.resize(a_sz / sizeof(*a_eff));
-                a_eff = a_pack_buf.data();
-
-                status = gemm_bf16bf16f32_pack("A", &trans_a, &trans_b, &m, &n,
-                        &k, &lda, &ldb, A, a_eff);
-                if (status != dnnl_success) return status;
-            }
+            a_pack_buf.resize(a_sz / sizeof(*a_eff));
+            a_eff = a_pack_buf.data();
+            status = dnnl_gemm_bf16bf16f32_pack('A', p.transA, p.transB,
+                    p.M, p.N, p.K, p.lda, p.ldb, A, a_eff);
+            if (status != dnnl_success) return status;
+            trans_a = 'P';
         }
 
-        if (pack_b) {
+        if (p.pack_params.pack_b) {
             size_t b_sz;
-            status = gemm_bf16bf16f32_pack_get_size("B", &trans_a, &trans_b, &m,
-                    &n, &k, &lda, &ldb, &b_sz, &pack_b);
+            status = dnnl_gemm_bf16bf16f32_pack_get_size('B', p.transA,
+                    p.transB, p.M, p.N, p.K, p.lda, p.ldb, &b_sz);
             if (status != dnnl_success) return status;
 
-            if (pack_b) {
-                b_pack_buf.resize(b_sz / sizeof(*b_eff));
-                b_eff = b_pack_buf.data();
-
-                status = gemm_bf16bf16f32_pack("B", &trans_a, &trans_b, &m, &n,
-                        &k, &lda, &ldb, B, b_eff);
-                if (status != dnnl_success) return status;
-            }
+            b_pack_buf.resize(b_sz / sizeof(*b_eff));
+            b_eff = b_pack_buf.data();
+            status = dnnl_gemm_bf16bf16f32_pack('B', p.transA, p.transB,
+                    p.M, p.N, p.K, p.lda, p.ldb, B, b_eff);
+            if (status != dnnl_success) return status;
+            trans_b = 'P';
         }
 
-        if (pack_a) trans_a = 'P';
-        if (pack_b) trans_b = 'P';
-
-        status = gemm_bf16bf16f32_compute(&trans_a, &trans_b, &m, &n, &k, a_eff,
-                &lda, b_eff, &ldb, &p.beta, C, &ldc);
-
-        return status;
+        return dnnl_gemm_bf16bf16f32_compute(trans_a, trans_b, p.M, p.N, p.K,
+                a_eff, p.lda, b_eff, p.ldb, p.beta, C, p.ldc);
     }
 
     static dnnl_status_t call(const test_params_t &p, const test_memory &a_mem,
@@ -541,8 +493,8 @@ struct dnnl_gemm_t<bfloat16_t, bfloat16_t, float> {
         if (p.pack_params.pack_a || p.pack_params.pack_b)
             return call_packed(p, a_mem, b_mem, c_mem);
 
-        auto A = map_memory<bfloat16_t>(a_mem);
-        auto B = map_memory<bfloat16_t>(b_mem);
+        auto A = map_memory<uint16_t>(a_mem);
+        auto B = map_memory<uint16_t>(b_mem);
         auto C = map_memory<float>(c_mem);
         return dnnl_gemm_bf16bf16f32(p.transA, p.transB, p.M, p.N, p.K, p.alpha,
                 A, p.lda, B, p.ldb, p.beta, C, p.ldc);
@@ -609,9 +561,9 @@ protected:
                 "Engine does not support this data type.");
 
         bool is_f16
-                = (data_traits_t<a_dt>::data_type == memory::data_type::f16);
+                = (data_traits_t<c_dt>::data_type == memory::data_type::f16);
         SKIP_IF(is_f16 && get_test_engine_kind() == engine::kind::cpu,
-                "CPU does not support f16 data type.");
+                "CPU does not support f16f16f16 GEMM.");
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
         SKIP_IF(get_test_engine_kind() == engine::kind::cpu,
@@ -0,0 +1,369 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+
+struct grouped_matmul_test_params_t {
+    dt src_dt;
+    dt wei_dt;
+    dt dst_dt;
+    memory::dim M;
+    memory::dim K;
+    memory::dim N;
+    // The end of the rows of every group.
+    std::vector<int32_t> offsets;
+    bool with_bias;
+    // The masks of the weights scales and zero points, -1 for none, and the
+    // size of their groups along K, 0 for none.
+    int scales_mask;
+    int zp_mask;
+    memory::dim group_k;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class grouped_matmul_test_t
+    : public ::testing::TestWithParam<grouped_matmul_test_params_t> {
+private:
+    grouped_matmul_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<grouped_matmul_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(p.src_dt, p.dst_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    memory::dim ngroups() const {
+        return static_cast<memory::dim>(p.offsets.size());
+    }
+    bool is_int4() const { return p.wei_dt == dt::s4 || p.wei_dt == dt::u4; }
+    bool is_signed() const { return p.wei_dt != dt::u4 && p.wei_dt != dt::u8; }
+
+    // Small integer values, exactly representable by every data type.
+    float src_value(memory::dim m, memory::dim k) const {
+        return static_cast<float>((m * 5 + k * 3) % 7) - 3.f;
+    }
+    int wei_value(memory::dim g, memory::dim k, memory::dim n) const {
+        const int v = static_cast<int>((g * 3 + k * 5 + n * 7) % 15);
+        return is_signed() ? v - 7 : v;
+    }
+    float bias_value(memory::dim g, memory::dim n) const {
+        return static_cast<float>((g + n) % 5) - 2.f;
+    }
+
+    // The dimensions of the quantization parameters of the weights.
+    memory::dims qparams_dims(int mask) const {
+        const memory::dim group_k = p.group_k > 0 ? p.group_k : 1;
+        return {mask & 1 ? ngroups() : 1, mask & 2 ? p.K / group_k : 1,
+                mask & 4 ? p.N : 1};
+    }
+    memory::dim qparams_off(
+            int mask, memory::dim g, memory::dim k, memory::dim n) const {
+        const auto dims = qparams_dims(mask);
+        const memory::dim group_k = p.group_k > 0 ? p.group_k : 1;
+        return ((mask & 1 ? g : 0) * dims[1] + (mask & 2 ? k / group_k : 0))
+                * dims[2]
+                + (mask & 4 ? n : 0);
+    }
+    static memory::dim nelems(const memory::dims &dims) {
+        memory::dim res = 1;
+        for (auto d : dims)
+            res *= d;
+        return res;
+    }
+    float scale_value(memory::dim off) const {
+        return 0.25f * static_cast<float>(off % 4 + 1);
+    }
+    int zp_value(memory::dim off) const { return static_cast<int>(off % 3); }
+
+    template <typename data_t>
+    static void fill(memory &mem, memory::dim n,
+            const std::function<float(memory::dim)> &value) {
+        auto ptr = map_memory<data_t>(mem);
+        for (memory::dim i = 0; i < n; ++i)
+            ptr[i] = static_cast<data_t>(value(i));
+    }
+
+    static void fill(memory &mem, dt data_type, memory::dim n,
+            const std::function<float(memory::dim)> &value) {
+        switch (data_type) {
+            case dt::f32: fill<float>(mem, n, value); break;
+            case dt::bf16: fill<bfloat16_t>(mem, n, value); break;
+            case dt::f16: fill<float16_t>(mem, n, value); break;
+            case dt::s8: fill<int8_t>(mem, n, value); break;
+            case dt::u8: fill<uint8_t>(mem, n, value); break;
+            default: FAIL() << "unexpected data type";
+        }
+    }
+
+    void fill_weights(memory &mem) const {
+        const memory::dim KN = p.K * p.N;
+        if (is_int4()) {
+            auto ptr = map_memory<uint8_t>(mem);
+            for (memory::dim i = 0; i < ngroups() * KN; i += 2) {
+                const memory::dim g = i / KN, k = i % KN / p.N, n = i % p.N;
+                const int lo = wei_value(g, k, n) & 0xf;
+                const int hi = wei_value(g, k, n + 1) & 0xf;
+                ptr[i / 2] = static_cast<uint8_t>(lo | (hi << 4));
+            }
+            return;
+        }
+        fill(mem, p.wei_dt, ngroups() * KN, [&](memory::dim i) {
+            return static_cast<float>(
+                    wei_value(i / KN, i % KN / p.N, i % p.N));
+        });
+    }
+
+    template <typename data_t>
+    static std::vector<float> read_dst(const memory &mem, memory::dim n) {
+        std::vector<float> res(n);
+        auto ptr = map_memory<data_t>(mem);
+        for (memory::dim i = 0; i < n; ++i)
+            res[i] = static_cast<float>(ptr[i]);
+        return res;
+    }
+
+    std::vector<float> read_dst(const memory &mem, memory::dim n) const {
+        switch (p.dst_dt) {
+            case dt::bf16: return read_dst<bfloat16_t>(mem, n);
+            case dt::f16: return read_dst<float16_t>(mem, n);
+            default: return read_dst<float>(mem, n);
+        }
+    }
+
+    void Test() {
+        using pd_t = grouped_matmul::primitive_desc;
+        const memory::dim G = ngroups();
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        primitive_attr attr;
+        const memory::dims groups = p.group_k > 0
+                ? memory::dims {p.group_k, 1}
+                : memory::dims {};
+        if (p.scales_mask >= 0)
+            attr.set_scales(DNNL_ARG_WEIGHTS, p.scales_mask, groups);
+        if (p.zp_mask >= 0)
+            attr.set_zero_points(DNNL_ARG_WEIGHTS, p.zp_mask, groups);
+
+        auto src_md = memory::desc(
+                {p.M, p.K}, p.src_dt, memory::format_tag::any);
+        auto wei_md = memory::desc(
+                {G, p.K, p.N}, p.wei_dt, memory::format_tag::abc);
+        auto off_md = memory::desc({G}, dt::s32, memory::format_tag::a);
+        auto bia_md = memory::desc({G, p.N}, dt::f32, memory::format_tag::ab);
+        auto dst_md = memory::desc(
+                {p.M, p.N}, p.dst_dt, memory::format_tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctors
+        if (p.with_bias)
+            pd = pd_t(eng, src_md, wei_md, off_md, bia_md, dst_md, attr);
+        else
+            pd = pd_t(eng, src_md, wei_md, off_md, dst_md, attr);
+
+        // test a pd constructed from the C API primitive descriptor
+        pd = pd_t(pd.get());
+
+        EXPECT_ANY_THROW(grouped_matmul(pd, {}));
+        // default primitive ctor
+        auto prim = grouped_matmul();
+        // regular primitive ctor
+        prim = grouped_matmul(pd);
+
+        ASSERT_TRUE(pd.weights_desc() == wei_md);
+        ASSERT_TRUE(pd.offsets_desc() == off_md);
+        if (p.with_bias) { ASSERT_TRUE(pd.bias_desc() == bia_md); }
+        const auto src_desc = pd.src_desc();
+        const auto dst_desc = pd.dst_desc();
+        ASSERT_EQ(src_desc.get_format_kind(), memory::format_kind::blocked);
+        ASSERT_EQ(dst_desc.get_format_kind(), memory::format_kind::blocked);
+
+        const auto test_engine = pd.get_engine();
+        auto mem_src = test::make_memory(src_desc, test_engine);
+        auto mem_wei = test::make_memory(wei_md, test_engine);
+        auto mem_off = test::make_memory(off_md, test_engine);
+        auto mem_bia = test::make_memory(bia_md, test_engine);
+        auto mem_dst = test::make_memory(dst_desc, test_engine);
+        auto mem_scales = test::make_memory(
+                {{nelems(qparams_dims(std::max(p.scales_mask, 0)))}, dt::f32,
+                        memory::format_tag::a},
+                test_engine);
+        auto mem_zp = test::make_memory(
+                {{nelems(qparams_dims(std::max(p.zp_mask, 0)))}, dt::s32,
+                        memory::format_tag::a},
+                test_engine);
+
+        fill(mem_src, p.src_dt, p.M * p.K,
+                [&](memory::dim i) { return src_value(i / p.K, i % p.K); });
+        fill_weights(mem_wei);
+        fill(mem_bia, dt::f32, G * p.N,
+                [&](memory::dim i) { return bias_value(i / p.N, i % p.N); });
+        fill(mem_scales, dt::f32,
+                nelems(qparams_dims(std::max(p.scales_mask, 0))),
+                [&](memory::dim i) { return scale_value(i); });
+        {
+            auto off = map_memory<int32_t>(mem_off);
+            for (memory::dim g = 0; g < G; ++g)
+                off[g] = p.offsets[g];
+            auto zp = map_memory<int32_t>(mem_zp);
+            for (memory::dim i = 0;
+                    i < nelems(qparams_dims(std::max(p.zp_mask, 0))); ++i)
+                zp[i] = zp_value(i);
+        }
+        // The rows out of the groups are not written.
+        fill(mem_dst, p.dst_dt, p.M * p.N, [](memory::dim) { return 42.f; });
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_SRC_1, mem_off}, {DNNL_ARG_WEIGHTS, mem_wei},
+                {DNNL_ARG_DST, mem_dst}};
+        if (p.with_bias) args.insert({DNNL_ARG_BIAS, mem_bia});
+        if (p.scales_mask >= 0)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, mem_scales});
+        if (p.zp_mask >= 0)
+            args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS, mem_zp});
+        prim.execute(strm, args);
+        strm.wait();
+
+        const auto dst = read_dst(mem_dst, p.M * p.N);
+        const float eps = p.src_dt == dt::f32 && p.dst_dt == dt::f32 ? 1e-5f
+                                                                     : 1e-2f;
+        memory::dim beg = 0;
+        for (memory::dim g = 0; g < G; ++g) {
+            const memory::dim end = std::max(
+                    beg, std::min<memory::dim>(p.offsets[g], p.M));
+            for (memory::dim m = beg; m < end; ++m)
+                for (memory::dim n = 0; n < p.N; ++n) {
+                    float ref = p.with_bias ? bias_value(g, n) : 0.f;
+                    for (memory::dim k = 0; k < p.K; ++k) {
+                        float w = static_cast<float>(wei_value(g, k, n));
+                        if (p.zp_mask >= 0)
+                            w -= static_cast<float>(zp_value(
+                                    qparams_off(p.zp_mask, g, k, n)));
+                        if (p.scales_mask >= 0)
+                            w *= scale_value(
+                                    qparams_off(p.scales_mask, g, k, n));
+                        ref += src_value(m, k) * w;
+                    }
+                    const float tol = eps * std::max(1.f, std::fabs(ref));
+                    ASSERT_NEAR(dst[m * p.N + n], ref, tol)
+                            << "group: " << g << " row: " << m
+                            << " column: " << n;
+                }
+            beg = end;
+        }
+        for (memory::dim m = beg; m < p.M; ++m)
+            for (memory::dim n = 0; n < p.N; ++n)
+                ASSERT_EQ(dst[m * p.N + n], 42.f)
+                        << "row: " << m << " column: " << n;
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // integer source
+            grouped_matmul_test_params_t {dt::s8, dt::s8, dt::f32, 8, 16, 16,
+                    {4, 8}, false, -1, -1, 0, true, dnnl_invalid_arguments},
+            // integer destination
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::s8, 8, 16, 16,
+                    {4, 8}, false, -1, -1, 0, true, dnnl_invalid_arguments},
+            // odd rows of 4-bit weights
+            grouped_matmul_test_params_t {dt::f32, dt::u4, dt::f32, 8, 16, 15,
+                    {4, 8}, false, -1, -1, 0, true, dnnl_unimplemented},
+            // groups not dividing K
+            grouped_matmul_test_params_t {dt::f32, dt::s8, dt::f32, 8, 48, 16,
+                    {4, 8}, false, 7, -1, 32, true, dnnl_unimplemented},
+            // zero points of floating-point weights
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 8, 16, 16,
+                    {4, 8}, false, -1, 0, 0, true, dnnl_unimplemented});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 0, 16, 16,
+                    {0, 0}, false, -1, -1, 0},
+            // empty groups
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 8, 16, 16,
+                    {0, 0, 0}, true, -1, -1, 0},
+            // no reduction, the destination is the bias
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 8, 0, 16,
+                    {3, 8}, true, -1, -1, 0});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 64, 32,
+                    48, {10, 10, 40, 64}, false, -1, -1, 0},
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 100, 300,
+                    130, {1, 70, 71, 100}, true, -1, -1, 0},
+            grouped_matmul_test_params_t {dt::bf16, dt::bf16, dt::bf16, 64,
+                    64, 64, {16, 32, 48, 64}, true, -1, -1, 0},
+            grouped_matmul_test_params_t {dt::f16, dt::f16, dt::f32, 40, 64,
+                    32, {20, 40}, false, -1, -1, 0},
+            // unsorted offsets and rows out of the groups
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 50, 16,
+                    16, {20, 10, 30, 200}, false, -1, -1, 0},
+            grouped_matmul_test_params_t {dt::f32, dt::f32, dt::f32, 50, 16,
+                    16, {5, 20, 30}, true, -1, -1, 0},
+            // weights decompression
+            grouped_matmul_test_params_t {dt::f32, dt::s8, dt::f32, 64, 128,
+                    96, {7, 50, 64}, true, 5, -1, 0},
+            grouped_matmul_test_params_t {dt::bf16, dt::u8, dt::f32, 64, 128,
+                    96, {30, 31, 64}, false, 5, 5, 0},
+            grouped_matmul_test_params_t {dt::f32, dt::s4, dt::f32, 64, 512,
+                    64, {33, 64}, false, 7, -1, 64},
+            grouped_matmul_test_params_t {dt::f16, dt::u4, dt::f16, 64, 512,
+                    64, {12, 40, 64}, true, 7, 7, 128},
+            grouped_matmul_test_params_t {dt::f32, dt::u4, dt::f32, 32, 64,
+                    32, {16, 32}, false, 0, 1, 0},
+            // tails of the M, N and K blocks of the tiles
+            grouped_matmul_test_params_t {dt::f32, dt::s8, dt::f32, 150, 600,
+                    200, {33, 100, 150}, true, 7, 6, 100},
+            grouped_matmul_test_params_t {dt::bf16, dt::u4, dt::bf16, 90,
+                    520, 130, {45, 46, 90}, false, 3, 7, 40});
+};
+
+TEST_P(grouped_matmul_test_t, TestsGroupedMatmul) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestGroupedMatmulEF, grouped_matmul_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(
+        TestGroupedMatmulZero, grouped_matmul_test_t, zero_dim());
+INSTANTIATE_TEST_SUITE_P(
+        TestGroupedMatmulSimple, grouped_matmul_test_t, simple_cases());
+
+} // namespace dnnl
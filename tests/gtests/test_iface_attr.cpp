@@ -127,6 +127,418 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestSrcNormalization) {
+    dnnl::primitive_attr attr;
+    float eps = 0.f;
+    normalization_flags flags = normalization_flags::none;
+    EXPECT_ANY_THROW(attr.get_src_normalization(eps, flags));
+
+    const auto ref_flags
+            = normalization_flags::use_scale | normalization_flags::use_shift;
+    attr.set_src_normalization(1e-5f, ref_flags);
+    attr.get_src_normalization(eps, flags);
+    ASSERT_EQ(eps, 1e-5f);
+    ASSERT_EQ(flags, ref_flags);
+
+    EXPECT_ANY_THROW(attr.set_src_normalization(-1.f, ref_flags));
+    EXPECT_ANY_THROW(attr.set_src_normalization(
+            1e-5f, normalization_flags::fuse_norm_relu));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSrcNormalizationMatmul) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Source normalization is supported on CPU only");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    // K covers full vectors and a tail of the normalization of a row.
+    const memory::dim M = 7, K = 67, N = 19;
+    const float eps = 1e-5f;
+    const auto flags
+            = normalization_flags::use_scale | normalization_flags::use_shift;
+
+    memory::desc src_f32_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_f32_md({K, N}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+    memory::desc ss_md({K}, data_type::f32, tag::a);
+
+    memory src_f32(src_f32_md, eng), wei_f32(wei_f32_md, eng),
+            scale(ss_md, eng), shift(ss_md, eng);
+    fill_data<float>(M * K, src_f32, 1.f, 2.f);
+    fill_data<float>(K * N, wei_f32, 0.f, 1.f);
+    fill_data<float>(K, scale, 1.f, 0.5f);
+    fill_data<float>(K, shift, 0.f, 0.5f);
+
+    for (auto dt : {data_type::f32, data_type::bf16}) {
+        if (unsupported_data_type(dt)) continue;
+
+        memory::desc src_md({M, K}, dt, tag::ab);
+        memory::desc wei_md({K, N}, dt, tag::ab);
+        memory src(src_md, eng), wei(wei_md, eng);
+        reorder(src_f32, src).execute(strm, src_f32, src);
+        reorder(wei_f32, wei).execute(strm, wei_f32, wei);
+
+        // Reference: layer normalization followed by a matmul.
+        memory norm(src_md, eng), ref_dst(dst_md, eng);
+        auto lnorm_pd = layer_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_inference, src_md, src_md, eps, flags);
+        layer_normalization_forward(lnorm_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, norm},
+                        {DNNL_ARG_SCALE, scale}, {DNNL_ARG_SHIFT, shift}});
+        auto ref_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        matmul(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC, norm}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, ref_dst}});
+
+        dnnl::primitive_attr attr;
+        attr.set_src_normalization(eps, flags);
+        memory dst(dst_md, eng);
+        auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_SRC_NORM_SCALE, scale},
+                        {DNNL_ARG_ATTR_SRC_NORM_SHIFT, shift}});
+        strm.wait();
+
+        // A normalized bf16 value may round the other way than in the layer
+        // normalization.
+        const float tol = dt == data_type::f32 ? 1e-4f : 1e-2f;
+        auto dst_ptr = map_memory<float>(dst);
+        auto ref_ptr = map_memory<float>(ref_dst);
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_NEAR(dst_ptr[i], ref_ptr[i], tol * K);
+    }
+}
+
+TEST_F(attr_test_t, TestAmax) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_amax(DNNL_ARG_SRC));
+    ASSERT_FALSE(attr.get_amax(DNNL_ARG_DST));
+
+    attr.set_amax(DNNL_ARG_DST);
+    ASSERT_FALSE(attr.get_amax(DNNL_ARG_SRC));
+    ASSERT_TRUE(attr.get_amax(DNNL_ARG_DST));
+
+    attr.set_amax(DNNL_ARG_SRC);
+    ASSERT_TRUE(attr.get_amax(DNNL_ARG_SRC));
+
+    EXPECT_ANY_THROW(attr.set_amax(DNNL_ARG_WEIGHTS));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestAmaxExecution) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Amax attribute is supported on CPU only");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    // The values span [-15, 9.75].
+    const memory::dim N = 100;
+    memory::desc data_md({N}, data_type::f32, tag::a);
+    memory::desc amax_md({1}, data_type::f32, tag::a);
+    memory src(data_md, eng), src_amax(amax_md, eng), dst_amax(amax_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < N; i++)
+            src_ptr[i] = 0.25f * (i - 60);
+    }
+
+    dnnl::primitive_attr attr;
+    attr.set_amax(DNNL_ARG_SRC);
+    attr.set_amax(DNNL_ARG_DST);
+
+    // Eltwise: the destination amax is the one of the activated values.
+    memory dst(data_md, eng);
+    auto eltwise_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, data_md,
+            data_md, 0.f, 0.f, attr);
+    eltwise_forward(eltwise_pd)
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_ATTR_SRC_AMAX, src_amax},
+                            {DNNL_ARG_ATTR_DST_AMAX, dst_amax}});
+    strm.wait();
+    ASSERT_EQ(map_memory<float>(src_amax)[0], 15.f);
+    ASSERT_EQ(map_memory<float>(dst_amax)[0], 9.75f);
+
+    // Reorder to fp8: the destination amax is taken after the source scales.
+    memory::desc f8_md({N}, data_type::f8_e4m3, tag::a);
+    memory f8_dst(f8_md, eng);
+    memory src_scale({{1}, data_type::f32, tag::a}, eng);
+    map_memory<float>(src_scale)[0] = 0.5f;
+    attr.set_scales_mask(DNNL_ARG_SRC, 0);
+    auto reorder_pd
+            = reorder::primitive_desc(eng, data_md, eng, f8_md, attr);
+    reorder(reorder_pd).execute(strm,
+            {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, f8_dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, src_scale},
+                    {DNNL_ARG_ATTR_SRC_AMAX, src_amax},
+                    {DNNL_ARG_ATTR_DST_AMAX, dst_amax}});
+    strm.wait();
+    ASSERT_EQ(map_memory<float>(src_amax)[0], 15.f);
+    ASSERT_EQ(map_memory<float>(dst_amax)[0], 7.5f);
+}
+
+// The optimized implementations compute the maxima in their kernels or with a
+// pass over the source. The shapes leave tails everywhere, and the values stay
+// below the exp(0) an unmasked tail lane would bring in.
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestAmaxOptimized) {
+    auto engine_kind = get_test_engine_kind();
+    bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+            || (engine_kind != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx512_core);
+#endif
+    SKIP_IF(skip_test,
+            "Optimized amax test is supported only on avx512_core CPU");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    memory::desc amax_md({1}, data_type::f32, tag::a);
+    memory src_amax(amax_md, eng), dst_amax(amax_md, eng);
+    auto max_abs = [](const memory &mem, memory::dim n) {
+        auto ptr = map_memory<float>(mem);
+        float m = 0.f;
+        for (memory::dim i = 0; i < n; i++)
+            m = std::max(m, std::fabs(ptr[i]));
+        return m;
+    };
+    auto is_ref = [](const std::string &impl_info) {
+        return impl_info.find("ref") != std::string::npos;
+    };
+
+    dnnl::primitive_attr attr;
+    attr.set_amax(DNNL_ARG_SRC);
+    attr.set_amax(DNNL_ARG_DST);
+
+    // Eltwise
+    const memory::dim nelems = 1003;
+    memory::desc data_md({nelems}, data_type::f32, tag::a);
+    memory src(data_md, eng), dst(data_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; i++)
+            src_ptr[i] = -0.5f - 0.01f * i;
+    }
+    auto eltwise_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_exp, data_md,
+            data_md, 0.f, 0.f, attr);
+    ASSERT_FALSE(is_ref(eltwise_pd.impl_info_str()));
+    eltwise_forward(eltwise_pd)
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_ATTR_SRC_AMAX, src_amax},
+                            {DNNL_ARG_ATTR_DST_AMAX, dst_amax}});
+    strm.wait();
+    ASSERT_EQ(map_memory<float>(src_amax)[0], max_abs(src, nelems));
+    ASSERT_EQ(map_memory<float>(dst_amax)[0], max_abs(dst, nelems));
+
+    // Matmul: the destination amax is taken before the destination scale.
+    const memory::dim M = 37, K = 29, N = 45;
+    memory::desc a_md({M, K}, data_type::f32, tag::ab);
+    memory::desc b_md({K, N}, data_type::f32, tag::ab);
+    memory::desc c_md({M, N}, data_type::f32, tag::ab);
+    memory a(a_md, eng), b(b_md, eng), c(c_md, eng);
+    {
+        auto a_ptr = map_memory<float>(a);
+        auto b_ptr = map_memory<float>(b);
+        for (memory::dim i = 0; i < M * K; i++)
+            a_ptr[i] = 0.01f * (i % 17 + 1);
+        for (memory::dim i = 0; i < K * N; i++)
+            b_ptr[i] = -0.01f * (i % 13 + 1);
+    }
+    memory dst_scale({{1}, data_type::f32, tag::a}, eng);
+    map_memory<float>(dst_scale)[0] = 0.5f;
+
+    dnnl::primitive_attr mm_attr = attr;
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_exp, 0.f, 0.f);
+    mm_attr.set_post_ops(ops);
+    mm_attr.set_scales_mask(DNNL_ARG_DST, 0);
+    auto matmul_pd = matmul::primitive_desc(eng, a_md, b_md, c_md, mm_attr);
+    ASSERT_FALSE(is_ref(matmul_pd.impl_info_str()));
+    matmul(matmul_pd).execute(strm,
+            {{DNNL_ARG_SRC, a}, {DNNL_ARG_WEIGHTS, b}, {DNNL_ARG_DST, c},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, dst_scale},
+                    {DNNL_ARG_ATTR_SRC_AMAX, src_amax},
+                    {DNNL_ARG_ATTR_DST_AMAX, dst_amax}});
+    strm.wait();
+    ASSERT_EQ(map_memory<float>(src_amax)[0], max_abs(a, M * K));
+    ASSERT_EQ(map_memory<float>(dst_amax)[0], 0.5f * max_abs(c, M * N));
+
+    // Reorder: the destination amax follows from the source one.
+    memory::desc ba_md({M, K}, data_type::bf16, tag::ba);
+    memory a_t(ba_md, eng);
+    memory src_scale({{1}, data_type::f32, tag::a}, eng);
+    map_memory<float>(src_scale)[0] = -4.f;
+    dnnl::primitive_attr r_attr = attr;
+    r_attr.set_scales_mask(DNNL_ARG_SRC, 0);
+    auto reorder_pd = reorder::primitive_desc(eng, a_md, eng, ba_md, r_attr);
+    ASSERT_FALSE(is_ref(reorder_pd.impl_info_str()));
+    reorder(reorder_pd).execute(strm,
+            {{DNNL_ARG_FROM, a}, {DNNL_ARG_TO, a_t},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, src_scale},
+                    {DNNL_ARG_ATTR_SRC_AMAX, src_amax},
+                    {DNNL_ARG_ATTR_DST_AMAX, dst_amax}});
+    strm.wait();
+    ASSERT_EQ(map_memory<float>(src_amax)[0], max_abs(a, M * K));
+    ASSERT_EQ(map_memory<float>(dst_amax)[0], 4.f * max_abs(a, M * K));
+}
+
+// A matmul with an empty destination still writes the maxima.
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestAmaxZeroDim) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Amax attribute is supported on CPU only");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    memory::desc amax_md({1}, data_type::f32, tag::a);
+    memory src_amax(amax_md, eng), dst_amax(amax_md, eng);
+    map_memory<float>(src_amax)[0] = -1.f;
+    map_memory<float>(dst_amax)[0] = -1.f;
+
+    dnnl::primitive_attr attr;
+    attr.set_amax(DNNL_ARG_SRC);
+    attr.set_amax(DNNL_ARG_DST);
+
+    memory::desc a_md({2, 3}, data_type::f32, tag::ab);
+    memory::desc b_md({3, 0}, data_type::f32, tag::ab);
+    memory::desc c_md({2, 0}, data_type::f32, tag::ab);
+    memory a(a_md, eng), b(b_md, eng), c(c_md, eng);
+    {
+        auto a_ptr = map_memory<float>(a);
+        for (int i = 0; i < 6; i++)
+            a_ptr[i] = -0.5f * i;
+    }
+    auto matmul_pd = matmul::primitive_desc(eng, a_md, b_md, c_md, attr);
+    matmul(matmul_pd).execute(strm,
+            {{DNNL_ARG_SRC, a}, {DNNL_ARG_WEIGHTS, b}, {DNNL_ARG_DST, c},
+                    {DNNL_ARG_ATTR_SRC_AMAX, src_amax},
+                    {DNNL_ARG_ATTR_DST_AMAX, dst_amax}});
+    strm.wait();
+    ASSERT_EQ(map_memory<float>(src_amax)[0], 2.5f);
+    ASSERT_EQ(map_memory<float>(dst_amax)[0], 0.f);
+}
+
+TEST_F(attr_test_t, TestStreaming) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_streaming());
+    attr.set_streaming(true);
+    ASSERT_TRUE(attr.get_streaming());
+    attr.set_streaming(false);
+    ASSERT_FALSE(attr.get_streaming());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestStreamingConvolution) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Streaming convolution is supported on CPU only");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    // A sequence of 3 chunks through a causal convolution with a context of
+    // (KW - 1) * (DW + 1) = 6 frames.
+    const memory::dim N = 2, C = 19, KW = 4, DW = 1, T = 8, n_chunks = 3;
+    const memory::dim context = (KW - 1) * (DW + 1);
+    const memory::dim L = T * n_chunks;
+    const memory::dims strides = {1}, dilates = {DW}, padding_l = {context},
+                       padding_r = {0};
+
+    dnnl::primitive_attr attr;
+    attr.set_streaming(true);
+
+    for (auto tag : {tag::nwc, tag::ncw})
+        for (memory::dim G : {memory::dim(1), C}) {
+            const bool is_nwc = tag == tag::nwc;
+            auto off = [&](memory::dim n, memory::dim c, memory::dim w,
+                               memory::dim W) {
+                return is_nwc ? (n * W + w) * C + c : (n * C + c) * W + w;
+            };
+
+            memory::desc wei_md = G == 1
+                    ? memory::desc({C, C, KW}, data_type::f32, tag::oiw)
+                    : memory::desc(
+                            {G, 1, 1, KW}, data_type::f32, tag::goiw);
+            memory::desc bia_md({C}, data_type::f32, tag::a);
+            memory wei(wei_md, eng), bia(bia_md, eng);
+            fill_data<float>(wei_md.get_size() / sizeof(float), wei);
+            fill_data<float>(C, bia);
+
+            // Reference: the whole sequence with zero padding.
+            memory::desc full_md({N, C, L}, data_type::f32, tag);
+            memory full_src(full_md, eng), full_dst(full_md, eng);
+            fill_data<float>(N * C * L, full_src);
+            auto ref_pd = convolution_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, full_md, wei_md, bia_md,
+                    full_md, strides, dilates, padding_l, padding_r);
+            convolution_forward(ref_pd).execute(strm,
+                    {{DNNL_ARG_SRC, full_src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, full_dst}});
+            strm.wait();
+
+            memory::desc chunk_md({N, C, T}, data_type::f32, tag);
+            auto pd = convolution_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, chunk_md, wei_md, bia_md,
+                    chunk_md, strides, dilates, padding_l, padding_r, attr);
+            auto state_md = pd.query_md(
+                    query::exec_arg_md, DNNL_ARG_ATTR_STREAMING_STATE);
+            ASSERT_EQ(state_md.get_dims(), memory::dims({N, C, context}));
+
+            memory state(state_md, eng), src(chunk_md, eng),
+                    dst(chunk_md, eng);
+            {
+                auto state_ptr = map_memory<float>(state);
+                for (memory::dim i = 0; i < N * C * context; i++)
+                    state_ptr[i] = 0.f;
+            }
+            convolution_forward conv(pd);
+            for (memory::dim k = 0; k < n_chunks; k++) {
+                {
+                    auto src_ptr = map_memory<float>(src);
+                    auto full_src_ptr = map_memory<float>(full_src);
+                    for_(memory::dim n = 0; n < N; n++)
+                    for_(memory::dim c = 0; c < C; c++)
+                    for (memory::dim w = 0; w < T; w++)
+                        src_ptr[off(n, c, w, T)]
+                                = full_src_ptr[off(n, c, k * T + w, L)];
+                }
+                conv.execute(strm,
+                        {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                                {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst},
+                                {DNNL_ARG_ATTR_STREAMING_STATE, state}});
+                strm.wait();
+
+                auto dst_ptr = map_memory<float>(dst);
+                auto full_dst_ptr = map_memory<float>(full_dst);
+                for_(memory::dim n = 0; n < N; n++)
+                for_(memory::dim c = 0; c < C; c++)
+                for (memory::dim w = 0; w < T; w++)
+                    ASSERT_NEAR(dst_ptr[off(n, c, w, T)],
+                            full_dst_ptr[off(n, c, k * T + w, L)],
+                            1e-4f * KW * C / G);
+            }
+
+            // Only causal convolutions can stream.
+            const memory::dims bad_padding_l = {context - 1},
+                               bad_padding_r = {1};
+            EXPECT_ANY_THROW(convolution_forward::primitive_desc(eng,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, chunk_md, wei_md, bia_md,
+                    chunk_md, strides, dilates, bad_padding_l, bad_padding_r,
+                    attr));
+        }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
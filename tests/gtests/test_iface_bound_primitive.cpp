@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class bound_primitive_test_t : public ::testing::Test {};
+
+TEST_F(bound_primitive_test_t, TestEltwise) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim N = 3, C = 17;
+    memory::desc md({N, C}, dt::f32, tag::ab);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward prim(pd);
+
+    memory src(md, eng), dst(md, eng), dst_ref(md, eng);
+    fill_data(dt::f32, src, 0.f, 1.f);
+    prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst_ref}});
+
+    bound_primitive bprim(
+            prim, strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    bprim.execute();
+    strm.wait();
+
+    const auto *d = static_cast<const float *>(dst.get_data_handle());
+    const auto *d_ref = static_cast<const float *>(dst_ref.get_data_handle());
+    for (memory::dim i = 0; i < N * C; i++)
+        ASSERT_EQ(d[i], d_ref[i]);
+
+    // Swap the source buffer without rebinding.
+    std::vector<float> src2(N * C);
+    for (size_t i = 0; i < src2.size(); i++)
+        src2[i] = (i % 2 ? -1.f : 1.f) * static_cast<float>(i);
+    bprim.set_data_handle(DNNL_ARG_SRC, src2.data());
+    bprim.execute();
+    strm.wait();
+    for (memory::dim i = 0; i < N * C; i++)
+        ASSERT_EQ(d[i], src2[i] > 0 ? src2[i] : 0.f);
+
+    EXPECT_ANY_THROW(bprim.set_data_handle(DNNL_ARG_WEIGHTS, src2.data()));
+}
+
+TEST_F(bound_primitive_test_t, TestUserScratchpad) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim M = 8, K = 32, N = 24;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    matmul prim(pd);
+
+    memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng),
+            dst_ref(dst_md, eng), scratchpad(pd.scratchpad_desc(), eng);
+    fill_data(dt::f32, src, 1.f, 1.f);
+    fill_data(dt::f32, wei, 1.f, 1.f);
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst_ref},
+                    {DNNL_ARG_SCRATCHPAD, scratchpad}});
+    bound_primitive bprim(prim, strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_SCRATCHPAD, scratchpad}});
+    for (int i = 0; i < 3; i++)
+        bprim.execute();
+    strm.wait();
+
+    const auto *d = static_cast<const float *>(dst.get_data_handle());
+    const auto *d_ref = static_cast<const float *>(dst_ref.get_data_handle());
+    for (memory::dim i = 0; i < M * N; i++)
+        ASSERT_EQ(d[i], d_ref[i]);
+}
+
+} // namespace dnnl
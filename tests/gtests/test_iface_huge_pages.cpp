@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class huge_pages_test_t : public ::testing::Test {
+protected:
+    void SetUp() override { policy_ = get_cpu_huge_pages(); }
+    void TearDown() override { set_cpu_huge_pages(policy_); }
+
+    // Returns false if the policy is not supported on the system.
+    bool set_policy(cpu_huge_pages policy) {
+        const status st = set_cpu_huge_pages(policy);
+        if (st == status::unimplemented) return false;
+        EXPECT_EQ(st, status::success);
+        EXPECT_EQ(get_cpu_huge_pages(), policy);
+        return true;
+    }
+
+    cpu_huge_pages policy_ = cpu_huge_pages::none;
+};
+
+TEST_F(huge_pages_test_t, TestPolicy) {
+    for (auto policy :
+            {cpu_huge_pages::transparent, cpu_huge_pages::explicit_2m,
+                    cpu_huge_pages::explicit_1g, cpu_huge_pages::none})
+        set_policy(policy);
+
+    ASSERT_EQ(dnnl_set_cpu_huge_pages(static_cast<dnnl_cpu_huge_pages_t>(4)),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_get_cpu_huge_pages_usage(nullptr, nullptr),
+            dnnl_invalid_arguments);
+
+    size_t allocated = 0, huge_backed = 0;
+    get_cpu_huge_pages_usage(allocated, huge_backed);
+    ASSERT_LE(huge_backed, allocated);
+}
+
+// The primitives compute the same results whatever pages back their
+// scratchpads. Explicit huge pages are usually not reserved, so the fallback
+// to regular pages is tested as well.
+TEST_F(huge_pages_test_t, TestScratchpad) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim M = 64, K = 1024, N = 1024;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng);
+    fill_data(dt::f32, src, 1.f, 1.f);
+    fill_data(dt::f32, wei, 1.f, 1.f);
+
+    std::vector<float> ref;
+    for (auto policy : {cpu_huge_pages::none, cpu_huge_pages::transparent,
+                 cpu_huge_pages::explicit_2m, cpu_huge_pages::explicit_1g}) {
+        if (!set_policy(policy)) continue;
+
+        size_t allocated_before = 0, huge_backed = 0;
+        get_cpu_huge_pages_usage(allocated_before, huge_backed);
+
+        // Creates the primitive anew so that its scratchpad is allocated
+        // under the policy.
+        auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        const size_t scratchpad_size = pd.scratchpad_desc().get_size();
+        {
+            matmul prim(pd);
+            prim.execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst}});
+            strm.wait();
+
+            // The scratchpad is tracked under any policy but `none`. Explicit
+            // huge pages back either all of it or nothing.
+            size_t allocated = 0;
+            get_cpu_huge_pages_usage(allocated, huge_backed);
+            ASSERT_LE(huge_backed, allocated);
+            if (policy == cpu_huge_pages::none) {
+                ASSERT_EQ(allocated, allocated_before);
+            } else {
+                ASSERT_GE(allocated, allocated_before + scratchpad_size);
+            }
+            ASSERT_TRUE(policy == cpu_huge_pages::transparent
+                    || huge_backed == 0 || huge_backed >= scratchpad_size);
+        }
+
+        // The tracked scratchpad is released with the primitive.
+        size_t allocated_after = 0;
+        get_cpu_huge_pages_usage(allocated_after, huge_backed);
+        ASSERT_EQ(allocated_after, allocated_before);
+
+        const auto *d = static_cast<const float *>(dst.get_data_handle());
+        if (ref.empty()) ref.assign(d, d + M * N);
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_EQ(d[i], ref[i]);
+    }
+}
+
+} // namespace dnnl
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class prepacked_memory_test_t : public ::testing::Test {
+protected:
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    const std::string path_ = "test_iface_prepacked_memory.bin";
+};
+
+TEST_F(prepacked_memory_test_t, TestMatMulWeights) {
+#ifdef _WIN32
+    SKIP_IF(true, "File mapping is not supported on Windows");
+#endif
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim M = 16, K = 64, N = 48;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_plain_md({K, N}, dt::f32, tag::ab);
+    memory::desc wei_any_md({K, N}, dt::f32, tag::any);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_any_md, dst_md);
+
+    memory src(src_md, eng), wei_plain(wei_plain_md, eng);
+    fill_data(dt::f32, src, 1.f, 1.f);
+    fill_data(dt::f32, wei_plain, 1.f, 1.f);
+
+    // Pack the weights once and store them next to their layout.
+    memory wei_packed(pd.weights_desc(), eng);
+    reorder(wei_plain, wei_packed).execute(strm, wei_plain, wei_packed);
+    strm.wait();
+    wei_packed.export_prepacked(path_);
+
+    memory wei_mapped = memory::from_prepacked_file(eng, path_);
+    ASSERT_EQ(wei_mapped.get_desc(), pd.weights_desc());
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(wei_mapped.get_data_handle()) % 64,
+            0U);
+    ASSERT_EQ(std::memcmp(wei_mapped.get_data_handle(),
+                      wei_packed.get_data_handle(),
+                      pd.weights_desc().get_size()),
+            0);
+
+    memory dst_ref(dst_md, eng), dst(dst_md, eng);
+    matmul prim(pd);
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_packed},
+                    {DNNL_ARG_DST, dst_ref}});
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_mapped},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+    ASSERT_EQ(std::memcmp(dst.get_data_handle(), dst_ref.get_data_handle(),
+                      dst_md.get_size()),
+            0);
+}
+
+// The descriptor is restored with its padding and blocking.
+TEST_F(prepacked_memory_test_t, TestPaddedBlockedDesc) {
+#ifdef _WIN32
+    SKIP_IF(true, "File mapping is not supported on Windows");
+#endif
+    engine eng(engine::kind::cpu, 0);
+
+    memory::desc md({5, 20, 3}, dt::f32, tag::aBc16b);
+    memory mem(md, eng);
+    fill_data(dt::f32, mem, 1.f, 1.f);
+    mem.export_prepacked(path_);
+
+    memory mapped = memory::from_prepacked_file(eng, path_);
+    ASSERT_EQ(mapped.get_desc(), md);
+    ASSERT_EQ(std::memcmp(mapped.get_data_handle(), mem.get_data_handle(),
+                      md.get_size()),
+            0);
+}
+
+// Files of another version of the format are rejected.
+TEST_F(prepacked_memory_test_t, TestFormatVersion) {
+#ifdef _WIN32
+    SKIP_IF(true, "File mapping is not supported on Windows");
+#endif
+    engine eng(engine::kind::cpu, 0);
+
+    memory mem({{16, 16}, dt::f32, tag::ab}, eng);
+    mem.export_prepacked(path_);
+    ASSERT_NO_THROW(memory::from_prepacked_file(eng, path_));
+
+    // The version follows the 8 bytes of the magic.
+    FILE *f = fopen(path_.c_str(), "r+b");
+    ASSERT_NE(f, nullptr);
+    const uint32_t old_version = 1;
+    ASSERT_EQ(fseek(f, 8, SEEK_SET), 0);
+    ASSERT_EQ(fwrite(&old_version, sizeof(old_version), 1, f), 1U);
+    fclose(f);
+    EXPECT_ANY_THROW(memory::from_prepacked_file(eng, path_));
+}
+
+TEST_F(prepacked_memory_test_t, TestBadFile) {
+#ifdef _WIN32
+    SKIP_IF(true, "File mapping is not supported on Windows");
+#endif
+    engine eng(engine::kind::cpu, 0);
+
+    EXPECT_ANY_THROW(memory::from_prepacked_file(eng, path_));
+
+    FILE *f = fopen(path_.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    const char garbage[256] = {0};
+    ASSERT_EQ(fwrite(garbage, sizeof(garbage), 1, f), 1U);
+    fclose(f);
+    EXPECT_ANY_THROW(memory::from_prepacked_file(eng, path_));
+}
+
+} // namespace dnnl
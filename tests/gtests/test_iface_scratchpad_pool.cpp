@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class scratchpad_pool_test_t : public ::testing::Test {
+protected:
+    void SetUp() override { capacity_ = get_scratchpad_pool_capacity(); }
+    void TearDown() override { set_scratchpad_pool_capacity(capacity_); }
+
+    size_t capacity_ = 0;
+};
+
+TEST_F(scratchpad_pool_test_t, TestCapacity) {
+    set_scratchpad_pool_capacity(size_t(1) << 20);
+    ASSERT_EQ(get_scratchpad_pool_capacity(), size_t(1) << 20);
+    set_scratchpad_pool_capacity(0);
+    ASSERT_EQ(get_scratchpad_pool_capacity(), 0u);
+
+    ASSERT_EQ(dnnl_get_scratchpad_pool_capacity(nullptr),
+            dnnl_invalid_arguments);
+}
+
+// The primitives with a library-managed scratchpad compute the same results
+// whether the pool is used, disabled or shrunk between the executions. The
+// primitives are created with the pool enabled by default. The pool is used
+// only by the builds with ONEDNN_ENABLE_CONCURRENT_EXEC=ON.
+TEST_F(scratchpad_pool_test_t, TestReuse) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim M = 16, K = 300, N = 40;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+    memory::desc src_t_md({K, M}, dt::f32, tag::ba);
+    memory::desc wei_t_md({N, K}, dt::f32, tag::ba);
+    memory::desc dst_t_md({N, M}, dt::f32, tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    auto pd_t = matmul::primitive_desc(eng, wei_t_md, src_t_md, dst_t_md);
+    matmul prim(pd), prim_t(pd_t);
+
+    memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng),
+            dst_t(dst_t_md, eng);
+    fill_data(dt::f32, src, 1.f, 1.f);
+    fill_data(dt::f32, wei, 1.f, 1.f);
+    // The second primitive computes the transposed product from the same
+    // buffers.
+    memory src_t(src_t_md, eng, src.get_data_handle());
+    memory wei_t(wei_t_md, eng, wei.get_data_handle());
+
+    std::vector<float> ref;
+    for (size_t capacity : {capacity_, size_t(0), size_t(1) << 12,
+                 size_t(1) << 30, capacity_}) {
+        set_scratchpad_pool_capacity(capacity);
+        for (int i = 0; i < 3; i++) {
+            prim.execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst}});
+            prim_t.execute(strm,
+                    {{DNNL_ARG_SRC, wei_t}, {DNNL_ARG_WEIGHTS, src_t},
+                            {DNNL_ARG_DST, dst_t}});
+            strm.wait();
+
+            const auto *d = static_cast<const float *>(dst.get_data_handle());
+            const auto *d_t
+                    = static_cast<const float *>(dst_t.get_data_handle());
+            if (ref.empty()) ref.assign(d, d + M * N);
+            for (memory::dim m = 0; m < M; m++)
+                for (memory::dim n = 0; n < N; n++) {
+                    ASSERT_EQ(d[m * N + n], ref[m * N + n]);
+                    ASSERT_NEAR(d_t[n * M + m], ref[m * N + n],
+                            1e-4f * (1.f + std::abs(ref[m * N + n])));
+                }
+        }
+    }
+}
+
+} // namespace dnnl
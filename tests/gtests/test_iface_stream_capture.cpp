@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class stream_capture_test_t : public ::testing::Test {};
+
+TEST_F(stream_capture_test_t, TestReplay) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim M = 4, K = 16, N = 8;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    matmul mm(matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+    eltwise_forward relu(eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, dst_md,
+            dst_md, 0.f));
+
+    memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng),
+            out(dst_md, eng), out_ref(dst_md, eng);
+    fill_data(dt::f32, src, 0.f, 1.f);
+    fill_data(dt::f32, wei, 0.f, 1.f);
+
+    mm.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    relu.execute(strm, {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, out_ref}});
+    strm.wait();
+
+    // Nothing is executed while the stream captures.
+    auto *o = static_cast<float *>(out.get_data_handle());
+    for (memory::dim i = 0; i < M * N; i++)
+        o[i] = -1.f;
+    stream_capture::begin(strm);
+    mm.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    relu.execute(strm, {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, out}});
+    EXPECT_ANY_THROW(stream_capture::begin(strm));
+    stream_capture capture = stream_capture::end(strm);
+    ASSERT_EQ(o[0], -1.f);
+
+    const auto *o_ref = static_cast<const float *>(out_ref.get_data_handle());
+    for (int r = 0; r < 2; r++) {
+        capture.replay();
+        strm.wait();
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_EQ(o[i], o_ref[i]);
+    }
+
+    EXPECT_ANY_THROW(stream_capture::end(strm));
+}
+
+} // namespace dnnl
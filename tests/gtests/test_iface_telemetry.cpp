@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class telemetry_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        capacity_ = get_telemetry_capacity();
+        set_telemetry_capacity(0);
+        drain_telemetry(size_t(1) << 16);
+    }
+    void TearDown() override { set_telemetry_capacity(capacity_); }
+
+    size_t capacity_ = 0;
+};
+
+TEST_F(telemetry_test_t, TestCapacity) {
+    set_telemetry_capacity(5);
+    ASSERT_EQ(get_telemetry_capacity(), 8u);
+    set_telemetry_capacity(0);
+    ASSERT_EQ(get_telemetry_capacity(), 0u);
+
+    ASSERT_EQ(dnnl_get_telemetry_capacity(nullptr), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_set_telemetry_capacity(size_t(1) << 40),
+            dnnl_invalid_arguments);
+    size_t count = 0;
+    ASSERT_EQ(dnnl_telemetry_drain(nullptr, 1, &count, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_telemetry_drain(nullptr, 0, &count, nullptr), dnnl_success);
+    ASSERT_EQ(count, 0u);
+    const char *name = nullptr;
+    ASSERT_EQ(dnnl_telemetry_get_impl_name(uint32_t(-1), &name),
+            dnnl_invalid_arguments);
+}
+
+TEST_F(telemetry_test_t, TestRecords) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc md({16, 64}, dt::f32, tag::ab);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward prim(pd);
+    memory src(md, eng), dst(md, eng);
+    fill_data(dt::f32, src, 1.f, 1.f);
+
+    const auto execute = [&](int n) {
+        for (int i = 0; i < n; i++)
+            prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+    };
+
+    // Nothing is recorded while the telemetry is disabled.
+    execute(2);
+    ASSERT_TRUE(drain_telemetry(16).empty());
+
+    set_telemetry_capacity(4);
+    execute(3);
+    size_t dropped = 0;
+    auto records = drain_telemetry(16, &dropped);
+    ASSERT_EQ(records.size(), 3u);
+    ASSERT_EQ(dropped, 0u);
+    for (const auto &r : records) {
+        ASSERT_EQ(r.primitive_id, prim.get_telemetry_id());
+        ASSERT_EQ(r.primitive_kind, dnnl_eltwise);
+        ASSERT_STREQ(get_telemetry_impl_name(r.impl_name_index),
+                pd.impl_info_str());
+        ASSERT_GT(r.nthr, 0);
+        ASSERT_LE(r.start_ns, r.end_ns);
+        ASSERT_EQ(r.bytes, 2 * md.get_size());
+    }
+    ASSERT_LE(records[0].end_ns, records[1].start_ns);
+
+    // A full ring drops the new records and the drain takes them in parts.
+    execute(6);
+    records = drain_telemetry(3, &dropped);
+    ASSERT_EQ(records.size(), 3u);
+    ASSERT_EQ(dropped, 2u);
+    records = drain_telemetry(3, &dropped);
+    ASSERT_EQ(records.size(), 1u);
+    ASSERT_EQ(dropped, 0u);
+
+    // A primitive gets a new identifier.
+    eltwise_forward prim2(pd);
+    ASSERT_NE(prim2.get_telemetry_id(), prim.get_telemetry_id());
+}
+
+} // namespace dnnl
@@ -53,6 +53,10 @@ protected:
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         input_f32.wino_supported = is_gpu;
         input_f16.wino_supported = is_gpu;
+#if DNNL_X64
+        const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
+        if (is_cpu) input_f32.wino_supported = mayiuse(cpu_isa::avx512_core);
+#endif
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
 #if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
         const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct softmax_cross_entropy_test_params_t {
+    prop_kind aprop_kind;
+    memory::format_tag src_format;
+    memory::dims src_dims;
+    float label_smoothing;
+    memory::dim ignore_index;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class softmax_cross_entropy_test_t
+    : public ::testing::TestWithParam<softmax_cross_entropy_test_params_t> {
+private:
+    softmax_cross_entropy_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits_t<data_t>::data_type;
+
+        p = ::testing::TestWithParam<
+                softmax_cross_entropy_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = softmax_cross_entropy::primitive_desc;
+        const bool is_training = p.aprop_kind == prop_kind::forward_training;
+        allows_attr_t aa {};
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim N = p.src_dims[0];
+        const memory::dim C = p.src_dims.size() > 1 ? p.src_dims[1] : 0;
+
+        auto desc_src = memory::desc(p.src_dims, data_dt, p.src_format);
+        auto desc_labels = memory::desc(
+                {N}, memory::data_type::s32, memory::format_tag::x);
+        auto desc_dst = memory::desc({N}, data_dt, memory::format_tag::x);
+        auto desc_diff_src
+                = memory::desc(p.src_dims, data_dt, memory::format_tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctors
+        if (is_training) {
+            pd = pd_t(eng, p.aprop_kind, desc_src, desc_labels, desc_dst,
+                    desc_diff_src, p.label_smoothing, p.ignore_index);
+            test_fwd_pd_constructors<pd_t>(pd, aa, p.aprop_kind, desc_src,
+                    desc_labels, desc_dst, desc_diff_src, p.label_smoothing,
+                    p.ignore_index);
+        } else {
+            pd = pd_t(eng, p.aprop_kind, desc_src, desc_labels, desc_dst,
+                    p.label_smoothing, p.ignore_index);
+            test_fwd_pd_constructors<pd_t>(pd, aa, p.aprop_kind, desc_src,
+                    desc_labels, desc_dst, p.label_smoothing, p.ignore_index);
+        }
+
+        EXPECT_ANY_THROW(softmax_cross_entropy(pd, {}));
+        // default primitive ctor
+        auto prim = softmax_cross_entropy();
+        // regular primitive ctor
+        prim = softmax_cross_entropy(pd);
+
+        const auto src_desc = pd.src_desc();
+        const auto labels_desc = pd.labels_desc();
+        const auto dst_desc = pd.dst_desc();
+        const auto diff_src_desc = pd.diff_src_desc();
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1)
+                == labels_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DIFF_SRC)
+                == diff_src_desc);
+        ASSERT_EQ(pd.get_prop_kind(), p.aprop_kind);
+        if (is_training) {
+            ASSERT_TRUE(diff_src_desc == src_desc);
+        } else {
+            ASSERT_TRUE(diff_src_desc.is_zero());
+        }
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(src_desc, test_engine);
+        auto mem_labels = memory(labels_desc, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_diff_src = memory(diff_src_desc, test_engine);
+
+        fill_data<data_t>(src_desc.get_size() / sizeof(data_t), mem_src,
+                data_t(0), data_t(4));
+        {
+            // Every third sample is ignored unless the ignore index is the
+            // default one.
+            const bool with_ignored = p.ignore_index != -1;
+            auto labels = map_memory<int32_t>(mem_labels);
+            for (memory::dim n = 0; n < N; ++n)
+                labels[n] = (!with_ignored || n % 3 != 1)
+                        ? static_cast<int32_t>((n * 7) % C)
+                        : static_cast<int32_t>(p.ignore_index);
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_SRC_1, mem_labels}, {DNNL_ARG_DST, mem_dst}};
+        if (is_training) args.insert({DNNL_ARG_DIFF_SRC, mem_diff_src});
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto src = map_memory<data_t>(mem_src);
+        auto labels = map_memory<int32_t>(mem_labels);
+        auto dst = map_memory<data_t>(mem_dst);
+        auto diff_src = map_memory<data_t>(mem_diff_src);
+
+        const auto src_strides = src_desc.get_strides();
+        const auto diff_src_strides = diff_src_desc.get_strides();
+        const double eps = p.label_smoothing;
+        const double tol
+                = data_dt == memory::data_type::f32 ? 1e-5 : 1e-2;
+
+        for (memory::dim n = 0; n < N; ++n) {
+            auto x = [&](memory::dim c) {
+                return static_cast<double>(static_cast<float>(
+                        src[n * src_strides[0] + c * src_strides[1]]));
+            };
+            auto dx = [&](memory::dim c) {
+                return static_cast<float>(diff_src[n * diff_src_strides[0]
+                        + c * diff_src_strides[1]]);
+            };
+            const memory::dim label = labels[n];
+            const float loss = static_cast<float>(dst[n]);
+
+            if (label == p.ignore_index) {
+                ASSERT_EQ(loss, 0.f);
+                for (memory::dim c = 0; is_training && c < C; ++c)
+                    ASSERT_EQ(dx(c), 0.f);
+                continue;
+            }
+
+            double m = x(0);
+            for (memory::dim c = 1; c < C; ++c)
+                m = std::max(m, x(c));
+            double s = 0;
+            for (memory::dim c = 0; c < C; ++c)
+                s += std::exp(x(c) - m);
+
+            double ref_loss = 0;
+            for (memory::dim c = 0; c < C; ++c) {
+                const double t = (c == label ? 1. - eps : 0.) + eps / C;
+                ref_loss -= t * (x(c) - m - std::log(s));
+            }
+            ASSERT_NEAR(loss, ref_loss, tol * std::max(1., ref_loss));
+
+            for (memory::dim c = 0; is_training && c < C; ++c) {
+                const double t = (c == label ? 1. - eps : 0.) + eps / C;
+                const double ref_dx = std::exp(x(c) - m) / s - t;
+                ASSERT_NEAR(dx(c), ref_dx, tol);
+            }
+        }
+    }
+};
+
+using tag = memory::format_tag;
+using pk = prop_kind;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported prop_kind
+            softmax_cross_entropy_test_params_t {pk::backward_data, tag::nc,
+                    {2, 4}, 0.f, -1, true, dnnl_invalid_arguments},
+            // label smoothing out of range
+            softmax_cross_entropy_test_params_t {pk::forward_training,
+                    tag::nc, {2, 4}, 1.5f, -1, true, dnnl_invalid_arguments},
+            // bad ndims
+            softmax_cross_entropy_test_params_t {pk::forward_inference,
+                    tag::ncw, {2, 4, 3}, 0.f, -1, true,
+                    dnnl_invalid_arguments},
+            softmax_cross_entropy_test_params_t {pk::forward_inference,
+                    tag::nc, {2, 4}, -0.5f, -1, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(softmax_cross_entropy_test_params_t {
+            pk::forward_training, tag::nc, {0, 4}, 0.f, -1});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_training, tag::nc, {2, 17}, 0.f, -1},
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_inference, tag::nc, {5, 10}, 0.f, -1},
+            // Label smoothing
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_training, tag::nc, {7, 130}, 0.1f, -1},
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_inference, tag::nc, {3, 64}, 1.f, -1},
+            // Ignored samples
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_training, tag::nc, {9, 33}, 0.f, -100},
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_training, tag::nc, {6, 200}, 0.2f, -7},
+            // Long rows of vocabulary logits
+            softmax_cross_entropy_test_params_t {
+                    pk::forward_training, tag::nc, {4, 32000}, 0.1f, -1});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsSoftmaxCrossEntropy) {} \
+    INSTANTIATE_TEST_SUITE_P( \
+            TestSoftmaxCrossEntropyEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestSoftmaxCrossEntropyZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P( \
+            TestSoftmaxCrossEntropySimple, test, simple_cases());
+
+using softmax_cross_entropy_test_f32 = softmax_cross_entropy_test_t<float>;
+using softmax_cross_entropy_test_bf16
+        = softmax_cross_entropy_test_t<bfloat16_t>;
+using softmax_cross_entropy_test_f16 = softmax_cross_entropy_test_t<float16_t>;
+
+INST_TEST_CASE(softmax_cross_entropy_test_f32)
+INST_TEST_CASE(softmax_cross_entropy_test_bf16)
+INST_TEST_CASE(softmax_cross_entropy_test_f16)
+
+} // namespace dnnl
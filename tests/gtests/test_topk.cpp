@@ -0,0 +1,253 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct topk_test_params_t {
+    memory::format_tag src_format;
+    memory::format_tag dst_format;
+    algorithm aalgorithm;
+    memory::dims src_dims;
+    int axis;
+    memory::dim k;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class topk_test_t : public ::testing::TestWithParam<topk_test_params_t> {
+private:
+    topk_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits_t<data_t>::data_type;
+
+        p = ::testing::TestWithParam<topk_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static memory::dim offset(const memory::desc &md, memory::dims pos) {
+        const auto strides = md.get_strides();
+        memory::dim off = 0;
+        for (size_t d = 0; d < pos.size(); ++d)
+            off += pos[d] * strides[d];
+        return off;
+    }
+
+    // Returns the positions of the first element of every row along the axis.
+    std::vector<memory::dims> rows() const {
+        std::vector<memory::dims> res;
+        memory::dims pos(p.src_dims.size(), 0);
+        const auto nelems = std::accumulate(p.src_dims.begin(),
+                p.src_dims.end(), memory::dim(1), std::multiplies<memory::dim>());
+        for (memory::dim i = 0; i < nelems / p.src_dims[p.axis]; ++i) {
+            res.push_back(pos);
+            for (int d = (int)pos.size() - 1; d >= 0; --d) {
+                if (d == p.axis) continue;
+                if (++pos[d] < p.src_dims[d]) break;
+                pos[d] = 0;
+            }
+        }
+        return res;
+    }
+
+    void Test() {
+        using pd_t = topk::primitive_desc;
+        const bool is_sample = p.aalgorithm == algorithm::topk_sample;
+        allows_attr_t aa {};
+        aa.scales = is_sample;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::dims dst_dims = p.src_dims;
+        if (0 <= p.axis && p.axis < (int)dst_dims.size())
+            dst_dims[p.axis] = is_sample ? 1 : p.k;
+
+        auto desc_src = memory::desc(p.src_dims, data_dt, p.src_format);
+        auto desc_dst = memory::desc(dst_dims, data_dt, p.dst_format);
+        auto desc_ind = memory::desc(
+                dst_dims, memory::data_type::s32, p.dst_format);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, desc_ind, p.axis,
+                p.k);
+        // test all pd ctors
+        test_fwd_pd_constructors<pd_t>(pd, aa, p.aalgorithm, desc_src,
+                desc_dst, desc_ind, p.axis, p.k);
+
+        EXPECT_ANY_THROW(topk(pd, {}));
+        // default primitive ctor
+        auto prim = topk();
+        // regular primitive ctor
+        prim = topk(pd);
+
+        const auto src_desc = pd.src_desc();
+        const auto dst_desc = pd.dst_desc();
+        const auto ind_desc = pd.indices_desc();
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_DST_1) == ind_desc);
+
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(src_desc, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_ind = memory(ind_desc, test_engine);
+        auto mem_seed = memory(
+                {{1}, memory::data_type::s32, memory::format_tag::x},
+                test_engine);
+
+        fill_data<data_t>(src_desc.get_size() / sizeof(data_t), mem_src);
+        {
+            auto seed = map_memory<int32_t>(mem_seed);
+            seed[0] = 42;
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_DST, mem_dst}, {DNNL_ARG_DST_1, mem_ind}};
+        if (is_sample) args.insert({DNNL_ARG_SRC_1, mem_seed});
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto src = map_memory<data_t>(mem_src);
+        auto dst = map_memory<data_t>(mem_dst);
+        auto ind = map_memory<int32_t>(mem_ind);
+
+        const memory::dim axis_size = p.src_dims[p.axis];
+        for (const auto &row : rows()) {
+            // Sort the row by decreasing value, then by increasing index.
+            std::vector<memory::dim> order(axis_size);
+            std::iota(order.begin(), order.end(), 0);
+            auto value = [&](memory::dim i) {
+                auto pos = row;
+                pos[p.axis] = i;
+                return static_cast<float>(src[offset(src_desc, pos)]);
+            };
+            std::stable_sort(order.begin(), order.end(),
+                    [&](memory::dim a, memory::dim b) {
+                        return value(a) > value(b);
+                    });
+
+            auto pos = row;
+            if (is_sample) {
+                const auto i = ind[offset(ind_desc, pos)];
+                const auto prob
+                        = static_cast<float>(dst[offset(dst_desc, pos)]);
+                ASSERT_TRUE(std::find(order.begin(), order.begin() + p.k, i)
+                        != order.begin() + p.k);
+                ASSERT_GT(prob, 0.f);
+                ASSERT_LE(prob, 1.f);
+                if (p.k == 1) { ASSERT_EQ(prob, 1.f); }
+                continue;
+            }
+            for (memory::dim j = 0; j < p.k; ++j) {
+                pos[p.axis] = j;
+                ASSERT_EQ(ind[offset(ind_desc, pos)], order[j]);
+                ASSERT_EQ(static_cast<float>(dst[offset(dst_desc, pos)]),
+                        value(order[j]));
+            }
+        }
+    }
+};
+
+using tag = memory::format_tag;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // k larger than the axis
+            topk_test_params_t {tag::nc, tag::nc, algorithm::topk_max, {2, 4},
+                    1, 5, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            topk_test_params_t {tag::nc, tag::nc, algorithm::eltwise_relu,
+                    {2, 4}, 1, 2, true, dnnl_invalid_arguments},
+            // bad axis
+            topk_test_params_t {tag::nc, tag::nc, algorithm::topk_max, {2, 4},
+                    2, 2, true, dnnl_invalid_arguments},
+            // invalid tag
+            topk_test_params_t {tag::any, tag::nc, algorithm::topk_max,
+                    {2, 4}, 1, 2, true, dnnl_invalid_arguments});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(topk_test_params_t {
+            tag::nc, tag::nc, algorithm::topk_max, {0, 4}, 1, 2});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(topk_test_params_t {tag::nc, tag::nc,
+                                     algorithm::topk_max, {2, 17}, 1, 1},
+            topk_test_params_t {
+                    tag::nc, tag::nc, algorithm::topk_max, {3, 100}, 1, 8},
+            topk_test_params_t {
+                    tag::nc, tag::any, algorithm::topk_max, {4, 7}, 0, 3},
+            topk_test_params_t {
+                    tag::nchw, tag::nhwc, algorithm::topk_max, {2, 8, 3, 5},
+                    1, 4},
+            topk_test_params_t {
+                    tag::nhwc, tag::any, algorithm::topk_max, {2, 3, 4, 9},
+                    3, 9},
+            // Large rows split in several chunks
+            topk_test_params_t {
+                    tag::nc, tag::nc, algorithm::topk_max, {1, 50000}, 1, 40},
+            topk_test_params_t {
+                    tag::nc, tag::nc, algorithm::topk_sample, {3, 1000}, 1, 1},
+            topk_test_params_t {tag::nc, tag::nc, algorithm::topk_sample,
+                    {2, 40000}, 1, 50});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsTopk) {} \
+    INSTANTIATE_TEST_SUITE_P(TestTopkEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopkZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopkSimple, test, simple_cases());
+
+using topk_test_f32 = topk_test_t<float>;
+using topk_test_bf16 = topk_test_t<bfloat16_t>;
+using topk_test_f16 = topk_test_t<float16_t>;
+
+INST_TEST_CASE(topk_test_f32)
+INST_TEST_CASE(topk_test_bf16)
+INST_TEST_CASE(topk_test_f16)
+
+} // namespace dnnl